@@ -136,7 +136,7 @@ int NEUIK_Menu_GetSize(
         goto out;
     }
 
-    TTF_SizeText(font, menu->name, &tW, &tH);
+    TTF_SizeUTF8(font, menu->name, &tW, &tH);
     rSize->w = tW + menu->cfg->fontEmWidth;
     rSize->h = menu->cfg->height;
 
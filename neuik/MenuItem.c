@@ -111,7 +111,7 @@ int NEUIK_MenuItem_GetSize(
         goto out;
     }
 
-    TTF_SizeText(font, mItem->name, &tW, &tH);
+    TTF_SizeUTF8(font, mItem->name, &tW, &tH);
     rSize->w = tW + (int)((1.5)*mItem->cfg->fontEmWidth);
     rSize->h = mItem->cfg->height;
 
@@ -562,7 +562,7 @@ int neuik_Element_Render__Canvas(
 
                         }
                     }
-                    TTF_SizeText(font, op->op_drawtext.text, &textW, &textH);
+                    TTF_SizeUTF8(font, op->op_drawtext.text, &textW, &textH);
 
                     tTex = NEUIK_RenderText(
                         op->op_drawtext.text, font, color, rend, &textW, &textH);
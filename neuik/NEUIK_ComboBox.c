@@ -377,12 +377,12 @@ int neuik_Element_GetMinSize__ComboBox(
     if (cb->aEntry != NULL)
     {
         /* this comboBox contains text */
-        TTF_SizeText(font, cb->aEntry, &tW, &tH);
+        TTF_SizeUTF8(font, cb->aEntry, &tW, &tH);
     }
     else
     {
         /* this comboBox does not contain text */
-        TTF_SizeText(font, " ", &tW, &tH);
+        TTF_SizeUTF8(font, " ", &tW, &tH);
     }
 
     rSize->h = (int)(1.5 * (float)TTF_FontHeight(font));
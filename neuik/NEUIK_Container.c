@@ -21,6 +21,7 @@
 #include <signal.h>
 
 #include "NEUIK_Container.h"
+#include "NEUIK_Container_internal.h"
 #include "NEUIK_error.h"
 #include "NEUIK_structs_basic.h"
 #include "NEUIK_Event.h"
@@ -204,6 +205,7 @@ int neuik_Object_New__Container(
     cont->elems        = NULL;
     cont->n_allocated  = 0;
     cont->n_used       = 0;
+    cont->modCount     = 0;
     cont->cType        = NEUIK_CONTAINER_UNSET;
     cont->shownIfEmpty = 0;
     cont->redrawAll    = 0;
@@ -499,12 +501,13 @@ int neuik_Element_ShouldRedrawAll__Container (
 int neuik_Container_RequestFullRedraw(
     NEUIK_Element cont)
 {
-    int               eNum       = 0; /* which error to report (if any) */
-    NEUIK_Container * cBase      = NULL;
-    RenderSize        rSize;
-    RenderLoc         rLoc;
-    static char       funcName[] = "neuik_Container_RequestFullRedraw";
-    static char     * errMsgs[]  = {"", // [ 0] no error
+    int                 eNum       = 0; /* which error to report (if any) */
+    NEUIK_Container   * cBase      = NULL;
+    NEUIK_ElementBase * eBase      = NULL;
+    RenderSize          rSize;
+    RenderLoc           rLoc;
+    static char         funcName[] = "neuik_Container_RequestFullRedraw";
+    static char       * errMsgs[]  = {"", // [ 0] no error
         "Argument `cont` does not implement Container class.",           // [1]
         "Argument `cont` caused `neuik_Object_GetClassObject` to fail.", // [2]
         "Failure in `neuik_Element_GetSizeAndLocation()`.",              // [3]
@@ -523,6 +526,13 @@ int neuik_Container_RequestFullRedraw(
     }
 
     cBase->redrawAll = 1;
+    if (neuik_Object_GetClassObject(cont, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    eBase->eSt.layoutDirty = 1;
+
     /*------------------------------------------------------------------------*/
     /* Make sure the window redraws the background for the entire size of the */
     /* current container.                                                     */
@@ -548,6 +558,75 @@ out:
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_Container_RenderStoredLayout
+ *
+ *  Description:   Render the shown contained elements which need to be redrawn
+ *                 at the sizes and locations stored by the last layout of the
+ *                 container. This is used in place of recomputing the layout
+ *                 when `neuik_Element_IsLayoutValid()` reports it unchanged.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise
+ *
+ ******************************************************************************/
+int neuik_Container_RenderStoredLayout(
+    NEUIK_Element   cont,
+    RenderLoc     * rlMod, /* A relative location modifier (for rendering) */
+    SDL_Renderer  * xRend, /* the external renderer to prepare the texture for */
+    int             mock)  /* If true; calculate sizes/locations but don't draw */
+{
+    int                 ctr        = 0;
+    int                 eNum       = 0; /* which error to report (if any) */
+    RenderSize          rs         = {0, 0};
+    NEUIK_Element       elem       = NULL;
+    NEUIK_Container   * cBase      = NULL;
+    NEUIK_ElementBase * eBase      = NULL;
+    static char         funcName[] = "neuik_Container_RenderStoredLayout";
+    static char       * errMsgs[]  = {"", // [ 0] no error
+        "Argument `cont` caused `neuik_Object_GetClassObject` to fail.", // [1]
+        "Failure in `neuik_Element_Render()`.",                          // [2]
+    };
+
+    if (neuik_Object_GetClassObject(cont, neuik__Class_Container, (void**)&cBase))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (cBase->elems == NULL) goto out;
+
+    for (ctr = 0;; ctr++)
+    {
+        elem = cBase->elems[ctr];
+        if (elem == NULL) break;
+
+        if (!NEUIK_Element_IsShown(elem)) continue;
+        if (!neuik_Element_NeedsRedraw(elem)) continue;
+
+        if (neuik_Object_GetClassObject(elem, neuik__Class_Element, (void**)&eBase))
+        {
+            eNum = 1;
+            goto out;
+        }
+        rs = eBase->eSt.rSize;
+
+        if (neuik_Element_Render(elem, &rs, rlMod, xRend, mock))
+        {
+            eNum = 2;
+            goto out;
+        }
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          NEUIK_Container_SetElement
@@ -621,6 +700,7 @@ int NEUIK_Container_SetElement(
     }
 
     cBase->elems[0] = elem;
+    cBase->modCount++;
 
     /*------------------------------------------------------------------------*/
     /* Set the Window and Parent Element pointers                             */
@@ -635,6 +715,7 @@ int NEUIK_Container_SetElement(
         neuik_Element_SetWindowPointer(elem, eBase->eSt.window);
     }
     neuik_Element_SetParentPointer(elem, cont);
+    neuik_Element_InvalidateLayout(cont);
 out:
     if (eNum > 0)
     {
@@ -659,25 +740,16 @@ int NEUIK_Container_AddElement(
     NEUIK_Element cont, 
     NEUIK_Element elem)
 {
-    int                 len;
-    int                 ctr;
-    int                 newInd;            /* index for newly added item */
     int                 eNum       = 0;    /* which error to report (if any) */
-    NEUIK_ElementBase * eBase      = NULL;
     NEUIK_Container   * cBase      = NULL;
-    RenderSize          rSize;
-    RenderLoc           rLoc;
     static char         funcName[] = "NEUIK_Container_AddElement";
     static char       * errMsgs[]  = {"",                                 // [0] no error
         "Argument `cont` does not implement Container class.",            // [1]
         "Argument `cont` caused `neuik_Object_GetClassObject` to fail.",  // [2]
         "Argument `elem` does not implement Element class.",              // [3]
         "Argument `cont` is not a MultiElement Container.",               // [4]
-        "Failure to allocate memory.",                                    // [5]
-        "Failure to reallocate memory.",                                  // [6]
-        "Argument `cont` does not allow the use of method AddElement().", // [7]
-        "Failure in `neuik_Element_RequestRedraw()`.",                    // [8]
-        "Failure in `neuik_Element_GetSizeAndLocation()`.",               // [9]
+        "Failure in `neuik_Container_InsertElements()`.",                 // [5]
+        "Argument `cont` does not allow the use of method AddElement().", // [6]
     };
 
     if (!neuik_Object_ImplementsClass(cont, neuik__Class_Container))
@@ -712,11 +784,11 @@ int NEUIK_Container_AddElement(
     }
 
     /*------------------------------------------------------------------------*/
-    /* SetElement should only be used on single-element containers            */
+    /* AddElement should only be used on multi-element containers             */
     /*------------------------------------------------------------------------*/
     if (cBase->cType == NEUIK_CONTAINER_NO_DEFAULT_ADD_SET)
     {
-        eNum = 7;
+        eNum = 6;
         goto out;
     }
     else if (cBase->cType != NEUIK_CONTAINER_MULTI)
@@ -725,86 +797,216 @@ int NEUIK_Container_AddElement(
         goto out;
     }
 
+    if (neuik_Container_InsertElements(cont, cBase->n_used, 1, &elem))
+    {
+        eNum = 5;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+out2:
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Container_Reserve
+ *
+ *  Description:   Make sure that a container has room for at least `nElems`
+ *                 child elements, so that adding them does not reallocate.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Container_Reserve(
+    NEUIK_Element cont, 
+    int           nElems)
+{
+    int               eNum       = 0; /* which error to report (if any) */
+    NEUIK_Element   * elems      = NULL;
+    NEUIK_Container * cBase      = NULL;
+    static char       funcName[] = "NEUIK_Container_Reserve";
+    static char     * errMsgs[]  = {"",                                  // [0] no error
+        "Argument `cont` does not implement Container class.",           // [1]
+        "Argument `cont` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Argument `nElems` is negative.",                                // [3]
+        "Failure to reallocate memory.",                                 // [4]
+    };
+
+    if (!neuik_Object_ImplementsClass(cont, neuik__Class_Container))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(cont, neuik__Class_Container, (void**)&cBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (nElems < 0)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    if (cBase->elems != NULL && (unsigned int)(nElems) <= cBase->n_allocated)
+    {
+        /* There is already enough space */
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* The pointer array is NULL terminated; allocate one extra slot.         */
+    /*------------------------------------------------------------------------*/
+    elems = (NEUIK_Element*)realloc(cBase->elems, 
+        (nElems+1)*sizeof(NEUIK_Element));
+    if (elems == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
     if (cBase->elems == NULL)
     {
-        /*--------------------------------------------------------------------*/
-        /* elems array currently unallocated; allocate now                    */
-        /*--------------------------------------------------------------------*/
-        cBase->elems = (NEUIK_Element*)malloc(2*sizeof(NEUIK_Element));
-        if (cBase->elems == NULL)
-        {
-            eNum = 5;
-            goto out;
-        }
-        cBase->n_allocated = 1;
-        cBase->n_used      = 1;
-        newInd             = 0;
+        cBase->n_used = 0;
+        elems[0]      = NULL;
     }
-    else if (cBase->n_allocated < cBase->n_used)
+    cBase->elems       = elems;
+    cBase->n_allocated = nElems;
+out:
+    if (eNum > 0)
     {
-        /*--------------------------------------------------------------------*/
-        /* This is subsequent UI element, but there is space available in the */
-        /* container elements arrary.                                         */
-        /*--------------------------------------------------------------------*/
-        newInd = cBase->n_used;
-        cBase->n_used++;
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
     }
-    else
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Container_InsertElements
+ *
+ *  Description:   Insert `nElems` child elements into a container before the
+ *                 element at `index` (`index` == count appends). Unlike the
+ *                 public function, this does not check the container type.
+ *
+ *                 Storage grows geometrically so that adding N elements (one
+ *                 at a time) takes O(N) time overall.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Container_InsertElements(
+    NEUIK_Element         cont, 
+    int                   index, 
+    int                   nElems, 
+    const NEUIK_Element * elems)
+{
+    int                 ctr;
+    int                 nNeeded    = 0;
+    int                 eNum       = 0; /* which error to report (if any) */
+    NEUIK_ElementBase * eBase      = NULL;
+    NEUIK_Container   * cBase      = NULL;
+    RenderSize          rSize;
+    RenderLoc           rLoc;
+    static char         funcName[] = "neuik_Container_InsertElements";
+    static char       * errMsgs[]  = {"",                                // [0] no error
+        "Argument `cont` caused `neuik_Object_GetClassObject` to fail.", // [1]
+        "Argument `index` is out of range.",                             // [2]
+        "Argument `elems` is NULL.",                                     // [3]
+        "An element of `elems` does not implement Element class.",       // [4]
+        "Failure in `NEUIK_Container_Reserve()`.",                       // [5]
+        "Failure in `neuik_Element_RequestRedraw()`.",                   // [6]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.",              // [7]
+    };
+
+    if (neuik_Object_GetClassObject(cont, neuik__Class_Container, (void**)&cBase))
     {
-        /*--------------------------------------------------------------------*/
-        /* This is subsequent UI element, reallocate memory.                  */
-        /* This pointer array will be null terminated.                        */
-        /*--------------------------------------------------------------------*/
-        
-        /* determine the current length */
-        for (ctr = 0;;ctr++)
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(cont, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (index < 0 || (unsigned int)(index) > cBase->n_used)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (nElems <= 0) goto out;
+    if (elems == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+    for (ctr = 0; ctr < nElems; ctr++)
+    {
+        if (!neuik_Object_ImplementsClass(elems[ctr], neuik__Class_Element))
         {
-            if (cBase->elems[ctr] == NULL)
-            {
-                len = 2 + ctr;
-                break;
-            }
+            eNum = 4;
+            goto out;
         }
+    }
 
-        cBase->elems = (NEUIK_Element*)realloc(cBase->elems, len*sizeof(NEUIK_Element));
-        if (cBase->elems == NULL)
+    /*------------------------------------------------------------------------*/
+    /* Grow the storage (at least doubling it) if there isn't enough room.    */
+    /*------------------------------------------------------------------------*/
+    nNeeded = cBase->n_used + nElems;
+    if (cBase->elems == NULL || (unsigned int)(nNeeded) > cBase->n_allocated)
+    {
+        if ((unsigned int)(nNeeded) < 2*cBase->n_allocated)
+        {
+            nNeeded = 2*cBase->n_allocated;
+        }
+        if (NEUIK_Container_Reserve(cont, nNeeded))
         {
-            eNum = 6;
+            eNum = 5;
             goto out;
         }
-        cBase->n_allocated++;
-        cBase->n_used++;
-        newInd = ctr;
     }
 
+    /*------------------------------------------------------------------------*/
+    /* Shift the following elements (and the NULL terminator) over and store  */
+    /* the new elements.                                                      */
+    /*------------------------------------------------------------------------*/
+    memmove(&(cBase->elems[index + nElems]), &(cBase->elems[index]), 
+        (cBase->n_used - index + 1)*sizeof(NEUIK_Element));
+    memcpy(&(cBase->elems[index]), elems, nElems*sizeof(NEUIK_Element));
+    if ((unsigned int)(index) < cBase->n_used) cBase->modCount++;
+    cBase->n_used += nElems;
+
     /*------------------------------------------------------------------------*/
     /* Set the Window and Parent Element pointers                             */
     /*------------------------------------------------------------------------*/
-    if (neuik_Object_GetClassObject(cont, neuik__Class_Element, (void**)&eBase))
+    for (ctr = 0; ctr < nElems; ctr++)
     {
-        eNum = 2;
-        goto out;
-    }
-    if (eBase->eSt.window != NULL)
-    {
-        neuik_Element_SetWindowPointer(elem, eBase->eSt.window);
+        if (eBase->eSt.window != NULL)
+        {
+            neuik_Element_SetWindowPointer(elems[ctr], eBase->eSt.window);
+        }
+        neuik_Element_SetParentPointer(elems[ctr], cont);
     }
-    neuik_Element_SetParentPointer(elem, cont);
-
-    cBase->elems[newInd]   = elem;
-    cBase->elems[newInd+1] = NULL; /* NULLptr terminated array */
 
     /*------------------------------------------------------------------------*/
-    /* When a new element is added to a container trigger a redraw            */
+    /* When new elements are added to a container trigger a redraw            */
     /*------------------------------------------------------------------------*/
+    neuik_Element_InvalidateLayout(cont);
     if (neuik_Element_GetSizeAndLocation(cont, &rSize, &rLoc))
     {
-        eNum = 9;
+        eNum = 7;
         goto out;
     }
     if (neuik_Element_RequestRedraw(cont, rLoc, rSize))
     {
-        eNum = 8;
+        eNum = 6;
         goto out;
     }
 out:
@@ -813,7 +1015,72 @@ out:
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
         eNum = 1;
     }
-out2:
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Container_InsertElements
+ *
+ *  Description:   Insert `nElems` child elements into a multi-element 
+ *                 container before the element at `index` (an `index` equal
+ *                 to the element count appends the elements).
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Container_InsertElements(
+    NEUIK_Element         cont, 
+    int                   index, 
+    int                   nElems, 
+    const NEUIK_Element * elems)
+{
+    int               eNum       = 0; /* which error to report (if any) */
+    NEUIK_Container * cBase      = NULL;
+    static char       funcName[] = "NEUIK_Container_InsertElements";
+    static char     * errMsgs[]  = {"",                                       // [0] no error
+        "Argument `cont` does not implement Container class.",                // [1]
+        "Argument `cont` caused `neuik_Object_GetClassObject` to fail.",      // [2]
+        "Argument `cont` is not a MultiElement Container.",                   // [3]
+        "Argument `cont` does not allow the use of method InsertElements().", // [4]
+        "Failure in `neuik_Container_InsertElements()`.",                     // [5]
+    };
+
+    if (!neuik_Object_ImplementsClass(cont, neuik__Class_Container))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(cont, neuik__Class_Container, (void**)&cBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (cBase->cType == NEUIK_CONTAINER_NO_DEFAULT_ADD_SET)
+    {
+        eNum = 4;
+        goto out;
+    }
+    else if (cBase->cType != NEUIK_CONTAINER_MULTI)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    if (neuik_Container_InsertElements(cont, index, nElems, elems))
+    {
+        eNum = 5;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
     return eNum;
 }
 
@@ -950,10 +1217,11 @@ int neuik_Element_IsShown__Container(
     NEUIK_Element       elem;
     NEUIK_ElementBase * eBase;
     NEUIK_Container   * cBase = NULL;
-    static int          nRecurse = 0; /* number of times recursively called */
+    int               * nRecurse = NULL; /* (per-thread) recursion depth */
 
-    nRecurse++;
-    if (nRecurse > NEUIK_MAX_RECURSION)
+    nRecurse = &(neuik_GetThreadState()->nRecurse[NEUIK_RECURSE_CONTAINER_ISSHOWN]);
+    (*nRecurse)++;
+    if ((*nRecurse) > NEUIK_MAX_RECURSION)
     {
         /*--------------------------------------------------------------------*/
         /* This is likely a case of appears to be runaway recursion; report   */
@@ -1011,7 +1279,7 @@ int neuik_Element_IsShown__Container(
         isShown = 1;
     }
 out:
-    nRecurse--;
+    (*nRecurse)--;
     return isShown;
 }
 
@@ -1020,10 +1288,7 @@ out:
  *
  *  Name:          NEUIK_Container_GetElementCount
  *
- *  Description:   Add multiple child element to a multi-element container.
- *
- *                 NOTE: the variable # of arguments must be terminated by a 
- *                 NULL pointer.
+ *  Description:   Get the number of child elements within a container.
  *
  *  Returns:       1 if there is an error; 0 otherwise.
  *
@@ -1032,10 +1297,8 @@ int NEUIK_Container_GetElementCount(
     NEUIK_Element   cont,
     int           * elemCount) 
 {
-    int                  ctr;
     int                  count  = 0;
     int                  eNum   = 0; /* which error to report (if any) */
-    NEUIK_Element        elem; 
     NEUIK_Container   * cBase = NULL;
     static char          funcName[] = "NEUIK_Container_GetElementCount";
     static char        * errMsgs[] = {"",                                // [0] no error
@@ -1050,13 +1313,7 @@ int NEUIK_Container_GetElementCount(
 
     if (cBase->elems != NULL)
     {
-        for (ctr = 0;; ctr++)
-        {
-            elem = cBase->elems[ctr];
-            if (elem == NULL) break;
-
-            count += 1;
-        }
+        count = cBase->n_used;
     }
 out:
     if (eNum > 0)
@@ -1146,9 +1403,7 @@ int NEUIK_Container_GetLastElement(
     NEUIK_Element   cont,
     NEUIK_Element * elem) 
 {
-    int               ctr;
     int               eNum   = 0; /* which error to report (if any) */
-    NEUIK_Element     nextElem; 
     NEUIK_Container * cBase = NULL;
     static char       funcName[] = "NEUIK_Container_GetLastElement";
     static char     * errMsgs[] = {"", // [0] no error
@@ -1169,15 +1424,9 @@ int NEUIK_Container_GetLastElement(
 
     *elem = NULL;
 
-    if (cBase->elems != NULL)
+    if (cBase->elems != NULL && cBase->n_used > 0)
     {
-        for (ctr = 0;; ctr++)
-        {
-            nextElem = cBase->elems[ctr];
-            if (nextElem == NULL) break;
-
-            *elem = nextElem;
-        }
+        *elem = cBase->elems[cBase->n_used - 1];
     }
 out:
     if (eNum > 0)
@@ -1206,9 +1455,7 @@ int NEUIK_Container_GetNthElement(
     int             n,
     NEUIK_Element * elem) 
 {
-    int               ctr;
     int               eNum   = 0; /* which error to report (if any) */
-    NEUIK_Element     nextElem; 
     NEUIK_Container * cBase = NULL;
     static char       funcName[] = "NEUIK_Container_GetNthElement";
     static char     * errMsgs[] = {"", // [0] no error
@@ -1229,18 +1476,9 @@ int NEUIK_Container_GetNthElement(
 
     *elem = NULL;
 
-    if (cBase->elems != NULL)
+    if (cBase->elems != NULL && n >= 0 && (unsigned int)(n) < cBase->n_used)
     {
-        for (ctr = 0;; ctr++)
-        {
-            nextElem = cBase->elems[ctr];
-            if (nextElem == NULL) break;
-            if (ctr == n)
-            {
-                *elem = nextElem;
-                break;
-            }
-        }
+        *elem = cBase->elems[n];
     }
 out:
     if (eNum > 0)
@@ -1268,7 +1506,6 @@ int NEUIK_Container_RemoveElement(
     NEUIK_Element elem)
 {
     int                 ctr;
-    int                 wasLocated = 0;
     int                 eNum       = 0;    /* which error to report (if any) */
     NEUIK_Container   * cBase      = NULL;
     RenderSize          rSize;
@@ -1325,44 +1562,31 @@ int NEUIK_Container_RemoveElement(
     /* Search through the elements in the container and look for the element  */
     /* to be removed.                                                         */
     /*------------------------------------------------------------------------*/
-    for (ctr = 0;;ctr++)
+    for (ctr = 0; (unsigned int)(ctr) < cBase->n_used; ctr++)
     {
-        if (cBase->elems[ctr] == NULL)
-        {
-            if (!wasLocated)
-            {
-                /*------------------------------------------------------------*/
-                /* The container did not contain the desired element          */
-                /*------------------------------------------------------------*/
-                eNum = 5;
-                goto out;
-            }
-
-            cBase->elems[ctr-1] = NULL;
-            break;
-        }
-
-        if (wasLocated)
-        {
-            /*----------------------------------------------------------------*/
-            /* Shuffle over the next value.                                   */
-            /*----------------------------------------------------------------*/
-            cBase->elems[ctr-1] = cBase->elems[ctr];
-        }
-        else if (cBase->elems[ctr] == elem)
-        {
-            /*----------------------------------------------------------------*/
-            /* The element to be removed has been located.                    */
-            /*----------------------------------------------------------------*/
-            wasLocated = 1;
-        }
+        if (cBase->elems[ctr] == elem) break;
+    }
+    if ((unsigned int)(ctr) == cBase->n_used)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The container did not contain the desired element                  */
+        /*--------------------------------------------------------------------*/
+        eNum = 5;
+        goto out;
     }
 
+    /*------------------------------------------------------------------------*/
+    /* Shift the following elements (and the NULL terminator) over.           */
+    /*------------------------------------------------------------------------*/
+    memmove(&(cBase->elems[ctr]), &(cBase->elems[ctr+1]), 
+        (cBase->n_used - ctr)*sizeof(NEUIK_Element));
     cBase->n_used--;
+    cBase->modCount++;
 
     /*------------------------------------------------------------------------*/
     /* When an element is removed from a container; trigger a redraw          */
     /*------------------------------------------------------------------------*/
+    neuik_Element_InvalidateLayout(cont);
     if (neuik_Element_GetSizeAndLocation(cont, &rSize, &rLoc))
     {
         eNum = 7;
@@ -1384,6 +1608,177 @@ out2:
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Container_RemoveRange
+ *
+ *  Description:   Remove `nElems` elements (starting with the element at 
+ *                 `index`) from a container. NOTE; This does not free memory
+ *                 associated with the elements.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Container_RemoveRange(
+    NEUIK_Element cont, 
+    int           index, 
+    int           nElems)
+{
+    int               eNum       = 0; /* which error to report (if any) */
+    NEUIK_Container * cBase      = NULL;
+    RenderSize        rSize;
+    RenderLoc         rLoc;
+    static char       funcName[] = "NEUIK_Container_RemoveRange";
+    static char     * errMsgs[]  = {"",                                  // [0] no error
+        "Argument `cont` does not implement Container class.",           // [1]
+        "Argument `cont` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "The range of elements to remove is out of bounds.",             // [3]
+        "Failure in `neuik_Element_RequestRedraw()`.",                   // [4]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.",              // [5]
+    };
+
+    if (!neuik_Object_ImplementsClass(cont, neuik__Class_Container))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(cont, neuik__Class_Container, (void**)&cBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (index < 0 || nElems < 0 || 
+        (unsigned int)(index + nElems) > cBase->n_used)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (nElems == 0) goto out;
+
+    /*------------------------------------------------------------------------*/
+    /* Shift the following elements (and the NULL terminator) over.           */
+    /*------------------------------------------------------------------------*/
+    memmove(&(cBase->elems[index]), &(cBase->elems[index + nElems]), 
+        (cBase->n_used - (index + nElems) + 1)*sizeof(NEUIK_Element));
+    cBase->n_used -= nElems;
+    cBase->modCount++;
+
+    /*------------------------------------------------------------------------*/
+    /* When elements are removed from a container; trigger a redraw           */
+    /*------------------------------------------------------------------------*/
+    neuik_Element_InvalidateLayout(cont);
+    if (neuik_Element_GetSizeAndLocation(cont, &rSize, &rLoc))
+    {
+        eNum = 5;
+        goto out;
+    }
+    if (neuik_Element_RequestRedraw(cont, rLoc, rSize))
+    {
+        eNum = 4;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Container_MoveElement
+ *
+ *  Description:   Move the element at index `from` so that it ends up at index
+ *                 `to`; the elements in between shift over by one.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Container_MoveElement(
+    NEUIK_Element cont, 
+    int           from, 
+    int           to)
+{
+    int               eNum       = 0; /* which error to report (if any) */
+    NEUIK_Element     elem       = NULL;
+    NEUIK_Container * cBase      = NULL;
+    RenderSize        rSize;
+    RenderLoc         rLoc;
+    static char       funcName[] = "NEUIK_Container_MoveElement";
+    static char     * errMsgs[]  = {"",                                  // [0] no error
+        "Argument `cont` does not implement Container class.",           // [1]
+        "Argument `cont` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Argument `from` is out of range.",                              // [3]
+        "Argument `to` is out of range.",                                // [4]
+        "Failure in `neuik_Element_RequestRedraw()`.",                   // [5]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.",              // [6]
+    };
+
+    if (!neuik_Object_ImplementsClass(cont, neuik__Class_Container))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(cont, neuik__Class_Container, (void**)&cBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (from < 0 || (unsigned int)(from) >= cBase->n_used)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (to < 0 || (unsigned int)(to) >= cBase->n_used)
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (from == to) goto out;
+
+    elem = cBase->elems[from];
+    if (from < to)
+    {
+        memmove(&(cBase->elems[from]), &(cBase->elems[from+1]), 
+            (to - from)*sizeof(NEUIK_Element));
+    }
+    else
+    {
+        memmove(&(cBase->elems[to+1]), &(cBase->elems[to]), 
+            (from - to)*sizeof(NEUIK_Element));
+    }
+    cBase->elems[to] = elem;
+    cBase->modCount++;
+
+    /*------------------------------------------------------------------------*/
+    /* The order of the elements changed; trigger a redraw                    */
+    /*------------------------------------------------------------------------*/
+    neuik_Element_InvalidateLayout(cont);
+    if (neuik_Element_GetSizeAndLocation(cont, &rSize, &rLoc))
+    {
+        eNum = 6;
+        goto out;
+    }
+    if (neuik_Element_RequestRedraw(cont, rLoc, rSize))
+    {
+        eNum = 5;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          NEUIK_Container_DeleteElements
@@ -1455,10 +1850,12 @@ int NEUIK_Container_DeleteElements(
             cBase->elems[ctr] = NULL;
         }
     }
+    cBase->modCount++;
 
     /*------------------------------------------------------------------------*/
     /* When an element is removed from a container; trigger a redraw          */
     /*------------------------------------------------------------------------*/
+    neuik_Element_InvalidateLayout(cont);
     if (neuik_Element_GetSizeAndLocation(cont, &rSize, &rLoc))
     {
         eNum = 7;
@@ -1714,6 +2111,7 @@ int NEUIK_Container_Configure(
 
     if (doRedraw)
     {
+        neuik_Element_InvalidateLayout(cont);
         if (neuik_Element_GetSizeAndLocation(cont, &rSize, &rLoc))
         {
             NEUIK_RaiseError(funcName, errMsgs[13]);
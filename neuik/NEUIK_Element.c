@@ -30,6 +30,7 @@
 #include "NEUIK_Element.h"
 #include "NEUIK_Element_internal.h"
 #include "NEUIK_Container.h"
+#include "NEUIK_FontSet.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
 
@@ -108,6 +109,11 @@ NEUIK_ElementState neuik_default_ElementState = {
     {NEUIK_INVALID_SIZE, NEUIK_INVALID_SIZE}, /* Minimum size of the element (previous frame) */
     NEUIK_MINSIZE_NOCHANGE,                   /* How min elem width changed */
     NEUIK_MINSIZE_NOCHANGE,                   /* How min elem height changed */
+    1,                                        /* Child layout must be computed */
+    {NEUIK_INVALID_SIZE, NEUIK_INVALID_SIZE}, /* size of the computed child layout */
+    {0, 0},                                   /* loc of the computed child layout */
+    0,                                        /* No min size measured ahead */
+    {NEUIK_INVALID_SIZE, NEUIK_INVALID_SIZE}, /* min size measured ahead */
 };
 
 
@@ -744,17 +750,21 @@ int NEUIK_Element_Configure(
 
     if (doRedraw)
     {
-        if (fullRedraw)
+        /*--------------------------------------------------------------------*/
+        /* Any of these settings can change the placement of this element     */
+        /* within its parent, so the parent layout has to be recomputed.      */
+        /*--------------------------------------------------------------------*/
+        if (eBase->eSt.parent != NULL)
         {
-            if (eBase->eSt.parent != NULL)
+            if (neuik_Element_PropagateIndeterminateMinSizeDelta(
+                eBase->eSt.parent))
             {
-                if (neuik_Element_PropagateIndeterminateMinSizeDelta(
-                    eBase->eSt.parent))
-                {
-                    NEUIK_RaiseError(funcName, errMsgs[14]);
-                }
+                NEUIK_RaiseError(funcName, errMsgs[14]);
             }
+        }
 
+        if (fullRedraw)
+        {
             if (neuik_Window_RequestFullRedraw((NEUIK_Window*)eBase->eSt.window))
             {
                 NEUIK_RaiseError(funcName, errMsgs[13]);
@@ -781,13 +791,32 @@ void neuik_SetDefaultElementConfig(NEUIK_ElementConfig eCfg)
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* Measure the minimum size of an element; a size which was measured ahead of */
+/* time by neuik_Element_GetMinSizeParallel is used (once) in its place.      */
+/*----------------------------------------------------------------------------*/
+static int neuik_Element_MeasureMinSize(
+    NEUIK_Element       elem,
+    NEUIK_ElementBase * eBase,
+    RenderSize        * rSize)
+{
+    if (eBase->eSt.minSizePending)
+    {
+        eBase->eSt.minSizePending = 0;
+        *rSize = eBase->eSt.minSizeNext;
+        return 0;
+    }
+    return (eBase->eFT->GetMinSize)(elem, rSize);
+}
+
+
 int neuik_Element_GetMinSize(
     NEUIK_Element   elem,
     RenderSize    * rSize)
 {
     int                  eNum       = 0;
     NEUIK_ElementBase  * eBase      = NULL;
-    static int           nRecurse   = 0; /* number of times recursively called */
+    int                * nRecurse   = NULL; /* (per-thread) recursion depth */
     static char          funcName[] = "neuik_Element_GetMinSize";
     static char        * errMsgs[]  = {"",                               // [0] no error
         "Argument `elem` caused `neuik_Object_GetClassObject` to fail.", // [1]
@@ -796,8 +825,9 @@ int neuik_Element_GetMinSize(
         "Failure in `neuik_Element_StoreFrameMinSize()`",                // [4]
     };
 
-    nRecurse++;
-    if (nRecurse > NEUIK_MAX_RECURSION)
+    nRecurse = &(neuik_GetThreadState()->nRecurse[NEUIK_RECURSE_ELEMENT_GETMINSIZE]);
+    (*nRecurse)++;
+    if ((*nRecurse) > NEUIK_MAX_RECURSION)
     {
         /*--------------------------------------------------------------------*/
         /* This is likely a case of appears to be runaway recursion; report   */
@@ -826,7 +856,7 @@ int neuik_Element_GetMinSize(
         /* These values should only be invalid if this is the first frame to  */
         /* be drawn. The minSize will need to be calculated.                  */
         /*--------------------------------------------------------------------*/
-        if ((eBase->eFT->GetMinSize)(elem, rSize))
+        if (neuik_Element_MeasureMinSize(elem, eBase, rSize))
         {
             if (neuik_HasFatalError())
             {
@@ -857,7 +887,7 @@ int neuik_Element_GetMinSize(
         /* There is a change to the minimum size of this element. The minSize */
         /* will need to be recalculated.                                      */
         /*--------------------------------------------------------------------*/
-        if ((eBase->eFT->GetMinSize)(elem, rSize))
+        if (neuik_Element_MeasureMinSize(elem, eBase, rSize))
         {
             if (neuik_HasFatalError())
             {
@@ -881,7 +911,532 @@ out:
         eNum = 1;
     }
 out2:
-    nRecurse--;
+    (*nRecurse)--;
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Parallel min-size pass                                                     */
+/*                                                                            */
+/* Sibling subtrees whose minimum sizes must be recalculated are measured on  */
+/* several threads; the serial GetMinSize pass which follows then uses those  */
+/* results in place of measuring the subtrees itself.                         */
+/*----------------------------------------------------------------------------*/
+#define NEUIK_MINSIZE_PARALLEL_MIN     256 /* fewer stale elems: go serial */
+#define NEUIK_MINSIZE_TASKS_PER_THREAD   8 /* for load balancing */
+#define NEUIK_MINSIZE_MAX_THREADS       64
+#define NEUIK_MINSIZE_MAX_SPLITS         8 /* tree levels searched */
+
+typedef struct {
+    NEUIK_Element * tasks;  /* roots of the subtrees to measure */
+    int             nTasks;
+    int             nAlloc;
+    SDL_atomic_t    next;   /* index of the next task to be claimed */
+} neuik_MinSizePass;
+
+/*----------------------------------------------------------------------------*/
+/* The min-size worker threads (and their private fonts) are kept between     */
+/* passes; they wait for the next pass until NEUIK_Quit.                      */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    SDL_mutex         * lock;
+    SDL_cond          * wake;      /* signalled when a pass starts (or quit) */
+    SDL_cond          * done;      /* signalled when the last worker is done */
+    SDL_Thread        * threads[NEUIK_MINSIZE_MAX_THREADS];
+    int                 nThreads;
+    int                 nBusy;     /* workers which haven't finished the pass */
+    unsigned int        passNo;    /* incremented as each pass is started */
+    unsigned int        startNo;   /* passNo when the last threads started */
+    int                 quit;
+    neuik_MinSizePass * pass;      /* the current pass */
+} neuik_MinSizeWorkers;
+
+static neuik_MinSizeWorkers neuik__MinSizeWorkers = {NULL, NULL, NULL, 
+    {NULL}, 0, 0, 0, 0, 0, NULL};
+
+
+/*----------------------------------------------------------------------------*/
+/* Check whether GetMinSize would (re)calculate the minimum size of an elem.  */
+/*----------------------------------------------------------------------------*/
+static int neuik_Element_MinSizeIsStale(
+    NEUIK_ElementBase * eBase)
+{
+    if (eBase->eSt.minSize.w == NEUIK_INVALID_SIZE &&
+        eBase->eSt.minSize.h == NEUIK_INVALID_SIZE)
+    {
+        return 1;
+    }
+    return (eBase->eSt.wDelta != NEUIK_MINSIZE_NOCHANGE ||
+            eBase->eSt.hDelta != NEUIK_MINSIZE_NOCHANGE);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_MinSizePass_GetChild                                 */
+/*                                                                            */
+/*  Description:   Get the `n`th child of an element which may be split into  */
+/*                 independently measured subtrees; i.e., a container whose   */
+/*                 own GetMinSize measures (at least) each of its shown       */
+/*                 children. Only stale, shown children are returned.         */
+/*                                                                            */
+/*  Returns:       -1 if there are no more children (or the element may not   */
+/*                 be split); 0 if the child is skipped; 1 if it is returned. */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_MinSizePass_GetChild(
+    NEUIK_Element   elem,
+    unsigned int    n,
+    NEUIK_Element * child)
+{
+    int                 isGrid = 0;
+    unsigned int        nElems = 0;
+    NEUIK_Container   * cBase  = NULL;
+    NEUIK_ElementBase * cEBase = NULL;
+
+    if (!(neuik_Object_IsClass_NoErr(elem, neuik__Class_HGroup)     ||
+          neuik_Object_IsClass_NoErr(elem, neuik__Class_VGroup)     ||
+          neuik_Object_IsClass_NoErr(elem, neuik__Class_GridLayout) ||
+          neuik_Object_IsClass_NoErr(elem, neuik__Class_CelGroup)   ||
+          neuik_Object_IsClass_NoErr(elem, neuik__Class_Stack)      ||
+          neuik_Object_IsClass_NoErr(elem, neuik__Class_Frame)      ||
+          neuik_Object_IsClass_NoErr(elem, neuik__Class_Transformer)))
+    {
+        return -1;
+    }
+    if (neuik_Object_GetClassObject_NoError(
+        elem, neuik__Class_Container, (void**)&cBase)) return -1;
+    if (cBase->elems == NULL) return -1;
+
+    /*------------------------------------------------------------------------*/
+    /* The elems of a GridLayout may contain NULLs; other containers end in a */
+    /* NULL.                                                                  */
+    /*------------------------------------------------------------------------*/
+    isGrid = neuik_Object_IsClass_NoErr(elem, neuik__Class_GridLayout);
+    nElems = (isGrid) ? cBase->n_allocated : cBase->n_used;
+    if (n >= nElems) return -1;
+
+    *child = cBase->elems[n];
+    if (*child == NULL) return (isGrid) ? 0 : -1;
+    if (neuik_Object_GetClassObject_NoError(
+        *child, neuik__Class_Element, (void**)&cEBase)) return 0;
+    if (cEBase->eFT == NULL || !neuik_Element_MinSizeIsStale(cEBase)) return 0;
+    if (!NEUIK_Element_IsShown(*child)) return 0;
+
+    return 1;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Count the stale elements which the serial GetMinSize pass would measure    */
+/* in subtrees that may be split (counting stops at `limit`).                 */
+/*----------------------------------------------------------------------------*/
+static int neuik_MinSizePass_CountStale(
+    NEUIK_Element elem,
+    int           limit)
+{
+    int           count = 1;
+    int           rv    = 0;
+    unsigned int  ctr;
+    NEUIK_Element child = NULL;
+
+    for (ctr = 0; count < limit; ctr++)
+    {
+        rv = neuik_MinSizePass_GetChild(elem, ctr, &child);
+        if (rv < 0) break;
+        if (rv == 0) continue;
+
+        count += neuik_MinSizePass_CountStale(child, limit - count);
+    }
+    return count;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Add a subtree to the tasks of a min-size pass.                             */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_MinSizePass_AddTask(
+    neuik_MinSizePass * pass,
+    NEUIK_Element       elem)
+{
+    int             nAlloc;
+    NEUIK_Element * tasks = NULL;
+
+    if (pass->nTasks == pass->nAlloc)
+    {
+        nAlloc = (pass->nAlloc == 0) ? 64 : 2*pass->nAlloc;
+        tasks  = (NEUIK_Element *)realloc(
+            pass->tasks, nAlloc*sizeof(NEUIK_Element));
+        if (tasks == NULL) return 1;
+        pass->tasks  = tasks;
+        pass->nAlloc = nAlloc;
+    }
+    pass->tasks[pass->nTasks++] = elem;
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_MinSizePass_Collect                                  */
+/*                                                                            */
+/*  Description:   Split the stale part of an element tree into (at least     */
+/*                 `target`, where possible) independent sibling subtrees.    */
+/*                 Splittable elements are replaced by their stale children,  */
+/*                 one tree level at a time; the elements which were split    */
+/*                 are left to be measured by the serial pass.                */
+/*                                                                            */
+/*  Returns:       1 if there is an error; 0 otherwise.                       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_MinSizePass_Collect(
+    neuik_MinSizePass * pass,
+    NEUIK_Element       elem,
+    int                 target)
+{
+    int               eNum  = 0;
+    int               depth = 0;
+    int               split = 0;
+    int               rv    = 0;
+    int               tCtr;
+    unsigned int      ctr;
+    NEUIK_Element     child = NULL;
+    neuik_MinSizePass level = {NULL, 0, 0, {0}};
+
+    if (neuik_MinSizePass_AddTask(pass, elem))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    for (depth = 0; depth < NEUIK_MINSIZE_MAX_SPLITS; depth++)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Split the current level of subtrees into the next (`pass` holds    */
+        /* the current level).                                                */
+        /*--------------------------------------------------------------------*/
+        level        = *pass;
+        pass->tasks  = NULL;
+        pass->nTasks = 0;
+        pass->nAlloc = 0;
+        split        = 0;
+
+        for (tCtr = 0; tCtr < level.nTasks; tCtr++)
+        {
+            if (neuik_MinSizePass_GetChild(level.tasks[tCtr], 0, &child) < 0)
+            {
+                /* this subtree may not be split; it remains a task */
+                if (depth > 0 &&
+                    neuik_MinSizePass_AddTask(pass, level.tasks[tCtr]))
+                {
+                    eNum = 1;
+                    goto out;
+                }
+                continue;
+            }
+
+            split = 1;
+            for (ctr = 0;; ctr++)
+            {
+                rv = neuik_MinSizePass_GetChild(level.tasks[tCtr], ctr, &child);
+                if (rv < 0) break;
+                if (rv == 0) continue;
+
+                if (neuik_MinSizePass_AddTask(pass, child))
+                {
+                    eNum = 1;
+                    goto out;
+                }
+            }
+        }
+        free(level.tasks);
+        level.tasks = NULL;
+
+        if (!split || pass->nTasks >= target) break;
+    }
+out:
+    if (level.tasks != NULL) free(level.tasks);
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Measure the subtrees of a min-size pass until none are left unclaimed.     */
+/*----------------------------------------------------------------------------*/
+static void neuik_MinSizePass_Work(
+    neuik_MinSizePass * pass)
+{
+    int                 tCtr;
+    RenderSize          rs;
+    NEUIK_ElementBase * eBase = NULL;
+
+    for (;;)
+    {
+        tCtr = SDL_AtomicAdd(&(pass->next), 1);
+        if (tCtr >= pass->nTasks) break;
+        if (neuik_HasFatalError()) continue;
+
+        if (neuik_Object_GetClassObject_NoError(
+            pass->tasks[tCtr], neuik__Class_Element, (void**)&eBase)) continue;
+
+        /*--------------------------------------------------------------------*/
+        /* On failure, the subtree is measured (and the failure is reported)  */
+        /* by the serial pass.                                                */
+        /*--------------------------------------------------------------------*/
+        if ((eBase->eFT->GetMinSize)(pass->tasks[tCtr], &rs)) continue;
+
+        eBase->eSt.minSizeNext    = rs;
+        eBase->eSt.minSizePending = 1;
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Entry point of a min-size worker thread; it works on each pass which is    */
+/* started until the workers are told to quit.                                */
+/*----------------------------------------------------------------------------*/
+static int neuik_MinSizePass_Thread(
+    void * data)
+{
+    int                    fontsOK = 0;
+    unsigned int           passNo  = 0;
+    neuik_MinSizePass    * pass    = NULL;
+    neuik_MinSizeWorkers * wkrs    = (neuik_MinSizeWorkers *)data;
+
+    /*------------------------------------------------------------------------*/
+    /* TTF_Fonts may not be shared between threads; the private fonts opened  */
+    /* by this thread are reused by every pass. Should they be unavailable,   */
+    /* the thread only takes part in passes without claiming any subtrees.    */
+    /*------------------------------------------------------------------------*/
+    fontsOK = !neuik_FontSet_BeginThreadFonts();
+
+    /*------------------------------------------------------------------------*/
+    /* The pass for which this thread was started may already be underway.    */
+    /*------------------------------------------------------------------------*/
+    SDL_LockMutex(wkrs->lock);
+    passNo = wkrs->startNo;
+    for (;;)
+    {
+        while (!wkrs->quit && wkrs->passNo == passNo)
+        {
+            SDL_CondWait(wkrs->wake, wkrs->lock);
+        }
+        if (wkrs->quit) break;
+
+        passNo = wkrs->passNo;
+        pass   = wkrs->pass;
+        SDL_UnlockMutex(wkrs->lock);
+
+        if (fontsOK) neuik_MinSizePass_Work(pass);
+
+        SDL_LockMutex(wkrs->lock);
+        wkrs->nBusy--;
+        if (wkrs->nBusy == 0) SDL_CondSignal(wkrs->done);
+    }
+    SDL_UnlockMutex(wkrs->lock);
+
+    if (fontsOK) neuik_FontSet_EndThreadFonts();
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Start min-size worker threads until there are `nThreads` of them (fewer    */
+/* if a thread fails to start).                                               */
+/*                                                                            */
+/* Returns: the number of worker threads.                                     */
+/*----------------------------------------------------------------------------*/
+static int neuik_MinSizeWorkers_Start(
+    int nThreads)
+{
+    SDL_Thread           * thread = NULL;
+    neuik_MinSizeWorkers * wkrs   = &neuik__MinSizeWorkers;
+
+    if (wkrs->lock == NULL)
+    {
+        wkrs->lock = SDL_CreateMutex();
+        wkrs->wake = SDL_CreateCond();
+        wkrs->done = SDL_CreateCond();
+        if (wkrs->lock == NULL || wkrs->wake == NULL || wkrs->done == NULL)
+        {
+            neuik_Element_QuitMinSizeWorkers();
+            return 0;
+        }
+    }
+
+    wkrs->startNo = wkrs->passNo;
+    while (wkrs->nThreads < nThreads)
+    {
+        thread = SDL_CreateThread(
+            neuik_MinSizePass_Thread, "neuik_MinSize", wkrs);
+        if (thread == NULL) break;
+
+        wkrs->threads[wkrs->nThreads++] = thread;
+    }
+    return wkrs->nThreads;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_QuitMinSizeWorkers
+ *
+ *  Description:   Stop the min-size worker threads (which close their private
+ *                 fonts). This must be called before TTF_Quit.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_Element_QuitMinSizeWorkers()
+{
+    int                    ctr;
+    neuik_MinSizeWorkers * wkrs = &neuik__MinSizeWorkers;
+
+    if (wkrs->nThreads > 0)
+    {
+        SDL_LockMutex(wkrs->lock);
+        wkrs->quit = 1;
+        SDL_CondBroadcast(wkrs->wake);
+        SDL_UnlockMutex(wkrs->lock);
+
+        for (ctr = 0; ctr < wkrs->nThreads; ctr++)
+        {
+            SDL_WaitThread(wkrs->threads[ctr], NULL);
+            wkrs->threads[ctr] = NULL;
+        }
+    }
+    if (wkrs->lock != NULL) SDL_DestroyMutex(wkrs->lock);
+    if (wkrs->wake != NULL) SDL_DestroyCond(wkrs->wake);
+    if (wkrs->done != NULL) SDL_DestroyCond(wkrs->done);
+
+    wkrs->lock     = NULL;
+    wkrs->wake     = NULL;
+    wkrs->done     = NULL;
+    wkrs->nThreads = 0;
+    wkrs->nBusy    = 0;
+    wkrs->quit     = 0;
+    wkrs->pass     = NULL;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_GetMinSizeParallel
+ *
+ *  Description:   Get the minimum size of an element (tree), as is done by
+ *                 neuik_Element_GetMinSize. When many elements are stale, the
+ *                 independent sibling subtrees are first measured in parallel;
+ *                 the threads claim subtrees until none are left. The results
+ *                 (and stored element state) match those of the serial pass.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Element_GetMinSizeParallel(
+    NEUIK_Element   elem,
+    RenderSize    * rSize)
+{
+    int                 eNum       = 0; /* which error to report (if any) */
+    int                 ctr        = 0;
+    int                    nThreads   = 0;
+    int                    nWorkers   = 0;
+    NEUIK_ElementBase    * eBase      = NULL;
+    neuik_MinSizePass      pass       = {NULL, 0, 0, {0}};
+    neuik_MinSizeWorkers * wkrs       = &neuik__MinSizeWorkers;
+    static char         funcName[] = "neuik_Element_GetMinSizeParallel";
+    static char       * errMsgs[]  = {"", // [0] no error
+        "Argument `elem` caused `neuik_Object_GetClassObject` to fail.", // [1]
+        "Failure to allocate memory.",                                   // [2]
+        "Failure in `neuik_Element_GetMinSize()`.",                      // [3]
+    };
+
+    if (neuik_Object_GetClassObject(elem, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    nThreads = SDL_GetCPUCount();
+    if (nThreads > NEUIK_MINSIZE_MAX_THREADS)
+    {
+        nThreads = NEUIK_MINSIZE_MAX_THREADS;
+    }
+
+    if (nThreads > 1 && eBase->eFT != NULL &&
+        neuik_Element_MinSizeIsStale(eBase) &&
+        neuik_MinSizePass_CountStale(elem, NEUIK_MINSIZE_PARALLEL_MIN) >=
+            NEUIK_MINSIZE_PARALLEL_MIN)
+    {
+        if (neuik_MinSizePass_Collect(
+            &pass, elem, nThreads*NEUIK_MINSIZE_TASKS_PER_THREAD))
+        {
+            eNum = 2;
+            goto out;
+        }
+    }
+    if (nThreads > pass.nTasks) nThreads = pass.nTasks;
+
+    if (nThreads > 1)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The calling thread works alongside the (kept) worker threads, with */
+        /* the shared fonts; should a thread fail to start, the rest take its */
+        /* share.                                                             */
+        /*--------------------------------------------------------------------*/
+        SDL_AtomicSet(&(pass.next), 0);
+        nWorkers = neuik_MinSizeWorkers_Start(nThreads - 1);
+        if (nWorkers > 0)
+        {
+            SDL_LockMutex(wkrs->lock);
+            wkrs->pass  = &pass;
+            wkrs->nBusy = nWorkers;
+            wkrs->passNo++;
+            SDL_CondBroadcast(wkrs->wake);
+            SDL_UnlockMutex(wkrs->lock);
+        }
+        neuik_MinSizePass_Work(&pass);
+
+        if (nWorkers > 0)
+        {
+            SDL_LockMutex(wkrs->lock);
+            while (wkrs->nBusy > 0)
+            {
+                SDL_CondWait(wkrs->done, wkrs->lock);
+            }
+            wkrs->pass = NULL;
+            SDL_UnlockMutex(wkrs->lock);
+        }
+    }
+
+    if (neuik_Element_GetMinSize(elem, rSize))
+    {
+        eNum = 3;
+        goto out;
+    }
+out:
+    /*------------------------------------------------------------------------*/
+    /* Sizes measured ahead of time are only valid for this pass.             */
+    /*------------------------------------------------------------------------*/
+    for (ctr = 0; ctr < pass.nTasks; ctr++)
+    {
+        if (!neuik_Object_GetClassObject_NoError(
+            pass.tasks[ctr], neuik__Class_Element, (void**)&eBase))
+        {
+            eBase->eSt.minSizePending = 0;
+        }
+    }
+    if (pass.tasks != NULL) free(pass.tasks);
+
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
 
     return eNum;
 }
@@ -1093,6 +1648,15 @@ int neuik_Element_Render(
         eBase->eSt.hDelta = NEUIK_MINSIZE_NOCHANGE;
         eBase->eSt.wDelta = NEUIK_MINSIZE_NOCHANGE;
     }
+    else
+    {
+        /*--------------------------------------------------------------------*/
+        /* A mock render places the element (and stores its layout) but draws */
+        /* nothing. The real render which follows reuses that layout instead  */
+        /* of computing it again; so it has to know the element must be drawn.*/
+        /*--------------------------------------------------------------------*/
+        eBase->eSt.doRedraw = 1;
+    }
     return result;
 }
 
@@ -1166,7 +1730,10 @@ int neuik_Element_RenderRotate(
         goto out;
     }
 
-    if (rotation == 0.0)
+    /*------------------------------------------------------------------------*/
+    /* A mock render draws nothing, so there is nothing to rotate either.     */
+    /*------------------------------------------------------------------------*/
+    if (rotation == 0.0 || mock)
     {
         return neuik_Element_Render(elem, rSize, rlMod, xRend, mock);
     }
@@ -1450,6 +2017,84 @@ void neuik_Element_StoreSizeAndLocation(
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_InvalidateLayout
+ *
+ *  Description:   Mark the stored layout (the sizes and locations of contained
+ *                 elements) of this element as stale. As the minimum size of
+ *                 the element may change as a result, the same is done for
+ *                 all of its parents.
+ *
+ *  Returns:       Non-zero if error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Element_InvalidateLayout(
+    NEUIK_Element elem)
+{
+    return neuik_Element_PropagateIndeterminateMinSizeDelta(elem);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_IsLayoutValid
+ *
+ *  Description:   Check whether the stored layout of this element can be used
+ *                 as is. This is the case when nothing has invalidated it and
+ *                 the element still has the size and location which it had
+ *                 when the layout was computed.
+ *
+ *  Returns:       1 if the stored layout is valid; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Element_IsLayoutValid(
+    NEUIK_Element   elem,
+    RenderSize    * rSize)
+{
+    NEUIK_ElementBase * eBase;
+
+    if (neuik_Object_GetClassObject_NoError(
+        elem, neuik__Class_Element, (void**)&eBase)) return 0;
+
+    if (eBase->eSt.layoutDirty) return 0;
+    if (eBase->eSt.layoutSize.w != rSize->w) return 0;
+    if (eBase->eSt.layoutSize.h != rSize->h) return 0;
+    if (eBase->eSt.layoutLoc.x  != eBase->eSt.rLoc.x) return 0;
+    if (eBase->eSt.layoutLoc.y  != eBase->eSt.rLoc.y) return 0;
+
+    return 1;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_StoreLayout
+ *
+ *  Description:   Record that the layout of this element has been computed
+ *                 (and stored in its contained elements) for the given size
+ *                 and the current location of the element.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_Element_StoreLayout(
+    NEUIK_Element   elem,
+    RenderSize    * rSize)
+{
+    NEUIK_ElementBase * eBase;
+
+    if (neuik_Object_GetClassObject(elem, neuik__Class_Element, (void**)&eBase))
+    {
+        return;
+    }
+
+    eBase->eSt.layoutSize  = *rSize;
+    eBase->eSt.layoutLoc   = eBase->eSt.rLoc;
+    eBase->eSt.layoutDirty = 0;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          NEUIK_Element_SetBackgroundColorGradient
@@ -1722,6 +2367,7 @@ int neuik_Element_StoreFrameMinSize(
 {
     int                 eNum       = 0;
     NEUIK_ElementBase * eBase      = NULL;
+    NEUIK_ElementBase * pBase      = NULL; /* parent element base */
     static char         funcName[] = "neuik_Element_StoreFrameMinSize";
     static char       * errMsgs[]  = {"", // [0] no error
         "Argument `elem` caused `neuik_Object_GetClassObject` to fail.", // [1]
@@ -1741,6 +2387,22 @@ int neuik_Element_StoreFrameMinSize(
 
     eBase->eSt.minSizeOld = eBase->eSt.minSize;
     eBase->eSt.minSize    = *size;
+
+    /*------------------------------------------------------------------------*/
+    /* A changed minimum size changes the layout of the parent element.       */
+    /*------------------------------------------------------------------------*/
+    if (eBase->eSt.parent != NULL &&
+        (eBase->eSt.minSize.w != eBase->eSt.minSizeOld.w ||
+         eBase->eSt.minSize.h != eBase->eSt.minSizeOld.h))
+    {
+        if (neuik_Object_GetClassObject(
+            eBase->eSt.parent, neuik__Class_Element, (void**)&pBase))
+        {
+            eNum = 1;
+            goto out;
+        }
+        pBase->eSt.layoutDirty = 1;
+    }
 out:
     if (eNum > 0)
     {
@@ -2642,8 +3304,9 @@ int neuik_Element_PropagateIndeterminateMinSizeDelta(
         goto out;
     }
 
-    eBase->eSt.hDelta = NEUIK_MINSIZE_INDETERMINATE;
-    eBase->eSt.wDelta = NEUIK_MINSIZE_INDETERMINATE;
+    eBase->eSt.hDelta      = NEUIK_MINSIZE_INDETERMINATE;
+    eBase->eSt.wDelta      = NEUIK_MINSIZE_INDETERMINATE;
+    eBase->eSt.layoutDirty = 1;
     if (eBase->eSt.parent != NULL)
     {
         neuik_Element_PropagateIndeterminateMinSizeDelta(eBase->eSt.parent);
@@ -3230,6 +3893,12 @@ int neuik_Element_RedrawBackground(
                 bgCfg->solid_color.b,
                 bgCfg->solid_color.a);
 
+            if (rlMod != NULL)
+            {
+                rl.x += rlMod->x;
+                rl.y += rlMod->y;
+            }
+
             if (maskMap != NULL)
             {
                 /*------------------------------------------------------------*/
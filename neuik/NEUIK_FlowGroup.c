@@ -24,12 +24,36 @@
 #include "NEUIK_Element_internal.h"
 #include "NEUIK_Window_internal.h"
 #include "NEUIK_Container.h"
+#include "NEUIK_Container_internal.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
 
 extern int   neuik__isInitialized;
 extern float neuik__HighDPI_Scaling;
 
+/*----------------------------------------------------------------------------*/
+/* The layout cache of a FlowGroup. The minimum size of every child and the   */
+/* lines they were broken into are kept so that a change of width only        */
+/* breaks the lines again from the first line which is affected, without      */
+/* measuring any of the children again.                                       */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    int                    nAlloc;     /* number of allocated entries */
+    int                    nElems;     /* number of children measured */
+    int                    nPlaced;    /* number of children broken into lines */
+    RenderSize           * size;       /* minimum size (per child) */
+    int                  * fullH;      /* height incl. padding (per child) */
+    int                  * shown;      /* shown state (per child) */
+    NEUIK_ElementConfig ** cfg;        /* element config (per child) */
+    int                  * lineOf;     /* line the child was placed on */
+    int                    nLines;     /* number of lines */
+    int                  * lineFirst;  /* index of the first child (per line) */
+    int                  * lineH;      /* height of the line */
+    float                * lineY;      /* y position of the line */
+    float                * lineFitW;   /* px used by the children of the line */
+    float                * lineBreakW; /* px which broke the line; < 0 if none */
+} neuik_FlowGroupCache;
+
 /*----------------------------------------------------------------------------*/
 /* Internal Function Prototypes                                               */
 /*----------------------------------------------------------------------------*/
@@ -135,12 +159,13 @@ out:
 int neuik_Object_New__FlowGroup(
         void ** fgPtr)
 {
-    int               eNum       = 0;
-    NEUIK_Container * cont       = NULL;
-    NEUIK_FlowGroup * fg         = NULL;
-    NEUIK_Element   * sClassPtr  = NULL;
-    static char       funcName[] = "neuik_Object_New__FlowGroup";
-    static char     * errMsgs[]  = {"",                                   // [0] no error
+    int                    eNum       = 0;
+    NEUIK_Container      * cont       = NULL;
+    NEUIK_FlowGroup      * fg         = NULL;
+    NEUIK_Element        * sClassPtr  = NULL;
+    neuik_FlowGroupCache * cache      = NULL;
+    static char            funcName[] = "neuik_Object_New__FlowGroup";
+    static char          * errMsgs[]  = {"",                              // [0] no error
         "Output Argument `fgPtr` is NULL.",                               // [1]
         "Failure to allocate memory.",                                    // [2]
         "Failure in `neuik_GetObjectBaseOfClass`.",                       // [3]
@@ -167,6 +192,28 @@ int neuik_Object_New__FlowGroup(
     fg->FillFirst  = NEUIK_FLOWGROUP_FILLDIRN_LEFT_TO_RIGHT;
     fg->FillSecond = NEUIK_FLOWGROUP_FILLDIRN_TOP_TO_BOTTOM;
 
+    cache = (neuik_FlowGroupCache*)malloc(sizeof(neuik_FlowGroupCache));
+    if (cache == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    cache->nAlloc     = 0;
+    cache->nElems     = 0;
+    cache->nPlaced    = 0;
+    cache->size       = NULL;
+    cache->fullH      = NULL;
+    cache->shown      = NULL;
+    cache->cfg        = NULL;
+    cache->lineOf     = NULL;
+    cache->nLines     = 0;
+    cache->lineFirst  = NULL;
+    cache->lineH      = NULL;
+    cache->lineY      = NULL;
+    cache->lineFitW   = NULL;
+    cache->lineBreakW = NULL;
+    fg->cache = cache;
+
     /*------------------------------------------------------------------------*/
     /* Successful allocation of Memory -- Create Base Class Object            */
     /*------------------------------------------------------------------------*/
@@ -262,10 +309,11 @@ int NEUIK_NewFlowGroup(
 int neuik_Object_Free__FlowGroup(
     void * fgPtr)
 {
-    int               eNum       = 0;    /* which error to report (if any) */
-    NEUIK_FlowGroup * fg         = NULL;
-    static char       funcName[] = "neuik_Object_Free__FlowGroup";
-    static char     * errMsgs[]  = {"",                // [0] no error
+    int                    eNum       = 0; /* which error to report (if any) */
+    NEUIK_FlowGroup      * fg         = NULL;
+    neuik_FlowGroupCache * cache      = NULL;
+    static char            funcName[] = "neuik_Object_Free__FlowGroup";
+    static char          * errMsgs[]  = {"",           // [0] no error
         "Argument `fgPtr` is NULL.",                   // [1]
         "Argument `fgPtr` is not of FlowGroup class.", // [2]
         "Failure in function `neuik_Object_Free`.",    // [3]
@@ -293,6 +341,21 @@ int neuik_Object_Free__FlowGroup(
         goto out;
     }
 
+    cache = (neuik_FlowGroupCache*)(fg->cache);
+    if (cache != NULL)
+    {
+        free(cache->size);
+        free(cache->fullH);
+        free(cache->shown);
+        free(cache->cfg);
+        free(cache->lineOf);
+        free(cache->lineFirst);
+        free(cache->lineH);
+        free(cache->lineY);
+        free(cache->lineFitW);
+        free(cache->lineBreakW);
+        free(cache);
+    }
     free(fg);
 out:
     if (eNum > 0)
@@ -327,6 +390,366 @@ int neuik_Element_GetMinSize__FlowGroup(
 }
 
 
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_FlowGroup_ReserveCache                                              */
+/*                                                                            */
+/*  Make sure the layout cache of a FlowGroup has room for `nElems` children  */
+/*  (and as many lines). The cache grows geometrically.                       */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_FlowGroup_ReserveCache(
+    neuik_FlowGroupCache * cache,
+    int                    nElems)
+{
+    int           nAlloc     = 0;
+    int           eNum       = 0; /* which error to report (if any) */
+    void        * ptr        = NULL;
+    static char   funcName[] = "neuik_FlowGroup_ReserveCache";
+    static char * errMsgs[]  = {"",     // [0] no error
+        "Failure to reallocate memory.", // [1]
+    };
+
+    if (nElems <= cache->nAlloc) goto out;
+
+    nAlloc = 2*cache->nAlloc;
+    if (nAlloc < nElems) nAlloc = nElems;
+
+    ptr = realloc(cache->size, nAlloc*sizeof(RenderSize));
+    if (ptr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    cache->size = (RenderSize*)ptr;
+
+    ptr = realloc(cache->fullH, nAlloc*sizeof(int));
+    if (ptr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    cache->fullH = (int*)ptr;
+
+    ptr = realloc(cache->shown, nAlloc*sizeof(int));
+    if (ptr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    cache->shown = (int*)ptr;
+
+    ptr = realloc(cache->cfg, nAlloc*sizeof(NEUIK_ElementConfig*));
+    if (ptr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    cache->cfg = (NEUIK_ElementConfig**)ptr;
+
+    ptr = realloc(cache->lineOf, nAlloc*sizeof(int));
+    if (ptr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    cache->lineOf = (int*)ptr;
+
+    ptr = realloc(cache->lineFirst, nAlloc*sizeof(int));
+    if (ptr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    cache->lineFirst = (int*)ptr;
+
+    ptr = realloc(cache->lineH, nAlloc*sizeof(int));
+    if (ptr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    cache->lineH = (int*)ptr;
+
+    ptr = realloc(cache->lineY, nAlloc*sizeof(float));
+    if (ptr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    cache->lineY = (float*)ptr;
+
+    ptr = realloc(cache->lineFitW, nAlloc*sizeof(float));
+    if (ptr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    cache->lineFitW = (float*)ptr;
+
+    ptr = realloc(cache->lineBreakW, nAlloc*sizeof(float));
+    if (ptr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    cache->lineBreakW = (float*)ptr;
+
+    cache->nAlloc = nAlloc;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_FlowGroup_MeasureChildren                                           */
+/*                                                                            */
+/*  Store the minimum size, shown state and config of every child in the      */
+/*  layout cache of a FlowGroup and report the index of the first child which */
+/*  differs from what was cached before.                                      */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_FlowGroup_MeasureChildren(
+    NEUIK_FlowGroup * fg,
+    int               elemCount,
+    int             * firstChanged)
+{
+    int                    ctr        = 0;
+    int                    shown      = 0;
+    int                    fullH      = 0;
+    int                    eNum       = 0; /* which error to report (if any) */
+    RenderSize             rs;
+    NEUIK_Element          elem       = NULL;
+    NEUIK_ElementConfig  * eCfg       = NULL;
+    NEUIK_Container      * cont       = NULL;
+    neuik_FlowGroupCache * cache      = NULL;
+    static char            funcName[] = "neuik_FlowGroup_MeasureChildren";
+    static char          * errMsgs[]  = {"",                           // [0] no error
+        "Argument `fg` caused `neuik_Object_GetClassObject` to fail.", // [1]
+        "Failure in `neuik_FlowGroup_ReserveCache()`.",                // [2]
+        "Element_GetConfig returned NULL.",                            // [3]
+        "Element_GetMinSize Failed.",                                  // [4]
+    };
+
+    cache = (neuik_FlowGroupCache*)(fg->cache);
+    if (neuik_Object_GetClassObject(fg, neuik__Class_Container, (void**)&cont))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_FlowGroup_ReserveCache(cache, elemCount))
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    *firstChanged = elemCount;
+    if (cache->nPlaced < elemCount) *firstChanged = cache->nPlaced;
+
+    for (ctr = 0; ctr < elemCount; ctr++)
+    {
+        elem = cont->elems[ctr];
+
+        shown = NEUIK_Element_IsShown(elem);
+        eCfg  = neuik_Element_GetConfig(elem);
+        if (eCfg == NULL)
+        {
+            eNum = 3;
+            goto out;
+        }
+        if (neuik_Element_GetMinSize(elem, &rs))
+        {
+            eNum = 4;
+            goto out;
+        }
+        fullH = rs.h + eCfg->PadTop + eCfg->PadBottom;
+
+        if (ctr < *firstChanged && 
+            (cache->shown[ctr]  != shown || cache->cfg[ctr] != eCfg || 
+             cache->size[ctr].w != rs.w  || cache->size[ctr].h != rs.h ||
+             cache->fullH[ctr]  != fullH))
+        {
+            *firstChanged = ctr;
+        }
+        cache->shown[ctr] = shown;
+        cache->cfg[ctr]   = eCfg;
+        cache->size[ctr]  = rs;
+        cache->fullH[ctr] = fullH;
+    }
+    cache->nElems = elemCount;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_FlowGroup_FirstAffectedLine                                         */
+/*                                                                            */
+/*  Find the first line of a FlowGroup which has to be broken again, either   */
+/*  because it holds (or directly precedes) the first changed child or        */
+/*  because it no longer breaks at the same place within `width`. A line      */
+/*  keeps its break if its children still fit and the child which was pushed */
+/*  to the next line still doesn't.                                           */
+/*                                                                            */
+/*  Returns: The index of the first line to break again.                      */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_FlowGroup_FirstAffectedLine(
+    neuik_FlowGroupCache * cache,
+    int                    width,
+    int                    firstChanged)
+{
+    int line      = 0;
+    int firstLine = 0;
+
+    if (cache->nLines == 0) return 0;
+
+    firstLine = cache->nLines;
+    if (firstChanged < cache->nPlaced)
+    {
+        /*--------------------------------------------------------------------*/
+        /* A changed child may now also fit on the end of the previous line.  */
+        /*--------------------------------------------------------------------*/
+        firstLine = cache->lineOf[firstChanged] - 1;
+        if (firstLine < 0) firstLine = 0;
+    }
+    else if (firstChanged < cache->nElems)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Children were added after the last line.                           */
+        /*--------------------------------------------------------------------*/
+        firstLine = cache->nLines - 1;
+    }
+
+    for (line = 0; line < firstLine; line++)
+    {
+        if (cache->lineFitW[line] > (float)(width)) break;
+        if (cache->lineBreakW[line] >= 0.0 && 
+            cache->lineBreakW[line] <= (float)(width)) break;
+    }
+
+    return line;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_FlowGroup_BreakLines                                                */
+/*                                                                            */
+/*  Break the cached children of a FlowGroup into lines of at most `width`    */
+/*  pixels, starting from line `firstLine` (the lines before it are kept).    */
+/*  Only the cached sizes are used; no child is measured here.                */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static void neuik_FlowGroup_BreakLines(
+    neuik_FlowGroupCache * cache,
+    int                    firstLine,
+    int                    width,
+    float                  hSpacing,
+    float                  vSpacing)
+{
+    int   ctr      = 0;
+    int   line     = 0;
+    int   vctr     = 0;   /* valid counter; for elements shown */
+    int   nextInd  = 0;
+    int   finalInd = 0;
+    int   elHeight = 0;
+    float used     = 0.0; /* px used by the elements of the line */
+    float fitW     = 0.0; /* px used by the elements which fit on the line */
+    float breakW   = 0.0; /* px used when the line had to be broken */
+    float yPos     = 0.0;
+
+    line = firstLine;
+    if (line > 0 && line >= cache->nLines) return; /* no line is affected */
+    if (line > 0)
+    {
+        nextInd  = cache->lineFirst[line];
+        yPos     = cache->lineY[line];
+        elHeight = cache->lineH[line - 1];
+    }
+
+    while (nextInd < cache->nElems)
+    {
+        vctr     = 0;
+        used     = 0.0;
+        fitW     = 0.0;
+        breakW   = -1.0;
+        finalInd = nextInd;
+
+        /*--------------------------------------------------------------------*/
+        /* Determine how many elements will fit in this line and what the     */
+        /* maximum height used by any of these elements.                      */
+        /*--------------------------------------------------------------------*/
+        for (ctr = nextInd; ctr < cache->nElems; ctr++)
+        {
+            finalInd++;
+            if (!cache->shown[ctr]) continue;
+            vctr += 1;
+
+            if (vctr > 1)
+            {
+                /* subsequent UI element is valid, add Horiz. Spacing */
+                used += hSpacing;
+            }
+
+            if (cache->fullH[ctr] > elHeight)
+            {
+                elHeight = cache->fullH[ctr];
+            }
+            used += (float)(cache->size[ctr].w);
+
+            if (used > (float)(width))
+            {
+                /*------------------------------------------------------------*/
+                /* If the line only contained a single element, then the     */
+                /* element can't get any smaller, just continue.              */
+                /*------------------------------------------------------------*/
+                /* Alternatively, push the element to the next line.          */
+                /*------------------------------------------------------------*/
+                breakW = used;
+                if (vctr > 1) finalInd--;
+                break;
+            }
+            fitW = used;
+        }
+
+        for (ctr = nextInd; ctr < finalInd; ctr++)
+        {
+            cache->lineOf[ctr] = line;
+        }
+        cache->lineFirst[line]  = nextInd;
+        cache->lineY[line]      = yPos;
+        cache->lineH[line]      = elHeight;
+        cache->lineFitW[line]   = fitW;
+        cache->lineBreakW[line] = breakW;
+
+        yPos += (float)(elHeight) + vSpacing;
+        nextInd = finalInd;
+        line++;
+    }
+    cache->nLines  = line;
+    cache->nPlaced = cache->nElems;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_Element_Render__FlowGroup
@@ -343,23 +766,20 @@ int neuik_Element_Render__FlowGroup(
     SDL_Renderer  * xRend, /* The external renderer to prepare the texture for */
     int             mock)  /* If true; calculate sizes/locations but don't draw */
 {
-    int                    tempH;
     int                    elemCount;
-    int                    nextInd;
     int                    finalInd;
     int                    ctr           = 0;
     int                    vctr          = 0;    /* valid counter; for elements shown */
-    int                    elHeight      = 0;
     int                    eNum          = 0;    /* which error to report (if any) */
-    int                  * eShown        = NULL;
+    int                    line          = 0;
+    int                    firstLine     = 0;    /* first line to break again */
+    int                    firstChanged  = 0;    /* first changed child */
     float                  xPos          = 0.0;
     float                  xSize         = 0.0;
-    float                  xFree         = 0.0;  /* px of space for hFill elems */
     float                  yPos          = 0.0;
     float                  fltHspacingSc = 0.0;  // float VSpacing HighDPI scaled
     float                  fltVspacingSc = 0.0;  // float VSpacing HighDPI scaled
     NEUIK_ElementConfig  * eCfg          = NULL;
-    NEUIK_ElementConfig ** eCfgs         = NULL;
     NEUIK_Element          elem          = NULL;
     NEUIK_Container      * cont          = NULL;
     NEUIK_ElementBase    * eBase         = NULL;
@@ -369,7 +789,9 @@ int neuik_Element_Render__FlowGroup(
     RenderLoc              rl;
     RenderLoc              rlRel         = {0, 0}; /* renderloc relative to parent */
     RenderSize             rs;
-    RenderSize           * eSizes        = NULL;
+    RenderLoc              rlOld         = {0, 0}; /* stored loc before layout */
+    RenderSize             rsOld         = {0, 0}; /* stored size before layout */
+    neuik_FlowGroupCache * cache         = NULL;
     neuik_MaskMap        * maskMap       = NULL; /* FREE upon return */
     enum neuik_bgstyle     bgStyle;
     static char            funcName[] = "neuik_Element_Render__FlowGroup";
@@ -384,11 +806,14 @@ int neuik_Element_Render__FlowGroup(
         "Argument `fgElem` caused `neuik_Object_GetClassObject` to fail.", // [ 8]
         "Vertical fill preference not specified.",                         // [ 9]
         "Horizontal fill preference not specified.",                       // [10]
-        "Failure in `NEUIK_Container_GetElementCount`."                    // [11]
-        "Failed to allocate memory"                                        // [12]
+        "Failure in `NEUIK_Container_GetElementCount`.",                   // [11]
+        "Failed to allocate memory",                                       // [12]
         "Invalid (negative) number of contained elements.",                // [13]
         "Failure in neuik_Element_RedrawBackground().",                    // [14]
         "Failure in `neuik_Window_FillTranspMaskFromLoc()`",               // [15]
+        "Failure in `neuik_FlowGroup_MeasureChildren()`",                  // [16]
+        "Failure in `neuik_Element_GetSizeAndLocation()`",                 // [17]
+        "Failure in `neuik_Container_RenderStoredLayout()`",               // [18]
     };
 
 
@@ -493,6 +918,20 @@ int neuik_Element_Render__FlowGroup(
         }
     }
 
+    /*------------------------------------------------------------------------*/
+    /* If nothing which affects the placement of the contained elements has   */
+    /* changed since the last layout, render them where they already are.     */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Element_IsLayoutValid(fgElem, rSize))
+    {
+        if (neuik_Container_RenderStoredLayout(fgElem, rlMod, rend, mock))
+        {
+            eNum = 18;
+            goto out;
+        }
+        goto out2;
+    }
+
     /*------------------------------------------------------------------------*/
     /* Calculate the minimum size used by the flow fill preferenes            */
     /*------------------------------------------------------------------------*/
@@ -554,121 +993,48 @@ int neuik_Element_Render__FlowGroup(
     /*------------------------------------------------------------------------*/
     /* ELSE: Render the elements according to the specified fill order        */
     /*------------------------------------------------------------------------*/
-    eSizes = (RenderSize*)malloc(elemCount*sizeof(RenderSize));
-    if (eSizes == NULL)
-    {
-        eNum = 12;
-        goto out;
-    }
-    eShown = (int*)malloc(elemCount*sizeof(int));
-    if (eShown == NULL)
-    {
-        eNum = 12;
-        goto out;
-    }
-    eCfgs = (NEUIK_ElementConfig**)malloc(elemCount*sizeof(NEUIK_ElementConfig*));
-    if (eShown == NULL)
-    {
-        eNum = 12;
-        goto out;
-    }
-
-    /*------------------------------------------------------------------------*/
-    /* Extract the RenderSizes, IsShown states, and ElementConfigs for the    */
-    /* contained elements.                                                    */
-    /*------------------------------------------------------------------------*/
-    for (ctr = 0; ctr < elemCount; ctr++)
+    if (fg->FillFirst  == NEUIK_FLOWGROUP_FILLDIRN_LEFT_TO_RIGHT &&
+        fg->FillSecond == NEUIK_FLOWGROUP_FILLDIRN_TOP_TO_BOTTOM)
     {
-        elem = cont->elems[ctr];
+        cache = (neuik_FlowGroupCache*)(fg->cache);
 
-        eShown[ctr] = NEUIK_Element_IsShown(elem);
-        eCfgs[ctr] = neuik_Element_GetConfig(elem);
-        if (eCfgs[ctr] == NULL)
-        {
-            eNum = 3;
-            goto out;
-        }
-        if (neuik_Element_GetMinSize(elem, &(eSizes[ctr])))
+        /*--------------------------------------------------------------------*/
+        /* The children only need to be measured again if one of them (or    */
+        /* the set of children) changed; a change of width alone reflows the  */
+        /* lines using the cached sizes.                                      */
+        /*--------------------------------------------------------------------*/
+        firstChanged = cache->nPlaced;
+        if (eBase->eSt.layoutDirty || cache->nElems != elemCount)
         {
-            eNum = 4;
-            goto out;
+            if (neuik_FlowGroup_MeasureChildren(fg, elemCount, &firstChanged))
+            {
+                eNum = 16;
+                goto out;
+            }
         }
-    }
 
+        firstLine = neuik_FlowGroup_FirstAffectedLine(
+            cache, rSize->w, firstChanged);
+        neuik_FlowGroup_BreakLines(
+            cache, firstLine, rSize->w, fltHspacingSc, fltVspacingSc);
 
-    if (fg->FillFirst  == NEUIK_FLOWGROUP_FILLDIRN_LEFT_TO_RIGHT &&
-        fg->FillSecond == NEUIK_FLOWGROUP_FILLDIRN_TOP_TO_BOTTOM)
-    {
         /*--------------------------------------------------------------------*/
-        /* Continue looping over elements until they have all been placed.    */
+        /* Render and place the child elements, line by line.                 */
         /*--------------------------------------------------------------------*/
-        yPos = 0.0;
-        for (nextInd = 0; nextInd < elemCount;)
+        for (line = 0; line < cache->nLines; line++)
         {
-            if (cont->elems[nextInd] == NULL) break;
-
-            vctr  = 0;        /* valid element counter */
-            xPos  = 0.0;
-            xFree = (float)(rSize->w); /* free X-px: start @ full width; deduct as used */
-            finalInd = nextInd;
-            
-            /*----------------------------------------------------------------*/
-            /* Determine how many elements will fit in the first row and what */
-            /* the maximum height used by any of these elements.              */
-            /*----------------------------------------------------------------*/
-            for (ctr = nextInd; ctr < elemCount; ctr++)
+            finalInd = cache->nElems;
+            if (line + 1 < cache->nLines)
             {
-                finalInd++;
-                elem = cont->elems[ctr];
-                if (elem == NULL) break;
-
-                if (!eShown[ctr]) continue;
-                vctr += 1;
-
-                if (vctr > 1)
-                {
-                    /* subsequent UI element is valid, deduct Horiz. Spacing */
-                    xFree -= fltHspacingSc;
-                }
-
-                eCfg = eCfgs[ctr];
-                rs   = eSizes[ctr];
-
-                tempH = rs.h + eCfg->PadTop + eCfg->PadBottom;
-                if (tempH > elHeight)
-                {
-                    elHeight = tempH;
-                }
-                xFree -= rs.w;
-
-                if (xFree < 0)
-                {
-                    /*--------------------------------------------------------*/
-                    /* If the row only contained a single element, then the   */
-                    /* element can't get any smaller, just continue.          */
-                    /*--------------------------------------------------------*/
-                    /* Alternatively, push the element to the next row.       */
-                    /*--------------------------------------------------------*/
-                    if (vctr > 1) finalInd--;
-                    break;
-                }
+                finalInd = cache->lineFirst[line + 1];
             }
 
-            /*----------------------------------------------------------------*/
-            /* Render and place the child elements                            */
-            /*----------------------------------------------------------------*/
-            vctr  = 0;        /* valid element counter */
-            for (ctr = nextInd; ctr < finalInd; ctr++)
+            vctr = 0;        /* valid element counter */
+            xPos = 0.0;
+            yPos = cache->lineY[line];
+            for (ctr = cache->lineFirst[line]; ctr < finalInd; ctr++)
             {
-                nextInd++;
-                elem = cont->elems[ctr];
-                if (elem == NULL) 
-                {
-                    nextInd--;
-                    break;
-                }
-
-                if (!eShown[ctr]) continue;
+                if (!cache->shown[ctr]) continue;
                 vctr += 1;
 
                 if (vctr > 1)
@@ -677,8 +1043,9 @@ int neuik_Element_Render__FlowGroup(
                     xPos += fltHspacingSc;
                 }
 
-                eCfg = eCfgs[ctr];
-                rs   = eSizes[ctr];
+                elem  = cont->elems[ctr];
+                eCfg  = cache->cfg[ctr];
+                rs    = cache->size[ctr];
                 xSize = (float)(rs.w);
 
                 /*------------------------------------------------------------*/
@@ -694,19 +1061,30 @@ int neuik_Element_Render__FlowGroup(
                 rl.y = (eBase->eSt.rLoc).y + rect.y;
                 rlRel.x = rect.x;
                 rlRel.y = rect.y;
+                if (neuik_Element_GetSizeAndLocation(elem, &rsOld, &rlOld))
+                {
+                    eNum = 17;
+                    goto out;
+                }
                 neuik_Element_StoreSizeAndLocation(elem, rs, rl, rlRel);
 
+                xPos += xSize + (float)(eCfg->PadLeft + eCfg->PadRight);
+
+                /*------------------------------------------------------------*/
+                /* Only elements which moved or need it otherwise are redrawn.*/
+                /*------------------------------------------------------------*/
+                if (rsOld.w == rs.w && rsOld.h == rs.h &&
+                    rlOld.x == rl.x && rlOld.y == rl.y &&
+                    !neuik_Element_NeedsRedraw(elem)) continue;
+
                 if (neuik_Element_Render(elem, &rs, rlMod, rend, mock))
                 {
                     eNum = 5;
                     goto out;
                 }
-
-                xPos += xSize + (float)(eCfg->PadLeft + eCfg->PadRight) ;
             }
-
-            yPos += (float)(elHeight) + fltVspacingSc;
         }
+        neuik_Element_StoreLayout(fgElem, rSize);
     }
 out2:
     if (!mock) eBase->eSt.doRedraw = 0;
@@ -714,9 +1092,6 @@ out:
     /*------------------------------------------------------------------------*/
     /* Free any dynamically allocated memory                                  */
     /*------------------------------------------------------------------------*/
-    if (eSizes  != NULL) free(eSizes);
-    if (eShown  != NULL) free(eShown);
-    if (eCfgs   != NULL) free(eCfgs);
     if (maskMap != NULL) neuik_Object_Free(maskMap);
 
     if (eNum > 0)
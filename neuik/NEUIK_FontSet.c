@@ -19,9 +19,26 @@
 #include "NEUIK_FontSet.h"
 #include "NEUIK_error.h"
 #include "NEUIK_render.h"
+#include "neuik_internal.h"
 
 extern float neuik__HighDPI_Scaling;
 
+/*----------------------------------------------------------------------------*/
+/* A TTF_Font may not be used by more than one thread at a time. A thread     */
+/* which measures text alongside others (see neuik_FontSet_BeginThreadFonts)  */
+/* uses private copies of the FontSet fonts instead.                          */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    TTF_Font * shared; /* the font as held by its FontSet */
+    TTF_Font * font;   /* the private copy used by this thread */
+} neuik_ThreadFont;
+
+typedef struct {
+    unsigned int       nUsed;
+    unsigned int       nAlloc;
+    neuik_ThreadFont * fonts;
+} neuik_ThreadFonts;
+
 /*----------------------------------------------------------------------------*/
 /* The following is the list of default fonts that NEUIK will check for on    */
 /* the system.  Fonts higher up in the list are preferred to those lower in   */
@@ -514,6 +531,52 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_ThreadFonts_Get                                      */
+/*                                                                            */
+/*  Description:   Get the private copy of a (shared) FontSet font; it is     */
+/*                 opened on first use. The shared lock must be held.         */
+/*                                                                            */
+/*  Returns:       NULL if there is an error; otherwise a valid pointer.      */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static TTF_Font * neuik_ThreadFonts_Get(
+    neuik_ThreadFonts * tFonts,
+    TTF_Font          * shared,
+    const char        * fontName,
+    unsigned int        fSize)
+{
+    unsigned int       ctr;
+    unsigned int       nAlloc;
+    neuik_ThreadFont * newFonts = NULL;
+    TTF_Font         * font     = NULL;
+
+    for (ctr = 0; ctr < tFonts->nUsed; ctr++)
+    {
+        if (tFonts->fonts[ctr].shared == shared) return tFonts->fonts[ctr].font;
+    }
+
+    if (tFonts->nUsed == tFonts->nAlloc)
+    {
+        nAlloc   = (tFonts->nAlloc == 0) ? 4 : 2*tFonts->nAlloc;
+        newFonts = (neuik_ThreadFont *)realloc(
+            tFonts->fonts, nAlloc*sizeof(neuik_ThreadFont));
+        if (newFonts == NULL) return NULL;
+        tFonts->fonts  = newFonts;
+        tFonts->nAlloc = nAlloc;
+    }
+
+    font = TTF_OpenFont(fontName, fSize);
+    if (font == NULL) return NULL;
+
+    tFonts->fonts[tFonts->nUsed].shared = shared;
+    tFonts->fonts[tFonts->nUsed].font   = font;
+    tFonts->nUsed++;
+    return font;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          NEUIK_FontSet_GetFont
@@ -543,8 +606,11 @@ neuik_ptrTo_TTF_Font NEUIK_FontSet_GetFont(
         "Func `TTF_OpenFont` failed.",           // [4]
         "Failed to reallocate memory.",          // [5]
         "Desired font style is unavailable.",    // [6]
+        "Failed to open a thread-private font.", // [7]
     };
-    TTF_Font * rvFont = NULL;
+    TTF_Font          * rvFont     = NULL;
+    neuik_ThreadState * tState     = NULL;
+    int                 locked     = 0;
 
     if (fs == NULL)
     {
@@ -584,6 +650,12 @@ neuik_ptrTo_TTF_Font NEUIK_FontSet_GetFont(
         goto out;
     }
 
+    /*------------------------------------------------------------------------*/
+    /* The font cache may be used by several (min-size worker) threads.       */
+    /*------------------------------------------------------------------------*/
+    neuik_LockShared();
+    locked = 1;
+
     if (ffs->MaxSize == 0)
     {
         /*--------------------------------------------------------------------*/
@@ -680,7 +752,23 @@ neuik_ptrTo_TTF_Font NEUIK_FontSet_GetFont(
         ffs->MaxSize = fSizeSc;
         rvFont = ffs->Fonts[fSizeSc];
     }
+
+    /*------------------------------------------------------------------------*/
+    /* A thread measuring text alongside others uses its own copy of a font.  */
+    /*------------------------------------------------------------------------*/
+    tState = neuik_GetThreadState();
+    if (tState->fonts != NULL)
+    {
+        rvFont = neuik_ThreadFonts_Get((neuik_ThreadFonts *)(tState->fonts),
+            rvFont, ffs->FontName, fSizeSc);
+        if (rvFont == NULL)
+        {
+            eNum = 7;
+            goto out;
+        }
+    }
 out:
+    if (locked) neuik_UnlockShared();
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -689,3 +777,114 @@ out:
     return rvFont;
 }
 
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_FontSet_BeginThreadFonts
+ *
+ *  Description:   Have NEUIK_FontSet_GetFont return fonts private to the
+ *                 calling thread (until neuik_FontSet_EndThreadFonts), so that
+ *                 text may be measured on it while other threads do the same.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_FontSet_BeginThreadFonts()
+{
+    int                 eNum       = 0; /* which error to report (if any) */
+    neuik_ThreadState * tState     = NULL;
+    neuik_ThreadFonts * tFonts     = NULL;
+    static char         funcName[] = "neuik_FontSet_BeginThreadFonts";
+    static char       * errMsgs[]  = {"", // [0] no error
+        "Thread fonts are already in use.", // [1]
+        "Failed to allocate memory.",       // [2]
+    };
+
+    neuik_LockShared();
+    tState = neuik_GetThreadState();
+    if (tState->fonts != NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    tFonts = (neuik_ThreadFonts *)calloc(1, sizeof(neuik_ThreadFonts));
+    if (tFonts == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    tState->fonts = tFonts;
+out:
+    neuik_UnlockShared();
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_FontSet_EndThreadFonts
+ *
+ *  Description:   Close the fonts private to the calling thread; subsequent
+ *                 calls to NEUIK_FontSet_GetFont return the shared fonts.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_FontSet_EndThreadFonts()
+{
+    unsigned int        ctr;
+    neuik_ThreadState * tState = NULL;
+    neuik_ThreadFonts * tFonts = NULL;
+
+    neuik_LockShared();
+    tState = neuik_GetThreadState();
+    tFonts = (neuik_ThreadFonts *)(tState->fonts);
+    if (tFonts != NULL)
+    {
+        for (ctr = 0; ctr < tFonts->nUsed; ctr++)
+        {
+            TTF_CloseFont(tFonts->fonts[ctr].font);
+        }
+        if (tFonts->fonts != NULL) free(tFonts->fonts);
+        free(tFonts);
+        tState->fonts = NULL;
+    }
+    neuik_UnlockShared();
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_FontSet_GetSharedFont
+ *
+ *  Description:   Get the FontSet font for which a font returned by
+ *                 NEUIK_FontSet_GetFont stands in. This differs from `font`
+ *                 only for the private fonts of a thread; it identifies the
+ *                 font in caches which outlive the thread fonts.
+ *
+ *  Returns:       The shared font.
+ *
+ ******************************************************************************/
+neuik_ptrTo_TTF_Font neuik_FontSet_GetSharedFont(
+    neuik_ptrTo_TTF_Font font)
+{
+    unsigned int        ctr;
+    neuik_ThreadFonts * tFonts = NULL;
+
+    tFonts = (neuik_ThreadFonts *)(neuik_GetThreadState()->fonts);
+    if (tFonts == NULL) return font;
+
+    for (ctr = 0; ctr < tFonts->nUsed; ctr++)
+    {
+        if (tFonts->fonts[ctr].font == font) return tFonts->fonts[ctr].shared;
+    }
+    return font;
+}
+
@@ -465,6 +465,7 @@ int neuik_Element_Render__Frame(
         "Failure in `neuik_MakeMaskMap()`",                               // [8]
         "Failure in `neuik_Element_RedrawBackground()`.",                 // [9]
         "Failure in `neuik_Window_FillTranspMaskFromLoc()`",              // [10]
+        "Failure in `neuik_Element_GetSizeAndLocation()`",                // [11]
     };
 
     if (!neuik_Object_IsClass(fElem, neuik__Class_Frame))
@@ -596,6 +597,25 @@ int neuik_Element_Render__Frame(
     /* If this frame has a hidden element, just make it a small box */
     if (!NEUIK_Element_IsShown(elem)) goto out;
 
+    /*------------------------------------------------------------------------*/
+    /* If neither the frame nor the minimum size of its element changed since */
+    /* the last (mock or real) render, the element stays where it is.         */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Element_IsLayoutValid(fElem, rSize))
+    {
+        if (neuik_Element_GetSizeAndLocation(elem, &rs, &rl))
+        {
+            eNum = 11;
+            goto out;
+        }
+        if (neuik_Element_Render(elem, &rs, rlMod, rend, mock))
+        {
+            eNum = 7;
+            goto out;
+        }
+        goto out;
+    }
+
     /*------------------------------------------------------------------------*/
     /* Determine whether the contained element fills the window               */
     /*------------------------------------------------------------------------*/
@@ -719,6 +739,7 @@ int neuik_Element_Render__Frame(
         eNum = 7;
         goto out;
     }
+    neuik_Element_StoreLayout(fElem, rSize);
 out:
     if (eBase != NULL)
     {
@@ -15,6 +15,7 @@
  ******************************************************************************/
 #include <SDL.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <math.h>
 #include <signal.h>
 
@@ -26,18 +27,75 @@
 #include "NEUIK_Element_internal.h"
 #include "NEUIK_Window_internal.h"
 #include "NEUIK_Container.h"
+#include "NEUIK_Container_internal.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
 
 extern int   neuik__isInitialized;
 extern float neuik__HighDPI_Scaling;
 
+#define NEUIK_GRIDLAYOUT_OVERSCAN   2  /* cells bound beyond each shown edge */
+#define NEUIK_GRIDLAYOUT_WHEELCELLS 3  /* cells scrolled per mouse wheel step */
+#define NEUIK_GRIDLAYOUT_UNBOUND   -1  /* a recycled cell which is still empty */
+#define NEUIK_GRIDLAYOUT_STALE     -2  /* a recycled cell which must be rebound */
+
+/*----------------------------------------------------------------------------*/
+/* The state of a virtual GridLayout. The contained elements are a small grid */
+/* (xDim by yDim) of recycled cells; cell (col, row) is always bound into the */
+/* slot (col % xDim, row % yDim) so scrolling by a column or row only rebinds */
+/* a single column or row of slots.                                           */
+/*                                                                            */
+/* The measured size (incl. padding) of every cell bound so far is kept, so   */
+/* that when one cell changes, only its own column and row are updated.       */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    int   size;  /* measured width (or height) of a cell */
+    int   ind;   /* row (or column) of the cell within its column (or row) */
+} neuik_GridLayoutSizeEntry;
+
+/*----------------------------------------------------------------------------*/
+/* A max-heap of the measured sizes of the cells of one column (or row). The  */
+/* entry of a cell is not removed when the cell changes size; an entry which  */
+/* no longer matches its cell is dropped once it reaches the top, and the     */
+/* heap is compacted (instead of grown) while it is mostly stale entries.     */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    neuik_GridLayoutSizeEntry * entries;
+    int                         nUsed;
+    int                         nAlloc;
+} neuik_GridLayoutSizeHeap;
+
+typedef struct {
+    int          nCols;          /* number of (virtual) columns in the grid */
+    int          nRows;          /* number of (virtual) rows in the grid */
+    int       (* bindFn)(NEUIK_Element *, int, int, void *);
+    void       * bindArg;
+    int          leftCol;        /* index of the first shown column */
+    int          topRow;         /* index of the first shown row */
+    int          nShownCols;     /* number of columns which fit in the grid */
+    int          nShownRows;     /* number of rows which fit in the grid */
+    int        * colW;           /* largest measured cell width (per column) */
+    int        * rowH;           /* largest measured cell height (per row) */
+    neuik_GridLayoutSizeHeap * colHeap; /* measured cell widths (per column) */
+    neuik_GridLayoutSizeHeap * rowHeap; /* measured cell heights (per row) */
+    RenderSize * cellSz;         /* measured size per cell; w < 0 if unknown */
+    int          estW;           /* width used for columns not yet measured */
+    int          estH;           /* height used for rows not yet measured */
+    int          metricsChanged; /* a column width or row height changed */
+    int        * slotCol;        /* column bound into each slot (or UNBOUND/STALE) */
+    int        * slotRow;        /* row bound into each slot (or UNBOUND/STALE) */
+    int          lastMouseX;     /* last known mouse position (for wheel events) */
+    int          lastMouseY;
+} neuik_GridLayoutVirtual;
+
 /*----------------------------------------------------------------------------*/
 /* Internal Function Prototypes                                               */
 /*----------------------------------------------------------------------------*/
 int neuik_Object_New__GridLayout(void **);
 int neuik_Object_Free__GridLayout(void *);
 
+static void neuik_GridLayout_FreeSizeHeaps(neuik_GridLayoutVirtual *);
+
 neuik_EventState neuik_Element_CaptureEvent__GridLayout(
     NEUIK_Element, SDL_Event*);
 int neuik_Element_GetMinSize__GridLayout(NEUIK_Element, RenderSize*);
@@ -199,6 +257,7 @@ int neuik_Object_New__GridLayout(
     grid->xDim        = 0;
     grid->yDim        = 0;
     grid->squareElems = 0;
+    grid->virt        = NULL;
 
     /*------------------------------------------------------------------------*/
     /* Successful allocation of Memory -- Create Base Class Object            */
@@ -349,6 +408,7 @@ int NEUIK_GridLayout_SetDimensions(
         "Failure in function `neuik_Object_Free`.",                       // [2]
         "Failure to allocate memory.",                                    // [3]
         "Failure to reallocate memory.",                                  // [4]
+        "GridLayout is virtual; use `NEUIK_GridLayout_SetVirtualCount()`.", // [5]
     };
 
     if (neuik_Object_GetClassObject(grid, neuik__Class_Container, (void**)&cBase))
@@ -356,6 +416,11 @@ int NEUIK_GridLayout_SetDimensions(
         eNum = 1;
         goto out;
     }
+    if (grid->virt != NULL)
+    {
+        eNum = 5;
+        goto out;
+    }
 
     finalInd = grid->xDim * grid->yDim;
 
@@ -468,10 +533,14 @@ out:
 int neuik_Object_Free__GridLayout(
     void  * gridPtr)
 {
-    int                eNum       = 0;    /* which error to report (if any) */
-    NEUIK_GridLayout * grid       = NULL;
-    static char        funcName[] = "neuik_Object_Free__GridLayout";
-    static char      * errMsgs[]  = {"",                 // [0] no error
+    int                       eNum       = 0; /* which error to report (if any) */
+    int                       ctr        = 0;
+    int                       finalInd   = 0;
+    NEUIK_Container         * cBase      = NULL;
+    NEUIK_GridLayout        * grid       = NULL;
+    neuik_GridLayoutVirtual * v          = NULL;
+    static char               funcName[] = "neuik_Object_Free__GridLayout";
+    static char             * errMsgs[]  = {"",          // [0] no error
         "Argument `gridPtr` is NULL.",                   // [1]
         "Argument `gridPtr` is not of Container class.", // [2]
         "Failure in function `neuik_Object_Free`.",      // [3]
@@ -490,6 +559,32 @@ int neuik_Object_Free__GridLayout(
     }
     grid = (NEUIK_GridLayout*)gridPtr;
 
+    if (grid->virt != NULL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The recycled cells of a virtual GridLayout may leave NULL holes    */
+        /* (slots which were never bound); free them here since the Container */
+        /* stops freeing elements at the first NULL.                          */
+        /*--------------------------------------------------------------------*/
+        if (neuik_Object_GetClassObject(grid, neuik__Class_Container, 
+            (void**)&cBase))
+        {
+            eNum = 2;
+            goto out;
+        }
+        finalInd = grid->xDim * grid->yDim;
+        for (ctr = 0; ctr < finalInd; ctr++)
+        {
+            if (cBase->elems[ctr] == NULL) continue;
+            if (neuik_Object_Free(cBase->elems[ctr]))
+            {
+                eNum = 3;
+                goto out;
+            }
+            cBase->elems[ctr] = NULL;
+        }
+    }
+
     /*------------------------------------------------------------------------*/
     /* The object is what it says it is and it is still allocated.            */
     /*------------------------------------------------------------------------*/
@@ -499,6 +594,17 @@ int neuik_Object_Free__GridLayout(
         goto out;
     }
 
+    if (grid->virt != NULL)
+    {
+        v = (neuik_GridLayoutVirtual*)(grid->virt);
+        neuik_GridLayout_FreeSizeHeaps(v);
+        free(v->colW);
+        free(v->rowH);
+        free(v->cellSz);
+        free(v->slotCol);
+        free(v->slotRow);
+        free(v);
+    }
     free(grid);
 out:
     if (eNum > 0)
@@ -700,11 +806,12 @@ int NEUIK_GridLayout_GetElementAt(
     unsigned int       yLoc,
     NEUIK_Element    * elem)
 {
-    int                 eNum       = 0;    /* which error to report (if any) */
-    int                 offset     = 0;
-    NEUIK_Container   * cBase      = NULL;
-    static char         funcName[] = "NEUIK_GridLayout_GetElementAt";
-    static char       * errMsgs[]  = {"",                                // [0] no error
+    int                       eNum       = 0; /* which error to report (if any) */
+    int                       offset     = 0;
+    NEUIK_Container         * cBase      = NULL;
+    neuik_GridLayoutVirtual * v          = NULL;
+    static char               funcName[] = "NEUIK_GridLayout_GetElementAt";
+    static char             * errMsgs[]  = {"",                          // [0] no error
         "Argument `grid` is not of GridLayout class.",                   // [1]
         "Argument `grid` caused `neuik_Object_GetClassObject` to fail.", // [2]
         "Output Argument `elem` is NULL.",                               // [3]
@@ -728,6 +835,35 @@ int NEUIK_GridLayout_GetElementAt(
         goto out;
     }
 
+    if (grid->virt != NULL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Only the cells which are currently bound have an element.          */
+        /*--------------------------------------------------------------------*/
+        v = (neuik_GridLayoutVirtual*)(grid->virt);
+        if (xLoc >= (unsigned int)(v->nCols))
+        {
+            eNum = 4;
+            goto out;
+        }
+        if (yLoc >= (unsigned int)(v->nRows))
+        {
+            eNum = 5;
+            goto out;
+        }
+
+        *elem  = NULL;
+        if (grid->xDim == 0 || grid->yDim == 0) goto out;
+
+        offset = (xLoc % grid->xDim) + (yLoc % grid->yDim)*(grid->xDim);
+        if (v->slotCol[offset] == (int)(xLoc) && 
+            v->slotRow[offset] == (int)(yLoc))
+        {
+            *elem = cBase->elems[offset];
+        }
+        goto out;
+    }
+
     /*------------------------------------------------------------------------*/
     /* Check that specified location is within GridLayout bounds.             */
     /*------------------------------------------------------------------------*/
@@ -772,12 +908,13 @@ int NEUIK_GridLayout_GetElementPos(
     int              * xLoc,
     int              * yLoc)
 {
-    int                 eNum       = 0;    /* which error to report (if any) */
-    int                 ctr        = 0;
-    int                 nAlloc     = 0;
-    NEUIK_Container   * cBase      = NULL;
-    static char         funcName[] = "NEUIK_GridLayout_GetElementPos";
-    static char       * errMsgs[]  = {"",                                // [0] no error
+    int                       eNum       = 0; /* which error to report (if any) */
+    int                       ctr        = 0;
+    int                       nAlloc     = 0;
+    NEUIK_Container         * cBase      = NULL;
+    neuik_GridLayoutVirtual * v          = NULL;
+    static char               funcName[] = "NEUIK_GridLayout_GetElementPos";
+    static char             * errMsgs[]  = {"",                          // [0] no error
         "Argument `grid` is not of GridLayout class.",                   // [1]
         "Argument `grid` caused `neuik_Object_GetClassObject` to fail.", // [2]
         "Argument `elem` is NULL.",                                      // [3]
@@ -830,6 +967,19 @@ int NEUIK_GridLayout_GetElementPos(
     {
         if (cBase->elems[ctr] == elem)
         {
+            if (grid->virt != NULL)
+            {
+                /*------------------------------------------------------------*/
+                /* Report the cell currently bound into this recycled slot.   */
+                /*------------------------------------------------------------*/
+                v = (neuik_GridLayoutVirtual*)(grid->virt);
+                if (v->slotCol[ctr] < 0) break;
+
+                *hasElem = 1;
+                *xLoc = v->slotCol[ctr];
+                *yLoc = v->slotRow[ctr];
+                break;
+            }
             *hasElem = 1;
             *xLoc = ctr % grid->xDim;
             *yLoc = (ctr - (*xLoc)) / grid->xDim;
@@ -874,6 +1024,7 @@ int NEUIK_GridLayout_SetElementAt(
         "Argument `elem` does not implement Element class.",             // [3]
         "Argument `xLoc` is beyond specified `xDim` of GridLayout.",     // [4]
         "Argument `yLoc` is beyond specified `yDim` of GridLayout.",     // [5]
+        "Elements can't be set within a virtual GridLayout.",            // [6]
     };
 
     if (!neuik_Object_IsClass(grid, neuik__Class_GridLayout))
@@ -891,6 +1042,11 @@ int NEUIK_GridLayout_SetElementAt(
         eNum = 3;
         goto out;
     }
+    if (grid->virt != NULL)
+    {
+        eNum = 6;
+        goto out;
+    }
 
     /*------------------------------------------------------------------------*/
     /* Check that specified location is within GridLayout bounds.             */
@@ -1200,10 +1356,11 @@ int neuik_Element_IsShown__GridLayout(
     NEUIK_ElementBase * eBase;
     NEUIK_Container   * cBase = NULL;
     NEUIK_GridLayout  * grid  = NULL;
-    static int          nRecurse = 0; /* number of times recursively called */
+    int               * nRecurse = NULL; /* (per-thread) recursion depth */
 
-    nRecurse++;
-    if (nRecurse > NEUIK_MAX_RECURSION)
+    nRecurse = &(neuik_GetThreadState()->nRecurse[NEUIK_RECURSE_GRIDLAYOUT_ISSHOWN]);
+    (*nRecurse)++;
+    if ((*nRecurse) > NEUIK_MAX_RECURSION)
     {
         /*--------------------------------------------------------------------*/
         /* This is likely a case of appears to be runaway recursion; report   */
@@ -1268,7 +1425,7 @@ int neuik_Element_IsShown__GridLayout(
         }
     }
 out:
-    nRecurse--;
+    (*nRecurse)--;
     return isShown;
 }
 
@@ -1348,6 +1505,17 @@ int neuik_Element_GetMinSize__GridLayout(
         goto out;
     }
 
+    if (grid->virt != NULL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* A virtual GridLayout shows as many cells as fit in the space it is */
+        /* given; like a virtual ListGroup it should be set to fill.          */
+        /*--------------------------------------------------------------------*/
+        rSize->w = 1;
+        rSize->h = 1;
+        goto out;
+    }
+
     if (cont->elems == NULL) {
         /* there are no UI elements contained by this GridLayout */
         goto out;
@@ -1589,195 +1757,1091 @@ out:
 }
 
 
-/*******************************************************************************
- *
- *  Name:          neuik_Element_Render__GridLayout
- *
- *  Description:   Renders a single button as an SDL_Texture*.
- *
- *  Returns:       NULL if there is a problem, otherwise a valid SDL_Texture*.
- *
- ******************************************************************************/
-int neuik_Element_Render__GridLayout(
-    NEUIK_Element   gridElem,
-    RenderSize    * rSize,    /* in/out the size the tex occupies when complete */
-    RenderLoc     * rlMod,    /* A relative location modifier (for rendering) */
-    SDL_Renderer  * xRend,    /* the external renderer to prepare the texture for */
-    int             mock)     /* If true; calculate sizes/locations but don't draw */
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_GridLayout_AddVirtualSlots                                          */
+/*                                                                            */
+/*  Grow the pool of recycled cells of a virtual GridLayout to (at least)     */
+/*  `nSlotCols` by `nSlotRows`. Since cells are bound into the slot           */
+/*  (col % xDim, row % yDim), all of the cells which were previously bound    */
+/*  must be rebound.                                                          */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_GridLayout_AddVirtualSlots(
+    NEUIK_GridLayout * grid,
+    int                nSlotCols,
+    int                nSlotRows)
 {
-    int                    nAlloc        = 0;
-    int                    tempH         = 0;
-    int                    tempW         = 0;
-    int                    rowCtr        = 0;
-    int                    colCtr        = 0;
-    int                    offset        = 0;
-    int                    ctr           = 0;
-    int                    squarePadH    = 0; // px of height lost to keep aspect
-    int                    squarePadW    = 0; // px of width lost to keep aspect
-    int                    xFree         = 0; // px of space free for hFill elems
-    int                    yFree         = 0; // px of space free for vFill elems
-    int                    dH            = 0; // Change in height [px]
-    int                    dW            = 0; // Change in width [px]
-    int                    eNum          = 0; // which error to report (if any)
-    int                    nHFill        = 0; // number of cols which can HFill
-    int                    nVFill        = 0; // number of rows which can VFill
-    int                    reqResizeH    = 0; // required resize height
-    int                    reqResizeW    = 0; // required resize width
-    int                    hfillColsMinW = 0; // min width for all hFill cols
-    int                    hfillMaxMinW  = 0; // largest minimum col width 
-    int                    vfillRowsMinH = 0; // min height for all vFill rows
-    int                    vfillMaxMinH  = 0; // largest minimum row height 
-                                              // among vertically filling rows.
-    int                    maxSideLen    = 0; // Maximum side length (square-elems)
-    float                  xPos          = 0.0;
-    float                  yPos          = 0.0;
-    float                  fltHspacingSc = 0.0;  // float VSpacing HighDPI scaled
-    float                  fltVspacingSc = 0.0;  // float VSpacing HighDPI scaled
-    int                  * allHFill      = NULL; // Free upon returning; 
-                                                 // Cols fills vertically? (per col)
-    int                  * allVFill      = NULL; // Free upon returning; 
-                                                 // Row fills vertically? (per row)
-    int                  * allMaxMinH    = NULL; // Free upon returning; 
-                                                 // The max min width (per row)
-    int                  * allMaxMinW    = NULL; // Free upon returning; 
-                                                 // The max min width (per column)
-    int                  * rendColW      = NULL; // Free upon returning; 
-                                                 // Rendered col width (per column)
-    int                  * rendRowH      = NULL; // Free upon returning; 
-                                                 // Rendered row height (per row)
-    int                  * elemsValid    = NULL; // Free upon returning.
-    int                  * elemsShown    = NULL; // Free upon returning.
-    RenderSize           * elemsMinSz    = NULL; // Free upon returning.
-    NEUIK_ElementConfig ** elemsCfg      = NULL; // Free upon returning.
-    RenderLoc              rl;
-    RenderLoc              rlRel         = {0, 0}; /* renderloc relative to parent */
-    SDL_Rect               rect          = {0, 0, 0, 0};
-    static RenderSize      rsZero        = {0, 0};
-    RenderSize             rsMin         = {0, 0};
-    RenderSize           * rs            = NULL;
-    SDL_Renderer         * rend          = NULL;
-    NEUIK_Container      * cont          = NULL;
-    NEUIK_ElementBase    * eBase         = NULL;
-    NEUIK_Element          elem          = NULL;
-    NEUIK_ElementConfig  * eCfg          = NULL;
-    NEUIK_GridLayout     * grid          = NULL;
-    neuik_MaskMap        * maskMap       = NULL; /* FREE upon return */
-    enum neuik_bgstyle     bgStyle;
-    static char            funcName[]    = "neuik_Element_Render__GridLayout";
-    static char          * errMsgs[]     = {"", // [0] no error
-        "Argument `gridElem` is not of GridLayout class.",                   // [1]
-        "Failure in `neuik_Element_Render()`",                               // [2]
-        "Element_GetConfig returned NULL.",                                  // [3]
-        "Element_GetMinSize Failed.",                                        // [4]
-        "Failure to allocate memory.",                                       // [5]
-        "Invalid specified `rSize` (negative values).",                      // [6]
-        "Failure in `neuik_Element_GetCurrentBGStyle()`.",                   // [7]
-        "Argument `gridElem` caused `neuik_Object_GetClassObject` to fail.", // [8]
-        "Failure in neuik_Element_RedrawBackground().",                      // [9]
-        "Failure in `neuik_MakeMaskMap()`",                                  // [10]
-        "Failure in `neuik_Window_FillTranspMaskFromLoc()`",                 // [11]
+    int                       ctr        = 0;
+    int                       nOld       = 0;
+    int                       nNew       = 0;
+    int                       eNum       = 0; /* which error to report (if any) */
+    int                     * slotCol    = NULL;
+    int                     * slotRow    = NULL;
+    NEUIK_Element           * elems      = NULL;
+    NEUIK_Container         * cBase      = NULL;
+    neuik_GridLayoutVirtual * v          = NULL;
+    static char               funcName[] = "neuik_GridLayout_AddVirtualSlots";
+    static char             * errMsgs[]  = {"",                          // [0] no error
+        "Argument `grid` caused `neuik_Object_GetClassObject` to fail.", // [1]
+        "Failure to reallocate memory.",                                 // [2]
     };
 
-    if (!neuik_Object_IsClass(gridElem, neuik__Class_GridLayout))
+    v = (neuik_GridLayoutVirtual*)(grid->virt);
+    if (neuik_Object_GetClassObject(grid, neuik__Class_Container, (void**)&cBase))
     {
         eNum = 1;
         goto out;
     }
-    grid = (NEUIK_GridLayout*)gridElem;
 
-    if (neuik_Object_GetClassObject(gridElem, neuik__Class_Element, (void**)&eBase))
+    if (nSlotCols < 1 || nSlotRows < 1) goto out;
+    if (nSlotCols <= (int)(grid->xDim) && nSlotRows <= (int)(grid->yDim))
     {
-        eNum = 8;
         goto out;
     }
-    if (neuik_Object_GetClassObject(gridElem, neuik__Class_Container, (void**)&cont))
+    if (nSlotCols < (int)(grid->xDim)) nSlotCols = grid->xDim;
+    if (nSlotRows < (int)(grid->yDim)) nSlotRows = grid->yDim;
+
+    nOld = grid->xDim*grid->yDim;
+    nNew = nSlotCols*nSlotRows;
+
+    slotCol = (int*)realloc(v->slotCol, nNew*sizeof(int));
+    if (slotCol == NULL)
     {
-        eNum = 8;
+        eNum = 2;
         goto out;
     }
+    v->slotCol = slotCol;
 
-    if (rSize->w < 0 || rSize->h < 0)
+    slotRow = (int*)realloc(v->slotRow, nNew*sizeof(int));
+    if (slotRow == NULL)
     {
-        eNum = 6;
+        eNum = 2;
         goto out;
     }
+    v->slotRow = slotRow;
 
-    eBase->eSt.rend = xRend;
-    rend = eBase->eSt.rend;
-
-    if (neuik__HighDPI_Scaling <= 1.0)
-    {
-        fltHspacingSc = (float)(grid->HSpacing);
-        fltVspacingSc = (float)(grid->VSpacing);
-    }
-    else
+    /*------------------------------------------------------------------------*/
+    /* This pointer array will be null terminated.                            */
+    /*------------------------------------------------------------------------*/
+    elems = (NEUIK_Element*)realloc(cBase->elems, 
+        (nNew+1)*sizeof(NEUIK_Element));
+    if (elems == NULL)
     {
-        fltHspacingSc = (float)(grid->HSpacing)*neuik__HighDPI_Scaling;
-        fltVspacingSc = (float)(grid->VSpacing)*neuik__HighDPI_Scaling;
+        eNum = 2;
+        goto out;
     }
+    cBase->elems = elems;
 
-    /*------------------------------------------------------------------------*/
-    /* Redraw the background surface before continuing.                       */
-    /*------------------------------------------------------------------------*/
-    if (!mock)
+    for (ctr = 0; ctr < nOld; ctr++)
     {
-        if (neuik_Element_GetCurrentBGStyle(gridElem, &bgStyle))
-        {
-            eNum = 7;
-            goto out;
-        }
-        if (bgStyle != NEUIK_BGSTYLE_TRANSPARENT)
+        if (v->slotCol[ctr] != NEUIK_GRIDLAYOUT_UNBOUND)
         {
-            /*----------------------------------------------------------------*/
-            /* Create a MaskMap an mark off the trasnparent pixels.           */
-            /*----------------------------------------------------------------*/
-            if (neuik_MakeMaskMap(&maskMap, rSize->w, rSize->h))
-            {
-                eNum = 10;
-                goto out;
-            }
-
-            rl = eBase->eSt.rLoc;
-            if (neuik_Window_FillTranspMaskFromLoc(
-                    eBase->eSt.window, maskMap, rl.x, rl.y))
-            {
-                eNum = 11;
-                goto out;
-            }
-
-            if (neuik_Element_RedrawBackground(gridElem, rlMod, maskMap))
-            {
-                eNum = 9;
-                goto out;
-            }
+            v->slotCol[ctr] = NEUIK_GRIDLAYOUT_STALE;
+            v->slotRow[ctr] = NEUIK_GRIDLAYOUT_STALE;
         }
     }
-    rl = eBase->eSt.rLoc;
-
-    if (cont->elems == NULL) {
-        /* there are no UI elements contained by this GridLayout */
-        goto out;
+    for (ctr = nOld; ctr < nNew; ctr++)
+    {
+        cBase->elems[ctr] = NULL;
+        v->slotCol[ctr]   = NEUIK_GRIDLAYOUT_UNBOUND;
+        v->slotRow[ctr]   = NEUIK_GRIDLAYOUT_UNBOUND;
     }
+    cBase->elems[nNew] = NULL;
 
-    /*------------------------------------------------------------------------*/
-    /* Allocate memory for the calculated maximum minimum values, the         */
-    /* VFill/HFill flags, and for the rendered row/column heights/widths.     */
-    /*------------------------------------------------------------------------*/
-    allMaxMinW = malloc(grid->xDim*sizeof(int));
-    if (allMaxMinW == NULL)
+    cBase->n_allocated = nNew;
+    cBase->n_used      = 0;
+    grid->xDim         = nSlotCols;
+    grid->yDim         = nSlotRows;
+out:
+    if (eNum > 0)
     {
-        eNum = 5;
-        goto out;
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
     }
-    allMaxMinH = malloc(grid->yDim*sizeof(int));
-    if (allMaxMinH == NULL)
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_GridLayout_IsCurrentSize                                            */
+/*                                                                            */
+/*  Check whether a heap entry of column (or row) `line` still matches the    */
+/*  measured size of its cell.                                                */
+/*                                                                            */
+/*  Returns: 1 if the entry is current; 0 otherwise.                          */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_GridLayout_IsCurrentSize(
+    neuik_GridLayoutVirtual         * v,
+    int                               isCol,
+    int                               line,
+    const neuik_GridLayoutSizeEntry * entry)
+{
+    if (isCol)
     {
-        eNum = 5;
-        goto out;
+        return v->cellSz[(size_t)(entry->ind)*(size_t)(v->nCols) + 
+            (size_t)line].w == entry->size;
     }
-    allHFill = malloc(grid->xDim*sizeof(int));
-    if (allHFill == NULL)
-    {
+    return v->cellSz[(size_t)line*(size_t)(v->nCols) + 
+        (size_t)(entry->ind)].h == entry->size;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Move the heap entry at `pos` down to its place.                            */
+/*----------------------------------------------------------------------------*/
+static void neuik_GridLayout_SiftDown(
+    neuik_GridLayoutSizeHeap * heap,
+    int                        pos)
+{
+    int                       child;
+    neuik_GridLayoutSizeEntry entry;
+
+    entry = heap->entries[pos];
+    for (;;)
+    {
+        child = 2*pos + 1;
+        if (child >= heap->nUsed) break;
+        if (child + 1 < heap->nUsed && 
+            heap->entries[child + 1].size > heap->entries[child].size)
+        {
+            child++;
+        }
+        if (heap->entries[child].size <= entry.size) break;
+
+        heap->entries[pos] = heap->entries[child];
+        pos = child;
+    }
+    heap->entries[pos] = entry;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Order heap entries by cell (and size), so that duplicates are adjacent.    */
+/*----------------------------------------------------------------------------*/
+static int neuik_GridLayout_CompareEntries(
+    const void * a,
+    const void * b)
+{
+    const neuik_GridLayoutSizeEntry * ea = (const neuik_GridLayoutSizeEntry*)a;
+    const neuik_GridLayoutSizeEntry * eb = (const neuik_GridLayoutSizeEntry*)b;
+
+    if (ea->ind != eb->ind) return (ea->ind < eb->ind) ? -1 : 1;
+    if (ea->size != eb->size) return (ea->size < eb->size) ? -1 : 1;
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_GridLayout_PushSize                                                 */
+/*                                                                            */
+/*  Add the measured size of a cell to the heap of its column (or row). When  */
+/*  the heap is full, its stale and duplicate entries are dropped first; it   */
+/*  is only grown if that doesn't free up at least half of it.                */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_GridLayout_PushSize(
+    neuik_GridLayoutVirtual  * v,
+    int                        isCol,
+    int                        line,
+    int                        size,
+    int                        ind)
+{
+    int                         ctr;
+    int                         nKept;
+    int                         nAlloc;
+    int                         pos;
+    int                         parent;
+    neuik_GridLayoutSizeEntry * entries;
+    neuik_GridLayoutSizeHeap  * heap;
+
+    heap = (isCol) ? &(v->colHeap[line]) : &(v->rowHeap[line]);
+
+    if (heap->nUsed == heap->nAlloc)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Drop the stale and duplicate entries; with the entries ordered by  */
+        /* cell, only the current entry of each cell is kept.                 */
+        /*--------------------------------------------------------------------*/
+        if (heap->nUsed > 0)
+        {
+            qsort(heap->entries, heap->nUsed, 
+                sizeof(neuik_GridLayoutSizeEntry), 
+                neuik_GridLayout_CompareEntries);
+        }
+        nKept = 0;
+        for (ctr = 0; ctr < heap->nUsed; ctr++)
+        {
+            if (!neuik_GridLayout_IsCurrentSize(
+                v, isCol, line, &(heap->entries[ctr]))) continue;
+            if (nKept > 0 && 
+                heap->entries[nKept-1].ind == heap->entries[ctr].ind) continue;
+
+            heap->entries[nKept++] = heap->entries[ctr];
+        }
+        heap->nUsed = nKept;
+        for (ctr = nKept/2 - 1; ctr >= 0; ctr--)
+        {
+            neuik_GridLayout_SiftDown(heap, ctr);
+        }
+
+        if (heap->nAlloc == 0 || heap->nUsed > heap->nAlloc/2)
+        {
+            nAlloc  = (heap->nAlloc > 0) ? 2*heap->nAlloc : 4;
+            entries = (neuik_GridLayoutSizeEntry*)realloc(heap->entries, 
+                nAlloc*sizeof(neuik_GridLayoutSizeEntry));
+            if (entries == NULL) return 1;
+            heap->entries = entries;
+            heap->nAlloc  = nAlloc;
+        }
+    }
+
+    pos = heap->nUsed++;
+    while (pos > 0)
+    {
+        parent = (pos - 1)/2;
+        if (heap->entries[parent].size >= size) break;
+
+        heap->entries[pos] = heap->entries[parent];
+        pos = parent;
+    }
+    heap->entries[pos].size = size;
+    heap->entries[pos].ind  = ind;
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_GridLayout_MaxSize                                                  */
+/*                                                                            */
+/*  Get the largest measured size within a column (or row); stale entries at  */
+/*  the top of its heap are dropped along the way.                            */
+/*                                                                            */
+/*  Returns: The largest size (0 if no cell has been measured).               */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_GridLayout_MaxSize(
+    neuik_GridLayoutVirtual  * v,
+    int                        isCol,
+    int                        line)
+{
+    neuik_GridLayoutSizeHeap * heap;
+
+    heap = (isCol) ? &(v->colHeap[line]) : &(v->rowHeap[line]);
+    while (heap->nUsed > 0 && 
+        !neuik_GridLayout_IsCurrentSize(v, isCol, line, &(heap->entries[0])))
+    {
+        heap->entries[0] = heap->entries[--(heap->nUsed)];
+        if (heap->nUsed > 0) neuik_GridLayout_SiftDown(heap, 0);
+    }
+
+    return (heap->nUsed > 0) ? heap->entries[0].size : 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Free the column and row heaps of a virtual GridLayout.                     */
+/*----------------------------------------------------------------------------*/
+static void neuik_GridLayout_FreeSizeHeaps(
+    neuik_GridLayoutVirtual * v)
+{
+    int ctr;
+
+    if (v->colHeap != NULL)
+    {
+        for (ctr = 0; ctr < v->nCols; ctr++) free(v->colHeap[ctr].entries);
+        free(v->colHeap);
+        v->colHeap = NULL;
+    }
+    if (v->rowHeap != NULL)
+    {
+        for (ctr = 0; ctr < v->nRows; ctr++) free(v->rowHeap[ctr].entries);
+        free(v->rowHeap);
+        v->rowHeap = NULL;
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_GridLayout_StoreCellSize                                            */
+/*                                                                            */
+/*  Store the measured size (incl. padding) of cell (col, row) of a virtual   */
+/*  GridLayout and update the cached column width and row height. The sizes  */
+/*  of each column and row are kept in a max-heap, so a cell which grows or   */
+/*  shrinks costs O(log n) (amortized) rather than a rescan of its column and */
+/*  row. A size of {-1, -1} forgets the measurement of the cell.              */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_GridLayout_StoreCellSize(
+    neuik_GridLayoutVirtual * v,
+    int                       col,
+    int                       row,
+    RenderSize                rs)
+{
+    int          maxW   = 0;
+    int          maxH   = 0;
+    RenderSize   rsOld;
+    RenderSize * cellRs = NULL;
+
+    cellRs = &(v->cellSz[(size_t)row*(size_t)(v->nCols) + (size_t)col]);
+    rsOld   = *cellRs;
+    *cellRs = rs;
+
+    if (rs.w != rsOld.w)
+    {
+        if (rs.w > 0 && neuik_GridLayout_PushSize(v, 1, col, rs.w, row))
+        {
+            return 1;
+        }
+        maxW = neuik_GridLayout_MaxSize(v, 1, col);
+        if (maxW != v->colW[col])
+        {
+            v->colW[col]      = maxW;
+            v->metricsChanged = 1;
+        }
+    }
+
+    if (rs.h != rsOld.h)
+    {
+        if (rs.h > 0 && neuik_GridLayout_PushSize(v, 0, row, rs.h, col))
+        {
+            return 1;
+        }
+        maxH = neuik_GridLayout_MaxSize(v, 0, row);
+        if (maxH != v->rowH[row])
+        {
+            v->rowH[row]      = maxH;
+            v->metricsChanged = 1;
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Columns/rows which were not measured yet are assumed to be as large as */
+    /* the largest one seen so far.                                           */
+    /*------------------------------------------------------------------------*/
+    if (v->colW[col] > v->estW) v->estW = v->colW[col];
+    if (v->rowH[row] > v->estH) v->estH = v->rowH[row];
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_GridLayout_CountShown                                               */
+/*                                                                            */
+/*  Count the columns (or rows) starting from `first` which fit (entirely)    */
+/*  within `avail` pixels; at least one is always shown. Only the columns     */
+/*  which fit are visited.                                                    */
+/*                                                                            */
+/*  Returns: The number of shown columns (or rows).                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_GridLayout_CountShown(
+    int   * sizes,
+    int     first,
+    int     n,
+    int     est,
+    int     avail,
+    float   spacing)
+{
+    int   ctr    = 0;
+    int   size   = 0;
+    int   nShown = 0;
+    float used   = 0.0;
+
+    for (ctr = first; ctr < n; ctr++)
+    {
+        size = sizes[ctr];
+        if (size <= 0) size = est;
+        if (size <= 0) break; /* nothing measured yet */
+
+        if (nShown > 0) used += spacing;
+        used += (float)(size);
+        if (used > (float)(avail)) break;
+        nShown++;
+    }
+    if (nShown < 1) nShown = 1;
+
+    return nShown;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_GridLayout_BindVirtualCells                                         */
+/*                                                                            */
+/*  Make sure that the shown cells of a virtual GridLayout (and the overscan  */
+/*  cells around them) are bound into the recycled cells. Only slots which    */
+/*  change the cell they hold are rebound; slots which do not hold a shown    */
+/*  cell are hidden.                                                          */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_GridLayout_BindVirtualCells(
+    NEUIK_GridLayout * grid)
+{
+    int                       slot       = 0;
+    int                       nSlots     = 0;
+    int                       xDim       = 0;
+    int                       yDim       = 0;
+    int                       col        = 0;
+    int                       row        = 0;
+    int                       firstCol   = 0; /* first bound column */
+    int                       lastCol    = 0; /* one past the last bound column */
+    int                       firstRow   = 0; /* first bound row */
+    int                       lastRow    = 0; /* one past the last bound row */
+    int                       nNeedCols  = 0; /* number of slot columns needed */
+    int                       nNeedRows  = 0; /* number of slot rows needed */
+    int                       eNum       = 0; /* which error to report (if any) */
+    NEUIK_Element             elem       = NULL;
+    NEUIK_ElementBase       * eBase      = NULL;
+    NEUIK_ElementConfig     * eCfg       = NULL;
+    NEUIK_Container         * cBase      = NULL;
+    neuik_GridLayoutVirtual * v          = NULL;
+    static char               funcName[] = "neuik_GridLayout_BindVirtualCells";
+    static char             * errMsgs[]  = {"",                          // [0] no error
+        "Argument `grid` caused `neuik_Object_GetClassObject` to fail.", // [1]
+        "Failure in `neuik_GridLayout_AddVirtualSlots()`.",              // [2]
+        "Element_GetConfig returned NULL.",                              // [3]
+        "The cell bind function reported an error.",                     // [4]
+        "The cell bind function did not provide a cell element.",        // [5]
+    };
+
+    v = (neuik_GridLayoutVirtual*)(grid->virt);
+    if (neuik_Object_GetClassObject(grid, neuik__Class_Container, (void**)&cBase))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(grid, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    if (v->nShownCols < 1) v->nShownCols = 1;
+    if (v->nShownRows < 1) v->nShownRows = 1;
+    if (v->leftCol > v->nCols - v->nShownCols) v->leftCol = v->nCols - v->nShownCols;
+    if (v->leftCol < 0)                        v->leftCol = 0;
+    if (v->topRow > v->nRows - v->nShownRows)  v->topRow = v->nRows - v->nShownRows;
+    if (v->topRow < 0)                         v->topRow = 0;
+
+    nNeedCols = v->nShownCols + 2*NEUIK_GRIDLAYOUT_OVERSCAN;
+    if (nNeedCols > v->nCols) nNeedCols = v->nCols;
+    nNeedRows = v->nShownRows + 2*NEUIK_GRIDLAYOUT_OVERSCAN;
+    if (nNeedRows > v->nRows) nNeedRows = v->nRows;
+    if (neuik_GridLayout_AddVirtualSlots(grid, nNeedCols, nNeedRows))
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    xDim   = grid->xDim;
+    yDim   = grid->yDim;
+    nSlots = xDim*yDim;
+    if (nSlots == 0) goto out;
+
+    firstCol = v->leftCol - NEUIK_GRIDLAYOUT_OVERSCAN;
+    if (firstCol < 0) firstCol = 0;
+    lastCol = v->leftCol + v->nShownCols + NEUIK_GRIDLAYOUT_OVERSCAN;
+    if (lastCol > v->nCols) lastCol = v->nCols;
+    firstRow = v->topRow - NEUIK_GRIDLAYOUT_OVERSCAN;
+    if (firstRow < 0) firstRow = 0;
+    lastRow = v->topRow + v->nShownRows + NEUIK_GRIDLAYOUT_OVERSCAN;
+    if (lastRow > v->nRows) lastRow = v->nRows;
+
+    for (slot = 0; slot < nSlots; slot++)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The (only) cell within the bound window which maps to this slot.   */
+        /*--------------------------------------------------------------------*/
+        col  = firstCol + ((slot%xDim - firstCol%xDim) + xDim) % xDim;
+        row  = firstRow + ((slot/xDim - firstRow%yDim) + yDim) % yDim;
+        elem = cBase->elems[slot];
+
+        if (col >= lastCol || row >= lastRow)
+        {
+            if (elem == NULL) continue;
+
+            eCfg = neuik_Element_GetConfig(elem);
+            if (eCfg == NULL)
+            {
+                eNum = 3;
+                goto out;
+            }
+            eCfg->Show = 0;
+            continue;
+        }
+
+        if (v->slotCol[slot] != col || v->slotRow[slot] != row)
+        {
+            if ((*v->bindFn)(&(cBase->elems[slot]), col, row, v->bindArg))
+            {
+                eNum = 4;
+                goto out;
+            }
+            if (cBase->elems[slot] != elem)
+            {
+                /*------------------------------------------------------------*/
+                /* The bind function created (or replaced) the cell element.  */
+                /*------------------------------------------------------------*/
+                elem = cBase->elems[slot];
+                if (!neuik_Object_ImplementsClass(elem, neuik__Class_Element))
+                {
+                    cBase->elems[slot] = NULL;
+                    eNum = 5;
+                    goto out;
+                }
+                if (eBase->eSt.window != NULL)
+                {
+                    neuik_Element_SetWindowPointer(elem, eBase->eSt.window);
+                }
+                neuik_Element_SetParentPointer(elem, grid);
+            }
+            v->slotCol[slot] = col;
+            v->slotRow[slot] = row;
+        }
+
+        eCfg = neuik_Element_GetConfig(elem);
+        if (eCfg == NULL)
+        {
+            eNum = 3;
+            goto out;
+        }
+        eCfg->Show = (col >= v->leftCol && col < v->leftCol + v->nShownCols && 
+            row >= v->topRow && row < v->topRow + v->nShownRows);
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_GridLayout_ScrollVirtual                                            */
+/*                                                                            */
+/*  Scroll a virtual GridLayout so that (leftCol, topRow) is the first shown  */
+/*  cell.                                                                     */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_GridLayout_ScrollVirtual(
+    NEUIK_GridLayout * grid,
+    int                leftCol,
+    int                topRow)
+{
+    int                       oldCol     = 0;
+    int                       oldRow     = 0;
+    int                       eNum       = 0; /* which error to report (if any) */
+    neuik_GridLayoutVirtual * v          = NULL;
+    static char               funcName[] = "neuik_GridLayout_ScrollVirtual";
+    static char             * errMsgs[]  = {"",                // [0] no error
+        "Failure in `neuik_GridLayout_BindVirtualCells()`.",   // [1]
+        "Failure in `neuik_Container_RequestFullRedraw()`.",   // [2]
+    };
+
+    v = (neuik_GridLayoutVirtual*)(grid->virt);
+    oldCol = v->leftCol;
+    oldRow = v->topRow;
+
+    v->leftCol = leftCol;
+    v->topRow  = topRow;
+    if (neuik_GridLayout_BindVirtualCells(grid))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (v->leftCol == oldCol && v->topRow == oldRow) goto out;
+
+    /*------------------------------------------------------------------------*/
+    /* Every shown cell moves; redraw the whole GridLayout.                   */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Container_RequestFullRedraw(grid))
+    {
+        eNum = 2;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_GridLayout_RenderVirtualCells                                       */
+/*                                                                            */
+/*  Lay out and render the shown cells of a virtual GridLayout. The shown     */
+/*  cells are measured (which keeps the cached column widths and row heights  */
+/*  up to date) and placed using the cached metrics, so the work done here    */
+/*  depends only on the number of cells which fit in the GridLayout.          */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_GridLayout_RenderVirtualCells(
+    NEUIK_GridLayout * grid,
+    RenderSize       * rSize,
+    RenderLoc        * rlMod,
+    SDL_Renderer     * rend,
+    int                mock,
+    float              hSpacing,
+    float              vSpacing)
+{
+    int                       slot       = 0;
+    int                       nSlots     = 0;
+    int                       pass       = 0;
+    int                       col        = 0;
+    int                       row        = 0;
+    int                       cellW      = 0;
+    int                       cellH      = 0;
+    int                       nFitCols   = 0;
+    int                       nFitRows   = 0;
+    int                       eNum       = 0; /* which error to report (if any) */
+    float                     xPos       = 0.0;
+    float                     yPos       = 0.0;
+    RenderSize                rs         = {0, 0};
+    RenderLoc                 rl         = {0, 0};
+    RenderLoc                 rlRel      = {0, 0};
+    SDL_Rect                  rect       = {0, 0, 0, 0};
+    enum neuik_HJustify       hJustify;
+    enum neuik_VJustify       vJustify;
+    NEUIK_Element             elem       = NULL;
+    NEUIK_ElementConfig     * eCfg       = NULL;
+    NEUIK_ElementBase       * eBase      = NULL;
+    NEUIK_Container         * cBase      = NULL;
+    neuik_GridLayoutVirtual * v          = NULL;
+    static char               funcName[] = "neuik_GridLayout_RenderVirtualCells";
+    static char             * errMsgs[]  = {"",                          // [0] no error
+        "Argument `grid` caused `neuik_Object_GetClassObject` to fail.", // [1]
+        "Failure in `neuik_GridLayout_BindVirtualCells()`.",             // [2]
+        "Element_GetConfig returned NULL.",                              // [3]
+        "Element_GetMinSize Failed.",                                    // [4]
+        "Failure in `neuik_Element_Render()`",                           // [5]
+        "Failure in `neuik_GridLayout_StoreCellSize()`.",                // [6]
+    };
+
+    v = (neuik_GridLayoutVirtual*)(grid->virt);
+    if (neuik_Object_GetClassObject(grid, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(grid, neuik__Class_Container, (void**)&cBase))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Bind the cells which fit and measure them; should this change the      */
+    /* number of columns or rows which fit, the cells are rebound. Unmeasured */
+    /* columns/rows are estimated from the measured ones so this settles fast.*/
+    /*------------------------------------------------------------------------*/
+    nFitCols = neuik_GridLayout_CountShown(v->colW, v->leftCol, v->nCols, 
+        v->estW, rSize->w, hSpacing);
+    nFitRows = neuik_GridLayout_CountShown(v->rowH, v->topRow, v->nRows, 
+        v->estH, rSize->h, vSpacing);
+    for (pass = 0; pass < 3; pass++)
+    {
+        v->nShownCols = nFitCols;
+        v->nShownRows = nFitRows;
+        if (neuik_GridLayout_BindVirtualCells(grid))
+        {
+            eNum = 2;
+            goto out;
+        }
+
+        nSlots = grid->xDim*grid->yDim;
+        for (slot = 0; slot < nSlots; slot++)
+        {
+            elem = cBase->elems[slot];
+            if (elem == NULL) continue;
+            if (!NEUIK_Element_IsShown(elem)) continue;
+
+            eCfg = neuik_Element_GetConfig(elem);
+            if (eCfg == NULL)
+            {
+                eNum = 3;
+                goto out;
+            }
+            if (neuik_Element_GetMinSize(elem, &rs))
+            {
+                eNum = 4;
+                goto out;
+            }
+            rs.w += eCfg->PadLeft + eCfg->PadRight;
+            rs.h += eCfg->PadTop + eCfg->PadBottom;
+            if (neuik_GridLayout_StoreCellSize(v, 
+                v->slotCol[slot], v->slotRow[slot], rs))
+            {
+                eNum = 6;
+                goto out;
+            }
+        }
+
+        nFitCols = neuik_GridLayout_CountShown(v->colW, v->leftCol, v->nCols, 
+            v->estW, rSize->w, hSpacing);
+        nFitRows = neuik_GridLayout_CountShown(v->rowH, v->topRow, v->nRows, 
+            v->estH, rSize->h, vSpacing);
+        if (nFitCols == v->nShownCols && nFitRows == v->nShownRows) break;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* If a column width or row height changed, the shown cells move.         */
+    /*------------------------------------------------------------------------*/
+    if (v->metricsChanged && !mock)
+    {
+        cBase->redrawAll  = 1;
+        v->metricsChanged = 0;
+    }
+
+    if (grid->xDim == 0 || grid->yDim == 0) goto out;
+
+    /*------------------------------------------------------------------------*/
+    /* Render and place the shown cells.                                      */
+    /*------------------------------------------------------------------------*/
+    yPos = 0.0;
+    for (row = v->topRow; row < v->topRow + v->nShownRows; row++)
+    {
+        if (row >= v->nRows) break;
+        if (row > v->topRow)
+        {
+            yPos += (float)(cellH) + vSpacing;
+        }
+        cellH = v->rowH[row];
+        if (cellH <= 0) cellH = v->estH;
+
+        xPos = 0.0;
+        for (col = v->leftCol; col < v->leftCol + v->nShownCols; col++)
+        {
+            if (col >= v->nCols) break;
+            if (col > v->leftCol)
+            {
+                xPos += (float)(cellW) + hSpacing;
+            }
+            cellW = v->colW[col];
+            if (cellW <= 0) cellW = v->estW;
+
+            slot = (col % grid->xDim) + (row % grid->yDim)*(grid->xDim);
+            if (v->slotCol[slot] != col || v->slotRow[slot] != row) continue;
+
+            elem = cBase->elems[slot];
+            if (elem == NULL) continue;
+            if (!NEUIK_Element_IsShown(elem)) continue;
+            if (!neuik_Element_NeedsRedraw(elem)) continue;
+
+            eCfg = neuik_Element_GetConfig(elem);
+            if (eCfg == NULL)
+            {
+                eNum = 3;
+                goto out;
+            }
+            if (neuik_Element_GetMinSize(elem, &rs))
+            {
+                eNum = 4;
+                goto out;
+            }
+
+            if (eCfg->HFill)
+            {
+                rs.w = cellW - (eCfg->PadLeft + eCfg->PadRight);
+            }
+            if (eCfg->VFill)
+            {
+                rs.h = cellH - (eCfg->PadTop + eCfg->PadBottom);
+            }
+
+            hJustify = eCfg->HJustify;
+            if (hJustify == NEUIK_HJUSTIFY_DEFAULT) hJustify = cBase->HJustify;
+            vJustify = eCfg->VJustify;
+            if (vJustify == NEUIK_VJUSTIFY_DEFAULT) vJustify = cBase->VJustify;
+
+            rect.x = (int)(xPos);
+            switch (hJustify)
+            {
+                case NEUIK_HJUSTIFY_LEFT:
+                    rect.x += eCfg->PadLeft;
+                    break;
+                case NEUIK_HJUSTIFY_RIGHT:
+                    rect.x += cellW - (rs.w + eCfg->PadRight);
+                    break;
+                default:
+                    rect.x += (cellW - rs.w)/2;
+                    break;
+            }
+
+            rect.y = (int)(yPos);
+            switch (vJustify)
+            {
+                case NEUIK_VJUSTIFY_TOP:
+                    rect.y += eCfg->PadTop;
+                    break;
+                case NEUIK_VJUSTIFY_BOTTOM:
+                    rect.y += cellH - (rs.h + eCfg->PadBottom);
+                    break;
+                default:
+                    rect.y += (cellH - rs.h)/2;
+                    break;
+            }
+
+            rl.x = (eBase->eSt.rLoc).x + rect.x;
+            rl.y = (eBase->eSt.rLoc).y + rect.y;
+            rlRel.x = rect.x;
+            rlRel.y = rect.y;
+            neuik_Element_StoreSizeAndLocation(elem, rs, rl, rlRel);
+
+            if (neuik_Element_Render(elem, &rs, rlMod, rend, mock))
+            {
+                eNum = 5;
+                goto out;
+            }
+        }
+    }
+out:
+    if (cBase != NULL)
+    {
+        if (!mock) cBase->redrawAll = 0;
+    }
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_Render__GridLayout
+ *
+ *  Description:   Renders a single button as an SDL_Texture*.
+ *
+ *  Returns:       NULL if there is a problem, otherwise a valid SDL_Texture*.
+ *
+ ******************************************************************************/
+int neuik_Element_Render__GridLayout(
+    NEUIK_Element   gridElem,
+    RenderSize    * rSize,    /* in/out the size the tex occupies when complete */
+    RenderLoc     * rlMod,    /* A relative location modifier (for rendering) */
+    SDL_Renderer  * xRend,    /* the external renderer to prepare the texture for */
+    int             mock)     /* If true; calculate sizes/locations but don't draw */
+{
+    int                    nAlloc        = 0;
+    int                    tempH         = 0;
+    int                    tempW         = 0;
+    int                    rowCtr        = 0;
+    int                    colCtr        = 0;
+    int                    offset        = 0;
+    int                    ctr           = 0;
+    int                    squarePadH    = 0; // px of height lost to keep aspect
+    int                    squarePadW    = 0; // px of width lost to keep aspect
+    int                    xFree         = 0; // px of space free for hFill elems
+    int                    yFree         = 0; // px of space free for vFill elems
+    int                    dH            = 0; // Change in height [px]
+    int                    dW            = 0; // Change in width [px]
+    int                    eNum          = 0; // which error to report (if any)
+    int                    nHFill        = 0; // number of cols which can HFill
+    int                    nVFill        = 0; // number of rows which can VFill
+    int                    reqResizeH    = 0; // required resize height
+    int                    reqResizeW    = 0; // required resize width
+    int                    hfillColsMinW = 0; // min width for all hFill cols
+    int                    hfillMaxMinW  = 0; // largest minimum col width 
+    int                    vfillRowsMinH = 0; // min height for all vFill rows
+    int                    vfillMaxMinH  = 0; // largest minimum row height 
+                                              // among vertically filling rows.
+    int                    maxSideLen    = 0; // Maximum side length (square-elems)
+    float                  xPos          = 0.0;
+    float                  yPos          = 0.0;
+    float                  fltHspacingSc = 0.0;  // float VSpacing HighDPI scaled
+    float                  fltVspacingSc = 0.0;  // float VSpacing HighDPI scaled
+    int                  * allHFill      = NULL; // Free upon returning; 
+                                                 // Cols fills vertically? (per col)
+    int                  * allVFill      = NULL; // Free upon returning; 
+                                                 // Row fills vertically? (per row)
+    int                  * allMaxMinH    = NULL; // Free upon returning; 
+                                                 // The max min width (per row)
+    int                  * allMaxMinW    = NULL; // Free upon returning; 
+                                                 // The max min width (per column)
+    int                  * rendColW      = NULL; // Free upon returning; 
+                                                 // Rendered col width (per column)
+    int                  * rendRowH      = NULL; // Free upon returning; 
+                                                 // Rendered row height (per row)
+    int                  * elemsValid    = NULL; // Free upon returning.
+    int                  * elemsShown    = NULL; // Free upon returning.
+    RenderSize           * elemsMinSz    = NULL; // Free upon returning.
+    NEUIK_ElementConfig ** elemsCfg      = NULL; // Free upon returning.
+    RenderLoc              rl;
+    RenderLoc              rlRel         = {0, 0}; /* renderloc relative to parent */
+    SDL_Rect               rect          = {0, 0, 0, 0};
+    static RenderSize      rsZero        = {0, 0};
+    RenderSize             rsMin         = {0, 0};
+    RenderSize           * rs            = NULL;
+    SDL_Renderer         * rend          = NULL;
+    NEUIK_Container      * cont          = NULL;
+    NEUIK_ElementBase    * eBase         = NULL;
+    NEUIK_Element          elem          = NULL;
+    NEUIK_ElementConfig  * eCfg          = NULL;
+    NEUIK_GridLayout     * grid          = NULL;
+    neuik_MaskMap        * maskMap       = NULL; /* FREE upon return */
+    enum neuik_bgstyle     bgStyle;
+    static char            funcName[]    = "neuik_Element_Render__GridLayout";
+    static char          * errMsgs[]     = {"", // [0] no error
+        "Argument `gridElem` is not of GridLayout class.",                   // [1]
+        "Failure in `neuik_Element_Render()`",                               // [2]
+        "Element_GetConfig returned NULL.",                                  // [3]
+        "Element_GetMinSize Failed.",                                        // [4]
+        "Failure to allocate memory.",                                       // [5]
+        "Invalid specified `rSize` (negative values).",                      // [6]
+        "Failure in `neuik_Element_GetCurrentBGStyle()`.",                   // [7]
+        "Argument `gridElem` caused `neuik_Object_GetClassObject` to fail.", // [8]
+        "Failure in neuik_Element_RedrawBackground().",                      // [9]
+        "Failure in `neuik_MakeMaskMap()`",                                  // [10]
+        "Failure in `neuik_Window_FillTranspMaskFromLoc()`",                 // [11]
+        "Failure in `neuik_GridLayout_RenderVirtualCells()`",                // [12]
+    };
+
+    if (!neuik_Object_IsClass(gridElem, neuik__Class_GridLayout))
+    {
+        eNum = 1;
+        goto out;
+    }
+    grid = (NEUIK_GridLayout*)gridElem;
+
+    if (neuik_Object_GetClassObject(gridElem, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 8;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(gridElem, neuik__Class_Container, (void**)&cont))
+    {
+        eNum = 8;
+        goto out;
+    }
+
+    if (rSize->w < 0 || rSize->h < 0)
+    {
+        eNum = 6;
+        goto out;
+    }
+
+    eBase->eSt.rend = xRend;
+    rend = eBase->eSt.rend;
+
+    if (neuik__HighDPI_Scaling <= 1.0)
+    {
+        fltHspacingSc = (float)(grid->HSpacing);
+        fltVspacingSc = (float)(grid->VSpacing);
+    }
+    else
+    {
+        fltHspacingSc = (float)(grid->HSpacing)*neuik__HighDPI_Scaling;
+        fltVspacingSc = (float)(grid->VSpacing)*neuik__HighDPI_Scaling;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Redraw the background surface before continuing.                       */
+    /*------------------------------------------------------------------------*/
+    if (!mock)
+    {
+        if (neuik_Element_GetCurrentBGStyle(gridElem, &bgStyle))
+        {
+            eNum = 7;
+            goto out;
+        }
+        if (bgStyle != NEUIK_BGSTYLE_TRANSPARENT)
+        {
+            /*----------------------------------------------------------------*/
+            /* Create a MaskMap an mark off the trasnparent pixels.           */
+            /*----------------------------------------------------------------*/
+            if (neuik_MakeMaskMap(&maskMap, rSize->w, rSize->h))
+            {
+                eNum = 10;
+                goto out;
+            }
+
+            rl = eBase->eSt.rLoc;
+            if (neuik_Window_FillTranspMaskFromLoc(
+                    eBase->eSt.window, maskMap, rl.x, rl.y))
+            {
+                eNum = 11;
+                goto out;
+            }
+
+            if (neuik_Element_RedrawBackground(gridElem, rlMod, maskMap))
+            {
+                eNum = 9;
+                goto out;
+            }
+        }
+    }
+    rl = eBase->eSt.rLoc;
+
+    if (grid->virt != NULL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Virtual GridLayouts only lay out the cells which fit.              */
+        /*--------------------------------------------------------------------*/
+        if (neuik_GridLayout_RenderVirtualCells(grid, rSize, rlMod, rend, mock,
+            fltHspacingSc, fltVspacingSc))
+        {
+            eNum = 12;
+            goto out;
+        }
+        goto out;
+    }
+
+    if (cont->elems == NULL) {
+        /* there are no UI elements contained by this GridLayout */
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Allocate memory for the calculated maximum minimum values, the         */
+    /* VFill/HFill flags, and for the rendered row/column heights/widths.     */
+    /*------------------------------------------------------------------------*/
+    allMaxMinW = malloc(grid->xDim*sizeof(int));
+    if (allMaxMinW == NULL)
+    {
+        eNum = 5;
+        goto out;
+    }
+    allMaxMinH = malloc(grid->yDim*sizeof(int));
+    if (allMaxMinH == NULL)
+    {
+        eNum = 5;
+        goto out;
+    }
+    allHFill = malloc(grid->xDim*sizeof(int));
+    if (allHFill == NULL)
+    {
         eNum = 5;
         goto out;
     }
@@ -2419,12 +3483,16 @@ neuik_EventState neuik_Element_CaptureEvent__GridLayout(
     NEUIK_Element   gridElem, 
     SDL_Event     * ev)
 {
-    int                ctr        = 0;
-    int                finalInd   = 0;
-    neuik_EventState   evCaputred = NEUIK_EVENTSTATE_NOT_CAPTURED;
-    NEUIK_Element      elem       = NULL;
-    NEUIK_Container  * cBase      = NULL;
-    NEUIK_GridLayout * grid       = NULL;
+    int                       ctr        = 0;
+    int                       finalInd   = 0;
+    neuik_EventState          evCaputred = NEUIK_EVENTSTATE_NOT_CAPTURED;
+    NEUIK_Element             elem       = NULL;
+    NEUIK_ElementBase       * eBase      = NULL;
+    NEUIK_Container         * cBase      = NULL;
+    NEUIK_GridLayout        * grid       = NULL;
+    SDL_MouseMotionEvent    * mouseMotEv = NULL;
+    SDL_MouseWheelEvent     * mWheelEv   = NULL;
+    neuik_GridLayoutVirtual * v          = NULL;
 
     if (neuik_Object_GetClassObject_NoError(
         gridElem, neuik__Class_GridLayout, (void**)&grid)) goto out;
@@ -2432,6 +3500,14 @@ neuik_EventState neuik_Element_CaptureEvent__GridLayout(
     if (neuik_Object_GetClassObject_NoError(
         gridElem, neuik__Class_Container, (void**)&cBase)) goto out;
 
+    if (grid->virt != NULL && ev->type == SDL_MOUSEMOTION)
+    {
+        v = (neuik_GridLayoutVirtual*)(grid->virt);
+        mouseMotEv = (SDL_MouseMotionEvent*)(ev);
+        v->lastMouseX = mouseMotEv->x;
+        v->lastMouseY = mouseMotEv->y;
+    }
+
     if (cBase->elems != NULL)
     {
         finalInd = grid->xDim * grid->yDim;
@@ -2459,6 +3535,28 @@ neuik_EventState neuik_Element_CaptureEvent__GridLayout(
             }
         }
     }
+
+    if (grid->virt != NULL && ev->type == SDL_MOUSEWHEEL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Scroll a virtual GridLayout if the mouse is over it.               */
+        /*--------------------------------------------------------------------*/
+        if (neuik_Object_GetClassObject_NoError(
+            gridElem, neuik__Class_Element, (void**)&eBase)) goto out;
+
+        v = (neuik_GridLayoutVirtual*)(grid->virt);
+        mWheelEv = (SDL_MouseWheelEvent*)(ev);
+        if (v->lastMouseY >= eBase->eSt.rLoc.y && 
+            v->lastMouseY <= eBase->eSt.rLoc.y + eBase->eSt.rSize.h &&
+            v->lastMouseX >= eBase->eSt.rLoc.x && 
+            v->lastMouseX <= eBase->eSt.rLoc.x + eBase->eSt.rSize.w)
+        {
+            neuik_GridLayout_ScrollVirtual(grid, 
+                v->leftCol + mWheelEv->x*NEUIK_GRIDLAYOUT_WHEELCELLS,
+                v->topRow  - mWheelEv->y*NEUIK_GRIDLAYOUT_WHEELCELLS);
+            evCaputred = NEUIK_EVENTSTATE_CAPTURED;
+        }
+    }
 out:
     return evCaputred;
 }
@@ -2563,3 +3661,471 @@ out:
 
     return eNum;
 }
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_GridLayout_SetVirtual
+ *
+ *  Description:   Make this a virtual GridLayout of `nCols` by `nRows` cells.
+ *                 Instead of holding an element for every cell, the GridLayout
+ *                 keeps a small grid of recycled cells (enough for the cells 
+ *                 which fit plus a few cells of overscan) and calls `bindFn` 
+ *                 to bind the contents of cell (col, row) into a recycled 
+ *                 cell. If `*cell` is NULL, `bindFn` must create the cell 
+ *                 element; later binds should only update its contents.
+ *
+ *                 Column widths and row heights are cached from the cells 
+ *                 which have been shown so far; columns and rows which have 
+ *                 not been shown yet are assumed to be as large as the largest
+ *                 one seen. The cells of a virtual GridLayout are not squared.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_GridLayout_SetVirtual(
+    NEUIK_GridLayout * grid,
+    int                nCols,
+    int                nRows,
+    int             (* bindFn)(NEUIK_Element *, int, int, void *),
+    void             * bindArg)
+{
+    int                       eNum       = 0; /* which error to report (if any) */
+    neuik_GridLayoutVirtual * v          = NULL;
+    static char               funcName[] = "NEUIK_GridLayout_SetVirtual";
+    static char             * errMsgs[]  = {"",                // [0] no error
+        "Argument `grid` is not of GridLayout class.",         // [1]
+        "Argument `nCols` or `nRows` is negative.",            // [2]
+        "Argument `bindFn` is NULL.",                          // [3]
+        "GridLayout already has (non-virtual) dimensions.",    // [4]
+        "Failure to allocate memory.",                         // [5]
+        "Failure in `NEUIK_GridLayout_SetVirtualCount()`.",    // [6]
+    };
+
+    if (!neuik_Object_IsClass(grid, neuik__Class_GridLayout))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (nCols < 0 || nRows < 0)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (bindFn == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    if (grid->virt == NULL)
+    {
+        if (grid->xDim*grid->yDim > 0)
+        {
+            eNum = 4;
+            goto out;
+        }
+
+        v = (neuik_GridLayoutVirtual*)malloc(sizeof(neuik_GridLayoutVirtual));
+        if (v == NULL)
+        {
+            eNum = 5;
+            goto out;
+        }
+        v->nCols          = 0;
+        v->nRows          = 0;
+        v->leftCol        = 0;
+        v->topRow         = 0;
+        v->nShownCols     = 0;
+        v->nShownRows     = 0;
+        v->colW           = NULL;
+        v->rowH           = NULL;
+        v->colHeap        = NULL;
+        v->rowHeap        = NULL;
+        v->cellSz         = NULL;
+        v->estW           = 0;
+        v->estH           = 0;
+        v->metricsChanged = 0;
+        v->slotCol        = NULL;
+        v->slotRow        = NULL;
+        v->lastMouseX     = 0;
+        v->lastMouseY     = 0;
+        grid->virt = v;
+    }
+    v = (neuik_GridLayoutVirtual*)(grid->virt);
+    v->bindFn  = bindFn;
+    v->bindArg = bindArg;
+
+    if (NEUIK_GridLayout_SetVirtualCount(grid, nCols, nRows))
+    {
+        eNum = 6;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_GridLayout_SetVirtualCount
+ *
+ *  Description:   Set the number of columns and rows of a virtual GridLayout.
+ *                 The cells which are currently bound are rebound and the 
+ *                 cached column widths and row heights are dropped; so this 
+ *                 is also the way to tell the GridLayout that the contents of
+ *                 many cells changed (see `NEUIK_GridLayout_UpdateCell()` for
+ *                 a single cell).
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_GridLayout_SetVirtualCount(
+    NEUIK_GridLayout * grid,
+    int                nCols,
+    int                nRows)
+{
+    int                       ctr        = 0;
+    size_t                    cellCtr    = 0;
+    size_t                    nCells     = 0;
+    int                     * colW       = NULL;
+    int                     * rowH       = NULL;
+    RenderSize              * cellSz     = NULL;
+    neuik_GridLayoutVirtual * v          = NULL;
+    int                       eNum       = 0; /* which error to report (if any) */
+    static char               funcName[] = "NEUIK_GridLayout_SetVirtualCount";
+    static char             * errMsgs[]  = {"",                // [0] no error
+        "Argument `grid` is not of GridLayout class.",         // [1]
+        "Argument `grid` is not a virtual GridLayout.",        // [2]
+        "Argument `nCols` or `nRows` is negative.",            // [3]
+        "Failure to reallocate memory.",                       // [4]
+        "Failure in `neuik_GridLayout_BindVirtualCells()`.",   // [5]
+        "Failure in `neuik_Container_RequestFullRedraw()`.",   // [6]
+        "Argument `nCols` times `nRows` is too large.",        // [7]
+    };
+
+    if (!neuik_Object_IsClass(grid, neuik__Class_GridLayout))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (grid->virt == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (nCols < 0 || nRows < 0)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (nCols > 0 && 
+        (size_t)nRows > (SIZE_MAX/sizeof(RenderSize) - 1)/(size_t)nCols)
+    {
+        eNum = 7;
+        goto out;
+    }
+    v = (neuik_GridLayoutVirtual*)(grid->virt);
+
+    /*------------------------------------------------------------------------*/
+    /* (Re)allocate the cached metrics; at least one entry is always kept so  */
+    /* that an empty GridLayout never reallocates to a size of zero.          */
+    /*------------------------------------------------------------------------*/
+    nCells = (size_t)nCols*(size_t)nRows;
+    colW = (int*)realloc(v->colW, ((size_t)nCols+1)*sizeof(int));
+    if (colW == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
+    v->colW = colW;
+
+    rowH = (int*)realloc(v->rowH, ((size_t)nRows+1)*sizeof(int));
+    if (rowH == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
+    v->rowH = rowH;
+
+    cellSz = (RenderSize*)realloc(v->cellSz, (nCells+1)*sizeof(RenderSize));
+    if (cellSz == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
+    v->cellSz = cellSz;
+
+    neuik_GridLayout_FreeSizeHeaps(v);
+    v->colHeap = (neuik_GridLayoutSizeHeap*)calloc((size_t)nCols+1, 
+        sizeof(neuik_GridLayoutSizeHeap));
+    v->rowHeap = (neuik_GridLayoutSizeHeap*)calloc((size_t)nRows+1, 
+        sizeof(neuik_GridLayoutSizeHeap));
+    if (v->colHeap == NULL || v->rowHeap == NULL)
+    {
+        free(v->colHeap);
+        free(v->rowHeap);
+        v->colHeap = NULL;
+        v->rowHeap = NULL;
+        v->nCols   = 0;
+        v->nRows   = 0;
+        eNum = 4;
+        goto out;
+    }
+
+    for (ctr = 0; ctr < nCols; ctr++)
+    {
+        v->colW[ctr] = 0;
+    }
+    for (ctr = 0; ctr < nRows; ctr++)
+    {
+        v->rowH[ctr] = 0;
+    }
+    for (cellCtr = 0; cellCtr < nCells; cellCtr++)
+    {
+        v->cellSz[cellCtr].w = -1;
+        v->cellSz[cellCtr].h = -1;
+    }
+    v->nCols          = nCols;
+    v->nRows          = nRows;
+    v->metricsChanged = 1;
+
+    for (ctr = 0; ctr < (int)(grid->xDim*grid->yDim); ctr++)
+    {
+        if (v->slotCol[ctr] != NEUIK_GRIDLAYOUT_UNBOUND)
+        {
+            v->slotCol[ctr] = NEUIK_GRIDLAYOUT_STALE;
+            v->slotRow[ctr] = NEUIK_GRIDLAYOUT_STALE;
+        }
+    }
+
+    if (neuik_GridLayout_BindVirtualCells(grid))
+    {
+        eNum = 5;
+        goto out;
+    }
+    if (neuik_Container_RequestFullRedraw(grid))
+    {
+        eNum = 6;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_GridLayout_UpdateCell
+ *
+ *  Description:   Tell a virtual GridLayout that the contents of cell 
+ *                 (col, row) changed. If the cell is bound it is rebound (and
+ *                 remeasured when it is next rendered); otherwise its cached 
+ *                 size is dropped. Only the width of column `col` and the 
+ *                 height of row `row` are updated.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_GridLayout_UpdateCell(
+    NEUIK_GridLayout * grid,
+    int                col,
+    int                row)
+{
+    int                       slot       = 0;
+    int                       colW       = 0;
+    int                       rowH       = 0;
+    int                       eNum       = 0; /* which error to report (if any) */
+    static RenderSize         rsUnknown  = {-1, -1};
+    RenderSize                rSize;
+    RenderLoc                 rLoc;
+    NEUIK_Container         * cBase      = NULL;
+    neuik_GridLayoutVirtual * v          = NULL;
+    static char               funcName[] = "NEUIK_GridLayout_UpdateCell";
+    static char             * errMsgs[]  = {"",                          // [0] no error
+        "Argument `grid` is not of GridLayout class.",                   // [1]
+        "Argument `grid` is not a virtual GridLayout.",                  // [2]
+        "Argument `grid` caused `neuik_Object_GetClassObject` to fail.", // [3]
+        "Argument `col` or `row` is out of range.",                      // [4]
+        "Failure in `neuik_GridLayout_BindVirtualCells()`.",             // [5]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.",              // [6]
+        "Failure in `neuik_Element_RequestRedraw()`.",                   // [7]
+        "Failure in `neuik_Container_RequestFullRedraw()`.",             // [8]
+        "Failure in `neuik_GridLayout_StoreCellSize()`.",                // [9]
+    };
+
+    if (!neuik_Object_IsClass(grid, neuik__Class_GridLayout))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (grid->virt == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(grid, neuik__Class_Container, (void**)&cBase))
+    {
+        eNum = 3;
+        goto out;
+    }
+    v = (neuik_GridLayoutVirtual*)(grid->virt);
+    if (col < 0 || col >= v->nCols || row < 0 || row >= v->nRows)
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    if (grid->xDim > 0 && grid->yDim > 0)
+    {
+        slot = (col % grid->xDim) + (row % grid->yDim)*(grid->xDim);
+        if (v->slotCol[slot] == col && v->slotRow[slot] == row)
+        {
+            /*----------------------------------------------------------------*/
+            /* The cell is bound; rebind just this slot and redraw the cell.  */
+            /*----------------------------------------------------------------*/
+            v->slotCol[slot] = NEUIK_GRIDLAYOUT_STALE;
+            v->slotRow[slot] = NEUIK_GRIDLAYOUT_STALE;
+            if (neuik_GridLayout_BindVirtualCells(grid))
+            {
+                eNum = 5;
+                goto out;
+            }
+            if (cBase->elems[slot] == NULL) goto out;
+
+            if (neuik_Element_GetSizeAndLocation(cBase->elems[slot], 
+                &rSize, &rLoc))
+            {
+                eNum = 6;
+                goto out;
+            }
+            if (neuik_Element_RequestRedraw(cBase->elems[slot], rLoc, rSize))
+            {
+                eNum = 7;
+                goto out;
+            }
+            goto out;
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* The cell is not bound; forget its measured size. Should that change   */
+    /* the size of its column or row, the shown cells may move.               */
+    /*------------------------------------------------------------------------*/
+    colW = v->colW[col];
+    rowH = v->rowH[row];
+    if (neuik_GridLayout_StoreCellSize(v, col, row, rsUnknown))
+    {
+        eNum = 9;
+        goto out;
+    }
+    if (v->colW[col] != colW || v->rowH[row] != rowH)
+    {
+        if (neuik_Container_RequestFullRedraw(grid))
+        {
+            eNum = 8;
+            goto out;
+        }
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_GridLayout_ScrollToCell
+ *
+ *  Description:   Scroll a virtual GridLayout (as little as possible) so that
+ *                 cell (col, row) is shown.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_GridLayout_ScrollToCell(
+    NEUIK_GridLayout * grid,
+    int                col,
+    int                row)
+{
+    int                       leftCol    = 0;
+    int                       topRow     = 0;
+    int                       eNum       = 0; /* which error to report (if any) */
+    neuik_GridLayoutVirtual * v          = NULL;
+    static char               funcName[] = "NEUIK_GridLayout_ScrollToCell";
+    static char             * errMsgs[]  = {"",             // [0] no error
+        "Argument `grid` is not of GridLayout class.",      // [1]
+        "Argument `grid` is not a virtual GridLayout.",     // [2]
+        "Argument `col` or `row` is out of range.",         // [3]
+        "Failure in `neuik_GridLayout_ScrollVirtual()`.",   // [4]
+    };
+
+    if (!neuik_Object_IsClass(grid, neuik__Class_GridLayout))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (grid->virt == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    v = (neuik_GridLayoutVirtual*)(grid->virt);
+    if (col < 0 || col >= v->nCols || row < 0 || row >= v->nRows)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    leftCol = v->leftCol;
+    if (col < leftCol)
+    {
+        leftCol = col;
+    }
+    else if (col >= leftCol + v->nShownCols)
+    {
+        leftCol = col - (v->nShownCols - 1);
+    }
+
+    topRow = v->topRow;
+    if (row < topRow)
+    {
+        topRow = row;
+    }
+    else if (row >= topRow + v->nShownRows)
+    {
+        topRow = row - (v->nShownRows - 1);
+    }
+    if (leftCol == v->leftCol && topRow == v->topRow) goto out;
+
+    if (neuik_GridLayout_ScrollVirtual(grid, leftCol, topRow))
+    {
+        eNum = 4;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
@@ -23,6 +23,7 @@
 #include "NEUIK_HGroup.h"
 #include "NEUIK_Element_internal.h"
 #include "NEUIK_Container.h"
+#include "NEUIK_Container_internal.h"
 #include "NEUIK_Window_internal.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
@@ -287,6 +288,7 @@ int NEUIK_HGroup_SetHSpacing(
     if (spacing == hg->HSpacing) goto out;
 
     hg->HSpacing = spacing;
+    neuik_Element_InvalidateLayout(hg);
     // neuik_Element_RequestRedraw(vg);
 
 out:
@@ -622,6 +624,8 @@ int neuik_Element_Render__HGroup(
     NEUIK_ElementConfig ** elemsCfg      = NULL; // Free upon returning.
     RenderLoc              rl            = {0, 0};
     RenderLoc              rlRel         = {0, 0}; /* renderloc relative to parent */
+    RenderLoc              rlOld         = {0, 0}; /* stored loc before layout */
+    RenderSize             rsOld         = {0, 0}; /* stored size before layout */
     SDL_Rect               rect          = {0, 0, 0, 0};
     static RenderSize      rsZero        = {0, 0};
     RenderSize             rsMin         = {0, 0};
@@ -647,6 +651,7 @@ int neuik_Element_Render__HGroup(
         "Element_GetConfig returned NULL.",                                // [9]
         "Element_GetMinSize Failed.",                                      // [10]
         "Failure in `neuik_Element_Render()`",                             // [11]
+        "Failure in `neuik_Element_GetSizeAndLocation()`",                 // [12]
     };
 
     if (!neuik_Object_IsClass(hgElem, neuik__Class_HGroup))
@@ -728,6 +733,20 @@ int neuik_Element_Render__HGroup(
         goto out;
     }
 
+    /*------------------------------------------------------------------------*/
+    /* If nothing which affects the placement of the contained elements has   */
+    /* changed since the last layout, render them where they already are.     */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Element_IsLayoutValid(hgElem, rSize))
+    {
+        if (neuik_Container_RenderStoredLayout(hgElem, rlMod, rend, mock))
+        {
+            eNum = 11;
+            goto out;
+        }
+        goto out;
+    }
+
     /*------------------------------------------------------------------------*/
     /* Allocate memory for the calculated maximum minimum values, the         */
     /* VFill/HFill flags, and for the rendered row/column heights/widths.     */
@@ -1016,7 +1035,6 @@ int neuik_Element_Render__HGroup(
         if (!elemsShown[ctr]) continue; /* this elem isn't shown */
 
         elem = cont->elems[ctr];
-        if (!neuik_Element_NeedsRedraw(elem)) continue;
 
         eCfg = elemsCfg[ctr];
         rs   = &elemsMinSz[ctr];
@@ -1103,14 +1121,28 @@ int neuik_Element_Render__HGroup(
         rl.y = (eBase->eSt.rLoc).y + rect.y;
         rlRel.x = rect.x;
         rlRel.y = rect.y;
+        if (neuik_Element_GetSizeAndLocation(elem, &rsOld, &rlOld))
+        {
+            eNum = 12;
+            goto out;
+        }
         neuik_Element_StoreSizeAndLocation(elem, *rs, rl, rlRel);
 
+        /*--------------------------------------------------------------------*/
+        /* Every shown element is placed (so that the stored layout is whole) */
+        /* but only those which moved or need it otherwise are redrawn.       */
+        /*--------------------------------------------------------------------*/
+        if (rsOld.w == rs->w && rsOld.h == rs->h &&
+            rlOld.x == rl.x  && rlOld.y == rl.y  &&
+            !neuik_Element_NeedsRedraw(elem)) continue;
+
         if (neuik_Element_Render(elem, rs, rlMod, rend, mock))
         {
             eNum = 11;
             goto out;
         }
     }
+    neuik_Element_StoreLayout(hgElem, rSize);
 out:
     if (eBase != NULL)
     {
@@ -41,6 +41,30 @@ int neuik_Element_GetMinSize__Label(NEUIK_Element, RenderSize*);
 int neuik_Element_Render__Label(
     NEUIK_Element, RenderSize*, RenderLoc*, SDL_Renderer*, int);
 
+/*----------------------------------------------------------------------------*/
+/* The layout of the text of a Label (its lines and their sizes) and the      */
+/* rendered lines are kept between frames; the layout is only measured again  */
+/* when the text or the font changes and the lines are only rendered again   */
+/* when the text, font, color or renderer changes.                            */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    TTF_Font      * font;       /* font of the measured layout (NULL=stale) */
+    size_t          nLines;
+    size_t          linesAlloc;
+    size_t        * lineStart;  /* byte offset of the start of each line */
+    size_t        * lineLen;
+    int           * lineW;      /* rendered width of each line */
+    int             textW;      /* width of the widest line */
+    int             lineH;
+    int             lineSkip;   /* vertical distance between lines */
+    SDL_Texture  ** lineTex;    /* rendered lines (NULL until rendered) */
+    SDL_Renderer  * rend;       /* renderer which owns the line textures */
+    NEUIK_Color     clr;        /* color in which the lines were rendered */
+    size_t          nStale;
+    size_t          staleAlloc;
+    SDL_Texture  ** staleTex;   /* lines to destroy on the render thread */
+} neuik_LabelLayout;
+
 /*----------------------------------------------------------------------------*/
 /* neuik_Element    Function Table                                            */
 /*----------------------------------------------------------------------------*/
@@ -195,6 +219,7 @@ int neuik_Object_New__Label(
     lbl->cfg         = NULL;
     lbl->cfgPtr      = NULL;
     lbl->text        = NULL;
+    lbl->layout      = NULL;
     lbl->needsRedraw = 1;
 
     if (NEUIK_NewLabelConfig(&lbl->cfg))
@@ -232,6 +257,254 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* Destroy the rendered lines of a Label layout.                              */
+/*----------------------------------------------------------------------------*/
+static void neuik_Label_FlushTextures(
+    neuik_LabelLayout * lyt)
+{
+    size_t ctr;
+
+    if (lyt->lineTex != NULL)
+    {
+        for (ctr = 0; ctr < lyt->nLines; ctr++)
+        {
+            ConditionallyDestroyTexture(&(lyt->lineTex[ctr]));
+        }
+    }
+    for (ctr = 0; ctr < lyt->nStale; ctr++)
+    {
+        ConditionallyDestroyTexture(&(lyt->staleTex[ctr]));
+    }
+    lyt->nStale = 0;
+    lyt->rend   = NULL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Move the rendered lines of a Label layout to its list of stale textures.   */
+/* The layout may be measured again on a min-size worker thread, where SDL    */
+/* render calls are not allowed; the stale textures are destroyed by the next */
+/* render of the Label instead.                                               */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_Label_RetireTextures(
+    neuik_LabelLayout * lyt)
+{
+    size_t          ctr;
+    size_t          newAlloc;
+    SDL_Texture  ** newStale;
+
+    if (lyt->lineTex == NULL) return 0;
+
+    for (ctr = 0; ctr < lyt->nLines; ctr++)
+    {
+        if (lyt->lineTex[ctr] == NULL) continue;
+
+        if (lyt->nStale == lyt->staleAlloc)
+        {
+            newAlloc = (lyt->staleAlloc == 0) ? 4 : 2*lyt->staleAlloc;
+            if (newAlloc < lyt->nStale + lyt->nLines - ctr)
+            {
+                newAlloc = lyt->nStale + lyt->nLines - ctr;
+            }
+            newStale = (SDL_Texture**)realloc(lyt->staleTex,
+                newAlloc*sizeof(SDL_Texture*));
+            if (newStale == NULL) return 1;
+            lyt->staleTex   = newStale;
+            lyt->staleAlloc = newAlloc;
+        }
+        lyt->staleTex[lyt->nStale++] = lyt->lineTex[ctr];
+        lyt->lineTex[ctr] = NULL;
+    }
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Mark the cached layout (and rendered lines) of a Label as stale.           */
+/*----------------------------------------------------------------------------*/
+static void neuik_Label_InvalidateLayout(
+    NEUIK_Label * lbl)
+{
+    neuik_LabelLayout * lyt;
+
+    lyt = (neuik_LabelLayout*)(lbl->layout);
+    if (lyt == NULL) return;
+
+    neuik_Label_FlushTextures(lyt);
+    lyt->font = NULL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Free the cached layout of a Label.                                         */
+/*----------------------------------------------------------------------------*/
+static void neuik_Label_FreeLayout(
+    NEUIK_Label * lbl)
+{
+    neuik_LabelLayout * lyt;
+
+    lyt = (neuik_LabelLayout*)(lbl->layout);
+    if (lyt == NULL) return;
+
+    neuik_Label_FlushTextures(lyt);
+    if (lyt->lineStart != NULL) free(lyt->lineStart);
+    if (lyt->lineLen   != NULL) free(lyt->lineLen);
+    if (lyt->lineW     != NULL) free(lyt->lineW);
+    if (lyt->lineTex   != NULL) free(lyt->lineTex);
+    if (lyt->staleTex  != NULL) free(lyt->staleTex);
+    free(lyt);
+    lbl->layout = NULL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Break the text of a Label into lines and measure them in the specified     */
+/* font (unless the cached layout is already for this text and font).         */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_Label_UpdateLayout(
+    NEUIK_Label * lbl,
+    TTF_Font    * font)
+{
+    int                 textH  = 0;
+    char                tempChar;
+    size_t              ctr;
+    size_t              nLines = 1;
+    size_t              pos;
+    size_t              lineEnd;
+    neuik_LabelLayout * lyt;
+
+    lyt = (neuik_LabelLayout*)(lbl->layout);
+    if (lyt == NULL)
+    {
+        lyt = (neuik_LabelLayout*)calloc(1, sizeof(neuik_LabelLayout));
+        if (lyt == NULL) return 1;
+        lbl->layout = lyt;
+    }
+    /*------------------------------------------------------------------------*/
+    /* A layout measured with a thread-private font (in a parallel min-size   */
+    /* pass) is stored under the shared font which it is a copy of.           */
+    /*------------------------------------------------------------------------*/
+    if (lyt->font == neuik_FontSet_GetSharedFont(font)) return 0;
+
+    if (neuik_Label_RetireTextures(lyt)) return 1;
+    lyt->nLines = 0;
+
+    for (ctr = 0; lbl->text[ctr] != '\0'; ctr++)
+    {
+        if (lbl->text[ctr] == '\n') nLines++;
+    }
+
+    if (nLines > lyt->linesAlloc)
+    {
+        if (lyt->lineStart != NULL) free(lyt->lineStart);
+        if (lyt->lineLen   != NULL) free(lyt->lineLen);
+        if (lyt->lineW     != NULL) free(lyt->lineW);
+        if (lyt->lineTex   != NULL) free(lyt->lineTex);
+        lyt->linesAlloc = 0;
+
+        lyt->lineStart = (size_t*)malloc(nLines*sizeof(size_t));
+        lyt->lineLen   = (size_t*)malloc(nLines*sizeof(size_t));
+        lyt->lineW     = (int*)malloc(nLines*sizeof(int));
+        lyt->lineTex   = (SDL_Texture**)calloc(nLines, sizeof(SDL_Texture*));
+        if (lyt->lineStart == NULL || lyt->lineLen == NULL || 
+            lyt->lineW == NULL || lyt->lineTex == NULL)
+        {
+            return 1;
+        }
+        lyt->linesAlloc = nLines;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Measure each line; lines are temporarily terminated at their ends.     */
+    /*------------------------------------------------------------------------*/
+    lyt->textW = 0;
+    lyt->lineH = TTF_FontHeight(font);
+    pos = 0;
+    for (ctr = 0; ctr < nLines; ctr++)
+    {
+        for (lineEnd = pos; 
+            lbl->text[lineEnd] != '\n' && lbl->text[lineEnd] != '\0'; 
+            lineEnd++);
+
+        lyt->lineStart[ctr] = pos;
+        lyt->lineLen[ctr]   = lineEnd - pos;
+        lyt->lineW[ctr]     = 0;
+        lyt->lineTex[ctr]   = NULL;
+        if (lineEnd > pos)
+        {
+            tempChar = lbl->text[lineEnd];
+            lbl->text[lineEnd] = '\0';
+            TTF_SizeUTF8(font, lbl->text + pos, &(lyt->lineW[ctr]), &textH);
+            lbl->text[lineEnd] = tempChar;
+        }
+        if (lyt->lineW[ctr] > lyt->textW) lyt->textW = lyt->lineW[ctr];
+
+        pos = lineEnd + 1;
+    }
+    lyt->nLines   = nLines;
+    lyt->lineSkip = TTF_FontLineSkip(font);
+    lyt->font     = neuik_FontSet_GetSharedFont(font);
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Render the lines of a Label (which haven't already been rendered with the  */
+/* same renderer and color).                                                  */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_Label_UpdateTextures(
+    NEUIK_Label       * lbl,
+    TTF_Font          * font,
+    SDL_Renderer      * rend,
+    const NEUIK_Color * fgClr)
+{
+    int                 textW = 0;
+    int                 textH = 0;
+    char                tempChar;
+    size_t              ctr;
+    size_t              lineEnd;
+    neuik_LabelLayout * lyt;
+
+    lyt = (neuik_LabelLayout*)(lbl->layout);
+    for (ctr = 0; ctr < lyt->nStale; ctr++)
+    {
+        ConditionallyDestroyTexture(&(lyt->staleTex[ctr]));
+    }
+    lyt->nStale = 0;
+
+    if (lyt->rend != rend ||
+        lyt->clr.r != fgClr->r || lyt->clr.g != fgClr->g ||
+        lyt->clr.b != fgClr->b || lyt->clr.a != fgClr->a)
+    {
+        neuik_Label_FlushTextures(lyt);
+        lyt->rend = rend;
+        lyt->clr  = *fgClr;
+    }
+
+    for (ctr = 0; ctr < lyt->nLines; ctr++)
+    {
+        if (lyt->lineTex[ctr] != NULL || lyt->lineLen[ctr] == 0) continue;
+
+        lineEnd  = lyt->lineStart[ctr] + lyt->lineLen[ctr];
+        tempChar = lbl->text[lineEnd];
+        lbl->text[lineEnd] = '\0';
+        lyt->lineTex[ctr] = NEUIK_RenderText(lbl->text + lyt->lineStart[ctr],
+            font, *fgClr, rend, &textW, &textH);
+        lbl->text[lineEnd] = tempChar;
+
+        if (lyt->lineTex[ctr] == NULL) return 1;
+    }
+    return 0;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_Object_Free__Label
@@ -275,6 +548,7 @@ int neuik_Object_Free__Label(
         goto out;
     }
     if(lbl->text != NULL) free(lbl->text);
+    neuik_Label_FreeLayout(lbl);
     if(neuik_Object_Free((void**)lbl->cfg))
     {
         eNum = 2;
@@ -388,6 +662,7 @@ int neuik_Element_GetMinSize__Label(
     int                       eNum       = 0;    /* which error to report (if any) */
     TTF_Font                * font       = NULL;
     NEUIK_Label             * label      = NULL;
+    neuik_LabelLayout       * lyt        = NULL;
     const NEUIK_LabelConfig * aCfg       = NULL; /* the active Label config */
     static char               funcName[] = "neuik_Element_GetMinSize__Label";
     static char             * errMsgs[]  = {"",      // [0] no error
@@ -395,6 +670,7 @@ int neuik_Element_GetMinSize__Label(
         "LabelConfig* is NULL.",                     // [2]
         "LabelConfig->FontSet is NULL.",             // [3]
         "FontSet_GetFont returned NULL.",            // [4]
+        "Failure in `neuik_Label_UpdateLayout()`.",  // [5]
     };
 
     /*------------------------------------------------------------------------*/
@@ -445,20 +721,29 @@ int neuik_Element_GetMinSize__Label(
         goto out;
     }
 
+    rSize->h = (int)(1.5 * (float)TTF_FontHeight(font));
     if (label->text != NULL)
     {
-        /* this Label contains text */
-        TTF_SizeText(font, label->text, &tW, &tH);
-
+        /*--------------------------------------------------------------------*/
+        /* This Label contains text; its (cached) layout holds the size of    */
+        /* the widest line and the number of lines.                           */
+        /*--------------------------------------------------------------------*/
+        if (neuik_Label_UpdateLayout(label, font))
+        {
+            eNum = 5;
+            goto out;
+        }
+        lyt = (neuik_LabelLayout*)(label->layout);
+        tW  = lyt->textW;
+        rSize->h += (int)(lyt->nLines - 1)*lyt->lineSkip;
     }
     else
     {
         /* this Label does not contain text */
-        TTF_SizeText(font, " ", &tW, &tH);
+        TTF_SizeUTF8(font, " ", &tW, &tH);
     }
 
     rSize->w = tW + aCfg->fontEmWidth;
-    rSize->h = (int)(1.5 * (float)TTF_FontHeight(font));
 out:
     if (eNum > 0)
     {
@@ -507,6 +792,7 @@ int NEUIK_Label_SetText(
     if (label->text != NULL) {
         free(label->text);
     }
+    neuik_Label_InvalidateLayout(label);
 
     /*------------------------------------------------------------------------*/
     /* Set the new Label text contents                                        */
@@ -633,12 +919,13 @@ int neuik_Element_Render__Label(
 {
     const NEUIK_Color       * fgClr      = NULL;
     SDL_Renderer            * rend       = NULL;
-    SDL_Texture             * tTex       = NULL; /* text texture */
     SDL_Rect                  rect;
-    int                       textW      = 0;
-    int                       textH      = 0;
+    int                       blockH     = 0; /* height of all of the lines */
+    int                       lineW      = 0;
     int                       eNum       = 0; /* which error to report (if any) */
+    size_t                    ctr;
     NEUIK_Label             * label      = NULL;
+    neuik_LabelLayout       * lyt        = NULL;
     TTF_Font                * font       = NULL;
     NEUIK_ElementBase       * eBase      = NULL;
     RenderLoc                 rl;
@@ -655,6 +942,7 @@ int neuik_Element_Render__Label(
         "Invalid specified `rSize` (negative values).",                  // [7]
         "Argument `elem` caused `neuik_Object_GetClassObject` to fail.", // [8]
         "Failure in neuik_Element_RedrawBackground().",                  // [9]
+        "Failure in `neuik_Label_UpdateLayout()`.",                      // [10]
     };
 
     if (!neuik_Object_IsClass(elem, neuik__Class_Label))
@@ -733,39 +1021,56 @@ int neuik_Element_Render__Label(
 
             }
 
-            tTex = NEUIK_RenderText(
-                label->text, font, *fgClr, rend, &textW, &textH);
-            if (tTex == NULL)
+            /*----------------------------------------------------------------*/
+            /* The lines are only rendered again if the text, font or color   */
+            /* has changed since the previous frame.                          */
+            /*----------------------------------------------------------------*/
+            if (neuik_Label_UpdateLayout(label, font))
+            {
+                eNum = 10;
+                goto out;
+            }
+            if (neuik_Label_UpdateTextures(label, font, rend, fgClr))
             {
                 eNum = 5;
                 goto out;
             }
+            lyt = (neuik_LabelLayout*)(label->layout);
 
-            rect.x = rlAdj.x;
-            rect.y = rlAdj.y;
-            rect.w = textW;
-            rect.h = textH;
-
-            switch (eBase->eCfg.HJustify)
+            /*----------------------------------------------------------------*/
+            /* The block of lines is centered vertically; each line is        */
+            /* justified horizontally on its own.                             */
+            /*----------------------------------------------------------------*/
+            blockH = (int)(lyt->nLines - 1)*lyt->lineSkip + lyt->lineH;
+            for (ctr = 0; ctr < lyt->nLines; ctr++)
             {
-                case NEUIK_HJUSTIFY_LEFT:
-                    rect.x += 6;
-                    rect.y += (int) ((float)(rSize->h - textH)/2.0);
-                    break;
-
-                case NEUIK_HJUSTIFY_CENTER:
-                case NEUIK_HJUSTIFY_DEFAULT:
-                    rect.x += (int) ((float)(rSize->w - textW)/2.0);
-                    rect.y += (int) ((float)(rSize->h - textH)/2.0);
-                    break;
-
-                case NEUIK_HJUSTIFY_RIGHT:
-                    rect.x += (int) (rSize->w - textW - 6);
-                    rect.y += (int) ((float)(rSize->h - textH)/2.0);
-                    break;
-            }
+                if (lyt->lineTex[ctr] == NULL) continue;
+
+                lineW  = lyt->lineW[ctr];
+                rect.x = rlAdj.x;
+                rect.y = rlAdj.y + (int) ((float)(rSize->h - blockH)/2.0) +
+                    (int)(ctr)*lyt->lineSkip;
+                rect.w = lineW;
+                rect.h = lyt->lineH;
+
+                switch (eBase->eCfg.HJustify)
+                {
+                    case NEUIK_HJUSTIFY_LEFT:
+                        rect.x += 6;
+                        break;
 
-            SDL_RenderCopy(rend, tTex, NULL, &rect);
+                    case NEUIK_HJUSTIFY_CENTER:
+                    case NEUIK_HJUSTIFY_DEFAULT:
+                        rect.x += (int) ((float)(rSize->w - lineW)/2.0);
+                        break;
+
+                    case NEUIK_HJUSTIFY_RIGHT:
+                        rect.x += (int) (rSize->w - lineW - 6);
+                        break;
+                }
+
+                SDL_RenderCopy(rend, lyt->lineTex[ctr], NULL, &rect);
+            }
         }
     }
 out:
@@ -774,8 +1079,6 @@ out:
         if (!mock) eBase->eSt.doRedraw = 0;
     }
 
-    ConditionallyDestroyTexture(&tTex);
-
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -1144,6 +1447,7 @@ out:
     }
     if (doRedraw)
     {
+        neuik_Label_InvalidateLayout(lbl);
         if (neuik_Element_GetSizeAndLocation(lbl, &rSize, &rLoc))
         {
             eNum = 10;
@@ -15,14 +15,18 @@
  ******************************************************************************/
 #include <SDL.h>
 #include <stdlib.h>
+#include <string.h>
  
 #include "NEUIK_error.h"
 #include "NEUIK_render.h"
 #include "NEUIK_structs_basic.h"
 #include "NEUIK_colors.h"
 #include "NEUIK_ListGroup.h"
+#include "NEUIK_ListGroup_internal.h"
+#include "NEUIK_Label.h"
 #include "NEUIK_Element_internal.h"
 #include "NEUIK_Container.h"
+#include "NEUIK_Container_internal.h"
 #include "NEUIK_Window_internal.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
@@ -30,6 +34,66 @@
 extern int   neuik__isInitialized;
 extern float neuik__HighDPI_Scaling;
 
+#define NEUIK_LISTGROUP_OVERSCAN  2  /* rows bound beyond each shown edge */
+#define NEUIK_LISTGROUP_WHEELROWS 3  /* rows scrolled per mouse wheel step */
+#define NEUIK_LISTGROUP_UNBOUND  -1  /* a recycled row which is still empty */
+#define NEUIK_LISTGROUP_STALE    -2  /* a recycled row which must be rebound */
+#define NEUIK_LISTGROUP_SORTRUN  32     /* keys sorted by insertion per run */
+#define NEUIK_LISTGROUP_SORTMIN  16384  /* fewest keys sorted per thread */
+#define NEUIK_LISTGROUP_SORTTHREADS 8   /* most threads used to sort rows */
+
+/*----------------------------------------------------------------------------*/
+/* The state of a virtual ListGroup. The contained elements are a pool of     */
+/* recycled ListRows; row `rowInd` is always bound into ListRow             */
+/* (rowInd % nSlots) so scrolling by a row only rebinds a single ListRow.     */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    int    nRows;      /* number of (virtual) rows in the list */
+    int (* bindFn)(NEUIK_ListRow *, int, int, void *);
+    void * bindArg;
+    int    topRow;     /* index of the first shown row */
+    int    nShown;     /* number of rows which fit within the ListGroup */
+    int    rowH;       /* (uniform) row height incl. padding; 0 if unknown */
+    int    nSlots;     /* number of recycled ListRows */
+    int  * slotRow;    /* row index bound into each ListRow (or UNBOUND/STALE) */
+    int    lastMouseX; /* last known mouse position (used for wheel events) */
+    int    lastMouseY;
+} neuik_ListGroupVirtual;
+
+/*----------------------------------------------------------------------------*/
+/* The selection of a ListGroup. Selected rows are kept as a sorted set of    */
+/* disjoint (first, last) row index ranges; the `selected` flags of the       */
+/* ListRows only mirror this set (for the rows which have a ListRow).         */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    int    nRanges;  /* number of selected ranges */
+    int    nAlloc;   /* number of ranges which fit within `ranges` */
+    int  * ranges;   /* (first, last) row index pairs in ascending order */
+    int    cursor;   /* row which keyboard navigation moves from; -1 if none */
+    int    anchor;   /* row which shift-selection extends from; -1 if none */
+    int    multi;    /* more than a single row may be selected */
+    int    stale;    /* ListRows were (de)selected directly; rebuild the set */
+    int    nRows;    /* number of ListRows when the set was last rebuilt */
+    unsigned int modCount; /* container `modCount` when the set was rebuilt */
+    int    updating; /* the ListGroup is changing the ListRows itself */
+} neuik_ListGroupSelection;
+
+/*----------------------------------------------------------------------------*/
+/* A sort/filter view over the rows of a (non-virtual) ListGroup. The rows    */
+/* are only reordered (as pointers) and shown/hidden; `model` holds them in   */
+/* the order in which they were added (by model row index).                   */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    int             nRows;     /* number of rows within the view */
+    int             nAlloc;    /* number of rows which fit within the arrays */
+    int             nShown;    /* number of rows which pass the filter */
+    NEUIK_Element * model;     /* the rows by model row index */
+    int           * order;     /* model row index of the row at each position */
+    unsigned int    modCount;  /* container `modCount` the view was built at */
+    int          (* filterFn)(NEUIK_ListRow *, int, void *);
+    void          * filterArg;
+} neuik_ListGroupView;
+
 /*----------------------------------------------------------------------------*/
 /* Internal Function Prototypes                                               */
 /*----------------------------------------------------------------------------*/
@@ -177,6 +241,18 @@ int neuik_Object_New__ListGroup(
     lg->colorBGSelect = bgSelectClr; /* color to use for the selected text */
     lg->colorBGOdd    = bgOddClr;    /* background color to use for unselected odd rows */
     lg->colorBGEven   = bgEvenClr;   /* background color to use for unselected even rows */
+    lg->virt          = NULL;
+    lg->view          = NULL;
+
+    lg->sel = malloc(sizeof(neuik_ListGroupSelection));
+    if (lg->sel == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    memset(lg->sel, 0, sizeof(neuik_ListGroupSelection));
+    ((neuik_ListGroupSelection*)(lg->sel))->cursor = -1;
+    ((neuik_ListGroupSelection*)(lg->sel))->anchor = -1;
 
     /*------------------------------------------------------------------------*/
     /* Successful allocation of Memory -- Create Base Class Object            */
@@ -318,6 +394,22 @@ int neuik_Object_Free__ListGroup(
         goto out;
     }
 
+    if (lg->virt != NULL)
+    {
+        free(((neuik_ListGroupVirtual*)(lg->virt))->slotRow);
+        free(lg->virt);
+    }
+    if (lg->sel != NULL)
+    {
+        free(((neuik_ListGroupSelection*)(lg->sel))->ranges);
+        free(lg->sel);
+    }
+    if (lg->view != NULL)
+    {
+        free(((neuik_ListGroupView*)(lg->view))->model);
+        free(((neuik_ListGroupView*)(lg->view))->order);
+        free(lg->view);
+    }
     free(lg);
 out:
     if (eNum > 0)
@@ -330,651 +422,3618 @@ out:
 }
 
 
-/*******************************************************************************
- *
- *  Name:          neuik_Element_GetMinSize__ListGroup
- *
- *  Description:   Returns the minimum rendered size of a given FlowGroup.
- *
- *  Returns:       1 if there is an error; 0 otherwise.
- *
- ******************************************************************************/
-int neuik_Element_GetMinSize__ListGroup(
-    NEUIK_Element    lgElem,
-    RenderSize     * rSize)
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_FirstRangeFrom                                            */
+/*                                                                            */
+/*  Binary search for the first selected range which ends at or after row     */
+/*  `rowInd`.                                                                 */
+/*                                                                            */
+/*  Returns: The index of the range; `nRanges` if there is none.              */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_FirstRangeFrom(
+    neuik_ListGroupSelection * sel,
+    int                        rowInd)
 {
-    if (rSize != NULL)
+    int lo  = 0;
+    int hi  = sel->nRanges;
+    int mid = 0;
+
+    while (lo < hi)
     {
-        rSize->w = 1;
-        rSize->h = 1;
+        mid = lo + (hi - lo)/2;
+        if (sel->ranges[2*mid + 1] < rowInd)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
     }
+    return lo;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_SelContains                                               */
+/*                                                                            */
+/*  Returns: 1 if row `rowInd` is within the selection; 0 otherwise.          */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_SelContains(
+    neuik_ListGroupSelection * sel,
+    int                        rowInd)
+{
+    int ind = 0;
+
+    ind = neuik_ListGroup_FirstRangeFrom(sel, rowInd);
+    return (ind < sel->nRanges && sel->ranges[2*ind] <= rowInd);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_SelReserve                                                */
+/*                                                                            */
+/*  Make room (at least doubling the storage) for `nRanges` ranges.           */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_SelReserve(
+    neuik_ListGroupSelection * sel,
+    int                        nRanges)
+{
+    int   nAlloc = 0;
+    int * ranges = NULL;
+
+    if (nRanges <= sel->nAlloc) return 0;
+
+    nAlloc = (2*sel->nAlloc > nRanges) ? 2*sel->nAlloc : nRanges;
+    if (nAlloc < 4) nAlloc = 4;
+    ranges = (int*)realloc(sel->ranges, 2*nAlloc*sizeof(int));
+    if (ranges == NULL) return 1;
+
+    sel->ranges = ranges;
+    sel->nAlloc = nAlloc;
     return 0;
 }
 
 
-/*******************************************************************************
- *
- *  Name:          neuik_Element_Render__ListGroup
- *
- *  Description:   Renders a vertical group of listRows.
- *
- *  Returns:       0 if there were no issues; otherwise 1.
- *
- ******************************************************************************/
-int neuik_Element_Render__ListGroup(
-    NEUIK_Element   lgElem,
-    RenderSize    * rSize, /* in/out the size the tex occupies when complete */
-    RenderLoc     * rlMod, /* A relative location modifier (for rendering) */
-    SDL_Renderer  * xRend, /* the external renderer to prepare the texture for */
-    int             mock)  /* If true; calculate sizes/locations but don't draw */
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_SelAdd                                                    */
+/*                                                                            */
+/*  Add the rows [first, last] to the selection; overlapping and adjacent     */
+/*  ranges are merged.                                                        */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_SelAdd(
+    neuik_ListGroupSelection * sel,
+    int                        first,
+    int                        last)
 {
-    int                    nAlloc        = 0;
-    int                    borderW       = 1; /* width of border line */
-    int                    xOffset       = 0; /* offset from left for rows */
-    int                    tempH         = 0;
-    int                    tempW         = 0;
-    int                    offLeft       = 0;
-    int                    offRight      = 0;
-    int                    offTop        = 0;
-    int                    offBottom     = 0;
-    int                    ctr           = 0;
-    int                    yFree         = 0; // px of space free for vFill elems
-    int                    dH            = 0; // Change in height [px]
-    int                    eNum          = 0; // which error to report (if any)
-    int                    nVFill        = 0; // number of rows which can VFill
-    int                    reqResizeH    = 0; // required resize height
-    int                    vfillRowsMinH = 0; // min height for all vFill rows
-    int                    vfillMaxMinH  = 0; // largest minimum row height 
-                                              // among vertically filling rows.
-    int                  * allHFill      = NULL; // Free upon returning; 
-                                                 // Cols fills vertically? (per col)
-    int                  * allVFill      = NULL; // Free upon returning; 
-                                                 // Row fills vertically? (per row)
-    int                  * allMaxMinH    = NULL; // Free upon returning; 
-                                                 // The max min width (per row)
-    int                    maxMinW       = 0;    // The max min width
-    int                  * rendRowH      = NULL; // Free upon returning; 
-                                                 // Rendered row height (per row)
-    int                  * elemsShown    = NULL; // Free upon returning.
-    float                  fltVspacingSc = 0.0;  // float VSpacing HighDPI scaled
-    float                  yPos          = 0.0;
-    RenderSize           * elemsMinSz    = NULL; // Free upon returning.
-    NEUIK_ElementConfig ** elemsCfg      = NULL; // Free upon returning.
-    RenderLoc              rl            = {0, 0};
-    RenderLoc              rlRel         = {0, 0}; /* renderloc relative to parent */
-    SDL_Rect               rect          = {0, 0, 0, 0};
-    static RenderSize      rsZero        = {0, 0};
-    RenderSize             rsMin         = {0, 0};
-    RenderSize           * rs            = NULL;
-    const NEUIK_Color    * bClr          = NULL; /* border color */
-    SDL_Renderer         * rend          = NULL;
-    NEUIK_Container      * cont          = NULL;
-    NEUIK_ElementBase    * eBase         = NULL;
-    NEUIK_Element          elem          = NULL;
-    NEUIK_ElementConfig  * eCfg          = NULL;
-    NEUIK_ListGroup      * lg            = NULL;
-    neuik_MaskMap        * maskMap       = NULL; /* FREE upon return */
-    enum neuik_bgstyle     bgStyle;
-    static char           funcName[]     = "neuik_Element_Render__ListGroup";
-    static char          * errMsgs[]     = {"", // [0] no error
-        "Argument `lgElem` is not of ListGroup class.",                    // [1]
-        "Argument `lgElem` caused `neuik_Object_GetClassObject` to fail.", // [2]
-        "Invalid specified `rSize` (negative values).",                    // [3]
-        "Failure in `neuik_Element_GetCurrentBGStyle()`.",                 // [4]
-        "Failure in `neuik_MakeMaskMap()`",                                // [5]
-        "Failure in `neuik_Window_FillTranspMaskFromLoc()`",               // [6]
-        "Failure in neuik_Element_RedrawBackground().",                    // [7]
-        "Failure to allocate memory.",                                     // [8]
-        "Element_GetConfig returned NULL.",                                // [9]
-        "Element_GetMinSize Failed.",                                      // [10]
-        "Failure in `neuik_Element_Render()`",                             // [11]
-    };
+    int ind     = 0;
+    int endInd  = 0;
+    int newLast = last;
 
-    if (!neuik_Object_IsClass(lgElem, neuik__Class_ListGroup))
+    ind = neuik_ListGroup_FirstRangeFrom(sel, first - 1);
+    for (endInd = ind; endInd < sel->nRanges; endInd++)
     {
-        eNum = 1;
-        goto out;
+        if (sel->ranges[2*endInd] > last + 1) break;
+
+        if (sel->ranges[2*endInd] < first) first = sel->ranges[2*endInd];
+        if (sel->ranges[2*endInd + 1] > newLast) 
+        {
+            newLast = sel->ranges[2*endInd + 1];
+        }
     }
-    lg = (NEUIK_ListGroup*)lgElem;
 
-    if (neuik_Object_GetClassObject(lgElem, neuik__Class_Element, (void**)&eBase))
+    if (endInd == ind)
     {
-        eNum = 2;
-        goto out;
+        /*--------------------------------------------------------------------*/
+        /* The rows don't touch any existing range; insert a new one.         */
+        /*--------------------------------------------------------------------*/
+        if (neuik_ListGroup_SelReserve(sel, sel->nRanges + 1)) return 1;
+        memmove(&(sel->ranges[2*(ind + 1)]), &(sel->ranges[2*ind]), 
+            2*(sel->nRanges - ind)*sizeof(int));
+        sel->nRanges++;
     }
-    if (neuik_Object_GetClassObject(lgElem, neuik__Class_Container, (void**)&cont))
+    else if (endInd > ind + 1)
     {
-        eNum = 2;
-        goto out;
+        /*--------------------------------------------------------------------*/
+        /* Several ranges were merged into the first of them.                 */
+        /*--------------------------------------------------------------------*/
+        memmove(&(sel->ranges[2*(ind + 1)]), &(sel->ranges[2*endInd]), 
+            2*(sel->nRanges - endInd)*sizeof(int));
+        sel->nRanges -= endInd - (ind + 1);
     }
+    sel->ranges[2*ind]     = first;
+    sel->ranges[2*ind + 1] = newLast;
+    return 0;
+}
 
-    if (rSize->w < 0 || rSize->h < 0)
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_SelRemove                                                 */
+/*                                                                            */
+/*  Remove the rows [first, last] from the selection.                         */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_SelRemove(
+    neuik_ListGroupSelection * sel,
+    int                        first,
+    int                        last)
+{
+    int ind    = 0;
+    int endInd = 0;
+
+    ind = neuik_ListGroup_FirstRangeFrom(sel, first);
+    if (ind == sel->nRanges) return 0;
+
+    if (sel->ranges[2*ind] < first && sel->ranges[2*ind + 1] > last)
     {
-        eNum = 3;
-        goto out;
+        /*--------------------------------------------------------------------*/
+        /* The rows are within a single range; split it in two.               */
+        /*--------------------------------------------------------------------*/
+        if (neuik_ListGroup_SelReserve(sel, sel->nRanges + 1)) return 1;
+        memmove(&(sel->ranges[2*(ind + 1)]), &(sel->ranges[2*ind]), 
+            2*(sel->nRanges - ind)*sizeof(int));
+        sel->nRanges++;
+        sel->ranges[2*ind + 1]   = first - 1;
+        sel->ranges[2*(ind + 1)] = last + 1;
+        return 0;
     }
 
-    eBase->eSt.rend = xRend;
-    rend = eBase->eSt.rend;
-
-    if (neuik__HighDPI_Scaling <= 1.0)
+    if (sel->ranges[2*ind] < first)
     {
-        fltVspacingSc = (float)(lg->VSpacing);
+        sel->ranges[2*ind + 1] = first - 1;
+        ind++;
     }
-    else
+    for (endInd = ind; endInd < sel->nRanges; endInd++)
     {
-        fltVspacingSc = (float)(lg->VSpacing)*neuik__HighDPI_Scaling;
+        if (sel->ranges[2*endInd + 1] > last) break;
+    }
+    if (endInd < sel->nRanges && sel->ranges[2*endInd] <= last)
+    {
+        sel->ranges[2*endInd] = last + 1;
     }
 
-    /*------------------------------------------------------------------------*/
-    /* Redraw the background surface before continuing.                       */
-    /*------------------------------------------------------------------------*/
-    if (!mock)
+    if (endInd > ind)
     {
-        if (neuik_Element_GetCurrentBGStyle(lgElem, &bgStyle))
-        {
-            eNum = 4;
-            goto out;
-        }
-        if (bgStyle != NEUIK_BGSTYLE_TRANSPARENT)
-        {
-            /*----------------------------------------------------------------*/
-            /* Create a MaskMap an mark off the trasnparent pixels.           */
-            /*----------------------------------------------------------------*/
-            if (neuik_MakeMaskMap(&maskMap, rSize->w, rSize->h))
-            {
-                eNum = 5;
-                goto out;
-            }
+        memmove(&(sel->ranges[2*ind]), &(sel->ranges[2*endInd]), 
+            2*(sel->nRanges - endInd)*sizeof(int));
+        sel->nRanges -= endInd - ind;
+    }
+    return 0;
+}
 
-            rl = eBase->eSt.rLoc;
-            if (neuik_Window_FillTranspMaskFromLoc(
-                    eBase->eSt.window, maskMap, rl.x, rl.y))
-            {
-                eNum = 6;
-                goto out;
-            }
 
-            if (neuik_Element_RedrawBackground(lgElem, rlMod, maskMap))
-            {
-                eNum = 7;
-                goto out;
-            }
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_SetRangeFlags                                             */
+/*                                                                            */
+/*  Select/deselect the ListRows of rows [first, last]. For virtual           */
+/*  ListGroups only the rows which are currently bound have a ListRow. Only   */
+/*  ListRows which actually change are redrawn.                               */
+/*                                                                            */
+/*  Returns: Nothing.                                                         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static void neuik_ListGroup_SetRangeFlags(
+    NEUIK_ListGroup * lg,
+    int               first,
+    int               last,
+    int               isSelected)
+{
+    int                        ind   = 0;
+    int                        slot  = 0;
+    NEUIK_Container          * cBase = NULL;
+    neuik_ListGroupVirtual   * v     = NULL;
+    neuik_ListGroupSelection * sel   = NULL;
+
+    if (first > last) return;
+    if (neuik_Object_GetClassObject_NoError(
+        lg, neuik__Class_Container, (void**)&cBase)) return;
+    if (cBase->elems == NULL) return;
+
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+    sel->updating++;
+    if (lg->virt != NULL)
+    {
+        v = (neuik_ListGroupVirtual*)(lg->virt);
+        for (slot = 0; slot < v->nSlots; slot++)
+        {
+            if (v->slotRow[slot] < first || v->slotRow[slot] > last) continue;
+            NEUIK_ListRow_SetSelected(cBase->elems[slot], isSelected);
         }
     }
-
-    /*------------------------------------------------------------------------*/
-    /* Draw the border of the ListGroup.                                      */
-    /*------------------------------------------------------------------------*/
-    if (!mock)
+    else
     {
-        if (neuik__HighDPI_Scaling > 1.0)
+        if (first < 0) first = 0;
+        if (last >= (int)(cBase->n_used)) last = cBase->n_used - 1;
+        for (ind = first; ind <= last; ind++)
         {
-            borderW = (int)(neuik__HighDPI_Scaling);
+            NEUIK_ListRow_SetSelected(cBase->elems[ind], isSelected);
         }
+    }
+    sel->updating--;
+}
 
-        bClr = &(lg->colorBorder);
-        SDL_SetRenderDrawColor(rend, bClr->r, bClr->g, bClr->b, 255);
 
-        offLeft   = rl.x;
-        offRight  = rl.x + (rSize->w - 1);
-        offTop    = rl.y;
-        offBottom = rl.y + (rSize->h - 1);
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_SyncSelection                                             */
+/*                                                                            */
+/*  Rebuild the selection of a regular ListGroup from the flags of its        */
+/*  ListRows if rows were added/removed or selected/deselected directly.      */
+/*  This is the only case in which all of the rows are walked.                */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_SyncSelection(
+    NEUIK_ListGroup * lg)
+{
+    int                        ind   = 0;
+    int                        nRows = 0;
+    NEUIK_Container          * cBase = NULL;
+    neuik_ListGroupSelection * sel   = NULL;
 
-        /* upper border line */
-        for (ctr = 0; ctr < borderW; ctr++)
-        {
-            SDL_RenderDrawLine(rend, 
-                offLeft,  offTop + ctr, 
-                offRight, offTop + ctr); 
-        }
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+    if (lg->virt != NULL) return 0;
+    if (neuik_Object_GetClassObject_NoError(
+        lg, neuik__Class_Container, (void**)&cBase)) return 1;
 
-        /* left border line */
-        for (ctr = 0; ctr < borderW; ctr++)
+    nRows = (cBase->elems == NULL) ? 0 : cBase->n_used;
+    if (!sel->stale && sel->nRows == nRows && 
+        sel->modCount == cBase->modCount) return 0;
+
+    sel->nRanges = 0;
+    for (ind = 0; ind < nRows; ind++)
+    {
+        if (!NEUIK_ListRow_IsSelected(cBase->elems[ind])) continue;
+
+        if (sel->nRanges > 0 && sel->ranges[2*sel->nRanges - 1] == ind - 1)
         {
-            SDL_RenderDrawLine(rend, 
-                offLeft + ctr, offTop, 
-                offLeft + ctr, offBottom); 
+            sel->ranges[2*sel->nRanges - 1] = ind;
+            continue;
         }
+        if (neuik_ListGroup_SelReserve(sel, sel->nRanges + 1)) return 1;
+        sel->ranges[2*sel->nRanges]     = ind;
+        sel->ranges[2*sel->nRanges + 1] = ind;
+        sel->nRanges++;
+    }
 
-        /* right border line */
-        for (ctr = 0; ctr < borderW; ctr++)
+    if (sel->cursor >= nRows || !neuik_ListGroup_SelContains(sel, sel->cursor))
+    {
+        sel->cursor = (sel->nRanges > 0) ? sel->ranges[0] : -1;
+    }
+    if (sel->anchor >= nRows) sel->anchor = sel->cursor;
+    sel->nRows    = nRows;
+    sel->modCount = cBase->modCount;
+    sel->stale    = 0;
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_SelectOnly                                                */
+/*                                                                            */
+/*  Make row `rowInd` the only selected row. Only the ListRows of rows which  */
+/*  were selected before (and of the new row) are touched.                    */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_SelectOnly(
+    NEUIK_ListGroup * lg,
+    int               rowInd)
+{
+    int                        ind = 0;
+    neuik_ListGroupSelection * sel = NULL;
+
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+    for (ind = 0; ind < sel->nRanges; ind++)
+    {
+        if (sel->ranges[2*ind] <= rowInd && rowInd <= sel->ranges[2*ind + 1])
         {
-            SDL_RenderDrawLine(rend, 
-                offRight - ctr, offTop, 
-                offRight - ctr, offBottom); 
+            neuik_ListGroup_SetRangeFlags(lg, sel->ranges[2*ind], rowInd - 1, 0);
+            neuik_ListGroup_SetRangeFlags(lg, rowInd + 1, sel->ranges[2*ind + 1], 0);
+            continue;
         }
+        neuik_ListGroup_SetRangeFlags(lg, 
+            sel->ranges[2*ind], sel->ranges[2*ind + 1], 0);
+    }
 
-        /* lower border line */
-        for (ctr = 0; ctr < borderW; ctr++)
+    sel->nRanges = 0;
+    if (neuik_ListGroup_SelAdd(sel, rowInd, rowInd)) return 1;
+    neuik_ListGroup_SetRangeFlags(lg, rowInd, rowInd, 1);
+    sel->cursor = rowInd;
+    sel->anchor = rowInd;
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_SelectSpan                                                */
+/*                                                                            */
+/*  Make the rows from the anchor row through row `rowInd` the selection      */
+/*  (shift-selection); the anchor row is left as it is.                       */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_SelectSpan(
+    NEUIK_ListGroup * lg,
+    int               rowInd)
+{
+    int                        ind   = 0;
+    int                        first = 0;
+    int                        last  = 0;
+    neuik_ListGroupSelection * sel   = NULL;
+
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+    if (sel->anchor < 0) sel->anchor = rowInd;
+
+    first = (sel->anchor < rowInd) ? sel->anchor : rowInd;
+    last  = (sel->anchor < rowInd) ? rowInd : sel->anchor;
+    for (ind = 0; ind < sel->nRanges; ind++)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Deselect the parts of the old ranges outside of the new span.      */
+        /*--------------------------------------------------------------------*/
+        if (sel->ranges[2*ind] < first)
         {
-            SDL_RenderDrawLine(rend, 
-                offLeft,  offBottom - ctr, 
-                offRight, offBottom - ctr); 
+            neuik_ListGroup_SetRangeFlags(lg, sel->ranges[2*ind], 
+                (sel->ranges[2*ind + 1] < first) ? 
+                    sel->ranges[2*ind + 1] : first - 1, 0);
+        }
+        if (sel->ranges[2*ind + 1] > last)
+        {
+            neuik_ListGroup_SetRangeFlags(lg, 
+                (sel->ranges[2*ind] > last) ? sel->ranges[2*ind] : last + 1, 
+                sel->ranges[2*ind + 1], 0);
         }
     }
 
-    if (cont->elems == NULL)
+    sel->nRanges = 0;
+    if (neuik_ListGroup_SelAdd(sel, first, last)) return 1;
+    neuik_ListGroup_SetRangeFlags(lg, first, last, 1);
+    sel->cursor = rowInd;
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_ToggleRow                                                 */
+/*                                                                            */
+/*  Add row `rowInd` to, or remove it from, the selection (ctrl-selection).   */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_ToggleRow(
+    NEUIK_ListGroup * lg,
+    int               rowInd)
+{
+    int                        isSelected = 0;
+    neuik_ListGroupSelection * sel        = NULL;
+
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+    isSelected = !neuik_ListGroup_SelContains(sel, rowInd);
+    if (isSelected)
     {
-        /* No elements are contained; don't do any more work here. */
-        goto out;
+        if (neuik_ListGroup_SelAdd(sel, rowInd, rowInd)) return 1;
+    }
+    else
+    {
+        if (neuik_ListGroup_SelRemove(sel, rowInd, rowInd)) return 1;
     }
+    neuik_ListGroup_SetRangeFlags(lg, rowInd, rowInd, isSelected);
+    sel->cursor = rowInd;
+    sel->anchor = rowInd;
+    return 0;
+}
 
-    /*------------------------------------------------------------------------*/
-    /* Allocate memory for the calculated maximum minimum values, the         */
-    /* VFill/HFill flags, and for the rendered row/column heights/widths.     */
-    /*------------------------------------------------------------------------*/
-    for (ctr = 0;; ctr++)
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_GetRowElem                                                */
+/*                                                                            */
+/*  Returns: The ListRow which holds row `rowInd`; NULL if the row is not     */
+/*  currently bound into a ListRow (virtual ListGroups) or out of range.     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static NEUIK_Element neuik_ListGroup_GetRowElem(
+    NEUIK_ListGroup * lg,
+    int               rowInd)
+{
+    NEUIK_Container        * cBase = NULL;
+    neuik_ListGroupVirtual * v     = NULL;
+
+    if (rowInd < 0) return NULL;
+    if (neuik_Object_GetClassObject_NoError(
+        lg, neuik__Class_Container, (void**)&cBase)) return NULL;
+    if (cBase->elems == NULL) return NULL;
+
+    if (lg->virt != NULL)
     {
-        elem = (NEUIK_Element)cont->elems[ctr];
-        if (elem == NULL) break;
+        v = (neuik_ListGroupVirtual*)(lg->virt);
+        if (v->nSlots == 0 || v->slotRow[rowInd % v->nSlots] != rowInd)
+        {
+            return NULL;
+        }
+        return cBase->elems[rowInd % v->nSlots];
     }
-    nAlloc = ctr;
 
-    allMaxMinH = malloc(nAlloc*sizeof(int));
-    if (allMaxMinH == NULL)
+    if (rowInd >= (int)(cBase->n_used)) return NULL;
+    return cBase->elems[rowInd];
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_ClickRow                                                  */
+/*                                                                            */
+/*  Update the selection after row `rowInd` was clicked; ctrl toggles the     */
+/*  row and shift selects the rows from the anchor row (if multi-selection    */
+/*  is enabled).                                                              */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_ClickRow(
+    NEUIK_ListGroup * lg,
+    int               rowInd)
+{
+    SDL_Keymod                 mods = KMOD_NONE;
+    neuik_ListGroupSelection * sel  = NULL;
+
+    sel  = (neuik_ListGroupSelection*)(lg->sel);
+    mods = SDL_GetModState();
+    if (sel->multi && (mods & KMOD_CTRL))
     {
-        eNum = 8;
-        goto out;
+        return neuik_ListGroup_ToggleRow(lg, rowInd);
     }
-    allHFill = malloc(nAlloc*sizeof(int));
-    if (allHFill == NULL)
+    else if (sel->multi && (mods & KMOD_SHIFT))
     {
-        eNum = 8;
-        goto out;
+        return neuik_ListGroup_SelectSpan(lg, rowInd);
     }
-    allVFill = malloc(nAlloc*sizeof(int));
-    if (allVFill == NULL)
+    return neuik_ListGroup_SelectOnly(lg, rowInd);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_MoveCursor                                                */
+/*                                                                            */
+/*  Move the selection cursor (keyboard navigation) to row `rowInd`. Only the */
+/*  ListRows which change are redrawn; for the usual up/down step that is the */
+/*  previous and the new row. If `extend` is set, the selection is extended  */
+/*  from the anchor row instead of replaced.                                  */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_MoveCursor(
+    NEUIK_ListGroup * lg,
+    int               rowInd,
+    int               extend)
+{
+    int                        eNum       = 0; /* which error to report (if any) */
+    NEUIK_Element              elem       = NULL;
+    NEUIK_ElementBase        * eBase      = NULL;
+    neuik_ListGroupSelection * sel        = NULL;
+    static char                funcName[] = "neuik_ListGroup_MoveCursor";
+    static char              * errMsgs[]  = {"",                       // [0] no error
+        "Argument `lg` caused `neuik_Object_GetClassObject` to fail.", // [1]
+        "Failure to update the row selection.",                        // [2]
+        "Failure in `NEUIK_ListGroup_ScrollToRow()`.",                 // [3]
+    };
+
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+    if (neuik_Object_GetClassObject(lg, neuik__Class_Element, (void**)&eBase))
     {
-        eNum = 8;
+        eNum = 1;
         goto out;
     }
-    rendRowH = malloc(nAlloc*sizeof(int));
-    if (rendRowH == NULL)
+
+    if (extend && sel->multi)
     {
-        eNum = 8;
+        if (neuik_ListGroup_SelectSpan(lg, rowInd))
+        {
+            eNum = 2;
+            goto out;
+        }
+    }
+    else if (neuik_ListGroup_SelectOnly(lg, rowInd))
+    {
+        eNum = 2;
         goto out;
     }
 
-    /*------------------------------------------------------------------------*/
-    /* Zero out the initial maximum minimum values and HFill/VFill flags.     */
-    /*------------------------------------------------------------------------*/
-    maxMinW = 0;
-    for (ctr = 0; ctr < nAlloc; ctr++)
+    if (lg->virt != NULL)
     {
-        allHFill[ctr]   = 0;
-        allMaxMinH[ctr] = 0;
-        allVFill[ctr]   = 0;
-        rendRowH[ctr]   = 0;
+        /*--------------------------------------------------------------------*/
+        /* Rows which become bound pick up their state from the selection.    */
+        /*--------------------------------------------------------------------*/
+        if (NEUIK_ListGroup_ScrollToRow(lg, rowInd))
+        {
+            eNum = 3;
+            goto out;
+        }
     }
 
     /*------------------------------------------------------------------------*/
-    /* Allocate memory for lists of contained element properties.             */
+    /* The row which loses the focus must keep its (managed) selection.       */
     /*------------------------------------------------------------------------*/
-    elemsCfg = malloc(nAlloc*sizeof(NEUIK_ElementConfig*));
-    if (elemsCfg == NULL)
+    elem = neuik_ListGroup_GetRowElem(lg, rowInd);
+    if (elem != NULL)
     {
-        eNum = 8;
-        goto out;
+        sel->updating++;
+        neuik_Window_TakeFocus(eBase->eSt.window, elem);
+        sel->updating--;
     }
-    elemsShown = malloc(nAlloc*sizeof(int));
-    if (elemsShown == NULL)
+out:
+    if (eNum > 0)
     {
-        eNum = 8;
-        goto out;
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
     }
-    elemsMinSz = malloc(nAlloc*sizeof(RenderSize));
-    if (elemsMinSz == NULL)
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_ListGroup_RowSelectionChanged
+ *
+ *  Description:   Called by a ListRow of this ListGroup when its selection 
+ *                 changed. Unless the ListGroup made the change itself, the
+ *                 selection of the ListGroup is rebuilt from the ListRows the
+ *                 next time it is needed.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_ListGroup_RowSelectionChanged(
+    NEUIK_Element lgElem)
+{
+    neuik_ListGroupSelection * sel = NULL;
+
+    if (!neuik_Object_IsClass_NoErr(lgElem, neuik__Class_ListGroup)) return;
+    sel = (neuik_ListGroupSelection*)(((NEUIK_ListGroup*)lgElem)->sel);
+    if (!sel->updating) sel->stale = 1;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_ListGroup_IsManagingSelection
+ *
+ *  Description:   Reports whether this ListGroup is currently changing the 
+ *                 selection (or focus) of its ListRows. While it is, ListRows
+ *                 which lose the focus are not deselected.
+ *
+ *  Returns:       1 if the selection is being managed; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_ListGroup_IsManagingSelection(
+    NEUIK_Element lgElem)
+{
+    neuik_ListGroupSelection * sel = NULL;
+
+    if (!neuik_Object_IsClass_NoErr(lgElem, neuik__Class_ListGroup)) return 0;
+    sel = (neuik_ListGroupSelection*)(((NEUIK_ListGroup*)lgElem)->sel);
+    return (sel->updating > 0);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_UpdateParity                                              */
+/*                                                                            */
+/*  Set the odd/even flags of the rows from their position amongst the shown */
+/*  rows (after the rows were reordered or shown/hidden).                     */
+/*                                                                            */
+/*  Returns: The number of shown rows.                                        */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_UpdateParity(
+    NEUIK_Container * cBase)
+{
+    int ctr    = 0;
+    int nShown = 0;
+
+    for (ctr = 0; ctr < (int)(cBase->n_used); ctr++)
     {
-        eNum = 8;
-        goto out;
+        if (!NEUIK_Element_IsShown(cBase->elems[ctr])) continue;
+
+        ((NEUIK_ListRow*)(cBase->elems[ctr]))->isOddRow = (nShown % 2 == 0);
+        nShown++;
     }
+    return nShown;
+}
 
-    /*------------------------------------------------------------------------*/
-    /* Zero out the values in the element minimum size array.                 */
-    /*------------------------------------------------------------------------*/
-    for (ctr = 0; ctr < nAlloc; ctr++)
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_SyncView                                                  */
+/*                                                                            */
+/*  Add the rows which were appended since the view was last updated to the  */
+/*  view (and test them against the filter). If rows were removed, moved or  */
+/*  inserted through the container (its `modCount` changed), the view is     */
+/*  rebuilt with the current order of the rows as the model order.           */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_SyncView(
+    NEUIK_ListGroup * lg)
+{
+    int                   pos     = 0;
+    int                   nRows   = 0;
+    int                   nAlloc  = 0;
+    int                   passes  = 0;
+    int                   changed = 0;
+    int                 * order   = NULL;
+    NEUIK_Element       * model   = NULL;
+    NEUIK_Element         row     = NULL;
+    NEUIK_ElementConfig * eCfg    = NULL;
+    NEUIK_Container     * cBase   = NULL;
+    neuik_ListGroupView * view    = NULL;
+
+    view = (neuik_ListGroupView*)(lg->view);
+    if (view == NULL) return 0;
+    if (neuik_Object_GetClassObject_NoError(
+        lg, neuik__Class_Container, (void**)&cBase)) return 1;
+
+    nRows = (cBase->elems == NULL) ? 0 : cBase->n_used;
+    if (cBase->modCount != view->modCount || nRows < view->nRows)
     {
-        elemsMinSz[ctr] = rsZero;
+        view->nRows    = 0;
+        view->nShown   = 0;
+        view->modCount = cBase->modCount;
     }
+    if (nRows == view->nRows) return 0;
 
-    /*------------------------------------------------------------------------*/
-    /* Store the current properties for the contained elements.               */
-    /*------------------------------------------------------------------------*/
-    for (ctr = 0;; ctr++)
+    if (nRows > view->nAlloc)
     {
-        elem = (NEUIK_Element)cont->elems[ctr];
-        if (elem == NULL) break;
+        nAlloc = (2*view->nAlloc > nRows) ? 2*view->nAlloc : nRows;
+        model = (NEUIK_Element*)realloc(view->model, 
+            nAlloc*sizeof(NEUIK_Element));
+        if (model == NULL) return 1;
+        view->model = model;
 
-        elemsShown[ctr] = NEUIK_Element_IsShown(elem);
-        if (!elemsShown[ctr]) continue;
+        order = (int*)realloc(view->order, nAlloc*sizeof(int));
+        if (order == NULL) return 1;
+        view->order  = order;
+        view->nAlloc = nAlloc;
+    }
 
-        elemsCfg[ctr] = neuik_Element_GetConfig(elem);
-        if (elemsCfg[ctr] == NULL)
+    for (pos = view->nRows; pos < nRows; pos++)
+    {
+        row = cBase->elems[pos];
+        view->model[pos] = row;
+        view->order[pos] = pos;
+
+        eCfg = neuik_Element_GetConfig(row);
+        if (eCfg == NULL) return 1;
+        if (view->filterFn != NULL)
         {
-            eNum = 9;
-            goto out;
+            passes = ((*view->filterFn)(row, pos, view->filterArg) != 0);
+            if (passes != eCfg->Show)
+            {
+                eCfg->Show = passes;
+                changed    = 1;
+            }
         }
-
-        if (neuik_Element_GetMinSize(elem, &elemsMinSz[ctr]))
+        if (eCfg->Show)
         {
-            eNum = 10;
-            goto out;
+            ((NEUIK_ListRow*)row)->isOddRow = (view->nShown % 2 == 0);
+            view->nShown++;
         }
     }
+    view->nRows = nRows;
 
     /*------------------------------------------------------------------------*/
-    /* Calculate the maximum minimum widths required for all of the columns.  */
-    /* (i.e., for each column of elements, determine the maximum value of the */
-    /* minimum widths required (among elements in the column)).               */
+    /* Rows hidden by the filter change the (stored) layout of the ListGroup. */
     /*------------------------------------------------------------------------*/
-    for (ctr = 0;; ctr++)
-    {
-        elem = (NEUIK_Element)cont->elems[ctr];
-        if (elem == NULL) break;
+    if (changed) neuik_Element_InvalidateLayout(lg);
+    return 0;
+}
 
-        if (!elemsShown[ctr]) continue; /* this elem isn't shown */
 
-        eCfg = elemsCfg[ctr];
-        rs   = &elemsMinSz[ctr];
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_AddVirtualSlots                                           */
+/*                                                                            */
+/*  Grow the pool of recycled ListRows of a virtual ListGroup to `nSlots`.   */
+/*  Since rows are bound into ListRow (rowInd % nSlots), all of the rows     */
+/*  which were previously bound must be rebound.                              */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_AddVirtualSlots(
+    NEUIK_ListGroup * lg,
+    int               nSlots)
+{
+    int                      ctr        = 0;
+    int                      eNum       = 0; /* which error to report (if any) */
+    int                    * slotRow    = NULL;
+    NEUIK_ListRow          * row        = NULL;
+    neuik_ListGroupVirtual * v          = NULL;
+    static char              funcName[] = "neuik_ListGroup_AddVirtualSlots";
+    static char            * errMsgs[]  = {"",                         // [0] no error
+        "Failure to reallocate memory.",                               // [1]
+        "Failure in `NEUIK_NewListRow()`.",                            // [2]
+        "Failure in `NEUIK_Container_Reserve()`.",                     // [3]
+        "Failure in `neuik_Container_InsertElements()`.",              // [4]
+    };
 
-        tempW = rs->w + (eCfg->PadLeft + eCfg->PadRight);
-        if (tempW > maxMinW)
+    v = (neuik_ListGroupVirtual*)(lg->virt);
+    if (nSlots <= v->nSlots) goto out;
+
+    slotRow = (int*)realloc(v->slotRow, nSlots*sizeof(int));
+    if (slotRow == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    v->slotRow = slotRow;
+
+    if (NEUIK_Container_Reserve(lg, nSlots))
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    for (ctr = 0; ctr < v->nSlots; ctr++)
+    {
+        if (v->slotRow[ctr] != NEUIK_LISTGROUP_UNBOUND)
         {
-            maxMinW = tempW;
+            v->slotRow[ctr] = NEUIK_LISTGROUP_STALE;
         }
+    }
 
-        allMaxMinH[ctr] = rs->h + (eCfg->PadTop + eCfg->PadBottom);
-
-        /*--------------------------------------------------------------------*/
-        /* Check if the element can fill horizontally and if so, mark the     */
-        /* whole listgroup as one that can fill horizontally.                 */
-        /*--------------------------------------------------------------------*/
-        if (eCfg->HFill)
+    for (; v->nSlots < nSlots; v->nSlots++)
+    {
+        if (NEUIK_NewListRow(&row))
         {
-            allHFill[ctr] = 1;
+            eNum = 2;
+            goto out;
         }
-        /*--------------------------------------------------------------------*/
-        /* Check if the element can fill vertically and if so, mark the whole */
-        /* listGroup as one that can fill vertically.                         */
-        /*--------------------------------------------------------------------*/
-        if (eCfg->VFill)
+        if (neuik_Container_InsertElements(lg, v->nSlots, 1, 
+            (NEUIK_Element*)&row))
         {
-            allVFill[ctr] = 1;
+            eNum = 4;
+            goto out;
         }
+        v->slotRow[v->nSlots] = NEUIK_LISTGROUP_UNBOUND;
     }
-
-    /*========================================================================*/
-    /* Calculation of rendered row heights (accounts for VFill).              */
-    /*========================================================================*/
-    /* Determine the required minimum height and the total number of rows     */
-    /* which can fill vertically.                                             */
-    /*------------------------------------------------------------------------*/
-    for (ctr = 0; ctr < nAlloc; ctr++)
+out:
+    if (eNum > 0)
     {
-        elem = (NEUIK_Element)cont->elems[ctr];
-        if (elem == NULL) break;
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
 
-        if (!elemsShown[ctr]) continue; /* this elem isn't shown */
+    return eNum;
+}
 
-        eCfg  = elemsCfg[ctr];
-        rs    = &elemsMinSz[ctr];
-        tempH = rs->h + (eCfg->PadTop + eCfg->PadBottom);
-        allMaxMinH[ctr] = tempH;
 
-        rsMin.h += allMaxMinH[ctr];
-        nVFill += allVFill[ctr];
-    }
-    if (nAlloc > 1)
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_BindVirtualRows                                           */
+/*                                                                            */
+/*  Make sure that the shown rows of a virtual ListGroup (and the overscan    */
+/*  rows around them) are bound into the recycled ListRows. Only ListRows     */
+/*  which change the row they hold are rebound; ListRows which do not hold a  */
+/*  shown row are hidden.                                                     */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_BindVirtualRows(
+    NEUIK_ListGroup * lg)
+{
+    int                      slot       = 0;
+    int                      rowInd     = 0;
+    int                      firstRow   = 0; /* first bound row */
+    int                      lastRow    = 0; /* one past the last bound row */
+    int                      nNeeded    = 0; /* number of ListRows needed */
+    int                      isShown    = 0;
+    int                      changed    = 0;
+    int                      eNum       = 0; /* which error to report (if any) */
+    NEUIK_Container        * cBase      = NULL;
+    NEUIK_ListRow          * row        = NULL;
+    NEUIK_ElementConfig    * eCfg       = NULL;
+    neuik_ListGroupVirtual * v          = NULL;
+    static char              funcName[] = "neuik_ListGroup_BindVirtualRows";
+    static char            * errMsgs[]  = {"",                         // [0] no error
+        "Argument `lg` caused `neuik_Object_GetClassObject` to fail.", // [1]
+        "Failure in `neuik_ListGroup_AddVirtualSlots()`.",             // [2]
+        "Element_GetConfig returned NULL.",                            // [3]
+        "The row bind function reported an error.",                    // [4]
+        "Failure in `neuik_Container_RequestFullRedraw()`.",           // [5]
+    };
+
+    v = (neuik_ListGroupVirtual*)(lg->virt);
+    if (neuik_Object_GetClassObject(lg, neuik__Class_Container, (void**)&cBase))
     {
-        rsMin.h += (int)(fltVspacingSc*(float)(nAlloc - 1));
+        eNum = 1;
+        goto out;
     }
 
-    /*------------------------------------------------------------------------*/
-    /* Calculate the space occupied by all VFill rows and determine the value */
-    /* of the largest minimum row height among vertically filling rows.       */
-    /*------------------------------------------------------------------------*/
-    for (ctr = 0; ctr < nAlloc; ctr++)
+    if (v->nShown < 1) v->nShown = 1;
+    if (v->topRow > v->nRows - v->nShown) v->topRow = v->nRows - v->nShown;
+    if (v->topRow < 0)                    v->topRow = 0;
+
+    nNeeded = v->nShown + 2*NEUIK_LISTGROUP_OVERSCAN;
+    if (nNeeded > v->nRows) nNeeded = v->nRows;
+    if (neuik_ListGroup_AddVirtualSlots(lg, nNeeded))
     {
-        if (allVFill[ctr])
-        {
-            vfillRowsMinH += allMaxMinH[ctr];
-            if (vfillMaxMinH < allMaxMinH[ctr])
-            {
-                vfillMaxMinH = allMaxMinH[ctr];
-            }
-        }
+        eNum = 2;
+        goto out;
     }
 
-    /*------------------------------------------------------------------------*/
-    /* Calculate the amount of currently unused vertical space (beyond min).  */
-    /*------------------------------------------------------------------------*/
-    yFree = rSize->h - rsMin.h;
+    firstRow = v->topRow - NEUIK_LISTGROUP_OVERSCAN;
+    if (firstRow < 0) firstRow = 0;
+    lastRow = v->topRow + v->nShown + NEUIK_LISTGROUP_OVERSCAN;
+    if (lastRow > v->nRows) lastRow = v->nRows;
 
-    /*------------------------------------------------------------------------*/
-    /* Check if there is enough unused vertical space to bring all VFill rows */
-    /* to the same height.                                                    */
-    /*------------------------------------------------------------------------*/
-    reqResizeH = nVFill*vfillMaxMinH - vfillRowsMinH; // required resize height
-    if (yFree >= reqResizeH)
+    for (slot = 0; slot < v->nSlots; slot++)
     {
-        /*--------------------------------------------------------------------*/
-        /* There is enough space; get all VFill rows to the same size first.  */
-        /*--------------------------------------------------------------------*/
-        for (ctr = 0; ctr < nAlloc; ctr++)
+        row  = (NEUIK_ListRow*)(cBase->elems[slot]);
+        eCfg = neuik_Element_GetConfig(row);
+        if (eCfg == NULL)
         {
-            rendRowH[ctr] = allMaxMinH[ctr];
-            if (allVFill[ctr])
-            {
-                rendRowH[ctr] = vfillMaxMinH;
-            }
+            eNum = 3;
+            goto out;
         }
 
         /*--------------------------------------------------------------------*/
-        /* Evenly divide the remaining vSpace between the vFill rows.         */
+        /* The (only) row within [firstRow, lastRow) which maps to this slot. */
         /*--------------------------------------------------------------------*/
-        yFree -= reqResizeH;
+        rowInd = lastRow;
+        if (v->nSlots > 0)
+        {
+            rowInd = firstRow + 
+                ((slot - firstRow%v->nSlots) + v->nSlots) % v->nSlots;
+        }
+        if (rowInd >= lastRow)
+        {
+            eCfg->Show = 0;
+            continue;
+        }
 
-        dH = (int)(floor( (float)(yFree)/(float)(nVFill) ));
-        if (dH > 0)
+        changed = 0;
+        if (v->slotRow[slot] != rowInd)
         {
-            /*----------------------------------------------------------------*/
-            /* Increase the height of vFill rows all by the same quantity.    */
-            /*----------------------------------------------------------------*/
-            for (ctr = 0; ctr < nAlloc; ctr++)
+            if ((*v->bindFn)(row, rowInd, 
+                v->slotRow[slot] == NEUIK_LISTGROUP_UNBOUND, v->bindArg))
             {
-                if (allVFill[ctr])
-                {
-                    rendRowH[ctr] += dH;
-                    yFree -= dH;
-                }
+                eNum = 4;
+                goto out;
             }
+            v->slotRow[slot] = rowInd;
+
+            row->isOddRow = 0;
+            if ((rowInd+1) % 2 == 1) row->isOddRow = 1;
+            row->selected = neuik_ListGroup_SelContains(
+                (neuik_ListGroupSelection*)(lg->sel), rowInd);
+            changed = 1;
         }
 
-        if (yFree > 0)
+        isShown = (rowInd >= v->topRow && rowInd < v->topRow + v->nShown);
+        if (eCfg->Show != isShown)
         {
-            /*----------------------------------------------------------------*/
-            /* Distribute the remaining vSpace to the vFill one pixel at a    */
-            /* time (starting from the top row and moving down).              */
-            /*----------------------------------------------------------------*/
-            for (ctr = 0; ctr < nAlloc; ctr++)
+            eCfg->Show = isShown;
+            changed    = 1;
+        }
+
+        if (changed && isShown)
+        {
+            if (neuik_Container_RequestFullRedraw(row))
             {
-                if (allVFill[ctr])
-                {
-                    rendRowH[ctr] += 1;
-                    yFree -= 1;
-                    if (yFree == 0)
-                    {
-                        break;
-                    }
-                }
+                eNum = 5;
+                goto out;
             }
         }
     }
-    else
+out:
+    if (eNum > 0)
     {
-        /*--------------------------------------------------------------------*/
-        /* Evenly divide the remaining vSpace between the vFill rows.         */
-        /*--------------------------------------------------------------------*/
-        if (yFree == 0)
-        {
-            /*----------------------------------------------------------------*/
-            /* There isn't enough space for any resizing.                     */
-            /*----------------------------------------------------------------*/
-            for (ctr = 0; ctr < nAlloc; ctr++)
-            {
-                rendRowH[ctr] = allMaxMinH[ctr];
-            }
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_ScrollVirtual                                             */
+/*                                                                            */
+/*  Scroll a virtual ListGroup so that `topRow` is the first shown row.       */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_ScrollVirtual(
+    NEUIK_ListGroup * lg,
+    int               topRow)
+{
+    int                      eNum       = 0; /* which error to report (if any) */
+    neuik_ListGroupVirtual * v          = NULL;
+    static char              funcName[] = "neuik_ListGroup_ScrollVirtual";
+    static char            * errMsgs[]  = {"",                 // [0] no error
+        "Failure in `neuik_ListGroup_BindVirtualRows()`.",     // [1]
+        "Failure in `neuik_Container_RequestFullRedraw()`.",   // [2]
+    };
+
+    v = (neuik_ListGroupVirtual*)(lg->virt);
+    v->topRow = topRow;
+    if (neuik_ListGroup_BindVirtualRows(lg))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Every shown row moves; redraw the whole ListGroup.                     */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Container_RequestFullRedraw(lg))
+    {
+        eNum = 2;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_RenderVirtualRows                                         */
+/*                                                                            */
+/*  Lay out and render the shown rows of a virtual ListGroup. All rows share  */
+/*  one height (the largest minimum height of the rows bound so far), so the  */
+/*  position of a row follows from its index and the work done here depends   */
+/*  only on the number of rows which fit in the ListGroup.                    */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_RenderVirtualRows(
+    NEUIK_ListGroup * lg,
+    RenderSize      * rSize,
+    RenderLoc       * rlMod,
+    SDL_Renderer    * rend,
+    int               mock,
+    int               borderW,
+    float             vSpacing)
+{
+    int                      slot       = 0;
+    int                      pass       = 0;
+    int                      tempH      = 0;
+    int                      maxH       = 0;
+    int                      availH     = 0;
+    int                      eNum       = 0; /* which error to report (if any) */
+    RenderSize               rs         = {0, 0};
+    RenderLoc                rl         = {0, 0};
+    RenderLoc                rlRel      = {0, 0};
+    SDL_Rect                 rect       = {0, 0, 0, 0};
+    enum neuik_HJustify      hJustify;
+    enum neuik_VJustify      vJustify;
+    NEUIK_Element            elem       = NULL;
+    NEUIK_ElementConfig    * eCfg       = NULL;
+    NEUIK_ElementBase      * eBase      = NULL;
+    NEUIK_Container        * cBase      = NULL;
+    neuik_ListGroupVirtual * v          = NULL;
+    static char              funcName[] = "neuik_ListGroup_RenderVirtualRows";
+    static char            * errMsgs[]  = {"",                         // [0] no error
+        "Argument `lg` caused `neuik_Object_GetClassObject` to fail.", // [1]
+        "Failure in `neuik_ListGroup_BindVirtualRows()`.",             // [2]
+        "Element_GetConfig returned NULL.",                            // [3]
+        "Element_GetMinSize Failed.",                                  // [4]
+        "Failure in `neuik_Element_Render()`",                         // [5]
+    };
+
+    v = (neuik_ListGroupVirtual*)(lg->virt);
+    if (neuik_Object_GetClassObject(lg, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(lg, neuik__Class_Container, (void**)&cBase))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    availH = rSize->h - 2*borderW;
+    if (availH < 0) availH = 0;
 
+    /*------------------------------------------------------------------------*/
+    /* Bind the rows which fit and measure them; should one of them be taller */
+    /* than the current row height, the number of rows which fit changes and  */
+    /* the rows are rebound. The row height only grows so this settles fast.  */
+    /*------------------------------------------------------------------------*/
+    for (pass = 0; pass < 3; pass++)
+    {
+        v->nShown = 1;
+        if (v->rowH > 0)
+        {
+            v->nShown = (int)(((float)(availH) + vSpacing)/
+                ((float)(v->rowH) + vSpacing));
         }
-        else
+        if (neuik_ListGroup_BindVirtualRows(lg))
         {
-            while (yFree > 0)
+            eNum = 2;
+            goto out;
+        }
+
+        maxH = v->rowH;
+        for (slot = 0; slot < v->nSlots; slot++)
+        {
+            elem = cBase->elems[slot];
+            if (!NEUIK_Element_IsShown(elem)) continue;
+
+            eCfg = neuik_Element_GetConfig(elem);
+            if (eCfg == NULL)
             {
-                /*------------------------------------------------------------*/
-                /* Distribute the remaining vSpace to the vFill one pixel at  */
-                /* a time (starting from the top row and moving down).        */
-                /*------------------------------------------------------------*/
-                for (ctr = 0; ctr < nAlloc; ctr++)
-                {
-                    if (allVFill[ctr] && rendRowH[ctr] < vfillMaxMinH)
-                    {
-                        rendRowH[ctr] += 1;
-                        yFree -= 1;
-                        if (yFree == 0)
-                        {
-                            break;
-                        }
-                    }
-                }
+                eNum = 3;
+                goto out;
             }
+            if (neuik_Element_GetMinSize(elem, &rs))
+            {
+                eNum = 4;
+                goto out;
+            }
+            tempH = rs.h + (eCfg->PadTop + eCfg->PadBottom);
+            if (tempH > maxH) maxH = tempH;
         }
+        if (maxH == v->rowH) break;
+        v->rowH = maxH;
     }
 
-    /*========================================================================*/
-    /* Render and place the child elements                                    */
-    /*========================================================================*/
-    xOffset = borderW;
-    yPos = (float)(borderW);
-    for (ctr = 0; ctr < nAlloc; ctr++)
+    /*------------------------------------------------------------------------*/
+    /* Render and place the shown rows.                                       */
+    /*------------------------------------------------------------------------*/
+    for (slot = 0; slot < v->nSlots; slot++)
     {
-        if (ctr > 0)
+        elem = cBase->elems[slot];
+        if (!NEUIK_Element_IsShown(elem)) continue;
+        if (!neuik_Element_NeedsRedraw(elem)) continue;
+
+        eCfg = neuik_Element_GetConfig(elem);
+        if (eCfg == NULL)
         {
-            yPos += (float)(rendRowH[ctr-1]) + fltVspacingSc;
+            eNum = 3;
+            goto out;
+        }
+        if (neuik_Element_GetMinSize(elem, &rs))
+        {
+            eNum = 4;
+            goto out;
         }
-        if (!elemsShown[ctr]) continue; /* this elem isn't shown */
-
-        elem = cont->elems[ctr];
-        if (!neuik_Element_NeedsRedraw(elem)) continue;
 
-        eCfg = elemsCfg[ctr];
-        rs   = &elemsMinSz[ctr];
+        if (eCfg->HFill)
+        {
+            rs.w = rSize->w - (eCfg->PadLeft + eCfg->PadRight) - 2*borderW + 1;
+        }
+        if (eCfg->VFill)
+        {
+            rs.h = v->rowH - (eCfg->PadTop + eCfg->PadBottom);
+        }
 
-        tempH = rendRowH[ctr];
+        hJustify = eCfg->HJustify;
+        if (hJustify == NEUIK_HJUSTIFY_DEFAULT) hJustify = cBase->HJustify;
+        vJustify = eCfg->VJustify;
+        if (vJustify == NEUIK_VJUSTIFY_DEFAULT) vJustify = cBase->VJustify;
 
-        /*--------------------------------------------------------------------*/
-        /* Check for and apply if necessary Horizontal and Vertical fill.     */
-        /*--------------------------------------------------------------------*/
-        if (allHFill[ctr])
+        switch (hJustify)
         {
-            rs->w = rSize->w - (eCfg->PadLeft + eCfg->PadRight) - 2*xOffset + 1;
+            case NEUIK_HJUSTIFY_LEFT:
+                rect.x = eCfg->PadLeft;
+                break;
+            case NEUIK_HJUSTIFY_RIGHT:
+                rect.x = rSize->w - (rs.w + eCfg->PadRight);
+                break;
+            default:
+                rect.x = (rSize->w/2) - (rs.w/2);
+                break;
         }
-        if (allVFill[ctr])
+
+        rect.y = borderW + (int)((float)(v->slotRow[slot] - v->topRow)*
+            ((float)(v->rowH) + vSpacing));
+        switch (vJustify)
         {
-            rs->h = tempH - (eCfg->PadTop + eCfg->PadBottom);
+            case NEUIK_VJUSTIFY_TOP:
+                rect.y += eCfg->PadTop;
+                break;
+            case NEUIK_VJUSTIFY_BOTTOM:
+                rect.y += v->rowH - (rs.h + eCfg->PadBottom);
+                break;
+            default:
+                rect.y += (v->rowH - rs.h)/2;
+                break;
         }
 
+        rl.x = (eBase->eSt.rLoc).x + rect.x;
+        rl.y = (eBase->eSt.rLoc).y + rect.y;
+        rlRel.x = rect.x;
+        rlRel.y = rect.y;
+        neuik_Element_StoreSizeAndLocation(elem, rs, rl, rlRel);
+
+        if (neuik_Element_Render(elem, &rs, rlMod, rend, mock))
+        {
+            eNum = 5;
+            goto out;
+        }
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_GetMinSize__ListGroup
+ *
+ *  Description:   Returns the minimum rendered size of a given FlowGroup.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Element_GetMinSize__ListGroup(
+    NEUIK_Element    lgElem,
+    RenderSize     * rSize)
+{
+    if (rSize != NULL)
+    {
+        rSize->w = 1;
+        rSize->h = 1;
+    }
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_Render__ListGroup
+ *
+ *  Description:   Renders a vertical group of listRows.
+ *
+ *  Returns:       0 if there were no issues; otherwise 1.
+ *
+ ******************************************************************************/
+int neuik_Element_Render__ListGroup(
+    NEUIK_Element   lgElem,
+    RenderSize    * rSize, /* in/out the size the tex occupies when complete */
+    RenderLoc     * rlMod, /* A relative location modifier (for rendering) */
+    SDL_Renderer  * xRend, /* the external renderer to prepare the texture for */
+    int             mock)  /* If true; calculate sizes/locations but don't draw */
+{
+    int                    nAlloc        = 0;
+    int                    borderW       = 1; /* width of border line */
+    int                    xOffset       = 0; /* offset from left for rows */
+    int                    tempH         = 0;
+    int                    tempW         = 0;
+    int                    offLeft       = 0;
+    int                    offRight      = 0;
+    int                    offTop        = 0;
+    int                    offBottom     = 0;
+    int                    ctr           = 0;
+    int                    yFree         = 0; // px of space free for vFill elems
+    int                    dH            = 0; // Change in height [px]
+    int                    eNum          = 0; // which error to report (if any)
+    int                    nVFill        = 0; // number of rows which can VFill
+    int                    reqResizeH    = 0; // required resize height
+    int                    vfillRowsMinH = 0; // min height for all vFill rows
+    int                    vfillMaxMinH  = 0; // largest minimum row height 
+                                              // among vertically filling rows.
+    int                  * allHFill      = NULL; // Free upon returning; 
+                                                 // Cols fills vertically? (per col)
+    int                  * allVFill      = NULL; // Free upon returning; 
+                                                 // Row fills vertically? (per row)
+    int                  * allMaxMinH    = NULL; // Free upon returning; 
+                                                 // The max min width (per row)
+    int                    maxMinW       = 0;    // The max min width
+    int                  * rendRowH      = NULL; // Free upon returning; 
+                                                 // Rendered row height (per row)
+    int                  * elemsShown    = NULL; // Free upon returning.
+    float                  fltVspacingSc = 0.0;  // float VSpacing HighDPI scaled
+    float                  yPos          = 0.0;
+    RenderSize           * elemsMinSz    = NULL; // Free upon returning.
+    NEUIK_ElementConfig ** elemsCfg      = NULL; // Free upon returning.
+    RenderLoc              rl            = {0, 0};
+    RenderLoc              rlRel         = {0, 0}; /* renderloc relative to parent */
+    RenderLoc              rlOld         = {0, 0}; /* stored loc before layout */
+    RenderSize             rsOld         = {0, 0}; /* stored size before layout */
+    SDL_Rect               rect          = {0, 0, 0, 0};
+    static RenderSize      rsZero        = {0, 0};
+    RenderSize             rsMin         = {0, 0};
+    RenderSize           * rs            = NULL;
+    const NEUIK_Color    * bClr          = NULL; /* border color */
+    SDL_Renderer         * rend          = NULL;
+    NEUIK_Container      * cont          = NULL;
+    NEUIK_ElementBase    * eBase         = NULL;
+    NEUIK_Element          elem          = NULL;
+    NEUIK_ElementConfig  * eCfg          = NULL;
+    NEUIK_ListGroup      * lg            = NULL;
+    neuik_MaskMap        * maskMap       = NULL; /* FREE upon return */
+    enum neuik_bgstyle     bgStyle;
+    static char           funcName[]     = "neuik_Element_Render__ListGroup";
+    static char          * errMsgs[]     = {"", // [0] no error
+        "Argument `lgElem` is not of ListGroup class.",                    // [1]
+        "Argument `lgElem` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Invalid specified `rSize` (negative values).",                    // [3]
+        "Failure in `neuik_Element_GetCurrentBGStyle()`.",                 // [4]
+        "Failure in `neuik_MakeMaskMap()`",                                // [5]
+        "Failure in `neuik_Window_FillTranspMaskFromLoc()`",               // [6]
+        "Failure in neuik_Element_RedrawBackground().",                    // [7]
+        "Failure to allocate memory.",                                     // [8]
+        "Element_GetConfig returned NULL.",                                // [9]
+        "Element_GetMinSize Failed.",                                      // [10]
+        "Failure in `neuik_Element_Render()`",                             // [11]
+        "Failure in `neuik_ListGroup_RenderVirtualRows()`",                // [12]
+        "Failure in `neuik_Element_GetSizeAndLocation()`",                 // [13]
+    };
+
+    if (!neuik_Object_IsClass(lgElem, neuik__Class_ListGroup))
+    {
+        eNum = 1;
+        goto out;
+    }
+    lg = (NEUIK_ListGroup*)lgElem;
+
+    if (neuik_Object_GetClassObject(lgElem, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(lgElem, neuik__Class_Container, (void**)&cont))
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    if (rSize->w < 0 || rSize->h < 0)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    eBase->eSt.rend = xRend;
+    rend = eBase->eSt.rend;
+
+    if (neuik__HighDPI_Scaling <= 1.0)
+    {
+        fltVspacingSc = (float)(lg->VSpacing);
+    }
+    else
+    {
+        fltVspacingSc = (float)(lg->VSpacing)*neuik__HighDPI_Scaling;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Redraw the background surface before continuing.                       */
+    /*------------------------------------------------------------------------*/
+    if (!mock)
+    {
+        if (neuik_Element_GetCurrentBGStyle(lgElem, &bgStyle))
+        {
+            eNum = 4;
+            goto out;
+        }
+        if (bgStyle != NEUIK_BGSTYLE_TRANSPARENT)
+        {
+            /*----------------------------------------------------------------*/
+            /* Create a MaskMap an mark off the trasnparent pixels.           */
+            /*----------------------------------------------------------------*/
+            if (neuik_MakeMaskMap(&maskMap, rSize->w, rSize->h))
+            {
+                eNum = 5;
+                goto out;
+            }
+
+            rl = eBase->eSt.rLoc;
+            if (neuik_Window_FillTranspMaskFromLoc(
+                    eBase->eSt.window, maskMap, rl.x, rl.y))
+            {
+                eNum = 6;
+                goto out;
+            }
+
+            if (neuik_Element_RedrawBackground(lgElem, rlMod, maskMap))
+            {
+                eNum = 7;
+                goto out;
+            }
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Draw the border of the ListGroup.                                      */
+    /*------------------------------------------------------------------------*/
+    if (!mock)
+    {
+        if (neuik__HighDPI_Scaling > 1.0)
+        {
+            borderW = (int)(neuik__HighDPI_Scaling);
+        }
+
+        bClr = &(lg->colorBorder);
+        SDL_SetRenderDrawColor(rend, bClr->r, bClr->g, bClr->b, 255);
+
+        offLeft   = rl.x;
+        offRight  = rl.x + (rSize->w - 1);
+        offTop    = rl.y;
+        offBottom = rl.y + (rSize->h - 1);
+
+        /* upper border line */
+        for (ctr = 0; ctr < borderW; ctr++)
+        {
+            SDL_RenderDrawLine(rend, 
+                offLeft,  offTop + ctr, 
+                offRight, offTop + ctr); 
+        }
+
+        /* left border line */
+        for (ctr = 0; ctr < borderW; ctr++)
+        {
+            SDL_RenderDrawLine(rend, 
+                offLeft + ctr, offTop, 
+                offLeft + ctr, offBottom); 
+        }
+
+        /* right border line */
+        for (ctr = 0; ctr < borderW; ctr++)
+        {
+            SDL_RenderDrawLine(rend, 
+                offRight - ctr, offTop, 
+                offRight - ctr, offBottom); 
+        }
+
+        /* lower border line */
+        for (ctr = 0; ctr < borderW; ctr++)
+        {
+            SDL_RenderDrawLine(rend, 
+                offLeft,  offBottom - ctr, 
+                offRight, offBottom - ctr); 
+        }
+    }
+
+    if (lg->virt != NULL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Virtual ListGroups only lay out the rows which fit.                */
+        /*--------------------------------------------------------------------*/
+        if (neuik_ListGroup_RenderVirtualRows(lg, rSize, rlMod, rend, mock,
+            borderW, fltVspacingSc))
+        {
+            eNum = 12;
+            goto out;
+        }
+        goto out;
+    }
+
+    if (cont->elems == NULL)
+    {
+        /* No elements are contained; don't do any more work here. */
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* If nothing which affects the placement of the rows has changed since   */
+    /* the last layout, render them where they already are.                   */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Element_IsLayoutValid(lgElem, rSize))
+    {
+        if (neuik_Container_RenderStoredLayout(lgElem, rlMod, rend, mock))
+        {
+            eNum = 11;
+            goto out;
+        }
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Allocate memory for the calculated maximum minimum values, the         */
+    /* VFill/HFill flags, and for the rendered row/column heights/widths.     */
+    /*------------------------------------------------------------------------*/
+    nAlloc = cont->n_used;
+
+    allMaxMinH = malloc(nAlloc*sizeof(int));
+    if (allMaxMinH == NULL)
+    {
+        eNum = 8;
+        goto out;
+    }
+    allHFill = malloc(nAlloc*sizeof(int));
+    if (allHFill == NULL)
+    {
+        eNum = 8;
+        goto out;
+    }
+    allVFill = malloc(nAlloc*sizeof(int));
+    if (allVFill == NULL)
+    {
+        eNum = 8;
+        goto out;
+    }
+    rendRowH = malloc(nAlloc*sizeof(int));
+    if (rendRowH == NULL)
+    {
+        eNum = 8;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Zero out the initial maximum minimum values and HFill/VFill flags.     */
+    /*------------------------------------------------------------------------*/
+    maxMinW = 0;
+    for (ctr = 0; ctr < nAlloc; ctr++)
+    {
+        allHFill[ctr]   = 0;
+        allMaxMinH[ctr] = 0;
+        allVFill[ctr]   = 0;
+        rendRowH[ctr]   = 0;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Allocate memory for lists of contained element properties.             */
+    /*------------------------------------------------------------------------*/
+    elemsCfg = malloc(nAlloc*sizeof(NEUIK_ElementConfig*));
+    if (elemsCfg == NULL)
+    {
+        eNum = 8;
+        goto out;
+    }
+    elemsShown = malloc(nAlloc*sizeof(int));
+    if (elemsShown == NULL)
+    {
+        eNum = 8;
+        goto out;
+    }
+    elemsMinSz = malloc(nAlloc*sizeof(RenderSize));
+    if (elemsMinSz == NULL)
+    {
+        eNum = 8;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Zero out the values in the element minimum size array.                 */
+    /*------------------------------------------------------------------------*/
+    for (ctr = 0; ctr < nAlloc; ctr++)
+    {
+        elemsMinSz[ctr] = rsZero;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Store the current properties for the contained elements.               */
+    /*------------------------------------------------------------------------*/
+    for (ctr = 0;; ctr++)
+    {
+        elem = (NEUIK_Element)cont->elems[ctr];
+        if (elem == NULL) break;
+
+        elemsShown[ctr] = NEUIK_Element_IsShown(elem);
+        if (!elemsShown[ctr]) continue;
+
+        elemsCfg[ctr] = neuik_Element_GetConfig(elem);
+        if (elemsCfg[ctr] == NULL)
+        {
+            eNum = 9;
+            goto out;
+        }
+
+        if (neuik_Element_GetMinSize(elem, &elemsMinSz[ctr]))
+        {
+            eNum = 10;
+            goto out;
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Calculate the maximum minimum widths required for all of the columns.  */
+    /* (i.e., for each column of elements, determine the maximum value of the */
+    /* minimum widths required (among elements in the column)).               */
+    /*------------------------------------------------------------------------*/
+    for (ctr = 0;; ctr++)
+    {
+        elem = (NEUIK_Element)cont->elems[ctr];
+        if (elem == NULL) break;
+
+        if (!elemsShown[ctr]) continue; /* this elem isn't shown */
+
+        eCfg = elemsCfg[ctr];
+        rs   = &elemsMinSz[ctr];
+
+        tempW = rs->w + (eCfg->PadLeft + eCfg->PadRight);
+        if (tempW > maxMinW)
+        {
+            maxMinW = tempW;
+        }
+
+        allMaxMinH[ctr] = rs->h + (eCfg->PadTop + eCfg->PadBottom);
+
+        /*--------------------------------------------------------------------*/
+        /* Check if the element can fill horizontally and if so, mark the     */
+        /* whole listgroup as one that can fill horizontally.                 */
+        /*--------------------------------------------------------------------*/
+        if (eCfg->HFill)
+        {
+            allHFill[ctr] = 1;
+        }
+        /*--------------------------------------------------------------------*/
+        /* Check if the element can fill vertically and if so, mark the whole */
+        /* listGroup as one that can fill vertically.                         */
+        /*--------------------------------------------------------------------*/
+        if (eCfg->VFill)
+        {
+            allVFill[ctr] = 1;
+        }
+    }
+
+    /*========================================================================*/
+    /* Calculation of rendered row heights (accounts for VFill).              */
+    /*========================================================================*/
+    /* Determine the required minimum height and the total number of rows     */
+    /* which can fill vertically.                                             */
+    /*------------------------------------------------------------------------*/
+    for (ctr = 0; ctr < nAlloc; ctr++)
+    {
+        elem = (NEUIK_Element)cont->elems[ctr];
+        if (elem == NULL) break;
+
+        if (!elemsShown[ctr]) continue; /* this elem isn't shown */
+
+        eCfg  = elemsCfg[ctr];
+        rs    = &elemsMinSz[ctr];
+        tempH = rs->h + (eCfg->PadTop + eCfg->PadBottom);
+        allMaxMinH[ctr] = tempH;
+
+        rsMin.h += allMaxMinH[ctr];
+        nVFill += allVFill[ctr];
+    }
+    if (nAlloc > 1)
+    {
+        rsMin.h += (int)(fltVspacingSc*(float)(nAlloc - 1));
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Calculate the space occupied by all VFill rows and determine the value */
+    /* of the largest minimum row height among vertically filling rows.       */
+    /*------------------------------------------------------------------------*/
+    for (ctr = 0; ctr < nAlloc; ctr++)
+    {
+        if (allVFill[ctr])
+        {
+            vfillRowsMinH += allMaxMinH[ctr];
+            if (vfillMaxMinH < allMaxMinH[ctr])
+            {
+                vfillMaxMinH = allMaxMinH[ctr];
+            }
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Calculate the amount of currently unused vertical space (beyond min).  */
+    /*------------------------------------------------------------------------*/
+    yFree = rSize->h - rsMin.h;
+
+    /*------------------------------------------------------------------------*/
+    /* Check if there is enough unused vertical space to bring all VFill rows */
+    /* to the same height.                                                    */
+    /*------------------------------------------------------------------------*/
+    reqResizeH = nVFill*vfillMaxMinH - vfillRowsMinH; // required resize height
+    if (yFree >= reqResizeH)
+    {
+        /*--------------------------------------------------------------------*/
+        /* There is enough space; get all VFill rows to the same size first.  */
+        /*--------------------------------------------------------------------*/
+        for (ctr = 0; ctr < nAlloc; ctr++)
+        {
+            rendRowH[ctr] = allMaxMinH[ctr];
+            if (allVFill[ctr])
+            {
+                rendRowH[ctr] = vfillMaxMinH;
+            }
+        }
+
+        /*--------------------------------------------------------------------*/
+        /* Evenly divide the remaining vSpace between the vFill rows.         */
+        /*--------------------------------------------------------------------*/
+        yFree -= reqResizeH;
+
+        dH = (int)(floor( (float)(yFree)/(float)(nVFill) ));
+        if (dH > 0)
+        {
+            /*----------------------------------------------------------------*/
+            /* Increase the height of vFill rows all by the same quantity.    */
+            /*----------------------------------------------------------------*/
+            for (ctr = 0; ctr < nAlloc; ctr++)
+            {
+                if (allVFill[ctr])
+                {
+                    rendRowH[ctr] += dH;
+                    yFree -= dH;
+                }
+            }
+        }
+
+        if (yFree > 0)
+        {
+            /*----------------------------------------------------------------*/
+            /* Distribute the remaining vSpace to the vFill one pixel at a    */
+            /* time (starting from the top row and moving down).              */
+            /*----------------------------------------------------------------*/
+            for (ctr = 0; ctr < nAlloc; ctr++)
+            {
+                if (allVFill[ctr])
+                {
+                    rendRowH[ctr] += 1;
+                    yFree -= 1;
+                    if (yFree == 0)
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        /*--------------------------------------------------------------------*/
+        /* Evenly divide the remaining vSpace between the vFill rows.         */
+        /*--------------------------------------------------------------------*/
+        if (yFree == 0)
+        {
+            /*----------------------------------------------------------------*/
+            /* There isn't enough space for any resizing.                     */
+            /*----------------------------------------------------------------*/
+            for (ctr = 0; ctr < nAlloc; ctr++)
+            {
+                rendRowH[ctr] = allMaxMinH[ctr];
+            }
+
+        }
+        else
+        {
+            while (yFree > 0)
+            {
+                /*------------------------------------------------------------*/
+                /* Distribute the remaining vSpace to the vFill one pixel at  */
+                /* a time (starting from the top row and moving down).        */
+                /*------------------------------------------------------------*/
+                for (ctr = 0; ctr < nAlloc; ctr++)
+                {
+                    if (allVFill[ctr] && rendRowH[ctr] < vfillMaxMinH)
+                    {
+                        rendRowH[ctr] += 1;
+                        yFree -= 1;
+                        if (yFree == 0)
+                        {
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /*========================================================================*/
+    /* Render and place the child elements                                    */
+    /*========================================================================*/
+    xOffset = borderW;
+    yPos = (float)(borderW);
+    for (ctr = 0; ctr < nAlloc; ctr++)
+    {
+        if (ctr > 0)
+        {
+            yPos += (float)(rendRowH[ctr-1]) + fltVspacingSc;
+        }
+        if (!elemsShown[ctr]) continue; /* this elem isn't shown */
+
+        elem = cont->elems[ctr];
+
+        eCfg = elemsCfg[ctr];
+        rs   = &elemsMinSz[ctr];
+
+        tempH = rendRowH[ctr];
+
+        /*--------------------------------------------------------------------*/
+        /* Check for and apply if necessary Horizontal and Vertical fill.     */
+        /*--------------------------------------------------------------------*/
+        if (allHFill[ctr])
+        {
+            rs->w = rSize->w - (eCfg->PadLeft + eCfg->PadRight) - 2*xOffset + 1;
+        }
+        if (allVFill[ctr])
+        {
+            rs->h = tempH - (eCfg->PadTop + eCfg->PadBottom);
+        }
+
+        /*--------------------------------------------------------------------*/
+        /* Update the stored location before rendering the element. This is   */
+        /* necessary as the location of this object will propagate to its     */
+        /* child objects.                                                     */
+        /*--------------------------------------------------------------------*/
+        switch (eCfg->HJustify)
+        {
+            case NEUIK_HJUSTIFY_DEFAULT:
+                switch (cont->HJustify)
+                {
+                    case NEUIK_HJUSTIFY_LEFT:
+                        rect.x = eCfg->PadLeft;
+                        break;
+                    case NEUIK_HJUSTIFY_CENTER:
+                    case NEUIK_HJUSTIFY_DEFAULT:
+                        rect.x = (rSize->w/2) - (rs->w/2);
+                        break;
+                    case NEUIK_HJUSTIFY_RIGHT:
+                        rect.x = rSize->w - (rs->w + eCfg->PadRight);
+                        break;
+                }
+                break;
+            case NEUIK_HJUSTIFY_LEFT:
+                rect.x = eCfg->PadLeft;
+                break;
+            case NEUIK_HJUSTIFY_CENTER:
+                rect.x = (rSize->w/2) - (rs->w/2);
+                break;
+            case NEUIK_HJUSTIFY_RIGHT:
+                rect.x = rSize->w - (rs->w + eCfg->PadRight);
+                break;
+        }
+        switch (eCfg->VJustify)
+        {
+            case NEUIK_VJUSTIFY_DEFAULT:
+                switch (cont->VJustify)
+                {
+                    case NEUIK_VJUSTIFY_TOP:
+                        rect.y = (int)(yPos) + eCfg->PadTop;
+                        break;
+                    case NEUIK_VJUSTIFY_CENTER:
+                    case NEUIK_VJUSTIFY_DEFAULT:
+                        rect.y = ((int)(yPos) + rendRowH[ctr]/2) - (tempH/2);
+                        break;
+                    case NEUIK_VJUSTIFY_BOTTOM:
+                        rect.y = ((int)(yPos) + rendRowH[ctr]) - 
+                            (rs->h + eCfg->PadBottom);
+                        break;
+                }
+                break;
+            case NEUIK_VJUSTIFY_TOP:
+                rect.y = (int)(yPos) + eCfg->PadTop;
+                break;
+            case NEUIK_VJUSTIFY_CENTER:
+                rect.y = ((int)(yPos) + rendRowH[ctr]/2) - (tempH/2);
+                break;
+            case NEUIK_VJUSTIFY_BOTTOM:
+                rect.y = ((int)(yPos) + rendRowH[ctr]) - 
+                    (rs->h + eCfg->PadBottom);
+                break;
+        }
+
+        rect.w = rs->w;
+        rect.h = rendRowH[ctr];
+        rl.x = (eBase->eSt.rLoc).x + rect.x;
+        rl.y = (eBase->eSt.rLoc).y + rect.y;
+        rlRel.x = rect.x;
+        rlRel.y = rect.y;
+        if (neuik_Element_GetSizeAndLocation(elem, &rsOld, &rlOld))
+        {
+            eNum = 13;
+            goto out;
+        }
+        neuik_Element_StoreSizeAndLocation(elem, *rs, rl, rlRel);
+
+        /*--------------------------------------------------------------------*/
+        /* Every shown row is placed (so that the stored layout is whole) but */
+        /* only those which moved or need it otherwise are redrawn.           */
+        /*--------------------------------------------------------------------*/
+        if (rsOld.w == rs->w && rsOld.h == rs->h &&
+            rlOld.x == rl.x  && rlOld.y == rl.y  &&
+            !neuik_Element_NeedsRedraw(elem)) continue;
+
+        if (neuik_Element_Render(elem, rs, rlMod, rend, mock))
+        {
+            eNum = 11;
+            goto out;
+        }
+    }
+    neuik_Element_StoreLayout(lgElem, rSize);
+out:
+    if (eBase != NULL)
+    {
+        if (!mock) eBase->eSt.doRedraw = 0;
+    }
+    if (cont != NULL)
+    {
+        if (!mock) cont->redrawAll = 0;
+    }
+    if (maskMap != NULL) neuik_Object_Free(maskMap);
+
+    if (elemsCfg   != NULL) free(elemsCfg);
+    if (elemsShown != NULL) free(elemsShown);
+    if (elemsMinSz != NULL) free(elemsMinSz);
+    if (allMaxMinH != NULL) free(allMaxMinH);
+    if (rendRowH   != NULL) free(rendRowH);
+    if (allHFill   != NULL) free(allHFill);
+    if (allVFill   != NULL) free(allVFill);
+
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_AddRow
+ *
+ *  Description:   Adds a row to a ListGroup.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListGroup_AddRow(
+    NEUIK_ListGroup * lg, 
+    NEUIK_ListRow   * row)
+{
+    int                 eNum       = 0;    /* which error to report (if any) */
+    NEUIK_Container   * cBase      = NULL;
+    static char         funcName[] = "NEUIK_ListGroup_AddRow";
+    static char       * errMsgs[]  = {"",                              // [0] no error
+        "Argument `lg` is not of ListGroup class.",                    // [1]
+        "Argument `lg` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Argument `row` is not of ListRow class.",                     // [3]
+        "Failure in `neuik_Container_InsertElements()`.",              // [4]
+        "Rows can't be added to a virtual ListGroup.",                 // [5]
+        "Failure in `neuik_ListGroup_SyncView()`.",                    // [6]
+    };
+
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(lg, neuik__Class_Container, (void**)&cBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (!neuik_Object_IsClass(row, neuik__Class_ListRow))
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (lg->virt != NULL)
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Set the odd/even flag of the row.                                      */
+    /*------------------------------------------------------------------------*/
+    row->isOddRow = 0;
+    if ((cBase->n_used+1) % 2 == 1) row->isOddRow = 1;
+
+    /*------------------------------------------------------------------------*/
+    /* Append the row; this also sets the window/parent pointers and triggers */
+    /* a redraw.                                                              */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Container_InsertElements(lg, cBase->n_used, 1, 
+        (NEUIK_Element*)&row))
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (neuik_ListGroup_SyncView(lg))
+    {
+        eNum = 6;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_AddRows
+ *
+ *  Description:   Add multiple rows to a ListGroup.
+ *
+ *                 NOTE: the variable # of arguments must be terminated by a 
+ *                 NULL pointer.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListGroup_AddRows(
+    NEUIK_ListGroup * lg, 
+    NEUIK_ListRow   * row0, 
+    ...)
+{
+    int             ctr;
+    int             vaOpen = 0;
+    int             eNum   = 0; /* which error to report (if any) */
+    va_list         args;
+    NEUIK_ListRow * row    = NULL; 
+    static char     funcName[] = "NEUIK_ListGroup_AddRows";
+    static char   * errMsgs[]  = {"",               // [0] no error
+        "Argument `lg` is not of ListGroup class.", // [1]
+        "Failure in `ListGroup_AddRow()`.",         // [2]
+    };
+
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    va_start(args, row0);
+    vaOpen = 1;
+
+    row = row0;
+    for (ctr = 0;; ctr++)
+    {
+        if (row == NULL) break;
+
+        if (NEUIK_ListGroup_AddRow(lg, row))
+        {
+            eNum = 2;
+            goto out;
+        }
+
+        /* before starting */
+        row = va_arg(args, NEUIK_Element);
+    }
+out:
+    if (vaOpen) va_end(args);
+
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_AddTable
+ *
+ *  Description:   Append `nRows` ListRows of `nCols` Label cells each to a 
+ *                 ListGroup. The text of cell (row, col) is 
+ *                 `cells[row*nCols + col]` (NULL for an empty cell) and the 
+ *                 cells of each column are laid out as given in `cols`.
+ *
+ *                 The cells are configured directly (without parsing 
+ *                 configuration strings), every row shares the same (read-only)
+ *                 `style` and the new rows are appended all at once. A NULL 
+ *                 `style` selects the default ListRow style.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListGroup_AddTable(
+    NEUIK_ListGroup          * lg, 
+    int                        nCols, 
+    const NEUIK_ListColumn   * cols, 
+    int                        nRows, 
+    const char * const       * cells, 
+    const NEUIK_ListRowStyle * style)
+{
+    int                   col        = 0;
+    int                   rowInd     = 0;
+    int                   nBuilt     = 0;    /* rows which have been built */
+    int                   nCells     = 0;    /* cells not yet added to a row */
+    int                   eNum       = 0;    /* which error to report (if any) */
+    NEUIK_Container     * cBase      = NULL;
+    NEUIK_ListRow       * row        = NULL;
+    NEUIK_Label         * lbl        = NULL;
+    NEUIK_ElementConfig * eCfg       = NULL;
+    NEUIK_Element       * rows       = NULL; /* FREE upon return */
+    NEUIK_Element       * rowCells   = NULL; /* FREE upon return */
+    static char           funcName[] = "NEUIK_ListGroup_AddTable";
+    static char         * errMsgs[]  = {"",                                // [0] no error
+        "Argument `lg` is not of ListGroup class.",                        // [1]
+        "Argument `lg` caused `neuik_Object_GetClassObject` to fail.",     // [2]
+        "Rows can't be added to a virtual ListGroup.",                     // [3]
+        "Argument `nCols` or `nRows` is negative.",                        // [4]
+        "Argument `cols` or `cells` is NULL.",                             // [5]
+        "Failure to allocate memory.",                                     // [6]
+        "Failure in `NEUIK_NewListRow()`.",                                // [7]
+        "Failure in `NEUIK_MakeLabel()`.",                                 // [8]
+        "Element_GetConfig returned NULL.",                                // [9]
+        "Failure in `neuik_Container_InsertElements()`.",                  // [10]
+        "Failure in `neuik_ListGroup_SyncView()`.",                        // [11]
+    };
+
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(lg, neuik__Class_Container, (void**)&cBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (lg->virt != NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (nCols < 0 || nRows < 0)
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (nRows == 0) goto out;
+    if (nCols > 0 && (cols == NULL || cells == NULL))
+    {
+        eNum = 5;
+        goto out;
+    }
+    if (style == NULL) style = NEUIK_GetDefaultListRowStyle();
+
+    rows = (NEUIK_Element*)malloc(nRows*sizeof(NEUIK_Element));
+    if (rows == NULL)
+    {
+        eNum = 6;
+        goto out;
+    }
+    if (nCols > 0)
+    {
+        rowCells = (NEUIK_Element*)malloc(nCols*sizeof(NEUIK_Element));
+        if (rowCells == NULL)
+        {
+            eNum = 6;
+            goto out;
+        }
+    }
+
+    for (rowInd = 0; rowInd < nRows; rowInd++)
+    {
+        if (NEUIK_NewListRow(&row))
+        {
+            eNum = 7;
+            goto out;
+        }
+        rows[rowInd] = row;
+        nBuilt++;
+
+        /*--------------------------------------------------------------------*/
+        /* The parity follows from the final position of the row.             */
+        /*--------------------------------------------------------------------*/
+        row->style    = style;
+        row->isOddRow = ((cBase->n_used + rowInd) % 2 == 0);
+
+        for (col = 0; col < nCols; col++)
+        {
+            if (NEUIK_MakeLabel(&lbl, cells[rowInd*nCols + col]))
+            {
+                eNum = 8;
+                goto out;
+            }
+            rowCells[col] = lbl;
+            nCells        = col + 1;
+
+            if (cols[col].labelCfg != NULL) lbl->cfgPtr = cols[col].labelCfg;
+            eCfg = neuik_Element_GetConfig(lbl);
+            if (eCfg == NULL)
+            {
+                eNum = 9;
+                goto out;
+            }
+            eCfg->HJustify = cols[col].HJustify;
+            eCfg->HFill    = cols[col].HFill;
+            eCfg->HScale   = cols[col].HScale;
+            eCfg->PadLeft  = cols[col].PadLeft;
+            eCfg->PadRight = cols[col].PadRight;
+        }
+
+        if (neuik_Container_InsertElements(row, 0, nCols, rowCells))
+        {
+            eNum = 10;
+            goto out;
+        }
+        nCells = 0;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Append all of the rows at once; this also sets the window/parent       */
+    /* pointers and triggers a single redraw.                                 */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Container_InsertElements(lg, cBase->n_used, nRows, rows))
+    {
+        eNum = 10;
+        goto out;
+    }
+    nBuilt = 0;
+
+    if (neuik_ListGroup_SyncView(lg))
+    {
+        eNum = 11;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Free the cells and rows which were built but not added.            */
+        /*--------------------------------------------------------------------*/
+        for (col = 0; col < nCells; col++)
+        {
+            neuik_Object_Free(rowCells[col]);
+        }
+        for (rowInd = 0; rowInd < nBuilt; rowInd++)
+        {
+            neuik_Object_Free(rows[rowInd]);
+        }
+    }
+    if (rows != NULL)     free(rows);
+    if (rowCells != NULL) free(rowCells);
+
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_SetVirtual
+ *
+ *  Description:   Make this a virtual ListGroup of `nRows` rows. Instead of 
+ *                 holding a ListRow for every row, the ListGroup keeps a small
+ *                 pool of ListRows (enough for the rows which fit plus a few
+ *                 rows of overscan) and calls `bindFn` to fill a recycled 
+ *                 ListRow with the contents of row `rowInd`. The `isNew` flag
+ *                 is set the first time that a ListRow is bound (when it is 
+ *                 still empty); later binds should only update its contents.
+ *
+ *                 All rows of a virtual ListGroup share the same height.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListGroup_SetVirtual(
+    NEUIK_ListGroup * lg, 
+    int               nRows, 
+    int            (* bindFn)(NEUIK_ListRow *, int, int, void *),
+    void            * bindArg)
+{
+    int                        eNum       = 0; /* which error to report (if any) */
+    NEUIK_Container          * cBase      = NULL;
+    neuik_ListGroupVirtual   * v          = NULL;
+    neuik_ListGroupSelection * sel        = NULL;
+    static char                funcName[] = "NEUIK_ListGroup_SetVirtual";
+    static char              * errMsgs[]  = {"",                       // [0] no error
+        "Argument `lg` is not of ListGroup class.",                    // [1]
+        "Argument `lg` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Argument `nRows` is negative.",                               // [3]
+        "Argument `bindFn` is NULL.",                                  // [4]
+        "ListGroup already contains (non-virtual) rows.",              // [5]
+        "Failure to allocate memory.",                                 // [6]
+        "Failure in `NEUIK_ListGroup_SetRowCount()`.",                 // [7]
+    };
+
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(lg, neuik__Class_Container, (void**)&cBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (nRows < 0)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (bindFn == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    if (lg->virt == NULL)
+    {
+        if (cBase->elems != NULL && cBase->elems[0] != NULL)
+        {
+            eNum = 5;
+            goto out;
+        }
+
+        v = (neuik_ListGroupVirtual*)malloc(sizeof(neuik_ListGroupVirtual));
+        if (v == NULL)
+        {
+            eNum = 6;
+            goto out;
+        }
+        v->topRow     = 0;
+        v->nShown     = 0;
+        v->rowH       = 0;
+        v->nSlots     = 0;
+        v->slotRow    = NULL;
+        v->lastMouseX = 0;
+        v->lastMouseY = 0;
+        lg->virt = v;
+
+        sel = (neuik_ListGroupSelection*)(lg->sel);
+        sel->nRanges = 0;
+        sel->cursor  = -1;
+        sel->anchor  = -1;
+    }
+    v = (neuik_ListGroupVirtual*)(lg->virt);
+    v->nRows   = nRows;
+    v->bindFn  = bindFn;
+    v->bindArg = bindArg;
+
+    if (NEUIK_ListGroup_SetRowCount(lg, nRows))
+    {
+        eNum = 7;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_SetRowCount
+ *
+ *  Description:   Set the number of rows in a virtual ListGroup. The rows 
+ *                 which are currently bound are rebound; so this is also the
+ *                 way to tell the ListGroup that the row contents changed.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListGroup_SetRowCount(
+    NEUIK_ListGroup * lg, 
+    int               nRows)
+{
+    int                        slot       = 0;
+    int                        eNum       = 0; /* which error to report (if any) */
+    neuik_ListGroupVirtual   * v          = NULL;
+    neuik_ListGroupSelection * sel        = NULL;
+    static char                funcName[] = "NEUIK_ListGroup_SetRowCount";
+    static char              * errMsgs[]  = {"",            // [0] no error
+        "Argument `lg` is not of ListGroup class.",         // [1]
+        "Argument `lg` is not a virtual ListGroup.",        // [2]
+        "Argument `nRows` is negative.",                    // [3]
+        "Failure in `neuik_ListGroup_ScrollVirtual()`.",    // [4]
+        "Failure to allocate memory.",                      // [5]
+    };
+
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (lg->virt == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (nRows < 0)
+    {
+        eNum = 3;
+        goto out;
+    }
+    v = (neuik_ListGroupVirtual*)(lg->virt);
+
+    /*------------------------------------------------------------------------*/
+    /* Drop the selected rows which no longer exist.                          */
+    /*------------------------------------------------------------------------*/
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+    if (nRows < v->nRows)
+    {
+        if (neuik_ListGroup_SelRemove(sel, nRows, v->nRows - 1))
+        {
+            eNum = 5;
+            goto out;
+        }
+    }
+    if (sel->cursor >= nRows) sel->cursor = -1;
+    if (sel->anchor >= nRows) sel->anchor = sel->cursor;
+    v->nRows = nRows;
+
+    for (slot = 0; slot < v->nSlots; slot++)
+    {
+        if (v->slotRow[slot] != NEUIK_LISTGROUP_UNBOUND)
+        {
+            v->slotRow[slot] = NEUIK_LISTGROUP_STALE;
+        }
+    }
+
+    if (neuik_ListGroup_ScrollVirtual(lg, v->topRow))
+    {
+        eNum = 4;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_ScrollToRow
+ *
+ *  Description:   Scroll a virtual ListGroup (as little as possible) so that 
+ *                 row `rowInd` is shown.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListGroup_ScrollToRow(
+    NEUIK_ListGroup * lg, 
+    int               rowInd)
+{
+    int                      topRow     = 0;
+    int                      eNum       = 0; /* which error to report (if any) */
+    neuik_ListGroupVirtual * v          = NULL;
+    static char              funcName[] = "NEUIK_ListGroup_ScrollToRow";
+    static char            * errMsgs[]  = {"",              // [0] no error
+        "Argument `lg` is not of ListGroup class.",         // [1]
+        "Argument `lg` is not a virtual ListGroup.",        // [2]
+        "Argument `rowInd` is out of range.",               // [3]
+        "Failure in `neuik_ListGroup_ScrollVirtual()`.",    // [4]
+    };
+
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (lg->virt == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    v = (neuik_ListGroupVirtual*)(lg->virt);
+    if (rowInd < 0 || rowInd >= v->nRows)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    topRow = v->topRow;
+    if (rowInd < topRow)
+    {
+        topRow = rowInd;
+    }
+    else if (rowInd >= topRow + v->nShown)
+    {
+        topRow = rowInd - (v->nShown - 1);
+    }
+    if (topRow == v->topRow) goto out;
+
+    if (neuik_ListGroup_ScrollVirtual(lg, topRow))
+    {
+        eNum = 4;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_GetSelectedRow
+ *
+ *  Description:   Get the index of the selected row of a ListGroup (-1 if no 
+ *                 row is selected). If several rows are selected, this is the
+ *                 row which was selected last (or else the first selected row).
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListGroup_GetSelectedRow(
+    NEUIK_ListGroup * lg, 
+    int             * rowInd)
+{
+    int                        eNum       = 0; /* which error to report (if any) */
+    neuik_ListGroupSelection * sel        = NULL;
+    static char                funcName[] = "NEUIK_ListGroup_GetSelectedRow";
+    static char              * errMsgs[]  = {"",           // [0] no error
+        "Argument `lg` is not of ListGroup class.",        // [1]
+        "Output argument `rowInd` is NULL.",               // [2]
+        "Failure in `neuik_ListGroup_SyncSelection()`.",   // [3]
+    };
+
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (rowInd == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (neuik_ListGroup_SyncSelection(lg))
+    {
+        eNum = 3;
+        goto out;
+    }
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+
+    *rowInd = -1;
+    if (sel->cursor >= 0 && neuik_ListGroup_SelContains(sel, sel->cursor))
+    {
+        *rowInd = sel->cursor;
+    }
+    else if (sel->nRanges > 0)
+    {
+        *rowInd = sel->ranges[0];
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_Deselect
+ *
+ *  Description:   Deselect all of the rows of a ListGroup.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void NEUIK_ListGroup_Deselect(
+    NEUIK_ListGroup * lg)
+{
+    int                        ind = 0;
+    neuik_ListGroupSelection * sel = NULL;
+
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup)) return;
+    if (neuik_ListGroup_SyncSelection(lg)) return;
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+
+    for (ind = 0; ind < sel->nRanges; ind++)
+    {
+        neuik_ListGroup_SetRangeFlags(lg, 
+            sel->ranges[2*ind], sel->ranges[2*ind + 1], 0);
+    }
+    sel->nRanges = 0;
+    sel->cursor  = -1;
+    sel->anchor  = -1;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_SetMultiSelect
+ *
+ *  Description:   Allow (or disallow) the selection of multiple rows. When 
+ *                 multi-selection is disabled, only the selected row returned
+ *                 by `NEUIK_ListGroup_GetSelectedRow()` stays selected.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListGroup_SetMultiSelect(
+    NEUIK_ListGroup * lg, 
+    int               allowMulti)
+{
+    int                        rowInd     = 0;
+    int                        eNum       = 0; /* which error to report (if any) */
+    neuik_ListGroupSelection * sel        = NULL;
+    static char                funcName[] = "NEUIK_ListGroup_SetMultiSelect";
+    static char              * errMsgs[]  = {"",                    // [0] no error
+        "Argument `lg` is not of ListGroup class.",                 // [1]
+        "Argument `allowMulti` is invalid; may be zero or one.",    // [2]
+        "Failure in `NEUIK_ListGroup_GetSelectedRow()`.",           // [3]
+        "Failure in `neuik_ListGroup_SelectOnly()`.",               // [4]
+    };
+
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (allowMulti != 0 && allowMulti != 1)
+    {
+        eNum = 2;
+        goto out;
+    }
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+    sel->multi = allowMulti;
+    if (allowMulti) goto out;
+
+    if (NEUIK_ListGroup_GetSelectedRow(lg, &rowInd))
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (rowInd < 0) goto out;
+    if (sel->nRanges == 1 && sel->ranges[0] == sel->ranges[1]) goto out;
+
+    if (neuik_ListGroup_SelectOnly(lg, rowInd))
+    {
+        eNum = 4;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_SelectRows
+ *
+ *  Description:   Select the rows [first, last] of a ListGroup; either in 
+ *                 addition to the current selection or replacing it. More 
+ *                 than one row may only be selected if multi-selection is 
+ *                 enabled.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListGroup_SelectRows(
+    NEUIK_ListGroup * lg, 
+    int               first, 
+    int               last, 
+    int               addToSelection)
+{
+    int                        nRows      = 0;
+    int                        eNum       = 0; /* which error to report (if any) */
+    NEUIK_Container          * cBase      = NULL;
+    neuik_ListGroupSelection * sel        = NULL;
+    static char                funcName[] = "NEUIK_ListGroup_SelectRows";
+    static char              * errMsgs[]  = {"",                       // [0] no error
+        "Argument `lg` is not of ListGroup class.",                    // [1]
+        "Argument `lg` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Arguments `first`/`last` are not a valid range of rows.",     // [3]
+        "Multi-selection is not enabled for this ListGroup.",          // [4]
+        "Failure in `neuik_ListGroup_SyncSelection()`.",               // [5]
+        "Failure to update the row selection.",                        // [6]
+    };
+
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(lg, neuik__Class_Container, (void**)&cBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    nRows = (cBase->elems == NULL) ? 0 : cBase->n_used;
+    if (lg->virt != NULL) nRows = ((neuik_ListGroupVirtual*)(lg->virt))->nRows;
+    if (first < 0 || last < first || last >= nRows)
+    {
+        eNum = 3;
+        goto out;
+    }
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+    if (!sel->multi && (first != last || addToSelection))
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (neuik_ListGroup_SyncSelection(lg))
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    if (addToSelection)
+    {
+        if (neuik_ListGroup_SelAdd(sel, first, last))
+        {
+            eNum = 6;
+            goto out;
+        }
+        neuik_ListGroup_SetRangeFlags(lg, first, last, 1);
+        sel->anchor = first;
+        sel->cursor = last;
+    }
+    else
+    {
+        sel->anchor = first;
+        if (neuik_ListGroup_SelectSpan(lg, last))
+        {
+            eNum = 6;
+            goto out;
+        }
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_IsRowSelected
+ *
+ *  Description:   Reports whether or not row `rowInd` of a ListGroup is 
+ *                 selected.
+ *
+ *  Returns:       1 if the row is selected; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListGroup_IsRowSelected(
+    NEUIK_ListGroup * lg, 
+    int               rowInd)
+{
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup)) return 0;
+    if (neuik_ListGroup_SyncSelection(lg)) return 0;
+
+    return neuik_ListGroup_SelContains(
+        (neuik_ListGroupSelection*)(lg->sel), rowInd);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_GetSelectedRanges
+ *
+ *  Description:   Get the selected rows of a ListGroup as `nRanges` pairs of
+ *                 (first, last) row indices in ascending order. The returned
+ *                 array belongs to the ListGroup and is valid until the 
+ *                 selection changes.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListGroup_GetSelectedRanges(
+    NEUIK_ListGroup  * lg, 
+    int              * nRanges, 
+    const int       ** ranges)
+{
+    int                        eNum       = 0; /* which error to report (if any) */
+    neuik_ListGroupSelection * sel        = NULL;
+    static char                funcName[] = "NEUIK_ListGroup_GetSelectedRanges";
+    static char              * errMsgs[]  = {"",               // [0] no error
+        "Argument `lg` is not of ListGroup class.",            // [1]
+        "Output argument `nRanges` or `ranges` is NULL.",      // [2]
+        "Failure in `neuik_ListGroup_SyncSelection()`.",       // [3]
+    };
+
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (nRanges == NULL || ranges == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (neuik_ListGroup_SyncSelection(lg))
+    {
+        eNum = 3;
+        goto out;
+    }
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+
+    *nRanges = sel->nRanges;
+    *ranges  = sel->ranges;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_CaptureRowEvent                                           */
+/*                                                                            */
+/*  Offer an event to a ListRow (`rowInd` is the row it holds). Keyboard      */
+/*  events are only offered to the ListRow of the cursor row; mouse events   */
+/*  are offered to every shown ListRow. A click which selects a row updates  */
+/*  the selection of the ListGroup.                                           */
+/*                                                                            */
+/*  Returns: The event state.                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static neuik_EventState neuik_ListGroup_CaptureRowEvent(
+    NEUIK_ListGroup * lg,
+    NEUIK_Element     elem,
+    int               rowInd,
+    SDL_Event       * ev)
+{
+    neuik_EventState           evCaputred = NEUIK_EVENTSTATE_NOT_CAPTURED;
+    neuik_ListGroupSelection * sel        = NULL;
+
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+    if (!NEUIK_Element_IsShown(elem)) goto out;
+    if (ev->type == SDL_KEYDOWN || ev->type == SDL_KEYUP)
+    {
+        if (rowInd != sel->cursor) goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* A clicked ListRow takes the focus; the ListRow which loses it must     */
+    /* keep its (managed) selection.                                          */
+    /*------------------------------------------------------------------------*/
+    sel->updating++;
+    evCaputred = neuik_Element_CaptureEvent(elem, ev);
+    if (evCaputred == NEUIK_EVENTSTATE_OBJECT_FREED)
+    {
+        if (neuik_Object_IsNEUIKObject_NoError(lg)) sel->updating--;
+        goto out;
+    }
+    sel->updating--;
+
+    if (evCaputred == NEUIK_EVENTSTATE_CAPTURED && 
+        ev->type == SDL_MOUSEBUTTONDOWN && ((NEUIK_ListRow*)elem)->clickOrigin)
+    {
+        neuik_ListGroup_ClickRow(lg, rowInd);
+    }
+out:
+    return evCaputred;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_CaptureVirtualEvent                                       */
+/*                                                                            */
+/*  The CaptureEvent implementation for virtual ListGroups. Selection and     */
+/*  keyboard navigation work on row indices (as the ListRows are recycled)   */
+/*  and the mouse wheel scrolls the list.                                     */
+/*                                                                            */
+/*  Returns: The event state.                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static neuik_EventState neuik_ListGroup_CaptureVirtualEvent(
+    NEUIK_ListGroup * lg,
+    SDL_Event       * ev)
+{
+    int                        slot       = 0;
+    int                        rowInd     = 0;
+    neuik_EventState           evCaputred = NEUIK_EVENTSTATE_NOT_CAPTURED;
+    NEUIK_ElementBase        * eBase      = NULL;
+    NEUIK_Container          * cBase      = NULL;
+    SDL_KeyboardEvent        * keyEv      = NULL;
+    SDL_MouseMotionEvent     * mouseMotEv = NULL;
+    SDL_MouseWheelEvent      * mWheelEv   = NULL;
+    neuik_ListGroupVirtual   * v          = NULL;
+    neuik_ListGroupSelection * sel        = NULL;
+
+    v   = (neuik_ListGroupVirtual*)(lg->virt);
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+    if (neuik_Object_GetClassObject_NoError(
+        lg, neuik__Class_Container, (void**)&cBase)) goto out;
+
+    if (neuik_Object_GetClassObject_NoError(
+        lg, neuik__Class_Element, (void**)&eBase)) goto out;
+
+    if (ev->type == SDL_MOUSEMOTION)
+    {
+        mouseMotEv = (SDL_MouseMotionEvent*)(ev);
+        v->lastMouseX = mouseMotEv->x;
+        v->lastMouseY = mouseMotEv->y;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Check if the event is captured by one of the shown rows.               */
+    /*------------------------------------------------------------------------*/
+    for (slot = 0; slot < v->nSlots; slot++)
+    {
+        evCaputred = neuik_ListGroup_CaptureRowEvent(
+            lg, cBase->elems[slot], v->slotRow[slot], ev);
+        if (evCaputred == NEUIK_EVENTSTATE_OBJECT_FREED)
+        {
+            goto out;
+        }
+        else if (evCaputred == NEUIK_EVENTSTATE_CAPTURED)
+        {
+            neuik_Element_SetActive(lg, 1);
+            goto out;
+        }
+    }
+
+    switch (ev->type)
+    {
+    case SDL_MOUSEWHEEL:
         /*--------------------------------------------------------------------*/
-        /* Update the stored location before rendering the element. This is   */
-        /* necessary as the location of this object will propagate to its     */
-        /* child objects.                                                     */
+        /* Scroll the list if the mouse is over this ListGroup.               */
         /*--------------------------------------------------------------------*/
-        switch (eCfg->HJustify)
+        mWheelEv = (SDL_MouseWheelEvent*)(ev);
+        if (v->lastMouseY >= eBase->eSt.rLoc.y && 
+            v->lastMouseY <= eBase->eSt.rLoc.y + eBase->eSt.rSize.h &&
+            v->lastMouseX >= eBase->eSt.rLoc.x && 
+            v->lastMouseX <= eBase->eSt.rLoc.x + eBase->eSt.rSize.w)
+        {
+            neuik_ListGroup_ScrollVirtual(lg, 
+                v->topRow - mWheelEv->y*NEUIK_LISTGROUP_WHEELROWS);
+            evCaputred = NEUIK_EVENTSTATE_CAPTURED;
+        }
+        break;
+
+    case SDL_KEYDOWN:
+        if (!neuik_Element_IsActive(lg) || v->nRows == 0) break;
+
+        keyEv  = (SDL_KeyboardEvent*)(ev);
+        rowInd = sel->cursor;
+        switch (keyEv->keysym.sym)
+        {
+        case SDLK_UP:
+            rowInd = (rowInd < 0) ? v->topRow : rowInd - 1;
+            break;
+        case SDLK_DOWN:
+            rowInd = (rowInd < 0) ? v->topRow : rowInd + 1;
+            break;
+        case SDLK_PAGEUP:
+            rowInd = (rowInd < 0) ? v->topRow : rowInd - v->nShown;
+            break;
+        case SDLK_PAGEDOWN:
+            rowInd = (rowInd < 0) ? v->topRow : rowInd + v->nShown;
+            break;
+        case SDLK_HOME:
+            rowInd = 0;
+            break;
+        case SDLK_END:
+            rowInd = v->nRows - 1;
+            break;
+        default:
+            goto out;
+        }
+        if (rowInd < 0)         rowInd = 0;
+        if (rowInd >= v->nRows) rowInd = v->nRows - 1;
+
+        if (rowInd != sel->cursor || 
+            !neuik_ListGroup_SelContains(sel, rowInd))
+        {
+            neuik_ListGroup_MoveCursor(lg, rowInd, 
+                (keyEv->keysym.mod & KMOD_SHIFT) != 0);
+        }
+        evCaputred = NEUIK_EVENTSTATE_CAPTURED;
+        break;
+    }
+out:
+    return evCaputred;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_CaptureEvent__ListGroup
+ *
+ *  Description:   A virtual function reimplementation of the function
+ *                 neuik_Element_CaptureEvent.
+ *
+ *  Returns:       1 if the event was captured; 0 otherwise.
+ *
+ ******************************************************************************/
+neuik_EventState neuik_Element_CaptureEvent__ListGroup(
+    NEUIK_Element   lgElem, 
+    SDL_Event     * ev)
+{
+    int                        ctr        = 0;
+    int                        rowInd     = 0;
+    int                        step       = 0;
+    neuik_EventState           evCaputred = NEUIK_EVENTSTATE_NOT_CAPTURED;
+    NEUIK_ListGroup          * lg         = NULL;
+    NEUIK_Element              elem       = NULL;
+    NEUIK_Container          * cBase      = NULL;
+    SDL_KeyboardEvent        * keyEv      = NULL;
+    neuik_ListGroupSelection * sel        = NULL;
+
+    if (neuik_Object_GetClassObject_NoError(
+        lgElem, neuik__Class_Container, (void**)&cBase)) goto out;
+
+    lg = (NEUIK_ListGroup*)lgElem;
+    if (lg->virt != NULL)
+    {
+        evCaputred = neuik_ListGroup_CaptureVirtualEvent(lg, ev);
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* If there are no contained elements, there is probably no possible      */
+    /* outcome to handling the event.                                         */
+    /*------------------------------------------------------------------------*/
+    if (cBase->elems == NULL) goto out;
+    if (neuik_ListGroup_SyncSelection(lg)) goto out;
+    sel = (neuik_ListGroupSelection*)(lg->sel);
+
+    /*------------------------------------------------------------------------*/
+    /* Check if the event is captured by one of the contained rows.          */
+    /*------------------------------------------------------------------------*/
+    if (ev->type == SDL_KEYDOWN || ev->type == SDL_KEYUP)
+    {
+        elem = neuik_ListGroup_GetRowElem(lg, sel->cursor);
+        if (elem != NULL)
+        {
+            evCaputred = neuik_ListGroup_CaptureRowEvent(
+                lg, elem, sel->cursor, ev);
+        }
+    }
+    else
+    {
+        for (ctr = 0; ctr < (int)(cBase->n_used); ctr++)
+        {
+            evCaputred = neuik_ListGroup_CaptureRowEvent(
+                lg, cBase->elems[ctr], ctr, ev);
+            if (evCaputred != NEUIK_EVENTSTATE_NOT_CAPTURED) break;
+        }
+    }
+    if (evCaputred == NEUIK_EVENTSTATE_OBJECT_FREED)
+    {
+        goto out;
+    }
+    else if (evCaputred == NEUIK_EVENTSTATE_CAPTURED)
+    {
+        neuik_Element_SetActive(lgElem, 1);
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Check if the event is captured by the ListGroup itself. The cursor     */
+    /* moves straight to the neighbouring (shown) row.                        */
+    /*------------------------------------------------------------------------*/
+    if (!neuik_Element_IsActive(lgElem) || ev->type != SDL_KEYDOWN) goto out;
+
+    keyEv = (SDL_KeyboardEvent*)(ev);
+    switch (keyEv->keysym.sym)
+    {
+    case SDLK_UP:
+        step = -1;
+        break;
+    case SDLK_DOWN:
+        step = 1;
+        break;
+    default:
+        goto out;
+    }
+
+    rowInd = sel->cursor + step;
+    if (sel->cursor < 0)
+    {
+        rowInd = 0;
+        step   = 1;
+    }
+    for (; rowInd >= 0 && rowInd < (int)(cBase->n_used); rowInd += step)
+    {
+        if (NEUIK_Element_IsShown(cBase->elems[rowInd])) break;
+    }
+    if (rowInd < 0 || rowInd >= (int)(cBase->n_used)) goto out;
+
+    neuik_ListGroup_MoveCursor(lg, rowInd, 
+        (keyEv->keysym.mod & KMOD_SHIFT) != 0);
+    evCaputred = NEUIK_EVENTSTATE_CAPTURED;
+out:
+    return evCaputred;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* A row sort key and a unit of work of the (parallel) row sort; a job either */
+/* sorts keys [first, last) or merges the sorted runs [first, mid) and        */
+/* [mid, last).                                                               */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    double key;
+    int    row;   /* model row index */
+} neuik_ListGroupSortKey;
+
+typedef struct {
+    neuik_ListGroupSortKey * keys;
+    neuik_ListGroupSortKey * tmp;
+    int                      first;
+    int                      mid;   /* 0 for a sort job */
+    int                      last;
+    int                      descending;
+} neuik_ListGroupSortJob;
+
+
+/*----------------------------------------------------------------------------*/
+/* Whether key `a` must be ordered before key `b` (ties keep the model order).*/
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_KeyBefore(
+    const neuik_ListGroupSortKey * a,
+    const neuik_ListGroupSortKey * b,
+    int                            descending)
+{
+    return descending ? (a->key > b->key) : (a->key < b->key);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_MergeRuns                                                 */
+/*                                                                            */
+/*  Stable merge of the sorted runs keys[first, mid) and keys[mid, last)      */
+/*  (using tmp[first, last) as scratch space).                                */
+/*                                                                            */
+/*  Returns: Nothing.                                                         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static void neuik_ListGroup_MergeRuns(
+    neuik_ListGroupSortKey * keys,
+    neuik_ListGroupSortKey * tmp,
+    int                      first,
+    int                      mid,
+    int                      last,
+    int                      descending)
+{
+    int i = first;
+    int j = mid;
+    int k = first;
+
+    if (mid <= first || mid >= last) return;
+    if (!neuik_ListGroup_KeyBefore(&keys[mid], &keys[mid - 1], descending))
+    {
+        return; /* the runs are already in order */
+    }
+
+    while (i < mid && j < last)
+    {
+        if (neuik_ListGroup_KeyBefore(&keys[j], &keys[i], descending))
         {
-            case NEUIK_HJUSTIFY_DEFAULT:
-                switch (cont->HJustify)
-                {
-                    case NEUIK_HJUSTIFY_LEFT:
-                        rect.x = eCfg->PadLeft;
-                        break;
-                    case NEUIK_HJUSTIFY_CENTER:
-                    case NEUIK_HJUSTIFY_DEFAULT:
-                        rect.x = (rSize->w/2) - (rs->w/2);
-                        break;
-                    case NEUIK_HJUSTIFY_RIGHT:
-                        rect.x = rSize->w - (rs->w + eCfg->PadRight);
-                        break;
-                }
-                break;
-            case NEUIK_HJUSTIFY_LEFT:
-                rect.x = eCfg->PadLeft;
-                break;
-            case NEUIK_HJUSTIFY_CENTER:
-                rect.x = (rSize->w/2) - (rs->w/2);
-                break;
-            case NEUIK_HJUSTIFY_RIGHT:
-                rect.x = rSize->w - (rs->w + eCfg->PadRight);
-                break;
+            tmp[k++] = keys[j++];
         }
-        switch (eCfg->VJustify)
+        else
         {
-            case NEUIK_VJUSTIFY_DEFAULT:
-                switch (cont->VJustify)
+            tmp[k++] = keys[i++];
+        }
+    }
+    while (i < mid) tmp[k++] = keys[i++];
+
+    /*------------------------------------------------------------------------*/
+    /* Any remaining keys of the second run are already in place.             */
+    /*------------------------------------------------------------------------*/
+    memcpy(&keys[first], &tmp[first], (k - first)*sizeof(neuik_ListGroupSortKey));
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_SortKeys                                                  */
+/*                                                                            */
+/*  Stable (bottom-up merge) sort of keys[first, last); short runs are first  */
+/*  sorted by insertion.                                                      */
+/*                                                                            */
+/*  Returns: Nothing.                                                         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static void neuik_ListGroup_SortKeys(
+    neuik_ListGroupSortKey * keys,
+    neuik_ListGroupSortKey * tmp,
+    int                      first,
+    int                      last,
+    int                      descending)
+{
+    int                    ctr   = 0;
+    int                    ins   = 0;
+    int                    start = 0;
+    int                    end   = 0;
+    int                    width = 0;
+    neuik_ListGroupSortKey key;
+
+    for (start = first; start < last; start += NEUIK_LISTGROUP_SORTRUN)
+    {
+        end = start + NEUIK_LISTGROUP_SORTRUN;
+        if (end > last) end = last;
+        for (ctr = start + 1; ctr < end; ctr++)
+        {
+            key = keys[ctr];
+            for (ins = ctr; ins > start; ins--)
+            {
+                if (!neuik_ListGroup_KeyBefore(&key, &keys[ins - 1], descending))
                 {
-                    case NEUIK_VJUSTIFY_TOP:
-                        rect.y = (int)(yPos) + eCfg->PadTop;
-                        break;
-                    case NEUIK_VJUSTIFY_CENTER:
-                    case NEUIK_VJUSTIFY_DEFAULT:
-                        rect.y = ((int)(yPos) + rendRowH[ctr]/2) - (tempH/2);
-                        break;
-                    case NEUIK_VJUSTIFY_BOTTOM:
-                        rect.y = ((int)(yPos) + rendRowH[ctr]) - 
-                            (rs->h + eCfg->PadBottom);
-                        break;
+                    break;
                 }
-                break;
-            case NEUIK_VJUSTIFY_TOP:
-                rect.y = (int)(yPos) + eCfg->PadTop;
-                break;
-            case NEUIK_VJUSTIFY_CENTER:
-                rect.y = ((int)(yPos) + rendRowH[ctr]/2) - (tempH/2);
-                break;
-            case NEUIK_VJUSTIFY_BOTTOM:
-                rect.y = ((int)(yPos) + rendRowH[ctr]) - 
-                    (rs->h + eCfg->PadBottom);
-                break;
+                keys[ins] = keys[ins - 1];
+            }
+            keys[ins] = key;
+        }
+    }
+
+    for (width = NEUIK_LISTGROUP_SORTRUN; width < last - first; width *= 2)
+    {
+        for (start = first; start + width < last; start += 2*width)
+        {
+            end = (last - start > 2*width) ? start + 2*width : last;
+            neuik_ListGroup_MergeRuns(
+                keys, tmp, start, start + width, end, descending);
+        }
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* The thread function of a (parallel) sort job.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_RunSortJob(
+    void * jobPtr)
+{
+    neuik_ListGroupSortJob * job = (neuik_ListGroupSortJob*)jobPtr;
+
+    if (job->mid > job->first)
+    {
+        neuik_ListGroup_MergeRuns(job->keys, job->tmp, 
+            job->first, job->mid, job->last, job->descending);
+    }
+    else
+    {
+        neuik_ListGroup_SortKeys(job->keys, job->tmp, 
+            job->first, job->last, job->descending);
+    }
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_RunSortJobs                                               */
+/*                                                                            */
+/*  Run independent sort jobs concurrently; the first job runs on the calling */
+/*  thread (as does any job for which no thread could be created).           */
+/*                                                                            */
+/*  Returns: Nothing.                                                         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static void neuik_ListGroup_RunSortJobs(
+    neuik_ListGroupSortJob * jobs,
+    int                      nJobs)
+{
+    int          ctr = 0;
+    SDL_Thread * threads[NEUIK_LISTGROUP_SORTTHREADS];
+
+    for (ctr = 1; ctr < nJobs; ctr++)
+    {
+        threads[ctr] = SDL_CreateThread(
+            neuik_ListGroup_RunSortJob, "neuik_ListGroup_Sort", &jobs[ctr]);
+        if (threads[ctr] == NULL) neuik_ListGroup_RunSortJob(&jobs[ctr]);
+    }
+    if (nJobs > 0) neuik_ListGroup_RunSortJob(&jobs[0]);
+
+    for (ctr = 1; ctr < nJobs; ctr++)
+    {
+        if (threads[ctr] != NULL) SDL_WaitThread(threads[ctr], NULL);
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_ParallelSort                                              */
+/*                                                                            */
+/*  Stable sort of `nKeys` keys. Large key sets are split into a part per CPU */
+/*  (up to NEUIK_LISTGROUP_SORTTHREADS), which are sorted concurrently and    */
+/*  then merged pairwise (the merges of each level also run concurrently).    */
+/*                                                                            */
+/*  Returns: Nothing.                                                         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static void neuik_ListGroup_ParallelSort(
+    neuik_ListGroupSortKey * keys,
+    neuik_ListGroupSortKey * tmp,
+    int                      nKeys,
+    int                      descending)
+{
+    int                    part   = 0;
+    int                    nParts = 0;
+    int                    nJobs  = 0;
+    int                    width  = 0;
+    int                    bounds[NEUIK_LISTGROUP_SORTTHREADS + 1];
+    neuik_ListGroupSortJob jobs[NEUIK_LISTGROUP_SORTTHREADS];
+
+    nParts = SDL_GetCPUCount();
+    if (nParts > NEUIK_LISTGROUP_SORTTHREADS) nParts = NEUIK_LISTGROUP_SORTTHREADS;
+    if (nParts > nKeys/NEUIK_LISTGROUP_SORTMIN) nParts = nKeys/NEUIK_LISTGROUP_SORTMIN;
+    if (nParts < 1) nParts = 1;
+
+    for (part = 0; part <= nParts; part++)
+    {
+        bounds[part] = (int)(((long long)nKeys*part)/nParts);
+    }
+
+    for (part = 0; part < nParts; part++)
+    {
+        jobs[part].keys       = keys;
+        jobs[part].tmp        = tmp;
+        jobs[part].first      = bounds[part];
+        jobs[part].mid        = 0;
+        jobs[part].last       = bounds[part + 1];
+        jobs[part].descending = descending;
+    }
+    neuik_ListGroup_RunSortJobs(jobs, nParts);
+
+    for (width = 1; width < nParts; width *= 2)
+    {
+        nJobs = 0;
+        for (part = 0; part + width < nParts; part += 2*width)
+        {
+            jobs[nJobs].keys       = keys;
+            jobs[nJobs].tmp        = tmp;
+            jobs[nJobs].first      = bounds[part];
+            jobs[nJobs].mid        = bounds[part + width];
+            jobs[nJobs].last       = (part + 2*width < nParts) ? 
+                bounds[part + 2*width] : bounds[nParts];
+            jobs[nJobs].descending = descending;
+            nJobs++;
+        }
+        neuik_ListGroup_RunSortJobs(jobs, nJobs);
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_GetView                                                   */
+/*                                                                            */
+/*  Get the (up to date) sort/filter view of a ListGroup; it is created the   */
+/*  first time that it is needed.                                             */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_GetView(
+    NEUIK_ListGroup      * lg,
+    neuik_ListGroupView ** viewPtr)
+{
+    neuik_ListGroupView * view = NULL;
+
+    if (lg->view == NULL)
+    {
+        view = (neuik_ListGroupView*)malloc(sizeof(neuik_ListGroupView));
+        if (view == NULL) return 1;
+        memset(view, 0, sizeof(neuik_ListGroupView));
+        lg->view = view;
+    }
+    if (neuik_ListGroup_SyncView(lg)) return 1;
+
+    *viewPtr = (neuik_ListGroupView*)(lg->view);
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_ApplyOrder                                                */
+/*                                                                            */
+/*  Reorder the rows of a ListGroup into the order of the view. The selected */
+/*  rows (and the cursor/anchor rows) move along with their ListRows.        */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_ApplyOrder(
+    NEUIK_ListGroup     * lg,
+    neuik_ListGroupView * view)
+{
+    int                        pos       = 0;
+    NEUIK_Element              cursorRow = NULL;
+    NEUIK_Element              anchorRow = NULL;
+    NEUIK_Container          * cBase     = NULL;
+    neuik_ListGroupSelection * sel       = NULL;
+
+    if (neuik_Object_GetClassObject_NoError(
+        lg, neuik__Class_Container, (void**)&cBase)) return 1;
+    if (neuik_ListGroup_SyncSelection(lg)) return 1;
+
+    sel       = (neuik_ListGroupSelection*)(lg->sel);
+    cursorRow = neuik_ListGroup_GetRowElem(lg, sel->cursor);
+    anchorRow = neuik_ListGroup_GetRowElem(lg, sel->anchor);
+    sel->cursor = -1;
+    sel->anchor = -1;
+
+    for (pos = 0; pos < view->nRows; pos++)
+    {
+        cBase->elems[pos] = view->model[view->order[pos]];
+        if (cBase->elems[pos] == cursorRow) sel->cursor = pos;
+        if (cBase->elems[pos] == anchorRow) sel->anchor = pos;
+    }
+    view->nShown = neuik_ListGroup_UpdateParity(cBase);
+
+    /*------------------------------------------------------------------------*/
+    /* Rebuild the selected ranges from the (moved) ListRows.                 */
+    /*------------------------------------------------------------------------*/
+    sel->stale = 1;
+    if (neuik_ListGroup_SyncSelection(lg)) return 1;
+
+    return neuik_Container_RequestFullRedraw(lg);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_ListGroup_FilterRows                                                */
+/*                                                                            */
+/*  Test the model rows [first, last] against the filter of the view; only   */
+/*  rows which are currently shown (`testShown`) and/or hidden (`testHidden`) */
+/*  are tested. Only if a row was shown/hidden is the layout of the ListGroup */
+/*  invalidated and the ListGroup redrawn.                                    */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListGroup_FilterRows(
+    NEUIK_ListGroup     * lg,
+    neuik_ListGroupView * view,
+    int                   first,
+    int                   last,
+    int                   testShown,
+    int                   testHidden)
+{
+    int                   ind     = 0;
+    int                   passes  = 0;
+    int                   changed = 0;
+    NEUIK_ElementConfig * eCfg    = NULL;
+    NEUIK_Container     * cBase   = NULL;
+
+    if (neuik_Object_GetClassObject_NoError(
+        lg, neuik__Class_Container, (void**)&cBase)) return 1;
+
+    for (ind = first; ind <= last; ind++)
+    {
+        eCfg = neuik_Element_GetConfig(view->model[ind]);
+        if (eCfg == NULL) return 1;
+        if (eCfg->Show ? !testShown : !testHidden) continue;
+
+        passes = 1;
+        if (view->filterFn != NULL)
+        {
+            passes = ((*view->filterFn)(
+                (NEUIK_ListRow*)(view->model[ind]), ind, view->filterArg) != 0);
         }
+        if (passes != eCfg->Show)
+        {
+            eCfg->Show = passes;
+            changed    = 1;
+        }
+    }
+    if (!changed) return 0;
+
+    view->nShown = neuik_ListGroup_UpdateParity(cBase);
+    if (neuik_Element_InvalidateLayout(lg)) return 1;
+    return neuik_Container_RequestFullRedraw(lg);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_SortRows
+ *
+ *  Description:   Sort the rows of a ListGroup by a key per row; `keys` holds
+ *                 the key of each row by model row index. The sort is stable
+ *                 (rows with equal keys keep their model order) and only the
+ *                 order of the existing rows changes.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListGroup_SortRows(
+    NEUIK_ListGroup * lg, 
+    const double    * keys, 
+    int               descending)
+{
+    int                      ind        = 0;
+    int                      eNum       = 0; /* which error to report (if any) */
+    neuik_ListGroupView    * view       = NULL;
+    neuik_ListGroupSortKey * sortKeys   = NULL; /* FREE upon return */
+    static char              funcName[] = "NEUIK_ListGroup_SortRows";
+    static char            * errMsgs[]  = {"",                     // [0] no error
+        "Argument `lg` is not of ListGroup class.",                // [1]
+        "Argument `keys` is NULL.",                                // [2]
+        "Rows of a virtual ListGroup can't be sorted.",            // [3]
+        "Failure in `neuik_ListGroup_GetView()`.",                 // [4]
+        "Failure to allocate memory.",                             // [5]
+        "Failure in `neuik_ListGroup_ApplyOrder()`.",              // [6]
+    };
+
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (keys == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (lg->virt != NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (neuik_ListGroup_GetView(lg, &view))
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (view->nRows == 0) goto out;
+
+    /*------------------------------------------------------------------------*/
+    /* The second half of the allocation is the scratch space of the sort.    */
+    /*------------------------------------------------------------------------*/
+    sortKeys = (neuik_ListGroupSortKey*)malloc(
+        2*view->nRows*sizeof(neuik_ListGroupSortKey));
+    if (sortKeys == NULL)
+    {
+        eNum = 5;
+        goto out;
+    }
+    for (ind = 0; ind < view->nRows; ind++)
+    {
+        sortKeys[ind].key = keys[ind];
+        sortKeys[ind].row = ind;
+    }
+    neuik_ListGroup_ParallelSort(
+        sortKeys, &sortKeys[view->nRows], view->nRows, descending);
+
+    for (ind = 0; ind < view->nRows; ind++)
+    {
+        view->order[ind] = sortKeys[ind].row;
+    }
+    if (neuik_ListGroup_ApplyOrder(lg, view))
+    {
+        eNum = 6;
+        goto out;
+    }
+out:
+    if (sortKeys != NULL) free(sortKeys);
+
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_ClearSort
+ *
+ *  Description:   Restore the model order (the order in which they were 
+ *                 added) of the rows of a ListGroup.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListGroup_ClearSort(
+    NEUIK_ListGroup * lg)
+{
+    int                   ind        = 0;
+    int                   eNum       = 0; /* which error to report (if any) */
+    neuik_ListGroupView * view       = NULL;
+    static char           funcName[] = "NEUIK_ListGroup_ClearSort";
+    static char         * errMsgs[]  = {"",                  // [0] no error
+        "Argument `lg` is not of ListGroup class.",          // [1]
+        "Failure in `neuik_ListGroup_GetView()`.",           // [2]
+        "Failure in `neuik_ListGroup_ApplyOrder()`.",        // [3]
+    };
 
-        rect.w = rs->w;
-        rect.h = rendRowH[ctr];
-        rl.x = (eBase->eSt.rLoc).x + rect.x;
-        rl.y = (eBase->eSt.rLoc).y + rect.y;
-        rlRel.x = rect.x;
-        rlRel.y = rect.y;
-        neuik_Element_StoreSizeAndLocation(elem, *rs, rl, rlRel);
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (lg->view == NULL) goto out;
 
-        if (neuik_Element_Render(elem, rs, rlMod, rend, mock))
-        {
-            eNum = 11;
-            goto out;
-        }
+    if (neuik_ListGroup_GetView(lg, &view))
+    {
+        eNum = 2;
+        goto out;
     }
-out:
-    if (eBase != NULL)
+    for (ind = 0; ind < view->nRows; ind++)
     {
-        if (!mock) eBase->eSt.doRedraw = 0;
+        if (view->order[ind] != ind) break;
     }
-    if (maskMap != NULL) neuik_Object_Free(maskMap);
-
-    if (elemsCfg   != NULL) free(elemsCfg);
-    if (elemsShown != NULL) free(elemsShown);
-    if (elemsMinSz != NULL) free(elemsMinSz);
-    if (allMaxMinH != NULL) free(allMaxMinH);
-    if (rendRowH   != NULL) free(rendRowH);
-    if (allHFill   != NULL) free(allHFill);
-    if (allVFill   != NULL) free(allVFill);
+    if (ind == view->nRows) goto out; /* already in model order */
 
+    for (ind = 0; ind < view->nRows; ind++)
+    {
+        view->order[ind] = ind;
+    }
+    if (neuik_ListGroup_ApplyOrder(lg, view))
+    {
+        eNum = 3;
+        goto out;
+    }
+out:
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -987,34 +4046,28 @@ out:
 
 /*******************************************************************************
  *
- *  Name:          NEUIK_ListGroup_AddRow
+ *  Name:          NEUIK_ListGroup_SetFilter
  *
- *  Description:   Adds a row to a ListGroup.
+ *  Description:   Show only the rows for which `filterFn` returns nonzero (a
+ *                 NULL `filterFn` shows all of the rows). The filter is also
+ *                 applied to rows which are added later on.
  *
  *  Returns:       1 if there is an error; 0 otherwise.
  *
  ******************************************************************************/
-int NEUIK_ListGroup_AddRow(
+int NEUIK_ListGroup_SetFilter(
     NEUIK_ListGroup * lg, 
-    NEUIK_ListRow   * row)
+    int            (* filterFn)(NEUIK_ListRow *, int, void *),
+    void            * filterArg)
 {
-    int                 len;
-    int                 ctr;
-    RenderSize          rSize;
-    RenderLoc           rLoc;
-    int                 newInd;            /* index for newly added item */
-    int                 eNum       = 0;    /* which error to report (if any) */
-    NEUIK_ElementBase * eBase      = NULL;
-    NEUIK_Container   * cBase      = NULL;
-    static char         funcName[] = "NEUIK_ListGroup_AddRow";
-    static char       * errMsgs[]  = {"",                              // [0] no error
-        "Argument `lg` is not of ListGroup class.",                    // [1]
-        "Argument `lg` caused `neuik_Object_GetClassObject` to fail.", // [2]
-        "Argument `row` is not of ListRow class.",                     // [3]
-        "Failure to allocate memory.",                                 // [4]
-        "Failure to reallocate memory.",                               // [5]
-        "Failure in `neuik_Element_RequestRedraw()`.",                 // [6]
-        "Failure in `neuik_Element_GetSizeAndLocation()`.",            // [7]
+    int                   eNum       = 0; /* which error to report (if any) */
+    neuik_ListGroupView * view       = NULL;
+    static char           funcName[] = "NEUIK_ListGroup_SetFilter";
+    static char         * errMsgs[]  = {"",                  // [0] no error
+        "Argument `lg` is not of ListGroup class.",          // [1]
+        "Rows of a virtual ListGroup can't be filtered.",    // [2]
+        "Failure in `neuik_ListGroup_GetView()`.",           // [3]
+        "Failure in `neuik_ListGroup_FilterRows()`.",        // [4]
     };
 
     if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
@@ -1022,90 +4075,91 @@ int NEUIK_ListGroup_AddRow(
         eNum = 1;
         goto out;
     }
-    if (neuik_Object_GetClassObject(lg, neuik__Class_Container, (void**)&cBase))
+    if (lg->virt != NULL)
     {
         eNum = 2;
         goto out;
     }
-    if (!neuik_Object_IsClass(row, neuik__Class_ListRow))
+    if (neuik_ListGroup_GetView(lg, &view))
     {
         eNum = 3;
         goto out;
     }
 
-    if (cBase->elems == NULL)
+    view->filterFn  = filterFn;
+    view->filterArg = filterArg;
+    if (neuik_ListGroup_FilterRows(lg, view, 0, view->nRows - 1, 1, 1))
     {
-        /*--------------------------------------------------------------------*/
-        /* elems array currently unallocated; allocate now                    */
-        /*--------------------------------------------------------------------*/
-        cBase->elems = (NEUIK_Element*)malloc(2*sizeof(NEUIK_Element));
-        if (cBase->elems == NULL)
-        {
-            eNum = 4;
-            goto out;
-        }
-        newInd = 0;
+        eNum = 4;
+        goto out;
     }
-    else
+out:
+    if (eNum > 0)
     {
-        /*--------------------------------------------------------------------*/
-        /* This is subsequent UI element, reallocate memory.                  */
-        /* This pointer array will be null terminated.                        */
-        /*--------------------------------------------------------------------*/
-        
-        /* determine the current length */
-        for (ctr = 0;;ctr++)
-        {
-            if (cBase->elems[ctr] == NULL)
-            {
-                len = 2 + ctr;
-                break;
-            }
-        }
-
-        cBase->elems = (NEUIK_Element*)realloc(cBase->elems, len*sizeof(NEUIK_Element));
-        if (cBase->elems == NULL)
-        {
-            eNum = 5;
-            goto out;
-        }
-        newInd = ctr;
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
     }
 
-    /*------------------------------------------------------------------------*/
-    /* Set the Window and Parent Element pointers                             */
-    /*------------------------------------------------------------------------*/
-    if (neuik_Object_GetClassObject(lg, neuik__Class_Element, (void**)&eBase))
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListGroup_RefineFilter
+ *
+ *  Description:   Replace the filter of a ListGroup with one that is stricter
+ *                 (`narrows` = 1; only the shown rows are tested) or looser 
+ *                 (`narrows` = 0; only the hidden rows are tested) than the 
+ *                 current filter; e.g. as a search string is typed/erased.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListGroup_RefineFilter(
+    NEUIK_ListGroup * lg, 
+    int            (* filterFn)(NEUIK_ListRow *, int, void *),
+    void            * filterArg,
+    int               narrows)
+{
+    int                   eNum       = 0; /* which error to report (if any) */
+    neuik_ListGroupView * view       = NULL;
+    static char           funcName[] = "NEUIK_ListGroup_RefineFilter";
+    static char         * errMsgs[]  = {"",                        // [0] no error
+        "Argument `lg` is not of ListGroup class.",                // [1]
+        "Rows of a virtual ListGroup can't be filtered.",          // [2]
+        "Argument `narrows` is invalid; may be zero or one.",      // [3]
+        "Failure in `neuik_ListGroup_GetView()`.",                 // [4]
+        "Failure in `neuik_ListGroup_FilterRows()`.",              // [5]
+    };
+
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (lg->virt != NULL)
     {
         eNum = 2;
         goto out;
     }
-    if (eBase->eSt.window != NULL)
+    if (narrows != 0 && narrows != 1)
     {
-        neuik_Element_SetWindowPointer(row, eBase->eSt.window);
+        eNum = 3;
+        goto out;
     }
-    neuik_Element_SetParentPointer(row, lg);
-
-    /*------------------------------------------------------------------------*/
-    /* Set the odd/even flag of the row.                                      */
-    /*------------------------------------------------------------------------*/
-    row->isOddRow = 0;
-    if ((newInd+1) % 2 == 1) row->isOddRow = 1;
-
-    cBase->elems[newInd]   = row;
-    cBase->elems[newInd+1] = NULL; /* NULLptr terminated array */
-
-    /*------------------------------------------------------------------------*/
-    /* When a new row is added, trigger a redraw                              */
-    /*------------------------------------------------------------------------*/
-    if (neuik_Element_GetSizeAndLocation(lg, &rSize, &rLoc))
+    if (neuik_ListGroup_GetView(lg, &view))
     {
-        eNum = 7;
+        eNum = 4;
         goto out;
     }
-    if (neuik_Element_RequestRedraw(lg, rLoc, rSize))
+
+    view->filterFn  = filterFn;
+    view->filterArg = filterArg;
+    if (neuik_ListGroup_FilterRows(
+        lg, view, 0, view->nRows - 1, narrows, !narrows))
     {
-        eNum = 6;
+        eNum = 5;
         goto out;
     }
 out:
@@ -1118,32 +4172,30 @@ out:
     return eNum;
 }
 
+
 /*******************************************************************************
  *
- *  Name:          NEUIK_ListGroup_AddRows
- *
- *  Description:   Add multiple rows to a ListGroup.
+ *  Name:          NEUIK_ListGroup_RefilterRows
  *
- *                 NOTE: the variable # of arguments must be terminated by a 
- *                 NULL pointer.
+ *  Description:   Test the model rows [firstModelRow, lastModelRow] against 
+ *                 the filter again (after their contents changed).
  *
  *  Returns:       1 if there is an error; 0 otherwise.
  *
  ******************************************************************************/
-int NEUIK_ListGroup_AddRows(
+int NEUIK_ListGroup_RefilterRows(
     NEUIK_ListGroup * lg, 
-    NEUIK_ListRow   * row0, 
-    ...)
+    int               firstModelRow, 
+    int               lastModelRow)
 {
-    int             ctr;
-    int             vaOpen = 0;
-    int             eNum   = 0; /* which error to report (if any) */
-    va_list         args;
-    NEUIK_ListRow * row    = NULL; 
-    static char     funcName[] = "NEUIK_ListGroup_AddRows";
-    static char   * errMsgs[]  = {"",               // [0] no error
-        "Argument `lg` is not of ListGroup class.", // [1]
-        "Failure in `ListGroup_AddRow()`.",         // [2]
+    int                   eNum       = 0; /* which error to report (if any) */
+    neuik_ListGroupView * view       = NULL;
+    static char           funcName[] = "NEUIK_ListGroup_RefilterRows";
+    static char         * errMsgs[]  = {"",                                // [0] no error
+        "Argument `lg` is not of ListGroup class.",                        // [1]
+        "Failure in `neuik_ListGroup_GetView()`.",                         // [2]
+        "Arguments `firstModelRow`/`lastModelRow` are not a valid range.", // [3]
+        "Failure in `neuik_ListGroup_FilterRows()`.",                      // [4]
     };
 
     if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
@@ -1151,27 +4203,26 @@ int NEUIK_ListGroup_AddRows(
         eNum = 1;
         goto out;
     }
+    if (lg->view == NULL) goto out; /* no filter is set */
 
-    va_start(args, row0);
-    vaOpen = 1;
-
-    row = row0;
-    for (ctr = 0;; ctr++)
+    if (neuik_ListGroup_GetView(lg, &view))
     {
-        if (row == NULL) break;
-
-        if (NEUIK_ListGroup_AddRow(lg, row))
-        {
-            eNum = 2;
-            goto out;
-        }
+        eNum = 2;
+        goto out;
+    }
+    if (firstModelRow < 0 || lastModelRow < firstModelRow || 
+        lastModelRow >= view->nRows)
+    {
+        eNum = 3;
+        goto out;
+    }
 
-        /* before starting */
-        row = va_arg(args, NEUIK_Element);
+    if (neuik_ListGroup_FilterRows(lg, view, firstModelRow, lastModelRow, 1, 1))
+    {
+        eNum = 4;
+        goto out;
     }
 out:
-    if (vaOpen) va_end(args);
-
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -1184,149 +4235,72 @@ out:
 
 /*******************************************************************************
  *
- *  Name:          neuik_Element_CaptureEvent__ListGroup
+ *  Name:          NEUIK_ListGroup_GetModelRow
  *
- *  Description:   A virtual function reimplementation of the function
- *                 neuik_Element_CaptureEvent.
+ *  Description:   Get the model row index (the order in which it was added) 
+ *                 of the row which is currently at position `rowInd`.
  *
- *  Returns:       1 if the event was captured; 0 otherwise.
+ *  Returns:       1 if there is an error; 0 otherwise.
  *
  ******************************************************************************/
-neuik_EventState neuik_Element_CaptureEvent__ListGroup(
-    NEUIK_Element   lgElem, 
-    SDL_Event     * ev)
+int NEUIK_ListGroup_GetModelRow(
+    NEUIK_ListGroup * lg, 
+    int               rowInd, 
+    int             * modelRow)
 {
-    int                 ctr         = 0;
-    int                 indSelect   = 0;
-    int                 wasSelected = 0;
-    neuik_EventState    evCaputred  = NEUIK_EVENTSTATE_NOT_CAPTURED;
-    NEUIK_Element       elem        = NULL;
-    NEUIK_ElementBase * eBase       = NULL;
-    NEUIK_Container   * cBase       = NULL;
-    SDL_KeyboardEvent * keyEv       = NULL;
-
-    if (neuik_Object_GetClassObject_NoError(
-        lgElem, neuik__Class_Container, (void**)&cBase)) goto out;
-
-    if (neuik_Object_GetClassObject_NoError(
-        lgElem, neuik__Class_Element, (void**)&eBase)) goto out;
+    int                   eNum       = 0; /* which error to report (if any) */
+    NEUIK_Container     * cBase      = NULL;
+    neuik_ListGroupView * view       = NULL;
+    static char           funcName[] = "NEUIK_ListGroup_GetModelRow";
+    static char         * errMsgs[]  = {"",                            // [0] no error
+        "Argument `lg` is not of ListGroup class.",                    // [1]
+        "Argument `lg` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Output argument `modelRow` is NULL.",                         // [3]
+        "Argument `rowInd` is out of range.",                          // [4]
+        "Failure in `neuik_ListGroup_GetView()`.",                     // [5]
+    };
 
-    /*------------------------------------------------------------------------*/
-    /* Check if the event is captured by one of the contained rows.          */
-    /*------------------------------------------------------------------------*/
-    if (cBase->elems != NULL)
+    if (!neuik_Object_IsClass(lg, neuik__Class_ListGroup))
     {
-        for (ctr = 0;; ctr++)
-        {
-            elem = cBase->elems[ctr];
-            if (elem == NULL) break;
-
-            if (!NEUIK_Element_IsShown(elem)) continue;
-
-            wasSelected = NEUIK_ListRow_IsSelected(elem);
-            evCaputred = neuik_Element_CaptureEvent(elem, ev);
-            if (evCaputred == NEUIK_EVENTSTATE_OBJECT_FREED)
-            {
-                goto out;
-            }
-            else if (evCaputred == NEUIK_EVENTSTATE_CAPTURED)
-            {
-                if (!wasSelected && NEUIK_ListRow_IsSelected(elem))
-                {
-                    indSelect = ctr;
-                    /*--------------------------------------------------------*/
-                    /* This event just caused this row to be selected.        */
-                    /* Deselect the other rows.                               */
-                    /*--------------------------------------------------------*/
-                    for (ctr = 0;; ctr++)
-                    {
-                        elem = cBase->elems[ctr];
-                        if (elem == NULL) break;
-                        if (ctr == indSelect) continue;
-
-                        NEUIK_ListRow_SetSelected(elem, 0);
-                    }
-                }
-
-                neuik_Element_SetActive(lgElem, 1);
-                goto out;
-            }
-        }
+        eNum = 1;
+        goto out;
     }
-    else
+    if (neuik_Object_GetClassObject(lg, neuik__Class_Container, (void**)&cBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (modelRow == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (lg->virt != NULL || lg->view == NULL)
     {
         /*--------------------------------------------------------------------*/
-        /* If there are no contained elements, there is probably no possible  */
-        /* outcome to handling the event.                                     */
+        /* Without a view the rows are in model order.                        */
         /*--------------------------------------------------------------------*/
+        *modelRow = rowInd;
         goto out;
     }
 
-    /*------------------------------------------------------------------------*/
-    /* Check if the event is captured by the ListGroup itself.                */
-    /*------------------------------------------------------------------------*/
-    if (neuik_Element_IsActive(lgElem))
+    if (neuik_ListGroup_GetView(lg, &view))
     {
-        switch (ev->type)
-        {
-        case SDL_KEYDOWN:
-            keyEv = (SDL_KeyboardEvent*)(ev);
-            switch (keyEv->keysym.sym)
-            {
-            case SDLK_UP:
-                /*------------------------------------------------------------*/
-                /* Determine the where the first selected item is             */
-                /*------------------------------------------------------------*/
-                for (ctr = 0;; ctr++)
-                {
-                    elem = cBase->elems[ctr];
-                    if (elem == NULL) break;
-
-                    if (!NEUIK_Element_IsShown(elem)) continue;
-                    if (NEUIK_ListRow_IsSelected(elem))
-                    {
-                        indSelect = ctr;
-                        break;
-                    }
-                }
-
-                if (indSelect > 0)
-                {
-                    NEUIK_ListRow_SetSelected(cBase->elems[indSelect], 0);
-                    indSelect--;
-                    NEUIK_ListRow_SetSelected(cBase->elems[indSelect], 1);
-                    neuik_Window_TakeFocus(eBase->eSt.window, cBase->elems[indSelect]);
-                }
-                break;
-            case SDLK_DOWN:
-                /*------------------------------------------------------------*/
-                /* Determine the where the first selected item is             */
-                /*------------------------------------------------------------*/
-                for (ctr = 0;; ctr++)
-                {
-                    elem = cBase->elems[ctr];
-                    if (elem == NULL) break;
-
-                    if (!NEUIK_Element_IsShown(elem)) continue;
-                    if (NEUIK_ListRow_IsSelected(elem))
-                    {
-                        indSelect = ctr;
-                        break;
-                    }
-                }
-
-                if (cBase->elems[indSelect+1] != NULL)
-                {
-                    NEUIK_ListRow_SetSelected(cBase->elems[indSelect], 0);
-                    indSelect++;
-                    NEUIK_ListRow_SetSelected(cBase->elems[indSelect], 1);
-                    neuik_Window_TakeFocus(eBase->eSt.window, cBase->elems[indSelect]);
-                }
-                break;
-            }
-        }       
+        eNum = 5;
+        goto out;
+    }
+    if (rowInd < 0 || rowInd >= view->nRows)
+    {
+        eNum = 4;
+        goto out;
     }
+    *modelRow = view->order[rowInd];
 out:
-    return evCaputred;
-}
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
 
+    return eNum;
+}
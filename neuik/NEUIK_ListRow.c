@@ -21,6 +21,7 @@
 #include "NEUIK_structs_basic.h"
 #include "NEUIK_colors.h"
 #include "NEUIK_ListRow.h"
+#include "NEUIK_ListGroup_internal.h"
 #include "NEUIK_Element_internal.h"
 #include "NEUIK_Window_internal.h"
 #include "NEUIK_Container.h"
@@ -180,6 +181,7 @@ int neuik_Object_New__ListRow(
     row->colorBGSelect = bgSelectClr; /* color to use for the selected text */
     row->colorBGOdd    = bgOddClr;    /* background color to use for unselected odd rows */
     row->colorBGEven   = bgEvenClr;   /* background color to use for unselected even rows */
+    row->style         = NULL;
 
     /*------------------------------------------------------------------------*/
     /* Successful allocation of Memory -- Create Base Class Object            */
@@ -323,6 +325,20 @@ out:
     return eNum;
 }
 
+/*----------------------------------------------------------------------------*/
+/* The element which contains this row (normally a ListGroup); NULL if none.  */
+/*----------------------------------------------------------------------------*/
+static NEUIK_Element neuik_ListRow_GetParent(
+    NEUIK_ListRow * row)
+{
+    NEUIK_ElementBase * eBase = NULL;
+
+    if (neuik_Object_GetClassObject_NoError(
+        row, neuik__Class_Element, (void**)&eBase)) return NULL;
+    return eBase->eSt.parent;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          NEUIK_ListRow_SetSelected
@@ -374,6 +390,7 @@ int NEUIK_ListRow_SetSelected(
         row->wasSelected = 0;
         neuik_Element_TriggerCallback(row, NEUIK_CALLBACK_ON_DESELECTED);
     }
+    neuik_ListGroup_RowSelectionChanged(neuik_ListRow_GetParent(row));
 
     if (neuik_Element_GetSizeAndLocation(row, &rSize, &rLoc))
     {
@@ -465,6 +482,91 @@ out:
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_GetDefaultListRowStyle
+ *
+ *  Description:   Returns a pointer to the default ListRow style (the same 
+ *                 spacing and colors that new ListRows start out with).
+ *
+ *  Returns:       A pointer to the (read-only) default NEUIK_ListRowStyle.
+ *
+ ******************************************************************************/
+const NEUIK_ListRowStyle * NEUIK_GetDefaultListRowStyle()
+{
+    static const NEUIK_ListRowStyle dStyle = {
+        1,              // int         HSpacing
+        COLOR_MBLUE,    // NEUIK_Color colorBGSelect
+        COLOR_WHITE,    // NEUIK_Color colorBGOdd
+        COLOR_MLLWHITE, // NEUIK_Color colorBGEven
+    };
+
+    return &dStyle;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ListRow_SetStyle
+ *
+ *  Description:   Have this row use a shared style in place of its own spacing
+ *                 and colors. The style is not copied; it must remain valid 
+ *                 for as long as the row uses it. A NULL style reverts to the 
+ *                 row's own settings.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ListRow_SetStyle(
+    NEUIK_ListRow            * row,
+    const NEUIK_ListRowStyle * style)
+{
+    RenderSize     rSize;
+    RenderLoc      rLoc;
+    int            eNum       = 0;    /* which error to report (if any) */
+    static char    funcName[] = "NEUIK_ListRow_SetStyle";
+    static char  * errMsgs[]  = {"",                        // [0] no error
+        "Argument `row` is not of ListRow class.",          // [1]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.", // [2]
+    };
+
+    if (!neuik_Object_IsClass(row, neuik__Class_ListRow))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (style == row->style) goto out;
+
+    row->style = style;
+    if (neuik_Element_GetSizeAndLocation(row, &rSize, &rLoc))
+    {
+        eNum = 2;
+        goto out;
+    }
+    neuik_Element_InvalidateLayout(row);
+    neuik_Element_RequestRedraw(row, rLoc, rSize);
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* The horizontal spacing of a row (from its shared style if it has one).     */
+/*----------------------------------------------------------------------------*/
+static int neuik_ListRow_GetHSpacing(
+    NEUIK_ListRow * row)
+{
+    if (row->style != NULL) return row->style->HSpacing;
+    return row->HSpacing;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_Element_GetMinSize__ListRow
@@ -652,11 +754,12 @@ int neuik_Element_GetMinSize__ListRow(
             /* subsequent UI element is valid, add Horizontal Spacing */
             if (neuik__HighDPI_Scaling <= 1.0)
             {
-                thisW += (float)(row->HSpacing);
+                thisW += (float)(neuik_ListRow_GetHSpacing(row));
             }
             else
             {
-                thisW += (float)(row->HSpacing)*neuik__HighDPI_Scaling;
+                thisW += (float)(neuik_ListRow_GetHSpacing(row))*
+                    neuik__HighDPI_Scaling;
             }
         }
 
@@ -789,11 +892,12 @@ int neuik_Element_Render__ListRow(
 
     if (neuik__HighDPI_Scaling <= 1.0)
     {
-        fltHspacingSc = (float)(row->HSpacing);
+        fltHspacingSc = (float)(neuik_ListRow_GetHSpacing(row));
     }
     else
     {
-        fltHspacingSc = (float)(row->HSpacing)*neuik__HighDPI_Scaling;
+        fltHspacingSc = (float)(neuik_ListRow_GetHSpacing(row))*
+            neuik__HighDPI_Scaling;
     }
 
     /*------------------------------------------------------------------------*/
@@ -831,10 +935,21 @@ int neuik_Element_Render__ListRow(
             if (row->selected)
             {
                 eBase->eSt.focusstate = NEUIK_FOCUSSTATE_SELECTED;
+                if (row->style != NULL)
+                {
+                    bgClr = &(row->style->colorBGSelect);
+                    if (NEUIK_Element_SetBackgroundColorSolid_noRedraw(row, 
+                        "selected", bgClr->r, bgClr->g, bgClr->b, bgClr->a))
+                    {
+                        eNum = 9;
+                        goto out;
+                    }
+                }
             }
             else if (row->isOddRow)
             {
                 bgClr = &(row->colorBGOdd);
+                if (row->style != NULL) bgClr = &(row->style->colorBGOdd);
                 eBase->eSt.focusstate = NEUIK_FOCUSSTATE_NORMAL;
                 if (NEUIK_Element_SetBackgroundColorSolid_noRedraw(row, "normal",
                     bgClr->r, bgClr->g, bgClr->b, bgClr->a))
@@ -846,6 +961,7 @@ int neuik_Element_Render__ListRow(
             else
             {
                 bgClr = &(row->colorBGEven);
+                if (row->style != NULL) bgClr = &(row->style->colorBGEven);
                 eBase->eSt.focusstate = NEUIK_FOCUSSTATE_NORMAL;
                 if (NEUIK_Element_SetBackgroundColorSolid_noRedraw(row, "normal",
                     bgClr->r, bgClr->g, bgClr->b, bgClr->a))
@@ -1352,6 +1468,7 @@ neuik_EventState neuik_Element_CaptureEvent__ListRow(
                 row->selected      = 1;
                 row->wasSelected   = 0;
                 row->timeLastClick = SDL_GetTicks();
+                neuik_ListGroup_RowSelectionChanged(eBase->eSt.parent);
                 neuik_Window_TakeFocus(eBase->eSt.window, row);
 
                 neuik_Element_TriggerCallback(row, NEUIK_CALLBACK_ON_CLICK);
@@ -1470,12 +1587,23 @@ void neuik_Element_Defocus__ListRow(
     if (!neuik_Object_IsClass(rowElem, neuik__Class_ListRow)) return;
     row = (NEUIK_ListRow*)rowElem;
 
+    /*------------------------------------------------------------------------*/
+    /* The focus moved to another row of a ListGroup which keeps this row     */
+    /* selected (keyboard navigation / multi-selection).                      */
+    /*------------------------------------------------------------------------*/
+    if (neuik_ListGroup_IsManagingSelection(neuik_ListRow_GetParent(row)))
+    {
+        row->clickOrigin = 0;
+        return;
+    }
+
     if (row->selected)
     {
         row->clickOrigin = 0;
         row->selected    = 0;
         row->wasSelected = 0;
         neuik_Element_TriggerCallback(row, NEUIK_CALLBACK_ON_DESELECTED);
+        neuik_ListGroup_RowSelectionChanged(neuik_ListRow_GetParent(row));
 
         if (neuik_Element_GetSizeAndLocation(row, &rSize, &rLoc))
         {
@@ -15,6 +15,7 @@
  ******************************************************************************/
 #include <SDL.h>
 #include <stdlib.h>
+#include <math.h>
 
 #include "NEUIK_error.h"
 #include "NEUIK_render.h"
@@ -2020,6 +2021,8 @@ int NEUIK_Plot2D_AddPlotData(
     dataCfg->lineThickness      = 1.0;
     dataCfg->lineColorSpecified = FALSE;
     dataCfg->lineColor          = color0;
+    dataCfg->seenStateMod       = data->stateMod;
+    dataCfg->seenBaseMod        = data->ring.baseMod;
 
     if (neuik_Plot2D_UpdateAxesRanges(plot2d))
     {
@@ -2056,6 +2059,261 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  neuik_Plot2D_ScrollXAxis                                                  */
+/*                                                                            */
+/*  Scroll the X-Axis range of a plot by `dx` (a whole number of ticmark      */
+/*  steps). The ticmarks stay where they are; only the text of the existing   */
+/*  X-Axis ticmark labels is updated.                                         */
+/*                                                                            */
+/*  Returns: 1 if there is an error; 0 otherwise.                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_Plot2D_ScrollXAxis(
+    NEUIK_Plot2D * plot2d,
+    NEUIK_Plot   * plot,
+    double         dx)
+{
+    int           ctr     = 0;
+    int           nLabels = 0;
+    double        ticSize = 0.0;
+    double        ticVal  = 0.0;
+    NEUIK_Element ticElem = NULL;
+    char          ticMarkLbl[100];
+
+    plot->x_range_min += dx;
+    plot->x_range_max += dx;
+    if (!plot2d->xAxisCfg.showTicLabels) return 0;
+
+    /*------------------------------------------------------------------------*/
+    /* The labels are separated by fills (see neuik_Plot2D_UpdateAxesRanges); */
+    /* their values are found in the same way.                                */
+    /*------------------------------------------------------------------------*/
+    nLabels = (plot2d->xAxisCfg.nTicmarks > 2) ? plot2d->xAxisCfg.nTicmarks : 2;
+    ticSize = (plot->x_range_max - plot->x_range_min)/((double)(nLabels - 1));
+    ticVal  = plot->x_range_min;
+    for (ctr = 0; ctr < nLabels; ctr++)
+    {
+        if (ctr == nLabels - 1)
+        {
+            ticVal = plot->x_range_max;
+        }
+        else if (ctr > 0)
+        {
+            ticVal += ticSize;
+        }
+
+        if (NEUIK_Container_GetNthElement(
+            plot2d->drawing_x_axis_ticmarks, 2*ctr, &ticElem)) return 1;
+
+        sprintf(ticMarkLbl, "%g", ticVal);
+        if (NEUIK_Label_SetText(ticElem, ticMarkLbl)) return 1;
+    }
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Plot2D_RefreshPlotData
+ *
+ *  Description:   Bring the plot up to date after the values of its PlotData
+ *                 sets have changed, using the `stateMod` of each PlotData as
+ *                 a change notice. Nothing is redrawn if no set changed.
+ *
+ *                 The axes (and their ticmark labels) are only recalculated if
+ *                 the values of a set were replaced or no longer fit within
+ *                 the axes ranges. Points appended to a ring buffer PlotData
+ *                 beyond the end of the X-Axis scroll it by whole ticmark
+ *                 steps instead; only the plotted data (and the X-Axis
+ *                 ticmark labels, if it scrolled) are redrawn.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Plot2D_RefreshPlotData(
+    NEUIK_Plot2D * plot2d)
+{
+    int                    changed    = FALSE;
+    int                    newAxes    = FALSE;
+    int                    fixedX     = FALSE;
+    int                    fixedY     = FALSE;
+    unsigned int           uCtr       = 0;
+    double                 xMin       = 0.0;
+    double                 xMax       = 0.0;
+    double                 yMin       = 0.0;
+    double                 yMax       = 0.0;
+    double                 scrollTo   = 0.0; /* X value to scroll into view */
+    double                 ticSize    = 0.0;
+    double                 dx         = 0.0;
+    NEUIK_Plot           * plot       = NULL;
+    NEUIK_PlotData       * data       = NULL;
+    neuik_PlotDataConfig * dataCfg    = NULL;
+    RenderSize             rSize;
+    RenderLoc              rLoc;
+    int                    eNum       = 0; /* which error to report (if any) */
+    static char            funcName[] = "NEUIK_Plot2D_RefreshPlotData";
+    static char          * errMsgs[]  = {"", // [0] no error
+        "Argument `plot2d` is not of Plot2D class.",                       // [1]
+        "Argument `plot2d` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Failure in `neuik_Plot2D_UpdateAxesRanges()`.",                   // [3]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.",                // [4]
+        "Failure in `neuik_Plot2D_ScrollXAxis()`.",                        // [5]
+    };
+
+    /*------------------------------------------------------------------------*/
+    /* Check for errors before continuing.                                    */
+    /*------------------------------------------------------------------------*/
+    if (!neuik_Object_IsClass(plot2d, neuik__Class_Plot2D))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    if (neuik_Object_GetClassObject(plot2d, neuik__Class_Plot, (void**)&plot))
+    {
+        eNum = 2;
+        goto out;
+    }
+    fixedX   = (plot->x_range_cfg == NEUIK_PLOTRANGECONFIG_SPECIFIED);
+    fixedY   = (plot->y_range_cfg == NEUIK_PLOTRANGECONFIG_SPECIFIED);
+    scrollTo = plot->x_range_max;
+
+    for (uCtr = 0; uCtr < plot->n_used; uCtr++)
+    {
+        data    = (NEUIK_PlotData*)(plot->data_sets[uCtr]);
+        dataCfg = &(plot->data_configs[uCtr]);
+        if (data->stateMod == dataCfg->seenStateMod) continue;
+
+        changed = TRUE;
+        if (data->ring.cap == 0 || data->ring.baseMod != dataCfg->seenBaseMod)
+        {
+            /*----------------------------------------------------------------*/
+            /* The values of this set were replaced.                          */
+            /*----------------------------------------------------------------*/
+            newAxes = TRUE;
+        }
+        else if (data->boundsSet)
+        {
+            /*----------------------------------------------------------------*/
+            /* Points were only appended; check if they left the currently    */
+            /* displayed ranges (which specified ranges never change).        */
+            /*----------------------------------------------------------------*/
+            if (data->precision == 32)
+            {
+                xMin = (double)(data->bounds_32.x_min);
+                xMax = (double)(data->bounds_32.x_max);
+                yMin = (double)(data->bounds_32.y_min);
+                yMax = (double)(data->bounds_32.y_max);
+            }
+            else
+            {
+                xMin = data->bounds_64.x_min;
+                xMax = data->bounds_64.x_max;
+                yMin = data->bounds_64.y_min;
+                yMax = data->bounds_64.y_max;
+            }
+            if (!fixedY && 
+                (yMin < plot->y_range_min || yMax > plot->y_range_max))
+            {
+                newAxes = TRUE;
+            }
+            if (!fixedX && xMin < plot->x_range_min)
+            {
+                newAxes = TRUE;
+            }
+            if (!fixedX && xMax > scrollTo) scrollTo = xMax;
+        }
+        dataCfg->seenStateMod = data->stateMod;
+        dataCfg->seenBaseMod  = data->ring.baseMod;
+    }
+    if (!changed) goto out;
+
+    /*------------------------------------------------------------------------*/
+    /* The X-Axis may only be scrolled if all of the data still fits.         */
+    /*------------------------------------------------------------------------*/
+    if (!newAxes && scrollTo > plot->x_range_max)
+    {
+        ticSize = plot->x_range_max - plot->x_range_min;
+        if (plot2d->xAxisCfg.nTicmarks > 2)
+        {
+            ticSize /= (double)(plot2d->xAxisCfg.nTicmarks - 1);
+        }
+
+        if (plot->x_range_cfg != NEUIK_PLOTRANGECONFIG_AUTO || ticSize <= 0.0)
+        {
+            newAxes = TRUE;
+        }
+        else
+        {
+            dx = ticSize*ceil((scrollTo - plot->x_range_max)/ticSize);
+
+            for (uCtr = 0; uCtr < plot->n_used && !newAxes; uCtr++)
+            {
+                data = (NEUIK_PlotData*)(plot->data_sets[uCtr]);
+                if (!data->boundsSet) continue;
+
+                xMin = (data->precision == 32) ? 
+                    (double)(data->bounds_32.x_min) : data->bounds_64.x_min;
+                if (xMin < plot->x_range_min + dx) newAxes = TRUE;
+            }
+        }
+    }
+
+    if (newAxes)
+    {
+        if (neuik_Plot2D_UpdateAxesRanges(plot2d))
+        {
+            eNum = 3;
+            goto out;
+        }
+        if (neuik_Element_GetSizeAndLocation(plot2d, &rSize, &rLoc))
+        {
+            eNum = 4;
+            goto out;
+        }
+        neuik_Element_RequestRedraw(plot2d, rLoc, rSize);
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* The axes are unchanged (or only scrolled); just the plotted data (and  */
+    /* the X-Axis ticmark labels) must be redrawn.                            */
+    /*------------------------------------------------------------------------*/
+    if (dx > 0.0)
+    {
+        if (neuik_Plot2D_ScrollXAxis(plot2d, plot, dx))
+        {
+            eNum = 5;
+            goto out;
+        }
+        if (neuik_Element_GetSizeAndLocation(
+            plot2d->drawing_x_axis_ticmarks, &rSize, &rLoc))
+        {
+            eNum = 4;
+            goto out;
+        }
+        neuik_Element_RequestRedraw(plot2d, rLoc, rSize);
+    }
+    if (neuik_Element_GetSizeAndLocation(
+        plot2d->drawing_plotted_data, &rSize, &rLoc))
+    {
+        eNum = 4;
+        goto out;
+    }
+    neuik_Element_RequestRedraw(plot2d, rLoc, rSize);
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          NEUIK_Plot2D_Configure
@@ -13,6 +13,7 @@
  * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  ******************************************************************************/
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -146,6 +147,7 @@ int neuik_Object_New__PlotData(
     pd->nUsed      = 0;
     pd->precision  = 0;
     pd->boundsSet  = FALSE;
+    pd->borrowed   = FALSE;
     pd->data_32    = NULL; /* (at time of free) free pointer if non-NULL */
     pd->data_64    = NULL; /* (at time of free) free pointer if non-NULL */
     /*------------------*/
@@ -158,6 +160,17 @@ int neuik_Object_New__PlotData(
     pd->bounds_64.x_max = 0.0;
     pd->bounds_64.y_min = 0.0;
     pd->bounds_64.y_max = 0.0;
+    /*------------------*/
+    pd->ring.cap       = 0;
+    pd->ring.head      = 0;
+    pd->ring.baseMod   = 0;
+    pd->ring.nAppended = 0;
+    pd->ring.minQ      = NULL; /* (at time of free) free pointer if non-NULL */
+    pd->ring.maxQ      = NULL; /* (at time of free) free pointer if non-NULL */
+    pd->ring.minHead   = 0;
+    pd->ring.minLen    = 0;
+    pd->ring.maxHead   = 0;
+    pd->ring.maxLen    = 0;
 out:
     if (eNum > 0)
     {
@@ -169,6 +182,56 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* Release the ring buffer state of a PlotData (the values are not touched).  */
+/*----------------------------------------------------------------------------*/
+static void neuik_PlotData_ReleaseRing(
+    NEUIK_PlotData * pd)
+{
+    if (pd->ring.minQ != NULL) free(pd->ring.minQ);
+    if (pd->ring.maxQ != NULL) free(pd->ring.maxQ);
+    pd->ring.minQ      = NULL;
+    pd->ring.maxQ      = NULL;
+    pd->ring.cap       = 0;
+    pd->ring.head      = 0;
+    pd->ring.nAppended = 0;
+    pd->ring.minHead   = 0;
+    pd->ring.minLen    = 0;
+    pd->ring.maxHead   = 0;
+    pd->ring.maxLen    = 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Release the values held by a PlotData and reset its bounds; borrowed       */
+/* values are left to their owner.                                            */
+/*----------------------------------------------------------------------------*/
+static void neuik_PlotData_ReleaseValues(
+    NEUIK_PlotData * pd)
+{
+    neuik_PlotData_ReleaseRing(pd);
+    if (!pd->borrowed)
+    {
+        if (pd->data_32 != NULL) free(pd->data_32);
+        if (pd->data_64 != NULL) free(pd->data_64);
+    }
+    pd->data_32  = NULL;
+    pd->data_64  = NULL;
+    pd->borrowed = FALSE;
+    /*------------------*/
+    pd->bounds_32.x_min = 0.0;
+    pd->bounds_32.x_max = 0.0;
+    pd->bounds_32.y_min = 0.0;
+    pd->bounds_32.y_max = 0.0;
+    /*------------------*/
+    pd->bounds_64.x_min = 0.0;
+    pd->bounds_64.x_max = 0.0;
+    pd->bounds_64.y_min = 0.0;
+    pd->bounds_64.y_max = 0.0;
+    pd->boundsSet = FALSE;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_Object_Free__PlotData
@@ -216,8 +279,7 @@ int neuik_Object_Free__PlotData(
     /* Free other memory allocated by this object.                            */
     /*------------------------------------------------------------------------*/
     if (pd->uniqueName != NULL) free(pd->uniqueName);
-    if (pd->data_32 != NULL)    free(pd->data_32);
-    if (pd->data_64 != NULL)    free(pd->data_64);
+    neuik_PlotData_ReleaseValues(pd);
 
     /*------------------------------------------------------------------------*/
     /* Free the memory used for the object structure itself.                  */
@@ -281,6 +343,7 @@ int neuik_Object_Copy__PlotData(
     dst->nUsed     = src->nUsed;
     dst->precision = src->precision;
     dst->boundsSet = src->boundsSet;
+    dst->borrowed  = FALSE; /* (borrowed values are copied) */
     /*------------------*/
     dst->bounds_32.x_min = src->bounds_32.x_min;
     dst->bounds_32.x_max = src->bounds_32.x_max;
@@ -291,6 +354,15 @@ int neuik_Object_Copy__PlotData(
     dst->bounds_64.x_max = src->bounds_64.x_max;
     dst->bounds_64.y_min = src->bounds_64.y_min;
     dst->bounds_64.y_max = src->bounds_64.y_max;
+    /*------------------*/
+    dst->ring.cap       = src->ring.cap;
+    dst->ring.head      = src->ring.head;
+    dst->ring.baseMod   = dst->stateMod;
+    dst->ring.nAppended = 0;
+    dst->ring.minHead   = src->ring.minHead;
+    dst->ring.minLen    = src->ring.minLen;
+    dst->ring.maxHead   = src->ring.maxHead;
+    dst->ring.maxLen    = src->ring.maxLen;
 
     /*------------------------------------------------------------------------*/
     /* Now copy over allocated data value(s) if allocated.                    */
@@ -331,6 +403,20 @@ int neuik_Object_Copy__PlotData(
             dst->data_64[ctr] = src->data_64[ctr];
         }
     }
+    if (src->ring.cap > 0)
+    {
+        dst->ring.minQ = malloc(src->ring.cap*sizeof(unsigned int));
+        dst->ring.maxQ = malloc(src->ring.cap*sizeof(unsigned int));
+        if (dst->ring.minQ == NULL || dst->ring.maxQ == NULL)
+        {
+            eNum = 4;
+            goto out;
+        }
+        memcpy(dst->ring.minQ, src->ring.minQ,
+            src->ring.cap*sizeof(unsigned int));
+        memcpy(dst->ring.maxQ, src->ring.maxQ,
+            src->ring.cap*sizeof(unsigned int));
+    }
 out:
     if (eNum > 0)
     {
@@ -972,25 +1058,7 @@ int NEUIK_PlotData_SetValuesFromString(
     /*------------------------------------------------------------------------*/
     /* Free previously allocated PlotData values (if present).                */
     /*------------------------------------------------------------------------*/
-    if (pd->data_32 != NULL)
-    {
-        free(pd->data_32);
-        pd->data_32         = NULL;
-        pd->bounds_32.x_min = 0.0;
-        pd->bounds_32.x_max = 0.0;
-        pd->bounds_32.y_min = 0.0;
-        pd->bounds_32.y_max = 0.0;
-    }
-    if (pd->data_64 != NULL)
-    {
-        free(pd->data_64);
-        pd->data_64         = NULL;
-        pd->bounds_64.x_min = 0.0;
-        pd->bounds_64.x_max = 0.0;
-        pd->bounds_64.y_min = 0.0;
-        pd->bounds_64.y_max = 0.0;
-    }
-    pd->boundsSet = FALSE;
+    neuik_PlotData_ReleaseValues(pd);
 
     /*------------------------------------------------------------------------*/
     /* Determine/Set the PlotData bounds from these values.                   */
@@ -1214,6 +1282,774 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_PlotData_ScanValues32                                */
+/*                                                                            */
+/*  Description:   Check that the X values of `nPoints` X,Y pairs ascend and  */
+/*                 find the bounds of the values, in a single pass. The loop  */
+/*                 has no early exit or data-dependent branch so that the     */
+/*                 compiler may vectorize it. The bounds are stored in the    */
+/*                 PlotData only if the values are valid.                     */
+/*                                                                            */
+/*  Returns:       1 if the X values are not ascending; 0 otherwise.          */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_PlotData_ScanValues32(
+    NEUIK_PlotData * pd,
+    const float    * xy,
+    unsigned int     nPoints)
+{
+    int    unsorted = 0;
+    size_t ctr;
+    float  y;
+    float  yMin;
+    float  yMax;
+
+    if (nPoints == 0) return 0;
+
+    yMin = xy[1];
+    yMax = xy[1];
+    for (ctr = 1; ctr < nPoints; ctr++)
+    {
+        unsorted |= (xy[2*ctr] < xy[2*ctr - 2]);
+
+        y    = xy[2*ctr + 1];
+        yMin = (y < yMin) ? y : yMin;
+        yMax = (y > yMax) ? y : yMax;
+    }
+    if (unsorted) return 1;
+
+    pd->bounds_32.x_min = xy[0];
+    pd->bounds_32.x_max = xy[2*(size_t)(nPoints - 1)];
+    pd->bounds_32.y_min = yMin;
+    pd->bounds_32.y_max = yMax;
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* The 64bit counterpart of neuik_PlotData_ScanValues32.                      */
+/*----------------------------------------------------------------------------*/
+static int neuik_PlotData_ScanValues64(
+    NEUIK_PlotData * pd,
+    const double   * xy,
+    unsigned int     nPoints)
+{
+    int    unsorted = 0;
+    size_t ctr;
+    double y;
+    double yMin;
+    double yMax;
+
+    if (nPoints == 0) return 0;
+
+    yMin = xy[1];
+    yMax = xy[1];
+    for (ctr = 1; ctr < nPoints; ctr++)
+    {
+        unsorted |= (xy[2*ctr] < xy[2*ctr - 2]);
+
+        y    = xy[2*ctr + 1];
+        yMin = (y < yMin) ? y : yMin;
+        yMax = (y > yMax) ? y : yMax;
+    }
+    if (unsorted) return 1;
+
+    pd->bounds_64.x_min = xy[0];
+    pd->bounds_64.x_max = xy[2*(size_t)(nPoints - 1)];
+    pd->bounds_64.y_min = yMin;
+    pd->bounds_64.y_max = yMax;
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_PlotData_SetValues32
+ *
+ *  Description:   Supply a new set of X,Y data point values as an array of
+ *                 `nPoints` X,Y pairs of 32bit floats (sorted by ascending X
+ *                 value). The array is copied, taken over (it must then have
+ *                 been allocated with malloc), or borrowed (it must then stay
+ *                 valid and unchanged while in use by the PlotData), according
+ *                 to `ownership`.
+ *
+ *                 If an error occurs, the PlotData is left unchanged and does
+ *                 not take ownership of the array.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_PlotData_SetValues32(
+    NEUIK_PlotData          * pd,
+    const float             * xy,
+    unsigned int              nPoints,
+    NEUIK_PlotDataOwnership   ownership)
+{
+    float         * data       = NULL;
+    int             eNum       = 0; /* which error to report (if any) */
+    static char     funcName[] = "NEUIK_PlotData_SetValues32";
+    static char   * errMsgs[]  = {"", // [0] no error
+        "Argument `pd` is not of PlotData class.",                      // [1]
+        "Argument `xy` is NULL.",                                       // [2]
+        "Argument `nPoints` is too large.",                             // [3]
+        "Argument `ownership` has an invalid value.",                   // [4]
+        "Argument `xy` must have values sorted by ascending X values.", // [5]
+        "Failure to allocate memory.",                                  // [6]
+    };
+
+    /*------------------------------------------------------------------------*/
+    /* Check for errors before continuing.                                    */
+    /*------------------------------------------------------------------------*/
+    if (!neuik_Object_IsClass(pd, neuik__Class_PlotData))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (xy == NULL && nPoints > 0)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (nPoints > UINT_MAX/2)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (ownership != NEUIK_PLOTDATA_COPY &&
+        ownership != NEUIK_PLOTDATA_TAKE &&
+        ownership != NEUIK_PLOTDATA_BORROW)
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Copy the values first (if requested) so that the PlotData is only      */
+    /* modified once nothing else can fail.                                   */
+    /*------------------------------------------------------------------------*/
+    data = (float *)xy;
+    if (ownership == NEUIK_PLOTDATA_COPY && nPoints > 0)
+    {
+        data = (float *)malloc(2*(size_t)(nPoints)*sizeof(float));
+        if (data == NULL)
+        {
+            eNum = 6;
+            goto out;
+        }
+        memcpy(data, xy, 2*(size_t)(nPoints)*sizeof(float));
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Validate the X ordering; this also stores the new bounds.              */
+    /*------------------------------------------------------------------------*/
+    if (neuik_PlotData_ScanValues32(pd, data, nPoints))
+    {
+        if (data != xy) free(data);
+        eNum = 5;
+        goto out;
+    }
+    else if (ownership == NEUIK_PLOTDATA_TAKE && nPoints == 0)
+    {
+        if (data != NULL) free(data);
+        data = NULL;
+    }
+
+    neuik_PlotData_ReleaseRing(pd);
+    if (!pd->borrowed)
+    {
+        if (pd->data_32 != NULL && pd->data_32 != data) free(pd->data_32);
+        if (pd->data_64 != NULL) free(pd->data_64);
+    }
+    pd->data_64         = NULL;
+    pd->bounds_64.x_min = 0.0;
+    pd->bounds_64.x_max = 0.0;
+    pd->bounds_64.y_min = 0.0;
+    pd->bounds_64.y_max = 0.0;
+
+    pd->stateMod++;
+    pd->nAlloc    = 2*nPoints;
+    pd->nPoints   = nPoints;
+    pd->nUsed     = 2*nPoints;
+    pd->precision = 32;
+    pd->boundsSet = (nPoints > 0);
+    pd->borrowed  = (ownership == NEUIK_PLOTDATA_BORROW && nPoints > 0);
+    pd->data_32   = (nPoints > 0) ? data : NULL;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_PlotData_SetValues64
+ *
+ *  Description:   Supply a new set of X,Y data point values as an array of
+ *                 `nPoints` X,Y pairs of 64bit doubles (sorted by ascending X
+ *                 value). The array is copied, taken over (it must then have
+ *                 been allocated with malloc), or borrowed (it must then stay
+ *                 valid and unchanged while in use by the PlotData), according
+ *                 to `ownership`.
+ *
+ *                 If an error occurs, the PlotData is left unchanged and does
+ *                 not take ownership of the array.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_PlotData_SetValues64(
+    NEUIK_PlotData          * pd,
+    const double            * xy,
+    unsigned int              nPoints,
+    NEUIK_PlotDataOwnership   ownership)
+{
+    double        * data       = NULL;
+    int             eNum       = 0; /* which error to report (if any) */
+    static char     funcName[] = "NEUIK_PlotData_SetValues64";
+    static char   * errMsgs[]  = {"", // [0] no error
+        "Argument `pd` is not of PlotData class.",                      // [1]
+        "Argument `xy` is NULL.",                                       // [2]
+        "Argument `nPoints` is too large.",                             // [3]
+        "Argument `ownership` has an invalid value.",                   // [4]
+        "Argument `xy` must have values sorted by ascending X values.", // [5]
+        "Failure to allocate memory.",                                  // [6]
+    };
+
+    /*------------------------------------------------------------------------*/
+    /* Check for errors before continuing.                                    */
+    /*------------------------------------------------------------------------*/
+    if (!neuik_Object_IsClass(pd, neuik__Class_PlotData))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (xy == NULL && nPoints > 0)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (nPoints > UINT_MAX/2)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (ownership != NEUIK_PLOTDATA_COPY &&
+        ownership != NEUIK_PLOTDATA_TAKE &&
+        ownership != NEUIK_PLOTDATA_BORROW)
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Copy the values first (if requested) so that the PlotData is only      */
+    /* modified once nothing else can fail.                                   */
+    /*------------------------------------------------------------------------*/
+    data = (double *)xy;
+    if (ownership == NEUIK_PLOTDATA_COPY && nPoints > 0)
+    {
+        data = (double *)malloc(2*(size_t)(nPoints)*sizeof(double));
+        if (data == NULL)
+        {
+            eNum = 6;
+            goto out;
+        }
+        memcpy(data, xy, 2*(size_t)(nPoints)*sizeof(double));
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Validate the X ordering; this also stores the new bounds.              */
+    /*------------------------------------------------------------------------*/
+    if (neuik_PlotData_ScanValues64(pd, data, nPoints))
+    {
+        if (data != xy) free(data);
+        eNum = 5;
+        goto out;
+    }
+    else if (ownership == NEUIK_PLOTDATA_TAKE && nPoints == 0)
+    {
+        if (data != NULL) free(data);
+        data = NULL;
+    }
+
+    neuik_PlotData_ReleaseRing(pd);
+    if (!pd->borrowed)
+    {
+        if (pd->data_64 != NULL && pd->data_64 != data) free(pd->data_64);
+        if (pd->data_32 != NULL) free(pd->data_32);
+    }
+    pd->data_32         = NULL;
+    pd->bounds_32.x_min = 0.0;
+    pd->bounds_32.x_max = 0.0;
+    pd->bounds_32.y_min = 0.0;
+    pd->bounds_32.y_max = 0.0;
+
+    pd->stateMod++;
+    pd->nAlloc    = 2*nPoints;
+    pd->nPoints   = nPoints;
+    pd->nUsed     = 2*nPoints;
+    pd->precision = 64;
+    pd->boundsSet = (nPoints > 0);
+    pd->borrowed  = (ownership == NEUIK_PLOTDATA_BORROW && nPoints > 0);
+    pd->data_64   = (nPoints > 0) ? data : NULL;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_PlotData_SetRingCapacity
+ *
+ *  Description:   Switch a PlotData into append mode; its values are replaced
+ *                 by an empty ring buffer holding up to `capacity` X,Y points
+ *                 which may then be filled with NEUIK_PlotData_AppendPoints32
+ *                 or NEUIK_PlotData_AppendPoints64 (matching the precision of
+ *                 the PlotData). Once full, each appended point replaces the
+ *                 oldest one. A capacity of zero returns the PlotData to an
+ *                 empty, normal data set.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_PlotData_SetRingCapacity(
+    NEUIK_PlotData * pd,
+    unsigned int     capacity)
+{
+    void          * data       = NULL;
+    unsigned int  * minQ       = NULL;
+    unsigned int  * maxQ       = NULL;
+    size_t          valSize    = 0;
+    int             eNum       = 0; /* which error to report (if any) */
+    static char     funcName[] = "NEUIK_PlotData_SetRingCapacity";
+    static char   * errMsgs[]  = {"", // [0] no error
+        "Argument `pd` is not of PlotData class.",                  // [1]
+        "Argument `pd` has an unsupported value for precision.",    // [2]
+        "Argument `capacity` is too large.",                        // [3]
+        "Failure to allocate memory.",                              // [4]
+    };
+
+    /*------------------------------------------------------------------------*/
+    /* Check for errors before continuing.                                    */
+    /*------------------------------------------------------------------------*/
+    if (!neuik_Object_IsClass(pd, neuik__Class_PlotData))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (!(pd->precision == 32 || pd->precision == 64))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (capacity > UINT_MAX/2)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    if (capacity > 0)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Allocate everything first so that a failure leaves the PlotData    */
+        /* unchanged.                                                         */
+        /*--------------------------------------------------------------------*/
+        valSize = (pd->precision == 32) ? sizeof(float) : sizeof(double);
+        data = malloc(2*(size_t)(capacity)*valSize);
+        minQ = malloc(capacity*sizeof(unsigned int));
+        maxQ = malloc(capacity*sizeof(unsigned int));
+        if (data == NULL || minQ == NULL || maxQ == NULL)
+        {
+            if (data != NULL) free(data);
+            if (minQ != NULL) free(minQ);
+            if (maxQ != NULL) free(maxQ);
+            eNum = 4;
+            goto out;
+        }
+    }
+
+    neuik_PlotData_ReleaseValues(pd);
+
+    pd->stateMod++;
+    pd->nAlloc    = 2*capacity;
+    pd->nPoints   = 0;
+    pd->nUsed     = 0;
+    if (pd->precision == 32)
+    {
+        pd->data_32 = (float *)data;
+    }
+    else
+    {
+        pd->data_64 = (double *)data;
+    }
+    pd->ring.cap     = capacity;
+    pd->ring.baseMod = pd->stateMod;
+    pd->ring.minQ    = minQ;
+    pd->ring.maxQ    = maxQ;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_PlotData_RingPush32                                  */
+/*                                                                            */
+/*  Description:   Store one X,Y point at the end of the ring buffer of a     */
+/*                 PlotData, dropping the oldest point if the buffer is full. */
+/*                                                                            */
+/*                 The running Y bounds are kept by two monotonic deques of   */
+/*                 point indices (oldest first): minQ holds strictly          */
+/*                 increasing Y values and maxQ strictly decreasing ones, so  */
+/*                 their front entries are always the minimum and maximum of  */
+/*                 the current window. Every point enters and leaves each     */
+/*                 deque at most once, making this O(1) amortized.            */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static void neuik_PlotData_RingPush32(
+    NEUIK_PlotData * pd,
+    float            x,
+    float            y)
+{
+    unsigned int   cap  = pd->ring.cap;
+    unsigned int   slot = 0;
+    unsigned int * minQ = pd->ring.minQ;
+    unsigned int * maxQ = pd->ring.maxQ;
+    float        * data = pd->data_32;
+
+    if (pd->nPoints == cap)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Drop the oldest point; if it is still in a deque it is the front.  */
+        /*--------------------------------------------------------------------*/
+        if (pd->ring.minLen > 0 && minQ[pd->ring.minHead] == pd->ring.head)
+        {
+            pd->ring.minHead = (pd->ring.minHead + 1) % cap;
+            pd->ring.minLen--;
+        }
+        if (pd->ring.maxLen > 0 && maxQ[pd->ring.maxHead] == pd->ring.head)
+        {
+            pd->ring.maxHead = (pd->ring.maxHead + 1) % cap;
+            pd->ring.maxLen--;
+        }
+        pd->ring.head = (pd->ring.head + 1) % cap;
+        pd->nPoints--;
+    }
+
+    slot = (pd->ring.head + pd->nPoints) % cap;
+    data[2*slot]     = x;
+    data[2*slot + 1] = y;
+    pd->nPoints++;
+
+    while (pd->ring.minLen > 0 &&
+        data[2*minQ[(pd->ring.minHead + pd->ring.minLen - 1) % cap] + 1] >= y)
+    {
+        pd->ring.minLen--;
+    }
+    minQ[(pd->ring.minHead + pd->ring.minLen) % cap] = slot;
+    pd->ring.minLen++;
+
+    while (pd->ring.maxLen > 0 &&
+        data[2*maxQ[(pd->ring.maxHead + pd->ring.maxLen - 1) % cap] + 1] <= y)
+    {
+        pd->ring.maxLen--;
+    }
+    maxQ[(pd->ring.maxHead + pd->ring.maxLen) % cap] = slot;
+    pd->ring.maxLen++;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* The 64bit counterpart of neuik_PlotData_RingPush32.                        */
+/*----------------------------------------------------------------------------*/
+static void neuik_PlotData_RingPush64(
+    NEUIK_PlotData * pd,
+    double           x,
+    double           y)
+{
+    unsigned int   cap  = pd->ring.cap;
+    unsigned int   slot = 0;
+    unsigned int * minQ = pd->ring.minQ;
+    unsigned int * maxQ = pd->ring.maxQ;
+    double       * data = pd->data_64;
+
+    if (pd->nPoints == cap)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Drop the oldest point; if it is still in a deque it is the front.  */
+        /*--------------------------------------------------------------------*/
+        if (pd->ring.minLen > 0 && minQ[pd->ring.minHead] == pd->ring.head)
+        {
+            pd->ring.minHead = (pd->ring.minHead + 1) % cap;
+            pd->ring.minLen--;
+        }
+        if (pd->ring.maxLen > 0 && maxQ[pd->ring.maxHead] == pd->ring.head)
+        {
+            pd->ring.maxHead = (pd->ring.maxHead + 1) % cap;
+            pd->ring.maxLen--;
+        }
+        pd->ring.head = (pd->ring.head + 1) % cap;
+        pd->nPoints--;
+    }
+
+    slot = (pd->ring.head + pd->nPoints) % cap;
+    data[2*slot]     = x;
+    data[2*slot + 1] = y;
+    pd->nPoints++;
+
+    while (pd->ring.minLen > 0 &&
+        data[2*minQ[(pd->ring.minHead + pd->ring.minLen - 1) % cap] + 1] >= y)
+    {
+        pd->ring.minLen--;
+    }
+    minQ[(pd->ring.minHead + pd->ring.minLen) % cap] = slot;
+    pd->ring.minLen++;
+
+    while (pd->ring.maxLen > 0 &&
+        data[2*maxQ[(pd->ring.maxHead + pd->ring.maxLen - 1) % cap] + 1] <= y)
+    {
+        pd->ring.maxLen--;
+    }
+    maxQ[(pd->ring.maxHead + pd->ring.maxLen) % cap] = slot;
+    pd->ring.maxLen++;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_PlotData_AppendPoints32
+ *
+ *  Description:   Append `nPoints` X,Y pairs of 32bit floats to a PlotData in
+ *                 append mode (see NEUIK_PlotData_SetRingCapacity). The X
+ *                 values must ascend and must not be less than the last X
+ *                 value already held. The bounds are updated incrementally.
+ *
+ *                 Appending increments `stateMod` but leaves `ring.baseMod`
+ *                 unchanged; `ring.nAppended` tells a consumer how many points
+ *                 arrived (and, once the buffer is full, how many scrolled
+ *                 out) since it last looked.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_PlotData_AppendPoints32(
+    NEUIK_PlotData * pd,
+    const float    * xy,
+    unsigned int     nPoints)
+{
+    int             unsorted   = 0;
+    unsigned int    last       = 0;
+    size_t          ctr        = 0;
+    int             eNum       = 0; /* which error to report (if any) */
+    static char     funcName[] = "NEUIK_PlotData_AppendPoints32";
+    static char   * errMsgs[]  = {"", // [0] no error
+        "Argument `pd` is not of PlotData class.",                          // [1]
+        "Argument `pd` is not in append mode (no ring buffer capacity).",   // [2]
+        "Argument `pd` does not have a precision of 32.",                   // [3]
+        "Argument `xy` is NULL.",                                           // [4]
+        "Argument `xy` must have values sorted by ascending X values.",     // [5]
+    };
+
+    /*------------------------------------------------------------------------*/
+    /* Check for errors before continuing.                                    */
+    /*------------------------------------------------------------------------*/
+    if (!neuik_Object_IsClass(pd, neuik__Class_PlotData))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (pd->ring.cap == 0)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (pd->precision != 32)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (nPoints == 0) goto out;
+    if (xy == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Validate the whole batch before storing any of it.                     */
+    /*------------------------------------------------------------------------*/
+    if (pd->nPoints > 0)
+    {
+        last = (pd->ring.head + pd->nPoints - 1) % pd->ring.cap;
+        unsorted = (xy[0] < pd->data_32[2*last]);
+    }
+    for (ctr = 1; ctr < nPoints; ctr++)
+    {
+        unsorted |= (xy[2*ctr] < xy[2*ctr - 2]);
+    }
+    if (unsorted)
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Only the last `cap` points of a large batch can remain in the buffer.  */
+    /*------------------------------------------------------------------------*/
+    ctr = (nPoints > pd->ring.cap) ? nPoints - pd->ring.cap : 0;
+    for (; ctr < nPoints; ctr++)
+    {
+        neuik_PlotData_RingPush32(pd, xy[2*ctr], xy[2*ctr + 1]);
+    }
+
+    last = (pd->ring.head + pd->nPoints - 1) % pd->ring.cap;
+    pd->bounds_32.x_min = pd->data_32[2*pd->ring.head];
+    pd->bounds_32.x_max = pd->data_32[2*last];
+    pd->bounds_32.y_min = pd->data_32[2*pd->ring.minQ[pd->ring.minHead] + 1];
+    pd->bounds_32.y_max = pd->data_32[2*pd->ring.maxQ[pd->ring.maxHead] + 1];
+    pd->boundsSet = TRUE;
+
+    pd->stateMod++;
+    pd->nUsed           = 2*pd->nPoints;
+    pd->ring.nAppended += nPoints;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_PlotData_AppendPoints64
+ *
+ *  Description:   Append `nPoints` X,Y pairs of 64bit doubles to a PlotData in
+ *                 append mode (see NEUIK_PlotData_SetRingCapacity). The X
+ *                 values must ascend and must not be less than the last X
+ *                 value already held. The bounds are updated incrementally.
+ *
+ *                 Appending increments `stateMod` but leaves `ring.baseMod`
+ *                 unchanged; `ring.nAppended` tells a consumer how many points
+ *                 arrived (and, once the buffer is full, how many scrolled
+ *                 out) since it last looked.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_PlotData_AppendPoints64(
+    NEUIK_PlotData * pd,
+    const double   * xy,
+    unsigned int     nPoints)
+{
+    int             unsorted   = 0;
+    unsigned int    last       = 0;
+    size_t          ctr        = 0;
+    int             eNum       = 0; /* which error to report (if any) */
+    static char     funcName[] = "NEUIK_PlotData_AppendPoints64";
+    static char   * errMsgs[]  = {"", // [0] no error
+        "Argument `pd` is not of PlotData class.",                          // [1]
+        "Argument `pd` is not in append mode (no ring buffer capacity).",   // [2]
+        "Argument `pd` does not have a precision of 64.",                   // [3]
+        "Argument `xy` is NULL.",                                           // [4]
+        "Argument `xy` must have values sorted by ascending X values.",     // [5]
+    };
+
+    /*------------------------------------------------------------------------*/
+    /* Check for errors before continuing.                                    */
+    /*------------------------------------------------------------------------*/
+    if (!neuik_Object_IsClass(pd, neuik__Class_PlotData))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (pd->ring.cap == 0)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (pd->precision != 64)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (nPoints == 0) goto out;
+    if (xy == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Validate the whole batch before storing any of it.                     */
+    /*------------------------------------------------------------------------*/
+    if (pd->nPoints > 0)
+    {
+        last = (pd->ring.head + pd->nPoints - 1) % pd->ring.cap;
+        unsorted = (xy[0] < pd->data_64[2*last]);
+    }
+    for (ctr = 1; ctr < nPoints; ctr++)
+    {
+        unsorted |= (xy[2*ctr] < xy[2*ctr - 2]);
+    }
+    if (unsorted)
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Only the last `cap` points of a large batch can remain in the buffer.  */
+    /*------------------------------------------------------------------------*/
+    ctr = (nPoints > pd->ring.cap) ? nPoints - pd->ring.cap : 0;
+    for (; ctr < nPoints; ctr++)
+    {
+        neuik_PlotData_RingPush64(pd, xy[2*ctr], xy[2*ctr + 1]);
+    }
+
+    last = (pd->ring.head + pd->nPoints - 1) % pd->ring.cap;
+    pd->bounds_64.x_min = pd->data_64[2*pd->ring.head];
+    pd->bounds_64.x_max = pd->data_64[2*last];
+    pd->bounds_64.y_min = pd->data_64[2*pd->ring.minQ[pd->ring.minHead] + 1];
+    pd->bounds_64.y_max = pd->data_64[2*pd->ring.maxQ[pd->ring.maxHead] + 1];
+    pd->boundsSet = TRUE;
+
+    pd->stateMod++;
+    pd->nUsed           = 2*pd->nPoints;
+    pd->ring.nAppended += nPoints;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          NEUIK_PlotData_WriteValuesToASCIIFile
@@ -1314,12 +2150,14 @@ int NEUIK_PlotData_WriteValuesToASCIIFile(
                 fprintf(outFile, "%s", cmtBarLn);
             }
 
+            posCtr = 2*pd->ring.head;
             for (ctr = 0; ctr < pd->nPoints; ctr++)
             {
                 fprintf(outFile, "% 16.10e % 16.10e\n", 
                     pd->data_32[posCtr],
                     pd->data_32[posCtr+1]);
                 posCtr += 2;
+                if (posCtr == 2*pd->ring.cap) posCtr = 0;
             }
             break;
         case 64:
@@ -1341,12 +2179,14 @@ int NEUIK_PlotData_WriteValuesToASCIIFile(
                 fprintf(outFile, "%s", cmtBarLn);
             }
 
+            posCtr = 2*pd->ring.head;
             for (ctr = 0; ctr < pd->nPoints; ctr++)
             {
                 fprintf(outFile, "% 18.12e % 18.12e\n", 
                     pd->data_64[posCtr],
                     pd->data_64[posCtr+1]);
                 posCtr += 2;
+                if (posCtr == 2*pd->ring.cap) posCtr = 0;
             }
             break;
         default:
@@ -390,13 +390,13 @@ int neuik_Element_GetMinSize__ProgressBar(
     if (strlen(pb->fracText) > 0)
     {
         /* this ProgressBar contains text */
-        TTF_SizeText(font, pb->fracText, &tW, &tH);
+        TTF_SizeUTF8(font, pb->fracText, &tW, &tH);
 
     }
     else
     {
         /* this ProgressBar does not contain text */
-        TTF_SizeText(font, " ", &tW, &tH);
+        TTF_SizeUTF8(font, " ", &tW, &tH);
     }
 
     rSize->w = tW + aCfg->fontEmWidth;
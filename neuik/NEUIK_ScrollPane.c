@@ -0,0 +1,1437 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <SDL.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "NEUIK_error.h"
+#include "NEUIK_render.h"
+#include "NEUIK_structs_basic.h"
+#include "NEUIK_ScrollPane.h"
+#include "NEUIK_Element_internal.h"
+#include "NEUIK_Window_internal.h"
+#include "NEUIK_Container.h"
+#include "neuik_MaskMap.h"
+#include "neuik_internal.h"
+#include "neuik_classes.h"
+
+extern int neuik__isInitialized;
+extern int neuik__Report_Debug;
+extern float neuik__HighDPI_Scaling;
+
+/*----------------------------------------------------------------------------*/
+/* The distance (in pixels) scrolled by a single mouse wheel step.            */
+/*----------------------------------------------------------------------------*/
+#define NEUIK_SCROLLPANE_WHEELSTEP 32
+
+/*----------------------------------------------------------------------------*/
+/* The retained viewport of a ScrollPane. The element surface (`eSt.surf`)    */
+/* holds the content as it appeared with the offsets (drawnX, drawnY); the    */
+/* texture is a copy of that surface uploaded for the window renderer.        */
+/*                                                                            */
+/* The texture wraps around; viewport pixel (x, y) is held in the texel       */
+/* ((x + texOX) % w, (y + texOY) % h). Scrolling moves this origin so that    */
+/* only the newly exposed strips have to be uploaded.                         */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    SDL_Texture  * tex;        /* streaming copy of the viewport surface */
+    SDL_Renderer * texRend;    /* the renderer `tex` was created for */
+    int            texOX;      /* texel column of viewport column zero */
+    int            texOY;      /* texel row of viewport row zero */
+    int            valid;      /* surface holds the content at drawnX/drawnY */
+    int            drawnX;     /* horizontal offset held by the surface */
+    int            drawnY;     /* vertical offset held by the surface */
+    SDL_Rect       dirty;      /* redraws requested within the content */
+    RenderSize     content;    /* laid out content size (including padding) */
+    int            lastMouseX; /* last known mouse position; wheel events */
+    int            lastMouseY; /* don't carry a position of their own */
+} neuik_ScrollPaneCache;
+
+/*----------------------------------------------------------------------------*/
+/* Internal Function Prototypes                                               */
+/*----------------------------------------------------------------------------*/
+int neuik_Object_New__ScrollPane(void ** spPtr);
+int neuik_Object_Free__ScrollPane(void * spPtr);
+
+int neuik_Element_GetMinSize__ScrollPane(NEUIK_Element, RenderSize*);
+neuik_EventState neuik_Element_CaptureEvent__ScrollPane(
+    NEUIK_Element, SDL_Event*);
+int neuik_Element_Render__ScrollPane(
+    NEUIK_Element, RenderSize*, RenderLoc*, SDL_Renderer*, int);
+int neuik_Element_RequestRedraw__ScrollPane(
+    NEUIK_Element, RenderLoc, RenderSize);
+
+
+/*----------------------------------------------------------------------------*/
+/* neuik_Object    Function Table                                             */
+/*----------------------------------------------------------------------------*/
+neuik_Class_BaseFuncs neuik_ScrollPane_BaseFuncs = {
+    /* Init(): Class initialization (in most cases will not be needed) */
+    NULL, /* (unused) */
+    /* New(): Allocate and Initialize the object */
+    neuik_Object_New__ScrollPane,
+    /* Copy(): Copy the contents of one object into another */
+    NULL,
+    /* Free(): Free the allocated memory of an object */
+    neuik_Object_Free__ScrollPane,
+};
+
+/*----------------------------------------------------------------------------*/
+/* neuik_Element    Function Table                                            */
+/*----------------------------------------------------------------------------*/
+NEUIK_Element_FuncTable neuik_ScrollPane_FuncTable = {
+    /* GetMinSize(): Get the minimum required size for the element  */
+    neuik_Element_GetMinSize__ScrollPane,
+
+    /* Render(): Redraw the element  element  */
+    neuik_Element_Render__ScrollPane,
+
+    /* CaptureEvent(): Determine if this element caputures a given event */
+    NULL,
+
+    /* Defocus(): This function will be called when an element looses focus */
+    NULL,
+};
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_RegisterClass_ScrollPane
+ *
+ *  Description:   Register this class with the NEUIK runtime.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_RegisterClass_ScrollPane()
+{
+    int            eNum       = 0; /* which error to report (if any) */
+    static char    funcName[] = "neuik_RegisterClass_ScrollPane";
+    static char  * errMsgs[]  = {"", // [0] no error
+        "NEUIK library must be initialized first.",       // [1]
+        "Failed to register `ScrollPane` object class .", // [2]
+        "Failed to register `Virtual Function`.",         // [3]
+    };
+
+    if (!neuik__isInitialized)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Otherwise, register the object                                         */
+    /*------------------------------------------------------------------------*/
+    if (neuik_RegisterClass(
+        "ScrollPane",                                  // className
+        "A single element container which shows a "
+        "scrollable viewport onto its element.",       // classDescription
+        neuik__Set_NEUIK,                              // classSet
+        neuik__Class_Container,                        // superClass
+        &neuik_ScrollPane_BaseFuncs,                   // baseFuncs
+        NULL,                                          // classFuncs
+        &neuik__Class_ScrollPane))                     // newClass
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    if (neuik_VirtualFunc_RegisterImplementation(
+        &neuik_Element_vfunc_CaptureEvent,
+        neuik__Class_ScrollPane,
+        neuik_Element_CaptureEvent__ScrollPane))
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    if (neuik_VirtualFunc_RegisterImplementation(
+        &neuik_Element_vfunc_RequestRedraw,
+        neuik__Class_ScrollPane,
+        neuik_Element_RequestRedraw__ScrollPane))
+    {
+        eNum = 3;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Object_New__ScrollPane
+ *
+ *  Description:   An implementation of the neuik_Object_New method.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Object_New__ScrollPane(
+    void ** spPtr)
+{
+    int                     eNum       = 0;
+    NEUIK_Container       * cont       = NULL;
+    NEUIK_ScrollPane      * sp         = NULL;
+    NEUIK_Element         * sClassPtr  = NULL;
+    neuik_ScrollPaneCache * cache      = NULL;
+    static char             funcName[] = "neuik_Object_New__ScrollPane";
+    static char           * errMsgs[]  = {"", // [0] no error
+        "Output Argument `spPtr` is NULL.",                               // [1]
+        "Failure to allocate memory.",                                    // [2]
+        "Failure in `neuik_GetObjectBaseOfClass`.",                       // [3]
+        "Failure in function `neuik.NewElement`.",                        // [4]
+        "Failure in function `neuik_Element_SetFuncTable`.",              // [5]
+        "Argument `spPtr` caused `neuik_Object_GetClassObject` to fail.", // [6]
+    };
+
+    if (spPtr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    (*spPtr) = (NEUIK_ScrollPane*) malloc(sizeof(NEUIK_ScrollPane));
+    sp = *spPtr;
+    if (sp == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    sp->scrollX = 0;
+    sp->scrollY = 0;
+    sp->cache   = NULL;
+
+    cache = (neuik_ScrollPaneCache*) malloc(sizeof(neuik_ScrollPaneCache));
+    if (cache == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    cache->tex        = NULL;
+    cache->texRend    = NULL;
+    cache->texOX      = 0;
+    cache->texOY      = 0;
+    cache->valid      = 0;
+    cache->drawnX     = 0;
+    cache->drawnY     = 0;
+    cache->dirty.x    = 0;
+    cache->dirty.y    = 0;
+    cache->dirty.w    = 0;
+    cache->dirty.h    = 0;
+    cache->content.w  = 0;
+    cache->content.h  = 0;
+    cache->lastMouseX = -1;
+    cache->lastMouseY = -1;
+    sp->cache = cache;
+
+    /*------------------------------------------------------------------------*/
+    /* Successful allocation of Memory -- Create Base Class Object            */
+    /*------------------------------------------------------------------------*/
+    if (neuik_GetObjectBaseOfClass(
+            neuik__Set_NEUIK, 
+            neuik__Class_ScrollPane, 
+            NULL,
+            &(sp->objBase)))
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Create first level Base SuperClass Object                              */
+    /*------------------------------------------------------------------------*/
+    sClassPtr = (NEUIK_Element *) &(sp->objBase.superClassObj);
+    if (neuik_Object_New(neuik__Class_Container, sClassPtr))
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (neuik_Element_SetFuncTable(sp, &neuik_ScrollPane_FuncTable))
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    if (neuik_Object_GetClassObject(sp, neuik__Class_Container, (void**)&cont))
+    {
+        eNum = 6;
+        goto out;
+    }
+    cont->cType        = NEUIK_CONTAINER_SINGLE;
+    cont->shownIfEmpty = 1;
+
+    /*------------------------------------------------------------------------*/
+    /* The pane keeps the default (solid) element background; the retained   */
+    /* viewport is only ever partially redrawn, so it must be opaque.         */
+    /*------------------------------------------------------------------------*/
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Object_Free__ScrollPane
+ *
+ *  Description:   An implementation of the neuik_Object_Free method.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Object_Free__ScrollPane(
+    void * spPtr)
+{
+    int                     eNum       = 0;    /* which error to report (if any) */
+    NEUIK_ScrollPane      * sp         = NULL;
+    neuik_ScrollPaneCache * cache      = NULL;
+    static char             funcName[] = "neuik_Object_Free__ScrollPane";
+    static char           * errMsgs[]  = {"", // [0] no error
+        "Argument `spPtr` is NULL.",                     // [1]
+        "Argument `spPtr` is not of ScrollPane class.",  // [2]
+        "Failure in function `neuik_Object_Free`.",      // [3]
+    };
+
+    if (spPtr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    if (!neuik_Object_IsClass(spPtr, neuik__Class_ScrollPane))
+    {
+        eNum = 2;
+        goto out;
+    }
+    sp = (NEUIK_ScrollPane*)spPtr;
+
+    /*------------------------------------------------------------------------*/
+    /* The object is what it says it is and it is still allocated.            */
+    /*------------------------------------------------------------------------*/
+    if(neuik_Object_Free(sp->objBase.superClassObj))
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    cache = (neuik_ScrollPaneCache*)(sp->cache);
+    if (cache != NULL)
+    {
+        ConditionallyDestroyTexture(&(cache->tex));
+        free(cache);
+    }
+
+    free(sp);
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_NewScrollPane
+ *
+ *  Description:   Create and return a pointer to a new NEUIK_ScrollPane.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_NewScrollPane(
+    NEUIK_ScrollPane ** spPtr)
+{
+    return neuik_Object_New__ScrollPane((void**)spPtr);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_ScrollPane_ClampOffsets                              */
+/*                                                                            */
+/*  Description:   Restrict a pair of scroll offsets to the range permitted   */
+/*                 by the last laid out content size and the viewport size.   */
+/*                                                                            */
+/*  Returns:       Nothing.                                                   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static void neuik_ScrollPane_ClampOffsets(
+    NEUIK_ScrollPane  * sp,
+    NEUIK_ElementBase * eBase,
+    int               * x,
+    int               * y)
+{
+    int                     maxX  = 0;
+    int                     maxY  = 0;
+    neuik_ScrollPaneCache * cache = (neuik_ScrollPaneCache*)(sp->cache);
+
+    maxX = cache->content.w - eBase->eSt.rSize.w;
+    maxY = cache->content.h - eBase->eSt.rSize.h;
+
+    if (*x > maxX) *x = maxX;
+    if (*y > maxY) *y = maxY;
+    if (*x < 0)    *x = 0;
+    if (*y < 0)    *y = 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ScrollPane_ScrollTo
+ *
+ *  Description:   Scroll the pane so that the content position (x, y) appears
+ *                 in its upper left corner. The offsets are clamped to the
+ *                 scrollable range of the content.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ScrollPane_ScrollTo(
+    NEUIK_ScrollPane * sp,
+    int                x,
+    int                y)
+{
+    int                 eNum       = 0; /* which error to report (if any) */
+    NEUIK_ElementBase * eBase      = NULL;
+    static char         funcName[] = "NEUIK_ScrollPane_ScrollTo";
+    static char       * errMsgs[]  = {"", // [0] no error
+        "Argument `sp` is not of ScrollPane class.",                   // [1]
+        "Argument `sp` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Failure in `neuik_Element_RequestRedraw()`.",                 // [3]
+    };
+
+    if (!neuik_Object_IsClass(sp, neuik__Class_ScrollPane))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(sp, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    neuik_ScrollPane_ClampOffsets(sp, eBase, &x, &y);
+    if (x == sp->scrollX && y == sp->scrollY) goto out;
+
+    sp->scrollX = x;
+    sp->scrollY = y;
+
+    /*------------------------------------------------------------------------*/
+    /* Only the pane itself is marked; the contained element is untouched as */
+    /* the retained viewport is shifted during the next render.               */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Element_RequestRedraw(sp, eBase->eSt.rLoc, eBase->eSt.rSize))
+    {
+        eNum = 3;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ScrollPane_ScrollBy
+ *
+ *  Description:   Scroll the pane by a relative amount (in pixels).
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ScrollPane_ScrollBy(
+    NEUIK_ScrollPane * sp,
+    int                dx,
+    int                dy)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "NEUIK_ScrollPane_ScrollBy";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `sp` is not of ScrollPane class.",   // [1]
+        "Failure in `NEUIK_ScrollPane_ScrollTo()`.",   // [2]
+    };
+
+    if (!neuik_Object_IsClass(sp, neuik__Class_ScrollPane))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (NEUIK_ScrollPane_ScrollTo(sp, sp->scrollX + dx, sp->scrollY + dy))
+    {
+        eNum = 2;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ScrollPane_GetScrollOffset
+ *
+ *  Description:   Get the current scroll offsets of the pane.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ScrollPane_GetScrollOffset(
+    NEUIK_ScrollPane * sp,
+    int              * x,
+    int              * y)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "NEUIK_ScrollPane_GetScrollOffset";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `sp` is not of ScrollPane class.",   // [1]
+        "Output argument(s) `x` and/or `y` are NULL.", // [2]
+    };
+
+    if (!neuik_Object_IsClass(sp, neuik__Class_ScrollPane))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (x == NULL || y == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    *x = sp->scrollX;
+    *y = sp->scrollY;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_GetMinSize__ScrollPane
+ *
+ *  Description:   Returns the minimum size of a ScrollPane. As the pane only
+ *                 shows a viewport onto its content, this does not depend upon
+ *                 the size of the contained element; the pane is expected to
+ *                 be configured to fill the space it is given.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Element_GetMinSize__ScrollPane(
+    NEUIK_Element   spElem,
+    RenderSize    * rSize)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_Element_GetMinSize__ScrollPane";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `spElem` is not of ScrollPane class.", // [1]
+    };
+
+    rSize->w = 1;
+    rSize->h = 1;
+
+    if (!neuik_Object_IsClass(spElem, neuik__Class_ScrollPane))
+    {
+        eNum = 1;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_ScrollPane_ShiftSurface                              */
+/*                                                                            */
+/*  Description:   Move the pixels of the viewport surface by (-dx, -dy) so   */
+/*                 that content drawn at one scroll offset lines up with an   */
+/*                 offset which is larger by (dx, dy). The pixels which are   */
+/*                 left over are stale and have to be rendered afterwards.    */
+/*                                                                            */
+/*  Returns:       1 if there is an error; 0 otherwise.                       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ScrollPane_ShiftSurface(
+    SDL_Surface * surf,
+    int           dx,
+    int           dy)
+{
+    int      y;
+    int      yDst;
+    int      bpp;
+    int      nRows;
+    int      nBytes;
+    int      srcX;
+    int      dstX;
+    Uint8  * pixels;
+
+    if (SDL_MUSTLOCK(surf))
+    {
+        if (SDL_LockSurface(surf)) return 1;
+    }
+
+    bpp    = surf->format->BytesPerPixel;
+    pixels = (Uint8*)(surf->pixels);
+    nRows  = surf->h - abs(dy);
+    nBytes = (surf->w - abs(dx))*bpp;
+    srcX   = (dx > 0) ?  dx*bpp : 0;
+    dstX   = (dx < 0) ? -dx*bpp : 0;
+
+    /*------------------------------------------------------------------------*/
+    /* Rows are visited in the order which never overwrites a source row      */
+    /* before it has been moved.                                              */
+    /*------------------------------------------------------------------------*/
+    for (y = 0; y < nRows; y++)
+    {
+        yDst = (dy >= 0) ? y : (surf->h - 1 - y);
+        memmove(
+            pixels + yDst*surf->pitch + dstX,
+            pixels + (yDst + dy)*surf->pitch + srcX,
+            nBytes);
+    }
+
+    if (SDL_MUSTLOCK(surf)) SDL_UnlockSurface(surf);
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_ScrollPane_MarkRegion                                */
+/*                                                                            */
+/*  Description:   Mark an element (and those of its descendants) which       */
+/*                 overlap an area (in unscrolled content coordinates) as     */
+/*                 needing a redraw. Containers only render the children      */
+/*                 which need it, so the rest of the subtree is skipped when  */
+/*                 the area is rendered.                                      */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static void neuik_ScrollPane_MarkRegion(
+    NEUIK_Element      elem,
+    const SDL_Rect   * area)
+{
+    unsigned int        ctr;
+    SDL_Rect            eRect;
+    NEUIK_ElementBase * eBase = NULL;
+    NEUIK_Container   * cont  = NULL;
+
+    if (!NEUIK_Element_IsShown(elem)) return;
+    if (neuik_Object_GetClassObject_NoError(
+            elem, neuik__Class_Element, (void**)&eBase)) return;
+
+    eRect.x = eBase->eSt.rLoc.x;
+    eRect.y = eBase->eSt.rLoc.y;
+    eRect.w = eBase->eSt.rSize.w;
+    eRect.h = eBase->eSt.rSize.h;
+    if (!SDL_HasIntersection(&eRect, area)) return;
+
+    eBase->eSt.doRedraw = 1;
+
+    if (!neuik_Object_ImplementsClass(elem, neuik__Class_Container)) return;
+    if (neuik_Object_GetClassObject_NoError(
+            elem, neuik__Class_Container, (void**)&cont)) return;
+    if (cont->elems == NULL) return;
+
+    for (ctr = 0; cont->elems[ctr] != NULL; ctr++)
+    {
+        neuik_ScrollPane_MarkRegion(cont->elems[ctr], area);
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_ScrollPane_RenderRegion                              */
+/*                                                                            */
+/*  Description:   Completely redraw one rectangular region of the viewport   */
+/*                 surface (background and contained element) at the current  */
+/*                 scroll offsets. Everything outside of the region is left   */
+/*                 untouched through the renderer clip rectangle and only the */
+/*                 descendants which overlap the region are rendered.         */
+/*                                                                            */
+/*  Returns:       1 if there is an error; 0 otherwise.                       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ScrollPane_RenderRegion(
+    NEUIK_ScrollPane  * sp,
+    NEUIK_ElementBase * eBase,
+    NEUIK_Element       elem,
+    RenderSize        * elemSize,
+    SDL_Rect          * region)
+{
+    int           rvErr     = 0;
+    SDL_Rect      area      = {0, 0, 0, 0};
+    RenderLoc     rlModBg   = {0, 0};
+    RenderLoc     rlModElem = {0, 0};
+    SDL_Renderer * rend     = eBase->eSt.rend;
+
+    if (region->w <= 0 || region->h <= 0) return 0;
+
+    /*------------------------------------------------------------------------*/
+    /* The viewport surface starts at the pane location; the contained        */
+    /* element is additionally moved by the scroll offsets.                   */
+    /*------------------------------------------------------------------------*/
+    rlModBg.x   = -eBase->eSt.rLoc.x;
+    rlModBg.y   = -eBase->eSt.rLoc.y;
+    rlModElem.x = rlModBg.x - sp->scrollX;
+    rlModElem.y = rlModBg.y - sp->scrollY;
+
+    SDL_RenderSetClipRect(rend, region);
+    if (neuik_Element_RedrawBackground(sp, &rlModBg, NULL))
+    {
+        rvErr = 1;
+        goto out;
+    }
+
+    if (elem != NULL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The region has been cleared; the descendants which overlap it have */
+        /* to draw (clipped to it), the others are left alone.                */
+        /*--------------------------------------------------------------------*/
+        area.x = region->x - rlModElem.x;
+        area.y = region->y - rlModElem.y;
+        area.w = region->w;
+        area.h = region->h;
+        neuik_ScrollPane_MarkRegion(elem, &area);
+
+        if (neuik_Element_NeedsRedraw(elem))
+        {
+            if (neuik_Element_Render(elem, elemSize, &rlModElem, rend, 0))
+            {
+                rvErr = 1;
+            }
+        }
+    }
+out:
+    SDL_RenderSetClipRect(rend, NULL);
+    return rvErr;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Split a span of the viewport (`pos`, `len`) into the (at most two) spans   */
+/* of the wrapped texture which hold it.                                      */
+/*                                                                            */
+/* Returns: The number of spans.                                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_ScrollPane_WrapSpan(
+    int   pos,
+    int   len,
+    int   origin,
+    int   size,
+    int * vPos,  /* out: viewport position of each span */
+    int * tPos,  /* out: texture position of each span */
+    int * sLen)  /* out: length of each span */
+{
+    vPos[0] = pos;
+    tPos[0] = (pos + origin) % size;
+    sLen[0] = len;
+    if (tPos[0] + len <= size) return 1;
+
+    sLen[0] = size - tPos[0];
+    vPos[1] = pos + sLen[0];
+    tPos[1] = 0;
+    sLen[1] = len - sLen[0];
+    return 2;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_ScrollPane_UploadRegion                              */
+/*                                                                            */
+/*  Description:   Upload one region of the viewport surface into the place   */
+/*                 of the (wrapped) viewport texture which holds it.          */
+/*                                                                            */
+/*  Returns:       1 if there is an error; 0 otherwise.                       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_ScrollPane_UploadRegion(
+    neuik_ScrollPaneCache * cache,
+    SDL_Surface           * surf,
+    const SDL_Rect        * region)
+{
+    int        rvErr = 0;
+    int        nX;
+    int        nY;
+    int        xCtr;
+    int        yCtr;
+    int        vX[2], tX[2], lX[2];
+    int        vY[2], tY[2], lY[2];
+    SDL_Rect   view  = {0, 0, 0, 0};
+    SDL_Rect   clip  = {0, 0, 0, 0};
+    SDL_Rect   texRect;
+    Uint8    * pixels;
+
+    view.w = surf->w;
+    view.h = surf->h;
+    if (!SDL_IntersectRect(region, &view, &clip)) return 0;
+
+    nX = neuik_ScrollPane_WrapSpan(clip.x, clip.w, cache->texOX, surf->w, 
+        vX, tX, lX);
+    nY = neuik_ScrollPane_WrapSpan(clip.y, clip.h, cache->texOY, surf->h, 
+        vY, tY, lY);
+
+    if (SDL_MUSTLOCK(surf))
+    {
+        if (SDL_LockSurface(surf)) return 1;
+    }
+    for (yCtr = 0; yCtr < nY; yCtr++)
+    {
+        for (xCtr = 0; xCtr < nX; xCtr++)
+        {
+            texRect.x = tX[xCtr];
+            texRect.y = tY[yCtr];
+            texRect.w = lX[xCtr];
+            texRect.h = lY[yCtr];
+            pixels = (Uint8*)(surf->pixels) + vY[yCtr]*surf->pitch + 
+                vX[xCtr]*surf->format->BytesPerPixel;
+            if (SDL_UpdateTexture(cache->tex, &texRect, pixels, surf->pitch))
+            {
+                rvErr = 1;
+                goto out;
+            }
+        }
+    }
+out:
+    if (SDL_MUSTLOCK(surf)) SDL_UnlockSurface(surf);
+    return rvErr;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_Render__ScrollPane
+ *
+ *  Description:   Renders the visible portion of the contained element.
+ *
+ *                 The contained element is laid out at its full (minimum or
+ *                 filled) size, with its stored location in unscrolled
+ *                 content coordinates. The viewport is retained in the element
+ *                 surface between frames; when only the scroll offsets change
+ *                 the retained pixels are shifted and only the newly exposed
+ *                 strips are rendered.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Element_Render__ScrollPane(
+    NEUIK_Element   spElem,
+    RenderSize    * rSize, /* in/out the size the tex occupies when complete */
+    RenderLoc     * rlMod, /* A relative location modifier (for rendering) */
+    SDL_Renderer  * xRend, /* the external renderer to prepare the texture for */
+    int             mock)  /* If true; calculate sizes/locations but don't draw */
+{
+    int                     eNum       = 0; /* which error to report (if any) */
+    int                     dx         = 0;
+    int                     dy         = 0;
+    int                     vw         = 0; /* viewport width */
+    int                     vh         = 0; /* viewport height */
+    int                     destX      = 0;
+    int                     destY      = 0;
+    int                     fullUpload = 0;
+    int                     nUpload    = 0;
+    int                     ctr;
+    int                     nX;
+    int                     nY;
+    int                     xCtr;
+    int                     yCtr;
+    int                     vX[2], tX[2], lX[2];
+    int                     vY[2], tY[2], lY[2];
+    RenderLoc               rl         = {0, 0};
+    RenderLoc               rlRel      = {0, 0}; /* renderloc relative to parent */
+    RenderLoc               rlModNext  = {0, 0}; /* to pass to contained elem */
+    RenderSize              rs         = {0, 0};
+    SDL_Surface           * surf       = NULL;
+    SDL_Rect                region     = {0, 0, 0, 0};
+    SDL_Rect                destRect   = {0, 0, 0, 0};
+    SDL_Rect                srcRect    = {0, 0, 0, 0};
+    SDL_Rect                upload[3]; /* changed regions of the viewport */
+    NEUIK_Container       * cont       = NULL;
+    NEUIK_Element           elem       = NULL;
+    NEUIK_ElementBase     * eBase      = NULL;
+    NEUIK_ElementConfig   * eCfg       = NULL;
+    NEUIK_ScrollPane      * sp         = NULL;
+    neuik_ScrollPaneCache * cache      = NULL;
+    static char             funcName[] = "neuik_Element_Render__ScrollPane";
+    static char           * errMsgs[]  = {"", // [0] no error
+        "Argument `spElem` is not of ScrollPane class.",                   // [1]
+        "Argument `spElem` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Call to Element_GetMinSize failed.",                              // [3]
+        "Invalid specified `rSize` (negative values).",                    // [4]
+        "Failure in Element_Resize().",                                    // [5]
+        "Element_GetConfig returned NULL.",                                // [6]
+        "Failure in `neuik_Element_Render()`.",                            // [7]
+        "Failure in `SDL_CreateTexture()`.",                               // [8]
+        "Failure in `neuik_ScrollPane_RenderRegion()`.",                   // [9]
+        "Failure in `neuik_ScrollPane_ShiftSurface()`.",                   // [10]
+        "Failure in `SDL_UpdateTexture()`.",                               // [11]
+    };
+
+    if (!neuik_Object_IsClass(spElem, neuik__Class_ScrollPane))
+    {
+        eNum = 1;
+        goto out;
+    }
+    sp    = (NEUIK_ScrollPane *)spElem;
+    cache = (neuik_ScrollPaneCache*)(sp->cache);
+
+    if (neuik_Object_GetClassObject(spElem, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(spElem, neuik__Class_Container, (void**)&cont))
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    if (rSize->w < 0 || rSize->h < 0)
+    {
+        eNum = 4;
+        goto out;
+    }
+    vw = rSize->w;
+    vh = rSize->h;
+
+    /*------------------------------------------------------------------------*/
+    /* Lay out the contained element at its full size. Its stored location is */
+    /* in unscrolled content coordinates; the scroll offsets are only applied */
+    /* through the render location modifier (and to mouse events).           */
+    /*------------------------------------------------------------------------*/
+    if (cont->elems != NULL) elem = cont->elems[0];
+    if (elem != NULL && !NEUIK_Element_IsShown(elem)) elem = NULL;
+
+    cache->content.w = 0;
+    cache->content.h = 0;
+    if (elem != NULL)
+    {
+        eCfg = neuik_Element_GetConfig(elem);
+        if (eCfg == NULL)
+        {
+            eNum = 6;
+            goto out;
+        }
+        if (neuik_Element_GetMinSize(elem, &rs))
+        {
+            eNum = 3;
+            goto out;
+        }
+
+        if (eCfg->HFill && rs.w < vw - (eCfg->PadLeft + eCfg->PadRight))
+        {
+            rs.w = vw - (eCfg->PadLeft + eCfg->PadRight);
+        }
+        if (eCfg->VFill && rs.h < vh - (eCfg->PadTop + eCfg->PadBottom))
+        {
+            rs.h = vh - (eCfg->PadTop + eCfg->PadBottom);
+        }
+
+        cache->content.w = rs.w + eCfg->PadLeft + eCfg->PadRight;
+        cache->content.h = rs.h + eCfg->PadTop  + eCfg->PadBottom;
+
+        rlRel.x = eCfg->PadLeft;
+        rlRel.y = eCfg->PadTop;
+        rl.x    = eBase->eSt.rLoc.x + rlRel.x;
+        rl.y    = eBase->eSt.rLoc.y + rlRel.y;
+        neuik_Element_StoreSizeAndLocation(elem, rs, rl, rlRel);
+    }
+    neuik_ScrollPane_ClampOffsets(sp, eBase, &(sp->scrollX), &(sp->scrollY));
+
+    if (mock)
+    {
+        if (elem != NULL)
+        {
+            rlModNext.x = -eBase->eSt.rLoc.x - sp->scrollX;
+            rlModNext.y = -eBase->eSt.rLoc.y - sp->scrollY;
+            if (neuik_Element_Render(elem, &rs, &rlModNext, xRend, 1))
+            {
+                eNum = 7;
+                goto out;
+            }
+        }
+        goto out;
+    }
+    if (vw == 0 || vh == 0) goto out;
+
+    /*------------------------------------------------------------------------*/
+    /* (Re)create the viewport surface if the size of the pane has changed.   */
+    /*------------------------------------------------------------------------*/
+    surf = eBase->eSt.surf;
+    if (surf == NULL || surf->w != vw || surf->h != vh)
+    {
+        if (neuik_Element_Resize(sp, *rSize) != 0)
+        {
+            eNum = 5;
+            goto out;
+        }
+        surf = eBase->eSt.surf;
+        cache->valid = 0;
+    }
+    if (cont->redrawAll) cache->valid = 0;
+
+    if (cache->valid && elem != NULL && neuik_Element_NeedsRedraw(elem))
+    {
+        /*--------------------------------------------------------------------*/
+        /* Bring the retained content up to date at the offsets it was drawn  */
+        /* with; only the parts of the element which changed will redraw.     */
+        /* The redraws requested from within the pane are what is uploaded.   */
+        /*--------------------------------------------------------------------*/
+        rlModNext.x = -eBase->eSt.rLoc.x - cache->drawnX;
+        rlModNext.y = -eBase->eSt.rLoc.y - cache->drawnY;
+        if (neuik_Element_Render(elem, &rs, &rlModNext, eBase->eSt.rend, 0))
+        {
+            eNum = 7;
+            goto out;
+        }
+        if (cache->dirty.w > 0 && cache->dirty.h > 0)
+        {
+            nUpload = 1;
+            upload[0].x = cache->dirty.x - eBase->eSt.rLoc.x - sp->scrollX;
+            upload[0].y = cache->dirty.y - eBase->eSt.rLoc.y - sp->scrollY;
+            upload[0].w = cache->dirty.w;
+            upload[0].h = cache->dirty.h;
+        }
+        else
+        {
+            fullUpload = 1;
+        }
+    }
+
+    dx = sp->scrollX - cache->drawnX;
+    dy = sp->scrollY - cache->drawnY;
+    if (!cache->valid || abs(dx) >= vw || abs(dy) >= vh)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Nothing of the retained viewport can be reused.                    */
+        /*--------------------------------------------------------------------*/
+        region.x = 0;
+        region.y = 0;
+        region.w = vw;
+        region.h = vh;
+        if (neuik_ScrollPane_RenderRegion(sp, eBase, elem, &rs, &region))
+        {
+            eNum = 9;
+            goto out;
+        }
+        fullUpload = 1;
+    }
+    else if (dx != 0 || dy != 0)
+    {
+        if (neuik_ScrollPane_ShiftSurface(surf, dx, dy))
+        {
+            eNum = 10;
+            goto out;
+        }
+
+        /*--------------------------------------------------------------------*/
+        /* Render the horizontal strip exposed by vertical scrolling and then */
+        /* the vertical strip exposed by horizontal scrolling.                */
+        /*--------------------------------------------------------------------*/
+        if (dy != 0)
+        {
+            region.x = 0;
+            region.y = (dy > 0) ? vh - dy : 0;
+            region.w = vw;
+            region.h = abs(dy);
+            if (neuik_ScrollPane_RenderRegion(sp, eBase, elem, &rs, &region))
+            {
+                eNum = 9;
+                goto out;
+            }
+            upload[nUpload++] = region;
+        }
+        if (dx != 0)
+        {
+            region.x = (dx > 0) ? vw - dx : 0;
+            region.y = 0;
+            region.w = abs(dx);
+            region.h = vh;
+            if (neuik_ScrollPane_RenderRegion(sp, eBase, elem, &rs, &region))
+            {
+                eNum = 9;
+                goto out;
+            }
+            upload[nUpload++] = region;
+        }
+    }
+    cache->valid  = 1;
+    cache->drawnX = sp->scrollX;
+    cache->drawnY = sp->scrollY;
+    SDL_RenderPresent(eBase->eSt.rend);
+
+    /*------------------------------------------------------------------------*/
+    /* Upload the changed parts of the viewport into the retained texture.    */
+    /*------------------------------------------------------------------------*/
+    if (cache->tex != NULL && cache->texRend != xRend)
+    {
+        ConditionallyDestroyTexture(&(cache->tex));
+    }
+    if (cache->tex != NULL)
+    {
+        if (SDL_QueryTexture(cache->tex, NULL, NULL, &(destRect.w), 
+                &(destRect.h)) || destRect.w != vw || destRect.h != vh)
+        {
+            ConditionallyDestroyTexture(&(cache->tex));
+        }
+    }
+    if (cache->tex == NULL)
+    {
+        cache->tex = SDL_CreateTexture(xRend, surf->format->format,
+            SDL_TEXTUREACCESS_STREAMING, vw, vh);
+        if (cache->tex == NULL)
+        {
+            eNum = 8;
+            goto out;
+        }
+        SDL_SetTextureBlendMode(cache->tex, SDL_BLENDMODE_BLEND);
+        cache->texRend = xRend;
+        fullUpload     = 1;
+    }
+
+    if (fullUpload)
+    {
+        cache->texOX = 0;
+        cache->texOY = 0;
+        nUpload      = 1;
+        upload[0].x  = 0;
+        upload[0].y  = 0;
+        upload[0].w  = vw;
+        upload[0].h  = vh;
+    }
+    else
+    {
+        /*--------------------------------------------------------------------*/
+        /* The texels which are kept now hold viewport pixels (-dx, -dy) away */
+        /* from where they were.                                              */
+        /*--------------------------------------------------------------------*/
+        cache->texOX = ((cache->texOX + dx) % vw + vw) % vw;
+        cache->texOY = ((cache->texOY + dy) % vh + vh) % vh;
+    }
+    for (ctr = 0; ctr < nUpload; ctr++)
+    {
+        if (neuik_ScrollPane_UploadRegion(cache, surf, &(upload[ctr])))
+        {
+            eNum = 11;
+            goto out;
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Copy out the viewport; up to four pieces of the wrapped texture.       */
+    /*------------------------------------------------------------------------*/
+    destX = eBase->eSt.rLoc.x;
+    destY = eBase->eSt.rLoc.y;
+    if (rlMod != NULL)
+    {
+        destX += rlMod->x;
+        destY += rlMod->y;
+    }
+    nX = neuik_ScrollPane_WrapSpan(0, vw, cache->texOX, vw, vX, tX, lX);
+    nY = neuik_ScrollPane_WrapSpan(0, vh, cache->texOY, vh, vY, tY, lY);
+    for (yCtr = 0; yCtr < nY; yCtr++)
+    {
+        for (xCtr = 0; xCtr < nX; xCtr++)
+        {
+            srcRect.x  = tX[xCtr];
+            srcRect.y  = tY[yCtr];
+            srcRect.w  = lX[xCtr];
+            srcRect.h  = lY[yCtr];
+            destRect.x = destX + vX[xCtr];
+            destRect.y = destY + vY[yCtr];
+            destRect.w = lX[xCtr];
+            destRect.h = lY[yCtr];
+            SDL_RenderCopy(xRend, cache->tex, &srcRect, &destRect);
+        }
+    }
+out:
+    if (eBase != NULL && !mock)
+    {
+        eBase->eSt.doRedraw = 0;
+        if (cont != NULL) cont->redrawAll = 0;
+        if (cache != NULL)
+        {
+            cache->dirty.w = 0;
+            cache->dirty.h = 0;
+        }
+    }
+
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_RequestRedraw__ScrollPane
+ *
+ *  Description:   A virtual function reimplementation of the function
+ *                 neuik_Element_RequestRedraw.
+ *
+ *                 Redraw requests from within the pane carry unscrolled
+ *                 content locations; these are collected (as the part of the
+ *                 viewport to upload) and replaced by the area of the pane
+ *                 itself before the request is passed on.
+ *
+ *  Returns:       Non-zero if error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Element_RequestRedraw__ScrollPane(
+    NEUIK_Element spElem,
+    RenderLoc     rLoc,
+    RenderSize    rSize)
+{
+    int                     eNum       = 0; /* which error to report (if any) */
+    SDL_Rect                reqRect    = {0, 0, 0, 0};
+    NEUIK_ElementBase     * eBase      = NULL;
+    NEUIK_Window          * win        = NULL;
+    neuik_ScrollPaneCache * cache      = NULL;
+    static char             funcName[] = 
+        "neuik_Element_RequestRedraw__ScrollPane";
+    static char           * errMsgs[]  = {"", // [0] no error
+        "Argument `spElem` caused `neuik_Object_GetClassObject` to fail.", // [1]
+        "Failure in `neuik_MaskMap_UnmaskUnboundedRect()`",                // [2]
+    };
+
+    if (neuik_Object_GetClassObject(spElem, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Requests for the area of the pane itself (e.g., a change of the scroll */
+    /* offsets) don't mark any of the content.                                */
+    /*------------------------------------------------------------------------*/
+    cache = (neuik_ScrollPaneCache*)(((NEUIK_ScrollPane*)spElem)->cache);
+    if (cache != NULL && rSize.w > 0 && rSize.h > 0 &&
+        (rLoc.x  != eBase->eSt.rLoc.x  || rLoc.y  != eBase->eSt.rLoc.y ||
+         rSize.w != eBase->eSt.rSize.w || rSize.h != eBase->eSt.rSize.h))
+    {
+        reqRect.x = rLoc.x;
+        reqRect.y = rLoc.y;
+        reqRect.w = rSize.w;
+        reqRect.h = rSize.h;
+        SDL_UnionRect(&(cache->dirty), &reqRect, &(cache->dirty));
+    }
+
+    eBase->eSt.doRedraw = 1;
+    rLoc  = eBase->eSt.rLoc;
+    rSize = eBase->eSt.rSize;
+
+    if (eBase->eSt.parent != NULL)
+    {
+        neuik_Element_RequestRedraw(eBase->eSt.parent, rLoc, rSize);
+    }
+    else
+    {
+        /* notify the parent window that it will probably need to be redrawn */
+        win = (NEUIK_Window*)(eBase->eSt.window);
+        if (win != NULL)
+        {
+            if (win->redrawMask != NULL)
+            {
+                if (neuik_MaskMap_UnmaskUnboundedRect(win->redrawMask,
+                    rLoc.x, rLoc.y, rSize.w, rSize.h))
+                {
+                    eNum = 2;
+                    goto out;
+                }
+            }
+            win->doRedraw = 1;
+        }
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_CaptureEvent__ScrollPane
+ *
+ *  Description:   A virtual function reimplementation of the function
+ *                 neuik_Element_CaptureEvent.
+ *
+ *                 Mouse positions are moved into the (unscrolled) content
+ *                 coordinates of the contained element. Mouse wheel events
+ *                 which the contained element does not capture scroll the
+ *                 pane.
+ *
+ *  Returns:       1 if the event was captured; 0 otherwise.
+ *
+ ******************************************************************************/
+neuik_EventState neuik_Element_CaptureEvent__ScrollPane(
+    NEUIK_Element   spElem,
+    SDL_Event     * ev)
+{
+    int                     inView     = 0;
+    int                     step       = 0;
+    int                     mx         = 0;
+    int                     my         = 0;
+    neuik_EventState        evCaputred = NEUIK_EVENTSTATE_NOT_CAPTURED;
+    RenderLoc               eLoc;
+    RenderSize              eSz;
+    NEUIK_Element           elem       = NULL;
+    NEUIK_ElementBase     * eBase      = NULL;
+    NEUIK_Container       * cont       = NULL;
+    NEUIK_ScrollPane      * sp         = NULL;
+    neuik_ScrollPaneCache * cache      = NULL;
+    SDL_Event             * evActive   = ev;
+    SDL_Event               evTr; /* Translated mouse event */
+
+    if (!neuik_Object_IsClass(spElem, neuik__Class_ScrollPane)) goto out;
+    sp    = (NEUIK_ScrollPane*)spElem;
+    cache = (neuik_ScrollPaneCache*)(sp->cache);
+
+    if (neuik_Object_GetClassObject_NoError(
+        spElem, neuik__Class_Element, (void**)&eBase)) goto out;
+    if (neuik_Object_GetClassObject_NoError(
+        spElem, neuik__Class_Container, (void**)&cont)) goto out;
+
+    if (cont->elems != NULL) elem = cont->elems[0];
+    if (elem != NULL && !NEUIK_Element_IsShown(elem)) elem = NULL;
+
+    eLoc = eBase->eSt.rLoc;
+    eSz  = eBase->eSt.rSize;
+
+    switch (ev->type)
+    {
+    case SDL_MOUSEBUTTONDOWN:
+    case SDL_MOUSEBUTTONUP:
+        mx = ev->button.x;
+        my = ev->button.y;
+        break;
+    case SDL_MOUSEMOTION:
+        mx = ev->motion.x;
+        my = ev->motion.y;
+        cache->lastMouseX = mx;
+        cache->lastMouseY = my;
+        break;
+    case SDL_MOUSEWHEEL:
+        mx = cache->lastMouseX;
+        my = cache->lastMouseY;
+        break;
+    }
+    inView = (mx >= eLoc.x && mx < eLoc.x + eSz.w &&
+              my >= eLoc.y && my < eLoc.y + eSz.h);
+
+    switch (ev->type)
+    {
+    case SDL_MOUSEBUTTONDOWN:
+    case SDL_MOUSEMOTION:
+        /*--------------------------------------------------------------------*/
+        /* Content which is scrolled out of view must not react to the mouse. */
+        /*--------------------------------------------------------------------*/
+        if (!inView) goto out;
+        /* fall through */
+    case SDL_MOUSEBUTTONUP:
+        evTr     = *ev;
+        evActive = &evTr;
+        if (ev->type == SDL_MOUSEMOTION)
+        {
+            evTr.motion.x += sp->scrollX;
+            evTr.motion.y += sp->scrollY;
+        }
+        else
+        {
+            evTr.button.x += sp->scrollX;
+            evTr.button.y += sp->scrollY;
+        }
+        break;
+    }
+
+    if (elem != NULL)
+    {
+        evCaputred = neuik_Element_CaptureEvent(elem, evActive);
+        if (evCaputred == NEUIK_EVENTSTATE_OBJECT_FREED) goto out;
+    }
+
+    if (evCaputred != NEUIK_EVENTSTATE_CAPTURED && 
+        ev->type == SDL_MOUSEWHEEL && inView)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Positive wheel values scroll up (y) and to the right (x).          */
+        /*--------------------------------------------------------------------*/
+        step = (int)(NEUIK_SCROLLPANE_WHEELSTEP*neuik__HighDPI_Scaling);
+
+        if (NEUIK_ScrollPane_ScrollBy(sp, 
+                ev->wheel.x*step, -ev->wheel.y*step) == 0)
+        {
+            evCaputred = NEUIK_EVENTSTATE_CAPTURED;
+        }
+    }
+
+    if (evCaputred == NEUIK_EVENTSTATE_CAPTURED)
+    {
+        neuik_Element_SetActive(spElem, 1);
+    }
+out:
+    return evCaputred;
+}
@@ -16,6 +16,7 @@
 #include <SDL.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
  
 #include "NEUIK_error.h"
 #include "NEUIK_render.h"
@@ -31,6 +32,32 @@
 
 extern int neuik__isInitialized;
 
+/*----------------------------------------------------------------------------*/
+/* A retained page of a Stack. The surface is the size of the stack and holds */
+/* the stack background with the page drawn over it at `rect`. A page which  */
+/* is `valid` only needs the parts which changed since it was last drawn.     */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    NEUIK_Element   elem;     /* the stack element held by this page */
+    SDL_Surface   * surf;     /* retained pixels of the page */
+    SDL_Renderer  * rend;     /* software renderer drawing into `surf` */
+    SDL_Rect        rect;     /* (absolute) location/size of the drawn page */
+    int             valid;    /* surface holds a complete rendering of elem */
+    unsigned int    lastUsed; /* stamp used for least-recently-used eviction */
+} neuik_StackPage;
+
+typedef struct {
+    size_t            budget;  /* max bytes held by page surfaces (0 = off) */
+    size_t            nBytes;  /* bytes currently held by page surfaces */
+    int               nPages;
+    int               nAlloc;
+    neuik_StackPage * pages;
+    unsigned int      clock;   /* last issued `lastUsed` stamp */
+    SDL_Texture     * tex;     /* streaming copy of the shown page surface */
+    SDL_Renderer    * texRend; /* the renderer `tex` was created for */
+    int               shown;   /* the active element was last shown from a page */
+} neuik_StackPageCache;
+
 /*----------------------------------------------------------------------------*/
 /* Internal Function Prototypes                                               */
 /*----------------------------------------------------------------------------*/
@@ -147,12 +174,13 @@ out:
 int neuik_Object_New__Stack(
     void ** objPtr)
 {
-    int               eNum       = 0;
-    NEUIK_Container * cont       = NULL;
-    NEUIK_Stack     * stk        = NULL;
-    NEUIK_Element   * sClassPtr  = NULL;
-    static char       funcName[] = "neuik_Object_New__Stack";
-    static char     * errMsgs[]  = {"", // [0] no error
+    int                    eNum       = 0;
+    NEUIK_Container      * cont       = NULL;
+    NEUIK_Stack          * stk        = NULL;
+    NEUIK_Element        * sClassPtr  = NULL;
+    neuik_StackPageCache * cache      = NULL;
+    static char            funcName[] = "neuik_Object_New__Stack";
+    static char          * errMsgs[]  = {"", // [0] no error
         "Output Argument `fPtr` is NULL.",                               // [1]
         "Failure to allocate memory.",                                   // [2]
         "Failure in `neuik_GetObjectBaseOfClass`.",                      // [3]
@@ -175,6 +203,24 @@ int neuik_Object_New__Stack(
         goto out;
     }
     stk->elemActive = NULL;
+    stk->pages      = NULL;
+
+    cache = (neuik_StackPageCache*) malloc(sizeof(neuik_StackPageCache));
+    if (cache == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    cache->budget  = 0;
+    cache->nBytes  = 0;
+    cache->nPages  = 0;
+    cache->nAlloc  = 0;
+    cache->pages   = NULL;
+    cache->clock   = 0;
+    cache->tex     = NULL;
+    cache->texRend = NULL;
+    cache->shown   = 0;
+    stk->pages = cache;
 
     /*------------------------------------------------------------------------*/
     /* Successful allocation of Memory -- Create Base Class Object            */
@@ -241,6 +287,37 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_Stack_ReleasePage                                    */
+/*                                                                            */
+/*  Description:   Free the surface of a retained page and remove the page    */
+/*                 from the cache (the last page takes its slot).             */
+/*                                                                            */
+/*  Returns:       Nothing.                                                   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static void neuik_Stack_ReleasePage(
+    neuik_StackPageCache * cache,
+    int                    ind)
+{
+    neuik_StackPage * page = &(cache->pages[ind]);
+
+    if (page->surf != NULL)
+    {
+        cache->nBytes -= (size_t)(page->surf->pitch)*(size_t)(page->surf->h);
+    }
+    if (page->rend != NULL) SDL_DestroyRenderer(page->rend);
+    if (page->surf != NULL) SDL_FreeSurface(page->surf);
+
+    cache->nPages--;
+    if (ind != cache->nPages)
+    {
+        cache->pages[ind] = cache->pages[cache->nPages];
+    }
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_Object_Free__Stack
@@ -253,10 +330,11 @@ out:
 int neuik_Object_Free__Stack(
     void * stkPtr)
 {
-    int           eNum       = 0;    /* which error to report (if any) */
-    NEUIK_Stack * stk        = NULL;
-    static char   funcName[] = "neuik_Object_Free__Stack";
-    static char * errMsgs[]  = {"",                 // [0] no error
+    int                    eNum       = 0;    /* which error to report (if any) */
+    NEUIK_Stack          * stk        = NULL;
+    neuik_StackPageCache * cache      = NULL;
+    static char            funcName[] = "neuik_Object_Free__Stack";
+    static char          * errMsgs[]  = {"",                 // [0] no error
         "Argument `fPtr` is NULL.",                 // [1]
         "Argument `fPtr` is not of Frame class.",   // [2]
         "Failure in function `neuik_Object_Free`.", // [3]
@@ -284,6 +362,18 @@ int neuik_Object_Free__Stack(
         goto out;
     }
 
+    cache = (neuik_StackPageCache*)(stk->pages);
+    if (cache != NULL)
+    {
+        while (cache->nPages > 0)
+        {
+            neuik_Stack_ReleasePage(cache, cache->nPages - 1);
+        }
+        if (cache->pages != NULL) free(cache->pages);
+        ConditionallyDestroyTexture(&(cache->tex));
+        free(cache);
+    }
+
     free(stk);
 out:
     if (eNum > 0)
@@ -415,12 +505,477 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_Stack_PlaceElement                                   */
+/*                                                                            */
+/*  Description:   Apply the fill and justification of a stack element to its */
+/*                 minimum size (`rs`) and calculate the rect it occupies     */
+/*                 within a stack of size `rSize` located at `rl`.            */
+/*                                                                            */
+/*  Returns:       Nothing.                                                   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static void neuik_Stack_PlaceElement(
+    NEUIK_Container     * cont,
+    NEUIK_ElementConfig * eCfg,
+    RenderSize          * rSize,
+    RenderLoc             rl,
+    RenderSize          * rs,
+    SDL_Rect            * rect)
+{
+    /*------------------------------------------------------------------------*/
+    /* Check for and apply if necessary Horizontal and Vertical fill          */
+    /*------------------------------------------------------------------------*/
+    if (eCfg->HFill)
+    {
+        /* This element is configured to fill space horizontally */
+        rs->w = rSize->w - (eCfg->PadLeft + eCfg->PadRight);
+    }
+    if (eCfg->VFill)
+    {
+        /* This element is configured to fill space vertically */
+        rs->h = rSize->h - (eCfg->PadTop + eCfg->PadBottom);
+    }
+
+    rect->x = rl.x;
+    rect->y = rl.y;
+    rect->w = rs->w;
+    rect->h = rs->h;
+
+    switch (eCfg->HJustify)
+    {
+        case NEUIK_HJUSTIFY_DEFAULT:
+            switch (cont->HJustify)
+            {
+                case NEUIK_HJUSTIFY_LEFT:
+                    rect->x += eCfg->PadLeft;
+                    break;
+                case NEUIK_HJUSTIFY_CENTER:
+                case NEUIK_HJUSTIFY_DEFAULT:
+                    rect->x += rSize->w/2 - (rs->w/2);
+                    break;
+                case NEUIK_HJUSTIFY_RIGHT:
+                    rect->x += rSize->w - (rs->w + eCfg->PadRight);
+                    break;
+            }
+            break;
+        case NEUIK_HJUSTIFY_LEFT:
+            rect->x += eCfg->PadLeft;
+            break;
+        case NEUIK_HJUSTIFY_CENTER:
+            rect->x += rSize->w/2 - (rs->w/2);
+            break;
+        case NEUIK_HJUSTIFY_RIGHT:
+            rect->x += rSize->w - (rs->w + eCfg->PadRight);
+            break;
+    }
+
+    switch (eCfg->VJustify)
+    {
+        case NEUIK_VJUSTIFY_DEFAULT:
+            switch (cont->VJustify)
+            {
+                case NEUIK_VJUSTIFY_TOP:
+                    rect->y += eCfg->PadTop;
+                    break;
+                case NEUIK_VJUSTIFY_CENTER:
+                case NEUIK_VJUSTIFY_DEFAULT:
+                    if (eCfg->VFill)
+                    {
+                        rect->y += eCfg->PadTop;
+                    }
+                    else
+                    {
+                        rect->y += (rSize->h
+                            - (eCfg->PadTop + eCfg->PadBottom))/2 - (rs->h/2);
+                    }
+                    break;
+                case NEUIK_VJUSTIFY_BOTTOM:
+                    rect->y += rSize->h - (rs->h + eCfg->PadBottom);
+                    break;
+            }
+            break;
+        case NEUIK_VJUSTIFY_TOP:
+            rect->y += eCfg->PadTop;
+            break;
+        case NEUIK_VJUSTIFY_CENTER:
+            if (eCfg->VFill)
+            {
+                rect->y += eCfg->PadTop;
+            }
+            else
+            {
+                rect->y += (rSize->h - (eCfg->PadTop + eCfg->PadBottom))/2 
+                    - (rs->h/2);
+            }
+            break;
+        case NEUIK_VJUSTIFY_BOTTOM:
+            rect->y += rSize->h - (rs->h + eCfg->PadBottom);
+            break;
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_Stack_FindPage                                       */
+/*                                                                            */
+/*  Description:   Look up the retained page of a stack element.              */
+/*                                                                            */
+/*  Returns:       The index of the page; -1 if the element has none.         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_Stack_FindPage(
+    neuik_StackPageCache * cache,
+    NEUIK_Element          elem)
+{
+    int ctr = 0;
+
+    for (ctr = 0; ctr < cache->nPages; ctr++)
+    {
+        if (cache->pages[ctr].elem == elem) return ctr;
+    }
+    return -1;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_Stack_IsPageCurrent                                  */
+/*                                                                            */
+/*  Description:   Check if an element has a complete retained page for a     */
+/*                 stack of the specified size.                               */
+/*                                                                            */
+/*  Returns:       1 if the page can be shown as is; 0 otherwise.             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_Stack_IsPageCurrent(
+    neuik_StackPageCache * cache,
+    NEUIK_Element          elem,
+    RenderSize           * rSize)
+{
+    int               ind  = 0;
+    neuik_StackPage * page = NULL;
+
+    ind = neuik_Stack_FindPage(cache, elem);
+    if (ind < 0) return 0;
+
+    page = &(cache->pages[ind]);
+    return (page->valid &&
+        page->surf->w == rSize->w && page->surf->h == rSize->h);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_Stack_PrunePages                                     */
+/*                                                                            */
+/*  Description:   Release the retained pages of elements which are no       */
+/*                 longer contained by the stack.                             */
+/*                                                                            */
+/*  Returns:       Nothing.                                                   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static void neuik_Stack_PrunePages(
+    neuik_StackPageCache * cache,
+    NEUIK_Container      * cont)
+{
+    int ctr     = 0;
+    int elemCtr = 0;
+    int found   = 0;
+
+    for (ctr = cache->nPages - 1; ctr >= 0; ctr--)
+    {
+        found = 0;
+        if (cont->elems != NULL)
+        {
+            for (elemCtr = 0; cont->elems[elemCtr] != NULL; elemCtr++)
+            {
+                if (cont->elems[elemCtr] == cache->pages[ctr].elem)
+                {
+                    found = 1;
+                    break;
+                }
+            }
+        }
+        if (!found) neuik_Stack_ReleasePage(cache, ctr);
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_Stack_TrimPages                                      */
+/*                                                                            */
+/*  Description:   Release least recently used pages (other than the page of  */
+/*                 `keep`) until `nBytes` more bytes fit within the budget.   */
+/*                                                                            */
+/*  Returns:       1 if the bytes still don't fit; 0 otherwise.              */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_Stack_TrimPages(
+    neuik_StackPageCache * cache,
+    size_t                 nBytes,
+    NEUIK_Element          keep)
+{
+    int ctr    = 0;
+    int oldest = 0;
+
+    while (cache->nBytes + nBytes > cache->budget)
+    {
+        oldest = -1;
+        for (ctr = 0; ctr < cache->nPages; ctr++)
+        {
+            if (cache->pages[ctr].elem == keep) continue;
+            if (oldest < 0 ||
+                cache->pages[ctr].lastUsed < cache->pages[oldest].lastUsed)
+            {
+                oldest = ctr;
+            }
+        }
+        if (oldest < 0) return 1;
+        neuik_Stack_ReleasePage(cache, oldest);
+    }
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_Stack_AcquirePage                                    */
+/*                                                                            */
+/*  Description:   Get the retained page of an element, (re)creating its      */
+/*                 surface if the element has no page of the specified size.  */
+/*                 If `evict` is set, least recently used pages (other than   */
+/*                 the page of `keep`) are released to make room for a new    */
+/*                 page. `*pagePtr` is set to NULL if the page doesn't fit.   */
+/*                                                                            */
+/*  Returns:       1 if there is an error; 0 otherwise.                       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_Stack_AcquirePage(
+    neuik_StackPageCache * cache,
+    NEUIK_Element          elem,
+    RenderSize           * rSize,
+    int                    evict,
+    NEUIK_Element          keep,
+    neuik_StackPage     ** pagePtr)
+{
+    int               ind    = 0;
+    int               nAlloc = 0;
+    size_t            nBytes = 0;
+    Uint32            rmask;
+    Uint32            gmask;
+    Uint32            bmask;
+    Uint32            amask;
+    neuik_StackPage * page   = NULL;
+    neuik_StackPage * pages  = NULL;
+
+    #if SDL_BYTEORDER == SDL_BIG_ENDIAN
+        rmask = 0xFF000000;
+        gmask = 0x00FF0000;
+        bmask = 0x0000FF00;
+        amask = 0x000000FF;
+    #else
+        rmask = 0x000000FF;
+        gmask = 0x0000FF00;
+        bmask = 0x00FF0000;
+        amask = 0xFF000000;
+    #endif
+
+    *pagePtr = NULL;
+    if (rSize->w <= 0 || rSize->h <= 0) return 0;
+
+    ind = neuik_Stack_FindPage(cache, elem);
+    if (ind >= 0)
+    {
+        page = &(cache->pages[ind]);
+        if (page->surf->w == rSize->w && page->surf->h == rSize->h)
+        {
+            *pagePtr = page;
+            return 0;
+        }
+        neuik_Stack_ReleasePage(cache, ind);
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* A new page surface (32 bits per pixel) is needed.                      */
+    /*------------------------------------------------------------------------*/
+    nBytes = 4*(size_t)(rSize->w)*(size_t)(rSize->h);
+    if (nBytes > cache->budget) return 0;
+    if (evict)
+    {
+        if (neuik_Stack_TrimPages(cache, nBytes, keep)) return 0;
+    }
+    else if (cache->nBytes + nBytes > cache->budget)
+    {
+        return 0;
+    }
+
+    if (cache->nPages == cache->nAlloc)
+    {
+        nAlloc = (cache->nAlloc > 0) ? 2*cache->nAlloc : 4;
+        pages  = (neuik_StackPage*)realloc(cache->pages, 
+            nAlloc*sizeof(neuik_StackPage));
+        if (pages == NULL) return 1;
+        cache->pages  = pages;
+        cache->nAlloc = nAlloc;
+    }
+
+    page = &(cache->pages[cache->nPages]);
+    page->elem     = elem;
+    page->valid    = 0;
+    page->lastUsed = 0;
+    page->rend     = NULL;
+    page->surf     = SDL_CreateRGBSurface(0,
+        rSize->w, rSize->h, 32, rmask, gmask, bmask, amask);
+    if (page->surf == NULL) return 1;
+
+    page->rend = SDL_CreateSoftwareRenderer(page->surf);
+    if (page->rend == NULL)
+    {
+        SDL_FreeSurface(page->surf);
+        return 1;
+    }
+    memset(&(page->rect), 0, sizeof(SDL_Rect));
+
+    cache->nPages++;
+    cache->nBytes += (size_t)(page->surf->pitch)*(size_t)(page->surf->h);
+    *pagePtr = page;
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_Stack_DrawPage                                       */
+/*                                                                            */
+/*  Description:   Bring the retained page of a (placed) stack element up to  */
+/*                 date. An incomplete page is cleared and drawn in full;     */
+/*                 otherwise only the parts of the element which requested a  */
+/*                 redraw are drawn again.                                    */
+/*                                                                            */
+/*  Returns:       1 if there is an error; 0 otherwise.                       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_Stack_DrawPage(
+    NEUIK_ElementBase * eBase,
+    NEUIK_Container   * cont,
+    neuik_StackPage   * page,
+    NEUIK_Element       elem,
+    RenderSize        * rs,
+    SDL_Rect          * rect)
+{
+    int       rvErr     = 0;
+    int       redrawAll = 0;
+    RenderLoc rlModPage = {0, 0};
+
+    if (page->rect.x != rect->x || page->rect.y != rect->y ||
+        page->rect.w != rect->w || page->rect.h != rect->h)
+    {
+        page->valid = 0;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* The page surface starts at the stack location.                         */
+    /*------------------------------------------------------------------------*/
+    rlModPage.x = -eBase->eSt.rLoc.x;
+    rlModPage.y = -eBase->eSt.rLoc.y;
+
+    if (!page->valid)
+    {
+        SDL_SetRenderDrawColor(page->rend, 0, 0, 0, 0);
+        SDL_RenderClear(page->rend);
+
+        redrawAll       = cont->redrawAll;
+        cont->redrawAll = 1;
+        rvErr = neuik_Element_Render(elem, rs, &rlModPage, page->rend, 0);
+        cont->redrawAll = redrawAll;
+    }
+    else if (neuik_Element_NeedsRedraw(elem))
+    {
+        rvErr = neuik_Element_Render(elem, rs, &rlModPage, page->rend, 0);
+    }
+    if (rvErr) return 1;
+
+    SDL_RenderPresent(page->rend);
+    page->rect  = *rect;
+    page->valid = 1;
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_Stack_ShowPage                                       */
+/*                                                                            */
+/*  Description:   Upload a retained page into the streaming texture of the   */
+/*                 stack and copy it out to the external renderer.            */
+/*                                                                            */
+/*  Returns:       1 if there is an error; 0 otherwise.                       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_Stack_ShowPage(
+    neuik_StackPageCache * cache,
+    neuik_StackPage      * page,
+    SDL_Renderer         * xRend,
+    RenderLoc            * rLoc,
+    RenderLoc            * rlMod)
+{
+    SDL_Rect      destRect = {0, 0, 0, 0};
+    SDL_Surface * surf     = page->surf;
+
+    if (cache->tex != NULL && cache->texRend != xRend)
+    {
+        ConditionallyDestroyTexture(&(cache->tex));
+    }
+    if (cache->tex != NULL)
+    {
+        if (SDL_QueryTexture(cache->tex, NULL, NULL, &(destRect.w), 
+                &(destRect.h)) || destRect.w != surf->w || destRect.h != surf->h)
+        {
+            ConditionallyDestroyTexture(&(cache->tex));
+        }
+    }
+    if (cache->tex == NULL)
+    {
+        cache->tex = SDL_CreateTexture(xRend, surf->format->format,
+            SDL_TEXTUREACCESS_STREAMING, surf->w, surf->h);
+        if (cache->tex == NULL) return 1;
+
+        SDL_SetTextureBlendMode(cache->tex, SDL_BLENDMODE_BLEND);
+        cache->texRend = xRend;
+    }
+    if (SDL_UpdateTexture(cache->tex, NULL, surf->pixels, surf->pitch))
+    {
+        return 1;
+    }
+
+    destRect.x = rLoc->x;
+    destRect.y = rLoc->y;
+    destRect.w = surf->w;
+    destRect.h = surf->h;
+    if (rlMod != NULL)
+    {
+        destRect.x += rlMod->x;
+        destRect.y += rlMod->y;
+    }
+    SDL_RenderCopy(xRend, cache->tex, NULL, &destRect);
+    return 0;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_Element_Render__Stack
  *
  *  Description:   Renders a NEUIK_Stack as an SDL_Texture*.
  *
+ *                 If a page cache budget is set, the active element is drawn
+ *                 into its retained page (only where it has changed) and the
+ *                 page is copied out to the external renderer.
+ *
  *  Returns:       NULL if there is a problem, otherwise a valid SDL_Texture*.
  *
  ******************************************************************************/
@@ -433,21 +988,23 @@ int neuik_Element_Render__Stack(
 {
     int                   ctr        = 0;
     int                   eNum       = 0; /* which error to report (if any) */
-    int                   elemIncl;
-    RenderLoc             rl;
-    RenderLoc             rlRel      = {0, 0}; /* renderloc relative to parent */
-    SDL_Rect              rect;
-    RenderSize            rs;
-    SDL_Renderer        * rend       = NULL;
-    NEUIK_Stack         * stk        = NULL;
-    NEUIK_Container     * cont       = NULL;
-    NEUIK_Element         elem       = NULL;
-    NEUIK_ElementBase   * eBase      = NULL;
-    NEUIK_ElementConfig * eCfg       = NULL;
-    neuik_MaskMap       * maskMap    = NULL; /* FREE upon return */
-    enum neuik_bgstyle    bgStyle;
-    static char           funcName[] = "neuik_Element_Render__Stack";
-    static char         * errMsgs[]  = {"", // [0] no error
+    int                    elemIncl;
+    RenderLoc              rl;
+    RenderLoc              rlRel      = {0, 0}; /* renderloc relative to parent */
+    SDL_Rect               rect;
+    RenderSize             rs;
+    SDL_Renderer         * rend       = NULL;
+    NEUIK_Stack          * stk        = NULL;
+    NEUIK_Container      * cont       = NULL;
+    NEUIK_Element          elem       = NULL;
+    NEUIK_ElementBase    * eBase      = NULL;
+    NEUIK_ElementConfig  * eCfg       = NULL;
+    neuik_MaskMap        * maskMap    = NULL; /* FREE upon return */
+    neuik_StackPage      * page       = NULL;
+    neuik_StackPageCache * cache      = NULL;
+    enum neuik_bgstyle     bgStyle;
+    static char            funcName[] = "neuik_Element_Render__Stack";
+    static char          * errMsgs[]  = {"", // [0] no error
         "Argument `stkElem` is not of Stack class.",                        // [1]
         "Argument `stkElem` caused `neuik_Object_GetClassObject` to fail.", // [2]
         "Call to Element_GetMinSize failed.",                               // [3]
@@ -459,6 +1016,9 @@ int neuik_Element_Render__Stack(
         "Failure in `neuik_Element_GetCurrentBGStyle()`.",                  // [9]
         "Failure in `neuik_MakeMaskMap()`",                                 // [10]
         "Failure in `neuik_Window_FillTranspMaskFromLoc()`",                // [11]
+        "Failure in `neuik_Stack_AcquirePage()`.",                          // [12]
+        "Failure in `neuik_Stack_DrawPage()`.",                             // [13]
+        "Failure in `neuik_Stack_ShowPage()`.",                             // [14]
     };
 
     if (!neuik_Object_IsClass(stkElem, neuik__Class_Stack))
@@ -466,7 +1026,8 @@ int neuik_Element_Render__Stack(
         eNum = 1;
         goto out;
     }
-    stk = (NEUIK_Stack *)stkElem;
+    stk   = (NEUIK_Stack *)stkElem;
+    cache = (neuik_StackPageCache*)(stk->pages);
 
     if (neuik_Object_GetClassObject(stkElem, neuik__Class_Element, (void**)&eBase))
     {
@@ -579,109 +1140,62 @@ int neuik_Element_Render__Stack(
         goto out;
     }
 
-    /*------------------------------------------------------------------------*/
-    /* Check for and apply if necessary Horizontal and Vertical fill          */
-    /*------------------------------------------------------------------------*/
-    if (eCfg->HFill)
-    {
-        /* This element is configured to fill space horizontally */
-        rs.w = rSize->w - (eCfg->PadLeft + eCfg->PadRight);
-    }
-    if (eCfg->VFill)
-    {
-        /* This element is configured to fill space vertically */
-        rs.h = rSize->h - (eCfg->PadTop + eCfg->PadBottom);
-    }
-
-
     /*------------------------------------------------------------------------*/
     /* Update the stored location before rendering the element. This is       */
     /* necessary as the location of this object will propagate to its         */
     /* child objects.                                                         */
     /*------------------------------------------------------------------------*/
-    rect.x = rl.x;
-    rect.y = rl.y;
-    rect.w = rs.w;
-    rect.h = rs.h;
-
-    switch (eCfg->HJustify)
-    {
-        case NEUIK_HJUSTIFY_DEFAULT:
-            switch (cont->HJustify)
-            {
-                case NEUIK_HJUSTIFY_LEFT:
-                    rect.x += eCfg->PadLeft;
-                    break;
-                case NEUIK_HJUSTIFY_CENTER:
-                case NEUIK_HJUSTIFY_DEFAULT:
-                    rect.x += rSize->w/2 - (rs.w/2);
-                    break;
-                case NEUIK_HJUSTIFY_RIGHT:
-                    rect.x += rSize->w - (rs.w + eCfg->PadRight);
-                    break;
-            }
-            break;
-        case NEUIK_HJUSTIFY_LEFT:
-            rect.x += eCfg->PadLeft;
-            break;
-        case NEUIK_HJUSTIFY_CENTER:
-            rect.x += rSize->w/2 - (rs.w/2);
-            break;
-        case NEUIK_HJUSTIFY_RIGHT:
-            rect.x += rSize->w - (rs.w + eCfg->PadRight);
-            break;
-    }
-
-    switch (eCfg->VJustify)
-    {
-        case NEUIK_VJUSTIFY_DEFAULT:
-            switch (cont->VJustify)
-            {
-                case NEUIK_VJUSTIFY_TOP:
-                    rect.y += eCfg->PadTop;
-                    break;
-                case NEUIK_VJUSTIFY_CENTER:
-                case NEUIK_VJUSTIFY_DEFAULT:
-                    if (eCfg->VFill)
-                    {
-                        rect.y += eCfg->PadTop;
-                    }
-                    else
-                    {
-                        rect.y += (rSize->h
-                            - (eCfg->PadTop + eCfg->PadBottom))/2 - (rs.h/2);
-                    }
-                    break;
-                case NEUIK_VJUSTIFY_BOTTOM:
-                    rect.y += rSize->h - (rs.h + eCfg->PadBottom);
-                    break;
-            }
-            break;
-        case NEUIK_VJUSTIFY_TOP:
-            rect.y += eCfg->PadTop;
-            break;
-        case NEUIK_VJUSTIFY_CENTER:
-            if (eCfg->VFill)
-            {
-                rect.y += eCfg->PadTop;
-            }
-            else
-            {
-                rect.y += (rSize->h - (eCfg->PadTop + eCfg->PadBottom))/2 
-                    - (rs.h/2);
-            }
-            break;
-        case NEUIK_VJUSTIFY_BOTTOM:
-            rect.y += rSize->h - (rs.h + eCfg->PadBottom);
-            break;
-    }
-
+    neuik_Stack_PlaceElement(cont, eCfg, rSize, rl, &rs, &rect);
     rl.x = rect.x;
     rl.y = rect.y;
     rlRel.x = rect.x;
     rlRel.y = rect.y;
     neuik_Element_StoreSizeAndLocation(elem, rs, rl, rlRel);
 
+    if (!mock && cache->budget > 0)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Show the active element through its retained page; the page is    */
+        /* only drawn where it has changed since it was last shown.           */
+        /*--------------------------------------------------------------------*/
+        neuik_Stack_PrunePages(cache, cont);
+        if (cont->redrawAll)
+        {
+            ctr = neuik_Stack_FindPage(cache, elem);
+            if (ctr >= 0) cache->pages[ctr].valid = 0;
+        }
+        if (neuik_Stack_AcquirePage(cache, elem, rSize, 1, elem, &page))
+        {
+            eNum = 12;
+            goto out;
+        }
+    }
+    if (page != NULL)
+    {
+        page->lastUsed = ++(cache->clock);
+        if (neuik_Stack_DrawPage(eBase, cont, page, elem, &rs, &rect))
+        {
+            eNum = 13;
+            goto out;
+        }
+        if (neuik_Stack_ShowPage(cache, page, xRend, &(eBase->eSt.rLoc), rlMod))
+        {
+            eNum = 14;
+            goto out;
+        }
+        cache->shown = 1;
+        goto out;
+    }
+    if (!mock && cache->shown)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The active element was last drawn into its page rather than onto   */
+        /* the external renderer; it must now be drawn in full.               */
+        /*--------------------------------------------------------------------*/
+        cont->redrawAll = 1;
+        cache->shown    = 0;
+    }
+
     if (neuik_Element_NeedsRedraw(elem))
     {
         if (neuik_Element_Render(elem, &rs, rlMod, rend, mock))
@@ -758,18 +1272,21 @@ int NEUIK_Stack_SetActiveElement(
     NEUIK_Stack   * stk,
     NEUIK_Element   elem)
 {
-    int               elemIncl;
-    int               ctr        = 0;
-    int               eNum       = 0; /* which error to report (if any) */
-    NEUIK_Container * cont       = NULL;
-    NEUIK_Element   * elemPtr;
-    static char       funcName[] = "NEUIK_Stack_SetActiveElement";
-    static char     * errMsgs[]  = {"", // [0] no error
+    int                    elemIncl;
+    int                    ctr        = 0;
+    int                    eNum       = 0; /* which error to report (if any) */
+    NEUIK_Container      * cont       = NULL;
+    NEUIK_ElementBase    * eBase      = NULL;
+    NEUIK_Element        * elemPtr;
+    neuik_StackPageCache * cache      = NULL;
+    static char            funcName[] = "NEUIK_Stack_SetActiveElement";
+    static char          * errMsgs[]  = {"", // [0] no error
         "Argument `stk` is not of Stack class.",                        // [1]
         "Argument `elem` does not implement Element class.",            // [2]
         "Active element not within this stack.",                        // [3]
         "Argument `stk` caused `neuik_Object_GetClassObject` to fail.", // [4]
         "Failure in `neuik_Container_RequestFullRedraw()`.",            // [5]
+        "Failure in `neuik_Element_RequestRedraw()`.",                  // [6]
     };
 
     if (!neuik_Object_IsClass(stk, neuik__Class_Stack))
@@ -787,6 +1304,11 @@ int NEUIK_Stack_SetActiveElement(
         eNum = 4;
         goto out;
     }
+    if (neuik_Object_GetClassObject(stk, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 4;
+        goto out;
+    }
 
     /*------------------------------------------------------------------------*/
     /* Verify that the current active stack element is within the stack.      */
@@ -811,6 +1333,24 @@ int NEUIK_Stack_SetActiveElement(
         goto out;
     }
 
+    cache = (neuik_StackPageCache*)(stk->pages);
+    if (elem != stk->elemActive && 
+        neuik_Stack_IsPageCurrent(cache, elem, &(eBase->eSt.rSize)))
+    {
+        /*--------------------------------------------------------------------*/
+        /* The element has a complete retained page; it only has to be copied */
+        /* out (along with any parts of it which have since changed).         */
+        /*--------------------------------------------------------------------*/
+        stk->elemActive = elem;
+        if (neuik_Element_RequestRedraw(stk, 
+                eBase->eSt.rLoc, eBase->eSt.rSize))
+        {
+            eNum = 6;
+            goto out;
+        }
+        goto out;
+    }
+
     stk->elemActive = elem;
     if (neuik_Container_RequestFullRedraw(stk))
     {
@@ -826,3 +1366,331 @@ out:
     return eNum;
 }
 
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Stack_SetPageCacheBudget
+ *
+ *  Description:   Set the number of bytes which this Stack may use to retain 
+ *                 the rendered contents of its pages. Each retained page takes
+ *                 4 bytes per pixel of the stack. Least recently shown pages 
+ *                 are released first when the budget is exceeded. A budget of 
+ *                 zero (the default) disables the retention of pages.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Stack_SetPageCacheBudget(
+    NEUIK_Stack * stk,
+    size_t        nBytes)
+{
+    int                    eNum       = 0; /* which error to report (if any) */
+    NEUIK_ElementBase    * eBase      = NULL;
+    neuik_StackPageCache * cache      = NULL;
+    static char            funcName[] = "NEUIK_Stack_SetPageCacheBudget";
+    static char          * errMsgs[]  = {"", // [0] no error
+        "Argument `stk` is not of Stack class.",                        // [1]
+        "Argument `stk` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Failure in `neuik_Element_RequestRedraw()`.",                  // [3]
+    };
+
+    if (!neuik_Object_IsClass(stk, neuik__Class_Stack))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(stk, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    cache = (neuik_StackPageCache*)(stk->pages);
+
+    cache->budget = nBytes;
+    neuik_Stack_TrimPages(cache, 0, stk->elemActive);
+    if (cache->nBytes > cache->budget)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Only the page of the active element remains and it doesn't fit.    */
+        /*--------------------------------------------------------------------*/
+        while (cache->nPages > 0)
+        {
+            neuik_Stack_ReleasePage(cache, cache->nPages - 1);
+        }
+    }
+    if (cache->nPages == 0)
+    {
+        ConditionallyDestroyTexture(&(cache->tex));
+    }
+
+    if (cache->shown && neuik_Stack_FindPage(cache, stk->elemActive) < 0)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The shown page was released; the active element must be redrawn.   */
+        /*--------------------------------------------------------------------*/
+        if (neuik_Element_RequestRedraw(stk, 
+                eBase->eSt.rLoc, eBase->eSt.rSize))
+        {
+            eNum = 3;
+            goto out;
+        }
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*  Name:          neuik_Stack_Prerender                                      */
+/*                                                                            */
+/*  Description:   Place an inactive stack element and draw it into its       */
+/*                 retained page. If `evict` is set, least recently shown     */
+/*                 pages are released to make room for the page.              */
+/*                                                                            */
+/*  Returns:       1 if there is an error; 0 otherwise. `*drawn` is set if    */
+/*                 the element was drawn into a page.                         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_Stack_Prerender(
+    NEUIK_Stack          * stk,
+    NEUIK_ElementBase    * eBase,
+    NEUIK_Container      * cont,
+    neuik_StackPageCache * cache,
+    NEUIK_Element          elem,
+    int                    evict,
+    int                  * drawn)
+{
+    RenderLoc             rl;
+    RenderSize            rs;
+    SDL_Rect              rect;
+    NEUIK_ElementConfig * eCfg = NULL;
+    neuik_StackPage     * page = NULL;
+
+    *drawn = 0;
+    if (eBase->eSt.rSize.w <= 0 || eBase->eSt.rSize.h <= 0) return 0;
+
+    eCfg = neuik_Element_GetConfig(elem);
+    if (eCfg == NULL) return 1;
+    if (neuik_Element_GetMinSize(elem, &rs)) return 1;
+
+    neuik_Stack_PlaceElement(cont, eCfg, &(eBase->eSt.rSize), 
+        eBase->eSt.rLoc, &rs, &rect);
+    rl.x = rect.x;
+    rl.y = rect.y;
+    neuik_Element_StoreSizeAndLocation(elem, rs, rl, rl);
+
+    if (neuik_Stack_AcquirePage(cache, elem, &(eBase->eSt.rSize), 
+            evict, stk->elemActive, &page))
+    {
+        return 1;
+    }
+    if (page == NULL) return 0;
+
+    if (neuik_Stack_DrawPage(eBase, cont, page, elem, &rs, &rect)) return 1;
+    *drawn = 1;
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Stack_PrerenderPage
+ *
+ *  Description:   Draw an inactive element of this Stack into a retained page
+ *                 so that it can be shown immediately once it is made active.
+ *                 This is meant to be called while the application is idle; 
+ *                 it does nothing unless a page cache budget has been set and 
+ *                 the stack has been laid out. Less recently shown pages are 
+ *                 released if needed to make room for the page.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Stack_PrerenderPage(
+    NEUIK_Stack   * stk,
+    NEUIK_Element   elem)
+{
+    int                    ctr        = 0;
+    int                    eNum       = 0; /* which error to report (if any) */
+    int                    drawn      = 0;
+    int                    elemIncl   = 0;
+    NEUIK_Container      * cont       = NULL;
+    NEUIK_ElementBase    * eBase      = NULL;
+    neuik_StackPageCache * cache      = NULL;
+    static char            funcName[] = "NEUIK_Stack_PrerenderPage";
+    static char          * errMsgs[]  = {"", // [0] no error
+        "Argument `stk` is not of Stack class.",                        // [1]
+        "Argument `elem` does not implement Element class.",            // [2]
+        "Element not within this stack.",                               // [3]
+        "Argument `stk` caused `neuik_Object_GetClassObject` to fail.", // [4]
+        "Failure in `neuik_Stack_Prerender()`.",                        // [5]
+    };
+
+    if (!neuik_Object_IsClass(stk, neuik__Class_Stack))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (!neuik_Object_ImplementsClass(elem, neuik__Class_Element))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(stk, neuik__Class_Container, (void**)&cont))
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(stk, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    if (cont->elems != NULL)
+    {
+        for (ctr = 0; cont->elems[ctr] != NULL; ctr++)
+        {
+            if (cont->elems[ctr] == elem)
+            {
+                elemIncl = 1;
+                break;
+            }
+        }
+    }
+    if (!elemIncl)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    cache = (neuik_StackPageCache*)(stk->pages);
+    if (cache->budget == 0) goto out;
+    if (elem == stk->elemActive) goto out;
+    if (!NEUIK_Element_IsShown(elem)) goto out;
+
+    if (neuik_Stack_Prerender(stk, eBase, cont, cache, elem, 1, &drawn))
+    {
+        eNum = 5;
+        goto out;
+    }
+    if (drawn)
+    {
+        cache->pages[neuik_Stack_FindPage(cache, elem)].lastUsed = 
+            ++(cache->clock);
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Stack_PrerenderNextPage
+ *
+ *  Description:   Draw the next inactive element of this Stack (in the order
+ *                 they were added) which doesn't have a complete retained page
+ *                 yet. Pages are only drawn if they fit within the remaining 
+ *                 page cache budget; no other pages are released. Calling this
+ *                 once per idle period spreads prerendering across frames.
+ *
+ *                 If `nLeft` is not NULL, it is set to the number of elements
+ *                 still left to prerender (zero once every page is retained or
+ *                 once the budget is full).
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Stack_PrerenderNextPage(
+    NEUIK_Stack * stk,
+    int         * nLeft)
+{
+    int                    ctr        = 0;
+    int                    eNum       = 0; /* which error to report (if any) */
+    int                    done       = 0; /* a page was drawn (or didn't fit) */
+    int                    drawn      = 0;
+    int                    nRemaining = 0;
+    NEUIK_Element          elem       = NULL;
+    NEUIK_Container      * cont       = NULL;
+    NEUIK_ElementBase    * eBase      = NULL;
+    neuik_StackPageCache * cache      = NULL;
+    static char            funcName[] = "NEUIK_Stack_PrerenderNextPage";
+    static char          * errMsgs[]  = {"", // [0] no error
+        "Argument `stk` is not of Stack class.",                        // [1]
+        "Argument `stk` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Failure in `neuik_Stack_Prerender()`.",                        // [3]
+    };
+
+    if (nLeft != NULL) *nLeft = 0;
+
+    if (!neuik_Object_IsClass(stk, neuik__Class_Stack))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(stk, neuik__Class_Container, (void**)&cont))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(stk, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    cache = (neuik_StackPageCache*)(stk->pages);
+    if (cache->budget == 0 || cont->elems == NULL) goto out;
+    neuik_Stack_PrunePages(cache, cont);
+
+    for (ctr = 0; cont->elems[ctr] != NULL; ctr++)
+    {
+        elem = cont->elems[ctr];
+        if (elem == stk->elemActive) continue;
+        if (!NEUIK_Element_IsShown(elem)) continue;
+        if (neuik_Stack_IsPageCurrent(cache, elem, &(eBase->eSt.rSize)))
+        {
+            continue;
+        }
+
+        if (done)
+        {
+            nRemaining++;
+            continue;
+        }
+
+        if (neuik_Stack_Prerender(stk, eBase, cont, cache, elem, 0, &drawn))
+        {
+            eNum = 3;
+            goto out;
+        }
+        if (!drawn) break; /* the remaining budget is too small */
+
+        cache->pages[neuik_Stack_FindPage(cache, elem)].lastUsed = 
+            ++(cache->clock);
+        done = 1;
+    }
+    if (nLeft != NULL) *nLeft = nRemaining;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
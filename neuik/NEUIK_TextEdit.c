@@ -28,6 +28,7 @@
 #include "NEUIK_Window_internal.h"
 #include "NEUIK_platform.h"
 #include "NEUIK_TextEdit.h"
+#include "neuik_UTF8.h"
 #include "NEUIK_Element_internal.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
@@ -53,6 +54,123 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit(
 int neuik_Element_Render__TextEdit(
     NEUIK_Element, RenderSize*, RenderLoc*, SDL_Renderer*, int);
 void neuik_Element_Defocus__TextEdit(NEUIK_Element);
+int neuik_TextEdit_LoadThroughLine(NEUIK_TextEdit *, size_t);
+int neuik_TextEdit_LoadAll(NEUIK_TextEdit *);
+void neuik_TextEdit_ReleaseFileLoad(NEUIK_TextEdit *);
+int neuik_TextEdit_PrepareLineCache(
+    NEUIK_TextEdit *, SDL_Renderer *, TTF_Font *, const NEUIK_Color *, size_t);
+SDL_Texture * neuik_TextEdit_GetLineTexture(
+    NEUIK_TextEdit *, SDL_Renderer *, TTF_Font *, const char *, int *, int *);
+void neuik_TextEdit_FreeLineCache(NEUIK_TextEdit *);
+int neuik_TextEdit_PrepareWrapCache(
+    NEUIK_TextEdit *, TTF_Font *, int, float, size_t);
+int neuik_TextEdit_GetWrapBreaks(
+    NEUIK_TextEdit *, size_t, char *, const size_t **, size_t *);
+size_t neuik_TextEdit_GetWrapRows(NEUIK_TextEdit *, size_t);
+size_t neuik_TextEdit_GetWrapRowOfLine(NEUIK_TextEdit *, size_t);
+int neuik_TextEdit_SetWrapTopRow(NEUIK_TextEdit *, size_t);
+int neuik_TextEdit_GetWrapPosAt(
+    NEUIK_TextEdit *, size_t, char *, size_t, int, size_t *);
+int neuik_TextEdit_WrapMoveVertical(NEUIK_TextEdit *, int, int, int *);
+void neuik_TextEdit_InvalidateWrap(NEUIK_TextEdit *);
+void neuik_TextEdit_NoteWrapAppend(NEUIK_TextEdit *);
+void neuik_TextEdit_FreeWrapCache(NEUIK_TextEdit *);
+
+/*----------------------------------------------------------------------------*/
+/* Number of bytes of a mapped file copied into the TextBlock at a time.      */
+/*----------------------------------------------------------------------------*/
+#define TEXTEDIT_LOAD_CHUNK (1024*1024)
+
+/*----------------------------------------------------------------------------*/
+/* State of a file which is being loaded through `NEUIK_TextEdit_LoadFile`.   */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    const char   * data;        /* memory mapped file contents */
+    size_t         length;      /* size of the mapped file (in bytes) */
+    size_t         loaded;      /* bytes copied into the TextBlock so far */
+    void         * handle;      /* platform specific mapping handle */
+    SDL_Thread   * countThread; /* background line counting thread */
+    SDL_atomic_t   cancel;      /* set to stop the line counting thread */
+    SDL_atomic_t   countDone;   /* set once `nLinesTotal` is valid */
+    size_t         nLinesTotal; /* total number of lines within the file */
+} neuik_TextEditFileLoad;
+
+/*----------------------------------------------------------------------------*/
+/* Minimum number of entries held within the line texture cache and the      */
+/* number of neighbouring slots checked for a line before one is evicted.     */
+/*----------------------------------------------------------------------------*/
+#define TEXTEDIT_LINECACHE_MIN   64
+#define TEXTEDIT_LINECACHE_PROBE 4
+
+/*----------------------------------------------------------------------------*/
+/* A rendered line of text held within the line texture cache.                */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    char         * text;      /* copy of the line that was rendered */
+    size_t         textLen;   /* length of the line (in bytes) */
+    size_t         textAlloc; /* allocated size of `text` */
+    unsigned int   hash;      /* hash of the line contents */
+    unsigned int   lastUsed;  /* frame in which the texture was last drawn */
+    SDL_Texture  * tex;       /* rendered line (NULL if the slot is unused) */
+    int            w;         /* width of the rendered line */
+    int            h;         /* height of the rendered line */
+} neuik_TextEditLineTex;
+
+/*----------------------------------------------------------------------------*/
+/* Textures of recently drawn lines; lines are keyed by their contents so an  */
+/* edit only causes the changed lines to be rendered again.                   */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    SDL_Renderer          * rend;     /* renderer the textures belong to */
+    TTF_Font              * font;     /* font used to render the textures */
+    NEUIK_Color             fgClr;    /* color used to render the textures */
+    unsigned int            frame;    /* incremented with each render */
+    size_t                  nEntries; /* number of entries (a power of 2) */
+    neuik_TextEditLineTex * entries;
+} neuik_TextEditLineCache;
+
+/*----------------------------------------------------------------------------*/
+/* Minimum number of entries held within the wrap point cache.                */
+/*----------------------------------------------------------------------------*/
+#define TEXTEDIT_WRAPCACHE_MIN 256
+
+/*----------------------------------------------------------------------------*/
+/* The points at which a (recently measured) line of text wraps.              */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    char         * text;      /* copy of the line that was measured */
+    size_t         textLen;   /* length of the line (in bytes) */
+    size_t         textAlloc; /* allocated size of `text` */
+    unsigned int   hash;      /* hash of the line contents */
+    unsigned int   lastUsed;  /* frame in which the entry was last used */
+    size_t         nRows;     /* rows the line is wrapped onto (0 = unused) */
+    size_t       * rowStart;  /* byte offset of the start of each row */
+    size_t         rowAlloc;  /* allocated size of `rowStart` */
+} neuik_TextEditWrapLine;
+
+/*----------------------------------------------------------------------------*/
+/* Word wrap state of a TextEdit. Wrap points are keyed by the contents of a  */
+/* line, so an edit only causes the changed lines to be measured again. The   */
+/* number of rows occupied by each logical line is kept in a Fenwick tree so  */
+/* that logical lines and visual rows can be converted in O(log n). Lines     */
+/* which have not been measured use an estimate based on their length.        */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    TTF_Font               * font;       /* font used to measure the lines */
+    int                      width;      /* width available to a row */
+    int                      charW;      /* average character width */
+    float                    rowH;       /* height of a row */
+    int                      rebuild;    /* the row index must be rebuilt */
+    long long                appendFrom; /* first line changed by an append */
+    unsigned int             frame;      /* incremented with each render */
+    size_t                   nEntries;   /* number of entries (a power of 2) */
+    neuik_TextEditWrapLine * entries;
+    size_t                   nLines;     /* logical lines in the row index */
+    size_t                   nAlloc;     /* allocated size of the index */
+    size_t                 * lineLen;    /* length of each logical line */
+    size_t                 * rows;       /* rows occupied by each line */
+    size_t                 * tree;       /* Fenwick tree (1-based) of `rows` */
+} neuik_TextEditWrap;
 
 /*----------------------------------------------------------------------------*/
 /* neuik_Element    Function Table                                            */
@@ -163,6 +281,7 @@ int neuik_Object_New__TextEdit(
         "Failure in `neuik_GetObjectBaseOfClass`.",            // [6]
         "Failure in function `neuik_NewTextBlock`.",           // [7]
         "Failure in `NEUIK_Element_SetBackgroundColorSolid`.", // [8]
+        "Failure in function `neuik_NewTextHistory`.",         // [9]
     };
 
     if (tePtr == NULL)
@@ -213,6 +332,11 @@ int neuik_Object_New__TextEdit(
         eNum = 7;
         goto out;
     }
+    if (neuik_NewTextHistory(&te->history))
+    {
+        eNum = 9;
+        goto out;
+    }
 
     /*------------------------------------------------------------------------*/
     /* All allocations successful                                             */
@@ -242,6 +366,12 @@ int neuik_Object_New__TextEdit(
     te->clickOrigin        = UNDEFINED;
     te->clickHeld          = FALSE;
     te->needsRedraw        = TRUE;
+    te->dirtyLines         = FALSE;
+    te->dirtyFirstLn       = 0;
+    te->dirtyLastLn        = 0;
+    te->dirtyScroll        = FALSE;
+    te->framePanLn         = 0;
+    te->frameAligned       = FALSE;
     te->timeLastClick      = 0;
     te->timeClickMinus2    = 0;
     te->cfg                = NULL; 
@@ -249,6 +379,14 @@ int neuik_Object_New__TextEdit(
     te->textSurf           = NULL;
     te->textTex            = NULL;
     te->textRend           = NULL;
+    te->lineBuf            = NULL;
+    te->lineBufSize        = 0;
+    te->fileLoad           = NULL;
+    te->lineCache          = NULL;
+    te->wrapCache          = NULL;
+    te->findPattern        = NULL;
+    te->maxLines           = 0;
+    te->autoScroll         = FALSE;
 
     if (NEUIK_NewTextEditConfig(&te->cfg))
     {
@@ -403,6 +541,12 @@ int neuik_Object_Free__TextEdit(
     if (te->textSurf != NULL) SDL_FreeSurface(te->textSurf);
     if (te->textTex  != NULL) SDL_DestroyTexture(te->textTex);
     if (te->textRend != NULL) SDL_DestroyRenderer(te->textRend);
+    if (te->lineBuf  != NULL) free(te->lineBuf);
+    neuik_TextEdit_ReleaseFileLoad(te);
+    neuik_TextEdit_FreeLineCache(te);
+    neuik_TextEdit_FreeWrapCache(te);
+    if (te->findPattern != NULL) free(te->findPattern);
+    if (te->history     != NULL) neuik_TextHistory_Free(te->history);
 
     if (neuik_Object_Free(te->cfg))
     {
@@ -498,7 +642,7 @@ int neuik_Element_GetMinSize__TextEdit(
     }
 
     /* this textEntry does not contain text */
-    TTF_SizeText(font, " ", &tW, &tH);
+    TTF_SizeUTF8(font, " ", &tW, &tH);
 
     rSize->w = tW + aCfg->fontEmWidth;
     rSize->h = 2 + (int)(1.5 * (float)TTF_FontHeight(font));
@@ -558,11 +702,15 @@ int NEUIK_TextEdit_SetText(
     /*------------------------------------------------------------------------*/
     if (text != NULL)
     {
+        neuik_TextEdit_ReleaseFileLoad(te);
+
         if (neuik_TextBlock_SetText(te->textBlk, text))
         {
             eNum = 2;
             goto out;
         }
+        neuik_TextEdit_InvalidateWrap(te);
+        neuik_TextHistory_Clear(te->history);
     }
 
     te->highlightIsSet     = FALSE;
@@ -588,7 +736,2479 @@ out:
         eNum = 1;
     }
 
-    return eNum;
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Release the memory mapping (and stop the line counting thread) associated  */
+/* with a file loaded through `NEUIK_TextEdit_LoadFile`. Any text which was   */
+/* already copied into the TextBlock is left in place.                        */
+/*----------------------------------------------------------------------------*/
+void neuik_TextEdit_ReleaseFileLoad(
+    NEUIK_TextEdit * te)
+{
+    neuik_TextEditFileLoad * fl;
+
+    fl = (neuik_TextEditFileLoad*)(te->fileLoad);
+    if (fl == NULL) return;
+
+    if (fl->countThread != NULL)
+    {
+        SDL_AtomicSet(&fl->cancel, 1);
+        SDL_WaitThread(fl->countThread, NULL);
+    }
+    neuik_UnmapFile(fl->data, fl->length, fl->handle);
+
+    free(fl);
+    te->fileLoad = NULL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Count the lines within a mapped file. This is run in a background thread   */
+/* so that the scrollbar can reflect the full file size before the whole file */
+/* has been copied into the TextBlock.                                        */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_CountFileLines(
+    void * ptr)
+{
+    size_t                   nEnds  = 0;
+    size_t                   sliceEnd;
+    const char             * pos;
+    const char             * end;
+    const char             * hit;
+    neuik_TextEditFileLoad * fl     = (neuik_TextEditFileLoad*)ptr;
+
+    /*------------------------------------------------------------------------*/
+    /* Line endings may be `\n`, `\r`, or `\r\n`; count each `\n` and each    */
+    /* `\r` which is not immediately followed by a `\n`.                      */
+    /*------------------------------------------------------------------------*/
+    pos = fl->data;
+    end = fl->data + fl->length;
+    while (pos < end)
+    {
+        if (SDL_AtomicGet(&fl->cancel)) return 1;
+
+        sliceEnd = (size_t)(end - pos);
+        if (sliceEnd > TEXTEDIT_LOAD_CHUNK) sliceEnd = TEXTEDIT_LOAD_CHUNK;
+
+        for (hit = pos;;)
+        {
+            hit = memchr(hit, '\n', (pos + sliceEnd) - hit);
+            if (hit == NULL) break;
+            nEnds++;
+            hit++;
+        }
+        for (hit = pos;;)
+        {
+            hit = memchr(hit, '\r', (pos + sliceEnd) - hit);
+            if (hit == NULL) break;
+            if (hit + 1 == end || hit[1] != '\n') nEnds++;
+            hit++;
+        }
+        pos += sliceEnd;
+    }
+
+    fl->nLinesTotal = 1 + nEnds;
+    SDL_AtomicSet(&fl->countDone, 1);
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Copy text from a mapped file into the TextBlock until the desired line is  */
+/* complete (or the whole file has been loaded). Text is copied in chunks     */
+/* which end on a line boundary. Once the entire file is resident the mapping */
+/* is released.                                                               */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+int neuik_TextEdit_LoadThroughLine(
+    NEUIK_TextEdit * te,
+    size_t           lineNo)
+{
+    size_t                   chunkLen;
+    const char             * chunk;
+    neuik_TextEditFileLoad * fl;
+
+    fl = (neuik_TextEditFileLoad*)(te->fileLoad);
+    if (fl == NULL) return 0;
+
+    /*------------------------------------------------------------------------*/
+    /* (compared as `lineNo >= nLines - 1` so that a very large `lineNo`      */
+    /* cannot overflow)                                                       */
+    /*------------------------------------------------------------------------*/
+    while (fl->loaded < fl->length &&
+        (te->textBlk->nLines == 0 || lineNo >= te->textBlk->nLines - 1))
+    {
+        chunk    = fl->data + fl->loaded;
+        chunkLen = fl->length - fl->loaded;
+        if (chunkLen > TEXTEDIT_LOAD_CHUNK)
+        {
+            /*----------------------------------------------------------------*/
+            /* End the chunk following the last `\n` within it. If there is   */
+            /* none, avoid splitting a `\r\n` pair across two chunks.         */
+            /*----------------------------------------------------------------*/
+            chunkLen = TEXTEDIT_LOAD_CHUNK;
+            while (chunkLen > 0 && chunk[chunkLen-1] != '\n') chunkLen--;
+            if (chunkLen == 0)
+            {
+                chunkLen = TEXTEDIT_LOAD_CHUNK;
+                if (chunk[chunkLen-1] == '\r') chunkLen++;
+            }
+        }
+
+        neuik_TextEdit_NoteWrapAppend(te);
+        if (neuik_TextBlock_AppendText(te->textBlk, chunk, chunkLen))
+        {
+            return 1;
+        }
+        fl->loaded += chunkLen;
+    }
+
+    if (fl->loaded >= fl->length)
+    {
+        neuik_TextEdit_ReleaseFileLoad(te);
+    }
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Copy the remainder of a mapped file into the TextBlock (regardless of how  */
+/* many lines it holds); used by operations which need the whole text.        */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+int neuik_TextEdit_LoadAll(
+    NEUIK_TextEdit * te)
+{
+    neuik_TextEditFileLoad * fl;
+
+    fl = (neuik_TextEditFileLoad*)(te->fileLoad);
+    if (fl == NULL) return 0;
+
+    while (te->fileLoad != NULL && fl->loaded < fl->length)
+    {
+        if (neuik_TextEdit_LoadThroughLine(te, te->textBlk->nLines))
+        {
+            return 1;
+        }
+    }
+    if (te->fileLoad != NULL) neuik_TextEdit_ReleaseFileLoad(te);
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Destroy all of the textures held within the line texture cache. The       */
+/* buffers holding the line contents are kept for reuse.                      */
+/*----------------------------------------------------------------------------*/
+static void neuik_TextEdit_FlushLineCache(
+    neuik_TextEditLineCache * lc)
+{
+    size_t ctr;
+
+    for (ctr = 0; ctr < lc->nEntries; ctr++)
+    {
+        ConditionallyDestroyTexture(&(lc->entries[ctr].tex));
+        lc->entries[ctr].textLen = 0;
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Free the line texture cache of a TextEdit (and all of its textures).       */
+/*----------------------------------------------------------------------------*/
+void neuik_TextEdit_FreeLineCache(
+    NEUIK_TextEdit * te)
+{
+    size_t                    ctr;
+    neuik_TextEditLineCache * lc;
+
+    lc = (neuik_TextEditLineCache*)(te->lineCache);
+    if (lc == NULL) return;
+
+    neuik_TextEdit_FlushLineCache(lc);
+    for (ctr = 0; ctr < lc->nEntries; ctr++)
+    {
+        if (lc->entries[ctr].text != NULL) free(lc->entries[ctr].text);
+    }
+    if (lc->entries != NULL) free(lc->entries);
+
+    free(lc);
+    te->lineCache = NULL;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEdit_PrepareLineCache
+ *
+ *  Description:   Prepare the line texture cache for a new render. Cached 
+ *                 textures are discarded if the renderer, font, or text color
+ *                 has changed and the cache is grown to comfortably hold all
+ *                 of the lines which are in view.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextEdit_PrepareLineCache(
+    NEUIK_TextEdit    * te,
+    SDL_Renderer      * rend,
+    TTF_Font          * font,
+    const NEUIK_Color * fgClr,
+    size_t              nVisible)
+{
+    int                       eNum       = 0; /* which error to report (if any) */
+    size_t                    ctr;
+    size_t                    nWanted;
+    neuik_TextEditLineCache * lc;
+    neuik_TextEditLineTex   * entries;
+    static char               funcName[] = "neuik_TextEdit_PrepareLineCache";
+    static char             * errMsgs[]  = {"", // [0] no error
+        "Failure to allocate memory.", // [1]
+    };
+
+    lc = (neuik_TextEditLineCache*)(te->lineCache);
+    if (lc == NULL)
+    {
+        lc = (neuik_TextEditLineCache*)calloc(1, sizeof(neuik_TextEditLineCache));
+        if (lc == NULL)
+        {
+            eNum = 1;
+            goto out;
+        }
+        te->lineCache = lc;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Textures belong to a single renderer and reflect a font and color.     */
+    /*------------------------------------------------------------------------*/
+    if (lc->rend != rend || lc->font != font ||
+        lc->fgClr.r != fgClr->r || lc->fgClr.g != fgClr->g ||
+        lc->fgClr.b != fgClr->b || lc->fgClr.a != fgClr->a)
+    {
+        neuik_TextEdit_FlushLineCache(lc);
+        lc->rend  = rend;
+        lc->font  = font;
+        lc->fgClr = *fgClr;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Keep the cache several times larger than the number of visible lines   */
+    /* so that scrolling a short distance does not re-render the view.        */
+    /*------------------------------------------------------------------------*/
+    nWanted = TEXTEDIT_LINECACHE_MIN;
+    while (nWanted < 4*nVisible)
+    {
+        nWanted *= 2;
+    }
+    if (nWanted > lc->nEntries)
+    {
+        entries = (neuik_TextEditLineTex*)calloc(
+            nWanted, sizeof(neuik_TextEditLineTex));
+        if (entries == NULL)
+        {
+            eNum = 1;
+            goto out;
+        }
+        neuik_TextEdit_FlushLineCache(lc);
+        for (ctr = 0; ctr < lc->nEntries; ctr++)
+        {
+            if (lc->entries[ctr].text != NULL) free(lc->entries[ctr].text);
+        }
+        if (lc->entries != NULL) free(lc->entries);
+
+        lc->entries  = entries;
+        lc->nEntries = nWanted;
+    }
+
+    lc->frame++;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEdit_GetLineTexture
+ *
+ *  Description:   Get the rendered texture of a line of text. If the same line
+ *                 contents were rendered recently, the cached texture is 
+ *                 returned; otherwise the line is rendered and cached. The 
+ *                 returned texture is owned by the cache.
+ *
+ *  Returns:       NULL if there is a problem, otherwise a valid SDL_Texture*.
+ *
+ ******************************************************************************/
+SDL_Texture * neuik_TextEdit_GetLineTexture(
+    NEUIK_TextEdit * te,
+    SDL_Renderer   * rend,
+    TTF_Font       * font,
+    const char     * lineBytes,
+    int            * rvW,
+    int            * rvH)
+{
+    int                       eNum       = 0; /* which error to report (if any) */
+    unsigned int              hash       = 2166136261u;
+    size_t                    textLen    = 0;
+    size_t                    ctr;
+    size_t                    slot;
+    char                    * newText;
+    SDL_Texture             * tex        = NULL;
+    neuik_TextEditLineCache * lc;
+    neuik_TextEditLineTex   * entry;
+    neuik_TextEditLineTex   * victim     = NULL;
+    static char               funcName[] = "neuik_TextEdit_GetLineTexture";
+    static char             * errMsgs[]  = {"", // [0] no error
+        "The line cache has not been prepared.",   // [1]
+        "Failure to allocate memory.",             // [2]
+        "Failure in function `NEUIK_RenderText`.", // [3]
+    };
+
+    lc = (neuik_TextEditLineCache*)(te->lineCache);
+    if (lc == NULL || lc->nEntries == 0)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Hash the line contents (FNV-1a).                                       */
+    /*------------------------------------------------------------------------*/
+    for (; lineBytes[textLen] != '\0'; textLen++)
+    {
+        hash ^= (unsigned char)(lineBytes[textLen]);
+        hash *= 16777619u;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Look for the line among its neighbouring slots; if it isn't present,  */
+    /* pick an unused slot or else the least recently drawn one.              */
+    /*------------------------------------------------------------------------*/
+    for (ctr = 0; ctr < TEXTEDIT_LINECACHE_PROBE; ctr++)
+    {
+        slot  = (hash + ctr) & (lc->nEntries - 1);
+        entry = &(lc->entries[slot]);
+        if (entry->tex == NULL)
+        {
+            if (victim == NULL || victim->tex != NULL) victim = entry;
+            continue;
+        }
+        if (entry->hash == hash && entry->textLen == textLen &&
+            memcmp(entry->text, lineBytes, textLen) == 0)
+        {
+            entry->lastUsed = lc->frame;
+            *rvW = entry->w;
+            *rvH = entry->h;
+            tex  = entry->tex;
+            goto out;
+        }
+        if (victim == NULL || 
+            (victim->tex != NULL && entry->lastUsed < victim->lastUsed))
+        {
+            victim = entry;
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Render the line into the selected slot.                                */
+    /*------------------------------------------------------------------------*/
+    if (victim->textAlloc < textLen + 1)
+    {
+        newText = (char*)realloc(victim->text, textLen + 1);
+        if (newText == NULL)
+        {
+            eNum = 2;
+            goto out;
+        }
+        victim->text      = newText;
+        victim->textAlloc = textLen + 1;
+    }
+    ConditionallyDestroyTexture(&(victim->tex));
+
+    victim->tex = NEUIK_RenderText(lineBytes, font, lc->fgClr, rend, 
+        &(victim->w), &(victim->h));
+    if (victim->tex == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+    memcpy(victim->text, lineBytes, textLen + 1);
+    victim->textLen  = textLen;
+    victim->hash     = hash;
+    victim->lastUsed = lc->frame;
+
+    *rvW = victim->w;
+    *rvH = victim->h;
+    tex  = victim->tex;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+    }
+
+    return tex;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* The lowest set bit of an index within the (1-based) Fenwick row tree.      */
+/*----------------------------------------------------------------------------*/
+#define TEXTEDIT_LOWBIT(x) ((x) & (~(x) + 1))
+
+
+/*----------------------------------------------------------------------------*/
+/* Estimate the number of rows onto which a line of the given length wraps.   */
+/*----------------------------------------------------------------------------*/
+static size_t neuik_TextEdit_EstimateWrapRows(
+    neuik_TextEditWrap * wc,
+    size_t               lineLen)
+{
+    size_t nRows;
+
+    if (wc->width <= 0) return 1;
+    nRows = (lineLen*(size_t)(wc->charW) + (size_t)(wc->width) - 1)/
+        (size_t)(wc->width);
+    return (nRows > 0) ? nRows : 1;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Rebuild the Fenwick tree from the per-line row counts; O(n).               */
+/*----------------------------------------------------------------------------*/
+static void neuik_TextEdit_BuildWrapTree(
+    neuik_TextEditWrap * wc)
+{
+    size_t ctr;
+    size_t parent;
+
+    wc->tree[0] = 0;
+    for (ctr = 1; ctr <= wc->nLines; ctr++)
+    {
+        wc->tree[ctr] = wc->rows[ctr-1];
+    }
+    for (ctr = 1; ctr <= wc->nLines; ctr++)
+    {
+        parent = ctr + TEXTEDIT_LOWBIT(ctr);
+        if (parent <= wc->nLines) wc->tree[parent] += wc->tree[ctr];
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Update the number of rows occupied by a single line; O(log n).             */
+/*----------------------------------------------------------------------------*/
+static void neuik_TextEdit_SetWrapRows(
+    neuik_TextEditWrap * wc,
+    size_t               lineNo,
+    size_t               nRows)
+{
+    size_t ctr;
+    size_t oldRows;
+
+    if (lineNo >= wc->nLines || wc->rows[lineNo] == nRows) return;
+
+    oldRows = wc->rows[lineNo];
+    wc->rows[lineNo] = nRows;
+    for (ctr = lineNo + 1; ctr <= wc->nLines; ctr += TEXTEDIT_LOWBIT(ctr))
+    {
+        wc->tree[ctr] = (wc->tree[ctr] - oldRows) + nRows;
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Make sure the row index can hold the specified number of lines.            */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_ReserveWrapIndex(
+    neuik_TextEditWrap * wc,
+    size_t               nLines)
+{
+    size_t   nAlloc;
+    size_t * newPtr;
+
+    if (nLines <= wc->nAlloc) return 0;
+
+    nAlloc = (wc->nAlloc > 0) ? wc->nAlloc : 1024;
+    while (nAlloc < nLines) nAlloc *= 2;
+
+    newPtr = (size_t*)realloc(wc->lineLen, nAlloc*sizeof(size_t));
+    if (newPtr == NULL) return 1;
+    wc->lineLen = newPtr;
+
+    newPtr = (size_t*)realloc(wc->rows, nAlloc*sizeof(size_t));
+    if (newPtr == NULL) return 1;
+    wc->rows = newPtr;
+
+    newPtr = (size_t*)realloc(wc->tree, (nAlloc + 1)*sizeof(size_t));
+    if (newPtr == NULL) return 1;
+    wc->tree = newPtr;
+
+    wc->nAlloc = nAlloc;
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Bring the row index in line with the number of lines in the TextBlock.     */
+/* Only the lines which were added (or changed) by an edit are looked at; the */
+/* remaining entries are shifted. An edit is assumed to have happened around  */
+/* the cursor, unless text was appended to the end of the TextEdit. Lines are */
+/* given an estimated row count until they are drawn (and measured).          */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_SyncWrapIndex(
+    NEUIK_TextEdit     * te,
+    neuik_TextEditWrap * wc,
+    size_t               nLines)
+{
+    size_t ctr;
+    size_t delta;
+    size_t first    = 0;
+    size_t nChanged = nLines;
+
+    if (!wc->rebuild && wc->nLines == nLines) return 0;
+
+    if (neuik_TextEdit_ReserveWrapIndex(wc, nLines)) return 1;
+
+    if (!wc->rebuild && wc->nLines > 0 && nLines > wc->nLines)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Lines were added; open up a gap for them in the index.             */
+        /*--------------------------------------------------------------------*/
+        delta = nLines - wc->nLines;
+        if (wc->appendFrom != UNDEFINED)
+        {
+            first = (size_t)(wc->appendFrom);
+        }
+        else if (te->cursorLine >= delta)
+        {
+            first = te->cursorLine - delta;
+        }
+        if (first > wc->nLines - 1) first = wc->nLines - 1;
+
+        memmove(wc->lineLen + first + 1 + delta, wc->lineLen + first + 1,
+            (wc->nLines - first - 1)*sizeof(size_t));
+        memmove(wc->rows + first + 1 + delta, wc->rows + first + 1,
+            (wc->nLines - first - 1)*sizeof(size_t));
+        nChanged = delta + 1;
+    }
+    else if (!wc->rebuild && wc->nLines > 0 && nLines < wc->nLines)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Lines were removed (merged into the line holding the cursor).      */
+        /*--------------------------------------------------------------------*/
+        delta = wc->nLines - nLines;
+        first = te->cursorLine;
+        if (first > nLines - 1) first = nLines - 1;
+
+        memmove(wc->lineLen + first + 1, wc->lineLen + first + 1 + delta,
+            (nLines - first - 1)*sizeof(size_t));
+        memmove(wc->rows + first + 1, wc->rows + first + 1 + delta,
+            (nLines - first - 1)*sizeof(size_t));
+        nChanged = 1;
+    }
+
+    if (neuik_TextBlock_GetLineLengths(te->textBlk, first, nChanged, 
+        wc->lineLen + first))
+    {
+        return 1;
+    }
+    for (ctr = first; ctr < first + nChanged; ctr++)
+    {
+        wc->rows[ctr] = neuik_TextEdit_EstimateWrapRows(wc, wc->lineLen[ctr]);
+    }
+
+    wc->nLines     = nLines;
+    wc->rebuild    = FALSE;
+    wc->appendFrom = UNDEFINED;
+    neuik_TextEdit_BuildWrapTree(wc);
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Discard all of the wrap points held within the cache.                      */
+/*----------------------------------------------------------------------------*/
+static void neuik_TextEdit_FlushWrapCache(
+    neuik_TextEditWrap * wc)
+{
+    size_t ctr;
+
+    for (ctr = 0; ctr < wc->nEntries; ctr++)
+    {
+        wc->entries[ctr].nRows = 0;
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Free the word wrap state of a TextEdit.                                    */
+/*----------------------------------------------------------------------------*/
+void neuik_TextEdit_FreeWrapCache(
+    NEUIK_TextEdit * te)
+{
+    size_t               ctr;
+    neuik_TextEditWrap * wc;
+
+    wc = (neuik_TextEditWrap*)(te->wrapCache);
+    if (wc == NULL) return;
+
+    for (ctr = 0; ctr < wc->nEntries; ctr++)
+    {
+        if (wc->entries[ctr].text     != NULL) free(wc->entries[ctr].text);
+        if (wc->entries[ctr].rowStart != NULL) free(wc->entries[ctr].rowStart);
+    }
+    if (wc->entries != NULL) free(wc->entries);
+    if (wc->lineLen != NULL) free(wc->lineLen);
+    if (wc->rows    != NULL) free(wc->rows);
+    if (wc->tree    != NULL) free(wc->tree);
+
+    free(wc);
+    te->wrapCache = NULL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Note that the text of a TextEdit was replaced; the row index is rebuilt    */
+/* (from the line lengths alone) before it is next used.                      */
+/*----------------------------------------------------------------------------*/
+void neuik_TextEdit_InvalidateWrap(
+    NEUIK_TextEdit * te)
+{
+    neuik_TextEditWrap * wc;
+
+    wc = (neuik_TextEditWrap*)(te->wrapCache);
+    if (wc == NULL) return;
+
+    wc->rebuild = TRUE;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Note that text is about to be appended to the end of a TextEdit, so that   */
+/* the lines which are added can be placed at the end of the row index.       */
+/*----------------------------------------------------------------------------*/
+void neuik_TextEdit_NoteWrapAppend(
+    NEUIK_TextEdit * te)
+{
+    neuik_TextEditWrap * wc;
+
+    wc = (neuik_TextEditWrap*)(te->wrapCache);
+    if (wc == NULL || wc->nLines == 0) return;
+
+    if (wc->appendFrom == UNDEFINED)
+    {
+        wc->appendFrom = (long long)(wc->nLines - 1);
+    }
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEdit_PrepareWrapCache
+ *
+ *  Description:   Prepare the word wrap state for a new render. If the font or
+ *                 the wrap width has changed, the cached wrap points are 
+ *                 discarded and the row count of each line is re-estimated 
+ *                 from its length (no line is measured here). The row index 
+ *                 is then brought up to date with the TextBlock.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextEdit_PrepareWrapCache(
+    NEUIK_TextEdit * te,
+    TTF_Font       * font,
+    int              width,
+    float            rowH,
+    size_t           nVisible)
+{
+    int                      eNum       = 0; /* which error to report (if any) */
+    int                      textW      = 0;
+    int                      textH      = 0;
+    int                      changed    = FALSE;
+    size_t                   ctr;
+    size_t                   nWanted;
+    neuik_TextEditWrap     * wc;
+    neuik_TextEditWrapLine * entries;
+    static char              funcName[] = "neuik_TextEdit_PrepareWrapCache";
+    static char            * errMsgs[]  = {"", // [0] no error
+        "Failure to allocate memory.",                           // [1]
+        "Failure in function `neuik_TextBlock_GetLineLengths`.", // [2]
+    };
+
+    wc = (neuik_TextEditWrap*)(te->wrapCache);
+    if (wc == NULL)
+    {
+        wc = (neuik_TextEditWrap*)calloc(1, sizeof(neuik_TextEditWrap));
+        if (wc == NULL)
+        {
+            eNum = 1;
+            goto out;
+        }
+        wc->appendFrom = UNDEFINED;
+        wc->rebuild    = TRUE;
+        te->wrapCache  = wc;
+    }
+    if (width < 1) width = 1;
+
+    /*------------------------------------------------------------------------*/
+    /* Wrap points reflect a single font and wrap width.                      */
+    /*------------------------------------------------------------------------*/
+    if (wc->font != font || wc->width != width)
+    {
+        neuik_TextEdit_FlushWrapCache(wc);
+        wc->font  = font;
+        wc->width = width;
+
+        TTF_SizeUTF8(font, "abcdefghijklmnopqrstuvwxyz", &textW, &textH);
+        wc->charW = (textW > 26) ? textW/26 : 1;
+        changed   = TRUE;
+    }
+    wc->rowH = rowH;
+
+    /*------------------------------------------------------------------------*/
+    /* Keep enough entries for several screens worth of (wrapped) lines.      */
+    /*------------------------------------------------------------------------*/
+    nWanted = TEXTEDIT_WRAPCACHE_MIN;
+    while (nWanted < 4*nVisible)
+    {
+        nWanted *= 2;
+    }
+    if (nWanted > wc->nEntries)
+    {
+        entries = (neuik_TextEditWrapLine*)calloc(
+            nWanted, sizeof(neuik_TextEditWrapLine));
+        if (entries == NULL)
+        {
+            eNum = 1;
+            goto out;
+        }
+        for (ctr = 0; ctr < wc->nEntries; ctr++)
+        {
+            if (wc->entries[ctr].text != NULL) free(wc->entries[ctr].text);
+            if (wc->entries[ctr].rowStart != NULL) 
+            {
+                free(wc->entries[ctr].rowStart);
+            }
+        }
+        if (wc->entries != NULL) free(wc->entries);
+
+        wc->entries  = entries;
+        wc->nEntries = nWanted;
+    }
+
+    if (neuik_TextEdit_SyncWrapIndex(te, wc, te->textBlk->nLines))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (changed)
+    {
+        for (ctr = 0; ctr < wc->nLines; ctr++)
+        {
+            wc->rows[ctr] = neuik_TextEdit_EstimateWrapRows(
+                wc, wc->lineLen[ctr]);
+        }
+        neuik_TextEdit_BuildWrapTree(wc);
+    }
+
+    wc->frame++;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Find the points at which a line wraps. The longest prefix of each row that */
+/* fits is found with a binary search (over the layout of the line); the row  */
+/* is then shortened to end after the last space within it (if it has one).   */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_MeasureWrap(
+    neuik_TextEditWrap     * wc,
+    char                   * lineBytes,
+    size_t                   textLen,
+    neuik_TextEditWrapLine * entry)
+{
+    int                startX = 0;
+    size_t             start  = 0;
+    size_t             end;
+    size_t             brk;
+    size_t             lo;
+    size_t             hi;
+    size_t             mid;
+    size_t             rowAlloc;
+    size_t           * newRows;
+    neuik_TextLayout * layout = NULL;
+
+    if (neuik_GetTextLayout(wc->font, lineBytes, textLen, &layout)) return 1;
+
+    entry->nRows = 0;
+    for (;;)
+    {
+        if (entry->nRows == entry->rowAlloc)
+        {
+            rowAlloc = (entry->rowAlloc > 0) ? 2*entry->rowAlloc : 4;
+            newRows  = (size_t*)realloc(entry->rowStart, 
+                rowAlloc*sizeof(size_t));
+            if (newRows == NULL) return 1;
+            entry->rowStart = newRows;
+            entry->rowAlloc = rowAlloc;
+        }
+        entry->rowStart[entry->nRows++] = start;
+
+        startX = neuik_TextLayout_GetX(layout, start);
+        if (neuik_TextLayout_GetX(layout, textLen) - startX <= wc->width) break;
+
+        lo = start + 1;
+        hi = textLen;
+        while (lo < hi)
+        {
+            mid = lo + (hi - lo + 1)/2;
+            if (neuik_TextLayout_GetX(layout, mid) - startX <= wc->width)
+            {
+                lo = mid;
+            }
+            else
+            {
+                hi = mid - 1;
+            }
+        }
+        end = lo;
+
+        if (lineBytes[end] == ' ')
+        {
+            /*----------------------------------------------------------------*/
+            /* The row ends at a word boundary; the spaces stay on this row.  */
+            /*----------------------------------------------------------------*/
+            while (end < textLen && lineBytes[end] == ' ') end++;
+        }
+        else
+        {
+            for (brk = end; brk > start + 1; brk--)
+            {
+                if (lineBytes[brk-1] == ' ') break;
+            }
+            if (brk > start + 1)
+            {
+                end = brk;
+            }
+            else
+            {
+                /*------------------------------------------------------------*/
+                /* A single word fills the row; don't split a UTF-8 sequence. */
+                /*------------------------------------------------------------*/
+                while (end > start + 1 && 
+                    ((unsigned char)(lineBytes[end]) & 0xC0) == 0x80) end--;
+                while (end < textLen && 
+                    ((unsigned char)(lineBytes[end]) & 0xC0) == 0x80) end++;
+            }
+        }
+
+        if (end >= textLen) break;
+        start = end;
+    }
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEdit_GetWrapBreaks
+ *
+ *  Description:   Get the byte offsets at which each (visual) row of a line 
+ *                 starts. Wrap points are cached by the contents of the line
+ *                 and a line is only measured if it is not in the cache. The
+ *                 row count of the line within the row index is updated. If
+ *                 word wrap is not active, the line occupies a single row.
+ *
+ *                 The returned row offsets are owned by the cache.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextEdit_GetWrapBreaks(
+    NEUIK_TextEdit  * te,
+    size_t            lineNo,
+    char            * lineBytes,
+    const size_t   ** rowStart,
+    size_t          * nRows)
+{
+    int                      eNum       = 0; /* which error to report (if any) */
+    unsigned int             hash       = 2166136261u;
+    size_t                   textLen    = 0;
+    size_t                   ctr;
+    size_t                   slot;
+    char                   * newText;
+    neuik_TextEditWrap     * wc;
+    neuik_TextEditWrapLine * entry;
+    neuik_TextEditWrapLine * victim     = NULL;
+    static size_t            noWrap     = 0;
+    static char              funcName[] = "neuik_TextEdit_GetWrapBreaks";
+    static char            * errMsgs[]  = {"", // [0] no error
+        "Failure to allocate memory.", // [1]
+    };
+
+    *rowStart = &noWrap;
+    *nRows    = 1;
+
+    wc = (neuik_TextEditWrap*)(te->wrapCache);
+    if (wc == NULL || wc->nEntries == 0) goto out;
+
+    for (; lineBytes[textLen] != '\0'; textLen++)
+    {
+        hash ^= (unsigned char)(lineBytes[textLen]);
+        hash *= 16777619u;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Look for the line among its neighbouring slots; if it isn't present,   */
+    /* pick an unused slot or else the least recently used one.               */
+    /*------------------------------------------------------------------------*/
+    for (ctr = 0; ctr < TEXTEDIT_LINECACHE_PROBE; ctr++)
+    {
+        slot  = (hash + ctr) & (wc->nEntries - 1);
+        entry = &(wc->entries[slot]);
+        if (entry->nRows == 0)
+        {
+            if (victim == NULL || victim->nRows != 0) victim = entry;
+            continue;
+        }
+        if (entry->hash == hash && entry->textLen == textLen &&
+            memcmp(entry->text, lineBytes, textLen) == 0)
+        {
+            victim = entry;
+            goto found;
+        }
+        if (victim == NULL || 
+            (victim->nRows != 0 && entry->lastUsed < victim->lastUsed))
+        {
+            victim = entry;
+        }
+    }
+
+    if (victim->textAlloc < textLen + 1)
+    {
+        newText = (char*)realloc(victim->text, textLen + 1);
+        if (newText == NULL)
+        {
+            eNum = 1;
+            goto out;
+        }
+        victim->text      = newText;
+        victim->textAlloc = textLen + 1;
+    }
+    if (neuik_TextEdit_MeasureWrap(wc, lineBytes, textLen, victim))
+    {
+        victim->nRows = 0;
+        eNum = 1;
+        goto out;
+    }
+    memcpy(victim->text, lineBytes, textLen + 1);
+    victim->textLen = textLen;
+    victim->hash    = hash;
+found:
+    victim->lastUsed = wc->frame;
+    if (lineNo < wc->nLines)
+    {
+        wc->lineLen[lineNo] = textLen;
+        neuik_TextEdit_SetWrapRows(wc, lineNo, victim->nRows);
+    }
+
+    *rowStart = victim->rowStart;
+    *nRows    = victim->nRows;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Get the number of rows occupied by a line (1 unless word wrap is active).  */
+/*----------------------------------------------------------------------------*/
+size_t neuik_TextEdit_GetWrapRows(
+    NEUIK_TextEdit * te,
+    size_t           lineNo)
+{
+    neuik_TextEditWrap * wc;
+
+    wc = (neuik_TextEditWrap*)(te->wrapCache);
+    if (wc == NULL || lineNo >= wc->nLines) return 1;
+
+    return wc->rows[lineNo];
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Get the visual row at which a line starts; O(log n). Lines which are not   */
+/* yet in the row index (e.g., not yet loaded) count as a single row.         */
+/*----------------------------------------------------------------------------*/
+size_t neuik_TextEdit_GetWrapRowOfLine(
+    NEUIK_TextEdit * te,
+    size_t           lineNo)
+{
+    size_t               ctr;
+    size_t               row = 0;
+    neuik_TextEditWrap * wc;
+
+    wc = (neuik_TextEditWrap*)(te->wrapCache);
+    if (wc == NULL) return lineNo;
+
+    ctr = lineNo;
+    if (ctr > wc->nLines)
+    {
+        row = lineNo - wc->nLines;
+        ctr = wc->nLines;
+    }
+    for (; ctr > 0; ctr -= TEXTEDIT_LOWBIT(ctr))
+    {
+        row += wc->tree[ctr];
+    }
+    return row;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Scroll a word wrapped view so that it starts at the specified visual row.  */
+/* The containing line is found by descending the row tree; O(log n).         */
+/*                                                                            */
+/* Returns: TRUE if the view was scrolled; FALSE if word wrap is not active.  */
+/*----------------------------------------------------------------------------*/
+int neuik_TextEdit_SetWrapTopRow(
+    NEUIK_TextEdit * te,
+    size_t           row)
+{
+    size_t               line = 0;
+    size_t               step = 1;
+    neuik_TextEditWrap * wc;
+
+    wc = (neuik_TextEditWrap*)(te->wrapCache);
+    if (wc == NULL || wc->nLines == 0) return FALSE;
+
+    while (2*step <= wc->nLines) step *= 2;
+    for (; step > 0; step /= 2)
+    {
+        if (line + step <= wc->nLines && wc->tree[line + step] <= row)
+        {
+            line += step;
+            row  -= wc->tree[line];
+        }
+    }
+    if (line >= wc->nLines)
+    {
+        /* the row is past the end; show the final row of the final line */
+        line = wc->nLines - 1;
+        row  = wc->rows[line] - 1;
+    }
+
+    te->vertPanLn = line;
+    te->vertPanPx = (unsigned int)((float)(row)*wc->rowH);
+    return TRUE;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEdit_GetWrapPosAt
+ *
+ *  Description:   Get the position within a word wrapped line of text which is
+ *                 closest to a horizontal offset within one of its rows. The 
+ *                 final row of the line is used if `row` is beyond it. A 
+ *                 position at the end of a row which is followed by another
+ *                 row is moved back so that it is shown within the row.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextEdit_GetWrapPosAt(
+    NEUIK_TextEdit * te,
+    size_t           lineNo,
+    char           * lineBytes,
+    size_t           row,
+    int              x,
+    size_t         * pos)
+{
+    int                  eNum       = 0; /* which error to report (if any) */
+    size_t               nRows      = 1;
+    size_t               rowEnd     = 0;
+    const size_t       * rowStart   = NULL;
+    neuik_TextEditWrap * wc;
+    neuik_TextLayout   * layout     = NULL;
+    static char          funcName[] = "neuik_TextEdit_GetWrapPosAt";
+    static char        * errMsgs[]  = {"", // [0] no error
+        "Word wrap is not active.",                            // [1]
+        "Failure in function `neuik_TextEdit_GetWrapBreaks`.", // [2]
+        "Failure in function `neuik_GetTextLayout`.",          // [3]
+    };
+
+    wc = (neuik_TextEditWrap*)(te->wrapCache);
+    if (wc == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_TextEdit_GetWrapBreaks(te, lineNo, lineBytes, &rowStart, &nRows))
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    if (row >= nRows) row = nRows - 1;
+    if (row + 1 < nRows)
+    {
+        rowEnd = rowStart[row + 1];
+    }
+    else
+    {
+        rowEnd = strlen(lineBytes);
+    }
+
+    if (neuik_GetTextLayout(wc->font, lineBytes, strlen(lineBytes), &layout))
+    {
+        eNum = 3;
+        goto out;
+    }
+    *pos = neuik_TextLayout_GetPosAtX(layout, 
+        neuik_TextLayout_GetX(layout, rowStart[row]) + ((x > 0) ? x : 0));
+    if (*pos < rowStart[row]) *pos = rowStart[row];
+    if (*pos > rowEnd)        *pos = rowEnd;
+    if (row + 1 < nRows && *pos == rowEnd)
+    {
+        for ((*pos)--; *pos > rowStart[row] &&
+            ((unsigned char)(lineBytes[*pos]) & 0xC0) == 0x80; (*pos)--);
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEdit_WrapMoveVertical
+ *
+ *  Description:   Move the cursor up or down by one visual row of a word 
+ *                 wrapped TextEdit, keeping its horizontal position within 
+ *                 the row. If `extendSel` is set, the highlighted selection is
+ *                 extended to the new cursor position. If word wrap is not 
+ *                 active, or the cursor is already on the first/final row, the
+ *                 cursor is not moved and `moved` is set to FALSE.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextEdit_WrapMoveVertical(
+    NEUIK_TextEdit * te,
+    int              down,
+    int              extendSel,
+    int            * moved)
+{
+    int                  eNum       = 0; /* which error to report (if any) */
+    int                  textW      = 0;
+    size_t               row        = 0;
+    size_t               nRows      = 1;
+    size_t               newLine;
+    size_t               newRow;
+    size_t               newPos     = 0;
+    const size_t       * rowStart   = NULL;
+    neuik_TextEditWrap * wc;
+    neuik_TextLayout   * layout     = NULL;
+    static char          funcName[] = "neuik_TextEdit_WrapMoveVertical";
+    static char        * errMsgs[]  = {"", // [0] no error
+        "Failure in function `neuik_TextBlock_GetLineIntoBuffer`.", // [1]
+        "Failure in function `neuik_TextEdit_GetWrapBreaks`.",      // [2]
+        "Failure in function `neuik_TextEdit_GetWrapPosAt`.",       // [3]
+        "Failure in function `neuik_GetTextLayout`.",               // [4]
+    };
+
+    *moved = FALSE;
+    wc = (neuik_TextEditWrap*)(te->wrapCache);
+    if (wc == NULL) goto out;
+
+    /*------------------------------------------------------------------------*/
+    /* Locate the row holding the cursor and the offset of the cursor in it.  */
+    /*------------------------------------------------------------------------*/
+    if (neuik_TextBlock_GetLineIntoBuffer(te->textBlk, te->cursorLine, 
+        &te->lineBuf, &te->lineBufSize, NULL))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_TextEdit_GetWrapBreaks(te, te->cursorLine, te->lineBuf, 
+        &rowStart, &nRows))
+    {
+        eNum = 2;
+        goto out;
+    }
+    while (row + 1 < nRows && rowStart[row + 1] <= te->cursorPos) row++;
+
+    if (neuik_GetTextLayout(wc->font, te->lineBuf, strlen(te->lineBuf), 
+        &layout))
+    {
+        eNum = 4;
+        goto out;
+    }
+    textW = neuik_TextLayout_GetX(layout, te->cursorPos) - 
+        neuik_TextLayout_GetX(layout, rowStart[row]);
+
+    /*------------------------------------------------------------------------*/
+    /* Determine the row into which the cursor is to be moved.                */
+    /*------------------------------------------------------------------------*/
+    newLine = te->cursorLine;
+    if (down)
+    {
+        newRow = row + 1;
+        if (newRow >= nRows)
+        {
+            if (te->cursorLine + 1 >= te->textBlk->nLines) goto out;
+            newLine++;
+            newRow = 0;
+        }
+    }
+    else
+    {
+        if (row > 0)
+        {
+            newRow = row - 1;
+        }
+        else
+        {
+            if (te->cursorLine == 0) goto out;
+            newLine--;
+            newRow = (size_t)(-1); /* the final row of the line */
+        }
+    }
+
+    if (newLine != te->cursorLine && 
+        neuik_TextBlock_GetLineIntoBuffer(te->textBlk, newLine, 
+        &te->lineBuf, &te->lineBufSize, NULL))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_TextEdit_GetWrapPosAt(te, newLine, te->lineBuf, newRow, textW, 
+        &newPos))
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    if (extendSel && !te->highlightIsSet)
+    {
+        te->highlightIsSet     = TRUE;
+        te->highlightBeginLine = te->cursorLine;
+        te->highlightBeginPos  = te->cursorPos;
+    }
+    else if (!extendSel)
+    {
+        te->highlightIsSet = FALSE;
+        te->clickOrigin    = UNDEFINED;
+    }
+    te->cursorLine = newLine;
+    te->cursorPos  = newPos;
+
+    if (te->highlightIsSet)
+    {
+        if (te->cursorLine < te->highlightBeginLine ||
+                (te->cursorLine == te->highlightBeginLine &&
+                 te->cursorPos < te->highlightBeginPos))
+        {
+            te->highlightStartLine = te->cursorLine;
+            te->highlightStartPos  = te->cursorPos;
+            te->highlightEndLine   = te->highlightBeginLine;
+            te->highlightEndPos    = te->highlightBeginPos;
+        }
+        else
+        {
+            te->highlightStartLine = te->highlightBeginLine;
+            te->highlightStartPos  = te->highlightBeginPos;
+            te->highlightEndLine   = te->cursorLine;
+            te->highlightEndPos    = te->cursorPos;
+        }
+    }
+    *moved = TRUE;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Get the total number of lines within a TextEdit. While a file is still     */
+/* being loaded, the count from the background thread is used if available;  */
+/* otherwise the count is estimated from the portion loaded so far.           */
+/*----------------------------------------------------------------------------*/
+static size_t neuik_TextEdit_GetTotalLineCount(
+    NEUIK_TextEdit * te)
+{
+    size_t                   nLines;
+    neuik_TextEditFileLoad * fl;
+
+    nLines = te->textBlk->nLines;
+    fl     = (neuik_TextEditFileLoad*)(te->fileLoad);
+    if (fl == NULL || fl->loaded == 0) return nLines;
+
+    if (SDL_AtomicGet(&fl->countDone))
+    {
+        return fl->nLinesTotal;
+    }
+    return (size_t)((double)(nLines) * 
+        ((double)(fl->length) / (double)(fl->loaded)));
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_TextEdit_LoadFile
+ *
+ *  Description:   Replace the text in a NEUIK_TextEdit with the contents of a
+ *                 file. The file is memory mapped and copied into the TextEdit
+ *                 as it is scrolled into view; the lines within the file are
+ *                 counted in the background.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_TextEdit_LoadFile(
+    NEUIK_TextEdit * te,
+    const char     * fileName)
+{
+    int                      eNum       = 0; /* which error to report (if any) */
+    RenderSize               rSize;
+    RenderLoc                rLoc;
+    neuik_TextEditFileLoad * fl         = NULL;
+    static char              funcName[] = "NEUIK_TextEdit_LoadFile";
+    static char            * errMsgs[]  = {"", // [0] no error
+        "Argument `te` is not of TextEdit class.",               // [1]
+        "Argument `fileName` is NULL.",                          // [2]
+        "Failed to open and map the specified file.",            // [3]
+        "Failure to allocate memory.",                           // [4]
+        "Failure in function `neuik_TextBlock_Clear`.",          // [5]
+        "Failure in function `neuik_TextEdit_LoadThroughLine`.", // [6]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.",      // [7]
+    };
+
+    if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (fileName == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    neuik_TextEdit_ReleaseFileLoad(te);
+
+    fl = (neuik_TextEditFileLoad*) malloc(sizeof(neuik_TextEditFileLoad));
+    if (fl == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
+    memset(fl, 0, sizeof(neuik_TextEditFileLoad));
+
+    if (neuik_MapFile(fileName, &fl->data, &fl->length, &fl->handle))
+    {
+        free(fl);
+        eNum = 3;
+        goto out;
+    }
+    te->fileLoad = fl;
+
+    if (neuik_TextBlock_Clear(te->textBlk))
+    {
+        eNum = 5;
+        goto out;
+    }
+    neuik_TextEdit_InvalidateWrap(te);
+    neuik_TextHistory_Clear(te->history);
+
+    /*------------------------------------------------------------------------*/
+    /* Count the lines of larger files in the background; the remaining text  */
+    /* is loaded as it is scrolled into view.                                 */
+    /*------------------------------------------------------------------------*/
+    if (fl->length > TEXTEDIT_LOAD_CHUNK)
+    {
+        fl->countThread = SDL_CreateThread(
+            neuik_TextEdit_CountFileLines, "neuik_TextEdit_CountLines", fl);
+    }
+
+    if (neuik_TextEdit_LoadThroughLine(te, 0))
+    {
+        eNum = 6;
+        goto out;
+    }
+
+    te->cursorLine         = 0;
+    te->cursorPos          = 0;
+    te->vertMovePos        = UNDEFINED;
+    te->vertPanLn          = 0;
+    te->vertPanPx          = 0;
+    te->panX               = 0;
+    te->panCursor          = 0;
+    te->highlightIsSet     = FALSE;
+    te->highlightBeginPos  = 0;
+    te->highlightBeginLine = 0;
+    te->highlightStartPos  = 0;
+    te->highlightStartLine = 0;
+    te->highlightEndPos    = 0;
+    te->highlightEndLine   = 0;
+    te->clickOrigin        = 0;
+    te->clickHeld          = FALSE;
+
+    if (neuik_Element_GetSizeAndLocation(te, &rSize, &rLoc))
+    {
+        eNum = 7;
+        goto out;
+    }
+    neuik_Element_RequestRedraw(te, rLoc, rSize);
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Get the height of a line (or row) of text within a TextEdit; zero if the   */
+/* font is not available.                                                     */
+/*----------------------------------------------------------------------------*/
+static float neuik_TextEdit_GetLineHeight(
+    NEUIK_TextEdit * te)
+{
+    TTF_Font             * font = NULL;
+    NEUIK_TextEditConfig * aCfg = NULL; /* the active textEdit config */
+
+    aCfg = te->cfgPtr;
+    if (aCfg == NULL) aCfg = te->cfg;  /* Fallback to internal config */
+
+    if (aCfg->fontMono)
+    {
+        font = NEUIK_FontSet_GetFont(aCfg->fontSetMS, aCfg->fontSize,
+            aCfg->fontBold, aCfg->fontItalic);
+    }
+    else
+    {
+        font = NEUIK_FontSet_GetFont(aCfg->fontSet, aCfg->fontSize,
+            aCfg->fontBold, aCfg->fontItalic);
+    }
+    if (font == NULL) return 0;
+
+    return 1.1*(float)(TTF_FontHeight(font));
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Get the number of complete lines of text which fit within the current view */
+/* of a TextEdit (zero if it has not yet been sized).                         */
+/*----------------------------------------------------------------------------*/
+static size_t neuik_TextEdit_GetViewLineCount(
+    NEUIK_TextEdit    * te,
+    NEUIK_ElementBase * eBase)
+{
+    size_t nView  = 0;
+    float  blankH = 0;
+
+    blankH = neuik_TextEdit_GetLineHeight(te);
+    if (blankH > 0 && eBase->eSt.rSize.h > 2)
+    {
+        nView = (size_t)((float)(eBase->eSt.rSize.h - 2)/blankH);
+    }
+    return nView;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Scroll the view of a TextEdit (if needed) so that a line is visible; a     */
+/* line which is out of view is brought to the middle of the view.            */
+/*----------------------------------------------------------------------------*/
+static void neuik_TextEdit_ShowLine(
+    NEUIK_TextEdit    * te,
+    NEUIK_ElementBase * eBase,
+    size_t              lineNo)
+{
+    size_t nView   = 0;
+    size_t lineRow = 0; /* visual row (word wrap) */
+    size_t viewRow = 0;
+
+    nView = neuik_TextEdit_GetViewLineCount(te, eBase);
+    if (te->wrapCache != NULL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* With word wrap, a line may occupy several rows of the view.        */
+        /*--------------------------------------------------------------------*/
+        lineRow = neuik_TextEdit_GetWrapRowOfLine(te, lineNo);
+        viewRow = neuik_TextEdit_GetWrapRowOfLine(te, te->vertPanLn);
+        if (lineRow < viewRow || lineRow >= viewRow + nView)
+        {
+            neuik_TextEdit_SetWrapTopRow(te, 
+                (lineRow > nView/2) ? lineRow - nView/2 : 0);
+        }
+    }
+    else if (lineNo < te->vertPanLn || lineNo >= te->vertPanLn + nView)
+    {
+        te->vertPanLn = lineNo;
+        te->vertPanPx = 0;
+        if (te->vertPanLn > nView/2)
+        {
+            te->vertPanLn -= nView/2;
+        }
+        else
+        {
+            te->vertPanLn = 0;
+        }
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Get the vertical position (relative to the top of the TextEdit) at which a */
+/* line in view (lineNo >= vertPanLn) is drawn.                               */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_GetLineY(
+    NEUIK_TextEdit * te,
+    float            blankH,
+    size_t           lineNo)
+{
+    size_t rowsAbove; /* rows between the top of the view and the line */
+
+    rowsAbove = lineNo - te->vertPanLn;
+    if (te->wrapCache != NULL)
+    {
+        rowsAbove = neuik_TextEdit_GetWrapRowOfLine(te, lineNo) - 
+            neuik_TextEdit_GetWrapRowOfLine(te, te->vertPanLn);
+    }
+    return (int)(2.0 + (float)(rowsAbove)*blankH) - (int)(te->vertPanPx);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Get the lines to redraw for the dirty lines of a TextEdit and the band of  */
+/* the view (relative to its top) which they occupy. The lines on either side */
+/* are included since the cursor of a line can reach into the top pixel row   */
+/* of the line below it. Returns TRUE if any part of the band is in view.     */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_GetDirtyBand(
+    NEUIK_TextEdit * te,
+    float            blankH,
+    int              viewH,
+    size_t         * firstLn,
+    size_t         * lastLn,
+    int            * top,
+    int            * bot)
+{
+    *firstLn = te->dirtyFirstLn;
+    *lastLn  = te->dirtyLastLn + 1;
+    if (*firstLn > 0) (*firstLn)--;
+
+    if (*lastLn < te->vertPanLn) return FALSE;
+    if (*firstLn < te->vertPanLn) *firstLn = te->vertPanLn;
+
+    *top = neuik_TextEdit_GetLineY(te, blankH, *firstLn);
+    *bot = neuik_TextEdit_GetLineY(te, blankH, *lastLn + 1);
+    if (*top < 0)     *top = 0;
+    if (*bot > viewH) *bot = viewH;
+
+    return (*top < *bot);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEdit_RequestLineRedraw
+ *
+ *  Description:   Request that only the lines [firstLn, lastLn] of a TextEdit
+ *                 be redrawn (e.g., the line being typed into, or the lines
+ *                 the cursor moved between). The view, the number of lines,
+ *                 and the text of the other lines must be unchanged. Requests
+ *                 made before the next redraw are merged; if a full redraw 
+ *                 has been requested in the meantime, it takes precedence.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextEdit_RequestLineRedraw(
+    NEUIK_TextEdit * te,
+    size_t           firstLn,
+    size_t           lastLn)
+{
+    int                 eNum       = 0; /* which error to report (if any) */
+    int                 top        = 0;
+    int                 bot        = 0;
+    float               blankH     = 0;
+    size_t              drawFirst  = 0;
+    size_t              drawLast   = 0;
+    size_t              swapLn     = 0;
+    RenderLoc           rLoc;
+    RenderSize          rSize;
+    NEUIK_ElementBase * eBase      = NULL;
+    static char         funcName[] = "neuik_TextEdit_RequestLineRedraw";
+    static char       * errMsgs[]  = {"", // [0] no error
+        "Argument `te` is not of TextEdit class.",                     // [1]
+        "Argument `te` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Failure in function `neuik_Element_RequestRedraw`.",          // [3]
+    };
+
+    if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(te, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    rLoc  = eBase->eSt.rLoc;
+    rSize = eBase->eSt.rSize;
+
+    /*------------------------------------------------------------------------*/
+    /* A full redraw is already pending; it will include these lines.         */
+    /*------------------------------------------------------------------------*/
+    if (eBase->eSt.doRedraw && !te->dirtyLines) goto out;
+
+    if (firstLn > lastLn)
+    {
+        swapLn  = firstLn;
+        firstLn = lastLn;
+        lastLn  = swapLn;
+    }
+    if (te->dirtyLines)
+    {
+        if (te->dirtyFirstLn < firstLn) firstLn = te->dirtyFirstLn;
+        if (te->dirtyLastLn  > lastLn)  lastLn  = te->dirtyLastLn;
+    }
+
+    blankH = neuik_TextEdit_GetLineHeight(te);
+    if (blankH <= 0 || rSize.h <= 0)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The TextEdit has not yet been drawn; redraw all of it.             */
+        /*--------------------------------------------------------------------*/
+        te->dirtyLines = FALSE;
+        if (neuik_Element_RequestRedraw(te, rLoc, rSize))
+        {
+            eNum = 3;
+        }
+        goto out;
+    }
+
+    te->dirtyFirstLn = firstLn;
+    te->dirtyLastLn  = lastLn;
+    if (!neuik_TextEdit_GetDirtyBand(te, blankH, rSize.h, 
+        &drawFirst, &drawLast, &top, &bot))
+    {
+        /*--------------------------------------------------------------------*/
+        /* None of these lines are in view; there is nothing to redraw.       */
+        /*--------------------------------------------------------------------*/
+        goto out;
+    }
+    te->dirtyLines = TRUE;
+
+    rLoc.y += top;
+    rSize.h = bot - top;
+    if (neuik_Element_RequestRedraw(te, rLoc, rSize))
+    {
+        eNum = 3;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Request the redraw of a TextEdit whose view was scrolled down by whole     */
+/* lines (since the last frame) and whose lines from `firstLn` onward changed.*/
+/* The lines which stay in view are copied from the last frame when drawn, so */
+/* only the newly exposed (and changed) lines are rendered. Falls back to a   */
+/* full redraw if the view can't be shifted this way.                         */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_RequestScrollRedraw(
+    NEUIK_TextEdit    * te,
+    NEUIK_ElementBase * eBase,
+    size_t              firstLn)
+{
+    size_t nView  = 0;
+    size_t nKept  = 0;
+    size_t nShift = 0;
+
+    /*------------------------------------------------------------------------*/
+    /* A full redraw is already pending; it will include these lines.         */
+    /*------------------------------------------------------------------------*/
+    if (eBase->eSt.doRedraw && !te->dirtyLines) return 0;
+
+    if (!te->frameAligned || te->vertPanPx != 0 || te->wrapCache != NULL ||
+        te->vertPanLn < te->framePanLn)
+    {
+        te->dirtyLines  = FALSE;
+        te->dirtyScroll = FALSE;
+        return neuik_Element_RequestRedraw(te, 
+            eBase->eSt.rLoc, eBase->eSt.rSize);
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Lines are only kept if they were complete within the last frame (with  */
+    /* a line to spare for a partially visible final line).                   */
+    /*------------------------------------------------------------------------*/
+    nShift = (size_t)(te->vertPanLn - te->framePanLn);
+    nView  = neuik_TextEdit_GetViewLineCount(te, eBase);
+    if (nView > nShift + 1)
+    {
+        nKept = nView - nShift - 1;
+    }
+    if (te->vertPanLn + nKept < firstLn)
+    {
+        firstLn = te->vertPanLn + nKept;
+    }
+
+    if (nShift > 0) te->dirtyScroll = TRUE;
+    if (neuik_TextEdit_RequestLineRedraw(te, firstLn, 
+        te->textBlk->nLines - 1))
+    {
+        return 1;
+    }
+    if (!te->dirtyLines && !eBase->eSt.doRedraw)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Nothing was requested (the TextEdit has not been drawn yet).       */
+        /*--------------------------------------------------------------------*/
+        te->dirtyScroll = FALSE;
+        return neuik_Element_RequestRedraw(te, 
+            eBase->eSt.rLoc, eBase->eSt.rSize);
+    }
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_TextEdit_AppendText
+ *
+ *  Description:   Append text to the end of a NEUIK_TextEdit. The text is
+ *                 written directly into the final data block of the TextBlock
+ *                 so that the cost does not depend on the amount of text that
+ *                 is already present (e.g., when used as a log viewer).
+ *
+ *                 If a maximum line count is set (`MaxLines=N`), the oldest 
+ *                 lines are dropped (a data block at a time). If `AutoScroll`
+ *                 is set and the final line was in view, the view follows the
+ *                 newly appended text.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_TextEdit_AppendText(
+    NEUIK_TextEdit * te,
+    const char     * text)
+{
+    int                    eNum       = 0; /* which error to report (if any) */
+    int                    atEnd      = FALSE;
+    int                    fullRedraw = FALSE;
+    size_t                 nDropped   = 0;
+    size_t                 nView      = 0;
+    size_t                 nLines     = 0;
+    size_t                 lastLn     = 0; /* final line prior to the append */
+    NEUIK_ElementBase    * eBase      = NULL;
+    static char            funcName[] = "NEUIK_TextEdit_AppendText";
+    static char          * errMsgs[]  = {"", // [0] no error
+        "Argument `te` is not of TextEdit class.",                     // [1]
+        "Argument `text` is NULL.",                                    // [2]
+        "Argument `te` caused `neuik_Object_GetClassObject` to fail.", // [3]
+        "Failure in function `neuik_TextEdit_LoadThroughLine`.",       // [4]
+        "Failure in function `neuik_TextBlock_AppendText`.",           // [5]
+        "Failure in function `neuik_TextBlock_DropLeadingBlocks`.",    // [6]
+        "Failure in function `neuik_Element_RequestRedraw`.",          // [7]
+    };
+
+    if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (text == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(te, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Text can only be appended once a file being loaded is fully resident.  */
+    /*------------------------------------------------------------------------*/
+    if (neuik_TextEdit_LoadAll(te))
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    nView = neuik_TextEdit_GetViewLineCount(te, eBase);
+
+    /*------------------------------------------------------------------------*/
+    /* Only follow the appended text if the final line is currently in view.  */
+    /*------------------------------------------------------------------------*/
+    nLines = te->textBlk->nLines;
+    lastLn = (nLines > 0) ? nLines - 1 : 0;
+    if (te->autoScroll && te->vertPanLn + nView + 1 >= nLines)
+    {
+        atEnd = TRUE;
+    }
+
+    neuik_TextEdit_NoteWrapAppend(te);
+    if (neuik_TextBlock_AppendText(te->textBlk, text, strlen(text)))
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Drop the oldest lines if a maximum line count was specified.           */
+    /*------------------------------------------------------------------------*/
+    if (te->maxLines > 0 && te->textBlk->nLines > te->maxLines)
+    {
+        if (neuik_TextBlock_DropLeadingBlocks(
+            te->textBlk, te->maxLines, &nDropped))
+        {
+            eNum = 6;
+            goto out;
+        }
+    }
+
+    if (nDropped > 0)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Shift the cursor, highlight, and view to follow their lines.       */
+        /*--------------------------------------------------------------------*/
+        neuik_TextEdit_InvalidateWrap(te);
+        neuik_TextHistory_Clear(te->history);
+        if (te->cursorLine >= nDropped)
+        {
+            te->cursorLine -= nDropped;
+        }
+        else
+        {
+            te->cursorLine = 0;
+            te->cursorPos  = 0;
+        }
+
+        if (te->highlightIsSet)
+        {
+            if (te->highlightStartLine >= nDropped)
+            {
+                te->highlightBeginLine -= nDropped;
+                te->highlightStartLine -= nDropped;
+                te->highlightEndLine   -= nDropped;
+            }
+            else
+            {
+                te->highlightIsSet = FALSE;
+            }
+        }
+        te->clickHeld = FALSE;
+
+        if (te->vertPanLn >= nDropped)
+        {
+            te->vertPanLn -= nDropped;
+        }
+        else
+        {
+            te->vertPanLn = 0;
+            te->vertPanPx = 0;
+            fullRedraw    = TRUE;
+        }
+
+        /*--------------------------------------------------------------------*/
+        /* The lines of the last frame (and of any pending line redraw) are   */
+        /* now numbered differently.                                          */
+        /*--------------------------------------------------------------------*/
+        if (te->framePanLn >= nDropped)
+        {
+            te->framePanLn -= nDropped;
+        }
+        else
+        {
+            te->frameAligned = FALSE;
+        }
+        if (te->dirtyLines) fullRedraw = TRUE;
+        lastLn = (lastLn >= nDropped) ? lastLn - nDropped : 0;
+    }
+
+    if (atEnd)
+    {
+        nLines = te->textBlk->nLines;
+        te->vertPanLn = 0;
+        te->vertPanPx = 0;
+        if (nLines > nView)
+        {
+            te->vertPanLn = nLines - nView;
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Only the lines from the previous final line onward have changed; if    */
+    /* the view followed them, the lines which stay in view are shifted       */
+    /* rather than drawn again. Requests are merged until the next frame, so  */
+    /* a burst of appends between two frames results in a single redraw.      */
+    /*------------------------------------------------------------------------*/
+    if (fullRedraw || te->wrapCache != NULL)
+    {
+        if (!eBase->eSt.doRedraw || te->dirtyLines)
+        {
+            te->dirtyLines  = FALSE;
+            te->dirtyScroll = FALSE;
+            if (neuik_Element_RequestRedraw(te, 
+                eBase->eSt.rLoc, eBase->eSt.rSize))
+            {
+                eNum = 7;
+                goto out;
+            }
+        }
+    }
+    else if (neuik_TextEdit_RequestScrollRedraw(te, eBase, lastLn))
+    {
+        eNum = 7;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_TextEdit_Find
+ *
+ *  Description:   Set the search pattern of a NEUIK_TextEdit. All occurrences
+ *                 of the pattern are highlighted and the number of matches is
+ *                 reported. If `starts` (or `ends`) is not NULL, it is set to
+ *                 an array holding the line number and line position of the
+ *                 start (or end) of each match as pairs, i.e., `2*nMatches`
+ *                 values ordered by position, which must be freed by the 
+ *                 caller. A NULL or empty pattern clears the search.
+ *
+ *                 Matches are confined to a single line; the pattern may not 
+ *                 contain a line ending.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_TextEdit_Find(
+    NEUIK_TextEdit * te,
+    const char     * pattern,
+    size_t        ** starts,
+    size_t        ** ends,
+    size_t         * nMatches)
+{
+    int                    eNum       = 0; /* which error to report (if any) */
+    size_t                 ctr        = 0;
+    size_t                 nFound     = 0;
+    size_t               * startVals  = NULL;
+    size_t               * endVals    = NULL;
+    neuik_TextBlockRange * found      = NULL;
+    NEUIK_ElementBase    * eBase      = NULL;
+    static char            funcName[] = "NEUIK_TextEdit_Find";
+    static char          * errMsgs[]  = {"", // [0] no error
+        "Argument `te` is not of TextEdit class.",                     // [1]
+        "Argument `te` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Argument `pattern` contains a line ending.",                  // [3]
+        "Failure in function `neuik_TextEdit_LoadThroughLine`.",       // [4]
+        "Failure in function `neuik_TextBlock_FindAll`.",              // [5]
+        "Failure in function `String_Duplicate`.",                     // [6]
+        "Failure to allocate memory.",                                 // [7]
+    };
+
+    if (starts   != NULL) *starts   = NULL;
+    if (ends     != NULL) *ends     = NULL;
+    if (nMatches != NULL) *nMatches = 0;
+
+    if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(te, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    if (te->findPattern != NULL)
+    {
+        free(te->findPattern);
+        te->findPattern = NULL;
+    }
+
+    if (pattern != NULL && pattern[0] != '\0')
+    {
+        if (strpbrk(pattern, "\r\n") != NULL)
+        {
+            eNum = 3;
+            goto out;
+        }
+
+        /*--------------------------------------------------------------------*/
+        /* The whole of a file being loaded must be resident to be searched.  */
+        /*--------------------------------------------------------------------*/
+        if (neuik_TextEdit_LoadAll(te))
+        {
+            eNum = 4;
+            goto out;
+        }
+        if (neuik_TextBlock_FindAll(te->textBlk, pattern, &found, &nFound))
+        {
+            eNum = 5;
+            goto out;
+        }
+        String_Duplicate(&te->findPattern, pattern);
+        if (te->findPattern == NULL)
+        {
+            eNum = 6;
+            goto out;
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Report the match locations as (line number, line position) pairs.      */
+    /*------------------------------------------------------------------------*/
+    if (nFound > 0 && (starts != NULL || ends != NULL))
+    {
+        if (starts != NULL)
+        {
+            startVals = (size_t*)malloc(2*nFound*sizeof(size_t));
+        }
+        if (ends != NULL)
+        {
+            endVals = (size_t*)malloc(2*nFound*sizeof(size_t));
+        }
+        if ((starts != NULL && startVals == NULL) ||
+            (ends   != NULL && endVals   == NULL))
+        {
+            eNum = 7;
+            goto out;
+        }
+        for (ctr = 0; ctr < nFound; ctr++)
+        {
+            if (startVals != NULL)
+            {
+                startVals[2*ctr]     = found[ctr].startLineNo;
+                startVals[2*ctr + 1] = found[ctr].startLinePos;
+            }
+            if (endVals != NULL)
+            {
+                endVals[2*ctr]     = found[ctr].endLineNo;
+                endVals[2*ctr + 1] = found[ctr].endLinePos;
+            }
+        }
+    }
+
+    if (nMatches != NULL) *nMatches = nFound;
+    if (starts != NULL)
+    {
+        *starts   = startVals;
+        startVals = NULL;
+    }
+    if (ends != NULL)
+    {
+        *ends   = endVals;
+        endVals = NULL;
+    }
+    neuik_Element_RequestRedraw(te, eBase->eSt.rLoc, eBase->eSt.rSize);
+out:
+    if (found     != NULL) free(found);
+    if (startVals != NULL) free(startVals);
+    if (endVals   != NULL) free(endVals);
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_TextEdit_FindNext
+ *
+ *  Description:   Select the next occurrence (after the cursor) of the pattern
+ *                 set by `NEUIK_TextEdit_Find`, wrapping around to the start 
+ *                 of the text if needed, and scroll it into view.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_TextEdit_FindNext(
+    NEUIK_TextEdit * te,
+    int            * found)
+{
+    int                    eNum       = 0; /* which error to report (if any) */
+    int                    isFound    = FALSE;
+    neuik_TextBlockRange   match;
+    NEUIK_ElementBase    * eBase      = NULL;
+    static char            funcName[] = "NEUIK_TextEdit_FindNext";
+    static char          * errMsgs[]  = {"", // [0] no error
+        "Argument `te` is not of TextEdit class.",                     // [1]
+        "Argument `te` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "No search pattern has been set (see NEUIK_TextEdit_Find).",   // [3]
+        "Failure in function `neuik_TextBlock_FindNext`.",             // [4]
+    };
+
+    if (found != NULL) *found = FALSE;
+
+    if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(te, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (te->findPattern == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    if (neuik_TextBlock_FindNext(te->textBlk, te->findPattern, 
+        te->cursorLine, te->cursorPos, &isFound, &match))
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (!isFound && (te->cursorLine > 0 || te->cursorPos > 0))
+    {
+        /*--------------------------------------------------------------------*/
+        /* Wrap around to the start of the text.                              */
+        /*--------------------------------------------------------------------*/
+        if (neuik_TextBlock_FindNext(te->textBlk, te->findPattern, 
+            0, 0, &isFound, &match))
+        {
+            eNum = 4;
+            goto out;
+        }
+    }
+    if (!isFound) goto out;
+
+    /*------------------------------------------------------------------------*/
+    /* Select the match and leave the cursor at the end of it.                */
+    /*------------------------------------------------------------------------*/
+    te->highlightIsSet     = TRUE;
+    te->highlightBeginLine = match.startLineNo;
+    te->highlightBeginPos  = match.startLinePos;
+    te->highlightStartLine = match.startLineNo;
+    te->highlightStartPos  = match.startLinePos;
+    te->highlightEndLine   = match.endLineNo;
+    te->highlightEndPos    = match.endLinePos;
+    te->cursorLine         = match.endLineNo;
+    te->cursorPos          = match.endLinePos;
+    te->vertMovePos        = -1;
+    te->clickHeld          = FALSE;
+
+    /*------------------------------------------------------------------------*/
+    /* Scroll the view (if needed) so that the line of the match is visible.  */
+    /*------------------------------------------------------------------------*/
+    neuik_TextEdit_ShowLine(te, eBase, match.startLineNo);
+
+    if (found != NULL) *found = TRUE;
+    neuik_Element_RequestRedraw(te, eBase->eSt.rLoc, eBase->eSt.rSize);
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_TextEdit_ReplaceAll
+ *
+ *  Description:   Replace every occurrence of a pattern within a 
+ *                 NEUIK_TextEdit with the replacement text. The text is 
+ *                 rebuilt in a single pass over the TextBlock. Any selection
+ *                 is cleared and the cursor is kept within the new text.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_TextEdit_ReplaceAll(
+    NEUIK_TextEdit * te,
+    const char     * pattern,
+    const char     * replacement,
+    size_t         * nReplaced)
+{
+    int                    eNum       = 0; /* which error to report (if any) */
+    size_t                 nRepl      = 0;
+    size_t                 nLines     = 0;
+    size_t                 lineLen    = 0;
+    NEUIK_ElementBase    * eBase      = NULL;
+    static char            funcName[] = "NEUIK_TextEdit_ReplaceAll";
+    static char          * errMsgs[]  = {"", // [0] no error
+        "Argument `te` is not of TextEdit class.",                     // [1]
+        "Argument `te` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Failure in function `neuik_TextEdit_LoadThroughLine`.",       // [3]
+        "Failure in function `neuik_TextBlock_ReplaceAll`.",           // [4]
+        "Failure in function `neuik_TextBlock_GetLineLength`.",        // [5]
+    };
+
+    if (nReplaced != NULL) *nReplaced = 0;
+
+    if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(te, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    if (neuik_TextEdit_LoadAll(te))
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (neuik_TextBlock_ReplaceAll(te->textBlk, pattern, replacement, &nRepl))
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (nReplaced != NULL) *nReplaced = nRepl;
+    if (nRepl == 0) goto out;
+    neuik_TextEdit_InvalidateWrap(te);
+    neuik_TextHistory_Clear(te->history);
+
+    /*------------------------------------------------------------------------*/
+    /* Keep the cursor and view within the (possibly shorter) new text.       */
+    /*------------------------------------------------------------------------*/
+    te->highlightIsSet = FALSE;
+    te->clickHeld      = FALSE;
+    te->vertMovePos    = -1;
+
+    nLines = te->textBlk->nLines;
+    if (te->cursorLine >= nLines)
+    {
+        te->cursorLine = nLines - 1;
+    }
+    if (neuik_TextBlock_GetLineLength(te->textBlk, te->cursorLine, &lineLen))
+    {
+        eNum = 5;
+        goto out;
+    }
+    if (te->cursorPos > lineLen)
+    {
+        te->cursorPos = lineLen;
+    }
+    if (te->vertPanLn >= nLines)
+    {
+        te->vertPanLn = nLines - 1;
+        te->vertPanPx = 0;
+    }
+
+    neuik_Element_RequestRedraw(te, eBase->eSt.rLoc, eBase->eSt.rSize);
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Undo (or redo) the next group of edits within the history of a TextEdit    */
+/* and move the cursor (and if needed, the view) to where they took place.    */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_StepHistory(
+    NEUIK_TextEdit * te,
+    int              redo,
+    int            * done)
+{
+    int                 eNum       = 0; /* which error to report (if any) */
+    int                 wasDone    = FALSE;
+    size_t              nLinesOld  = 0;
+    size_t              oldCursorLn;
+    size_t              oldCursorPos;
+    NEUIK_ElementBase * eBase      = NULL;
+    static char         funcName[] = "neuik_TextEdit_StepHistory";
+    static char       * errMsgs[]  = {"", // [0] no error
+        "Argument `te` is not of TextEdit class.",                     // [1]
+        "Argument `te` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Failure in function `neuik_TextHistory_Undo`.",               // [3]
+        "Failure in function `neuik_TextHistory_Redo`.",               // [4]
+    };
+
+    if (done != NULL) *done = FALSE;
+
+    if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Object_GetClassObject(te, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    nLinesOld    = te->textBlk->nLines;
+    oldCursorLn  = te->cursorLine;
+    oldCursorPos = te->cursorPos;
+    if (redo)
+    {
+        if (neuik_TextHistory_Redo(te->history, te->textBlk, &wasDone,
+            &te->cursorLine, &te->cursorPos))
+        {
+            eNum = 4;
+            goto out;
+        }
+    }
+    else if (neuik_TextHistory_Undo(te->history, te->textBlk, &wasDone,
+        &te->cursorLine, &te->cursorPos))
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (done != NULL) *done = wasDone;
+    if (!wasDone) goto out;
+
+    /*------------------------------------------------------------------------*/
+    /* A group of edits may add or remove lines at more than one location.    */
+    /*------------------------------------------------------------------------*/
+    if (te->textBlk->nLines != nLinesOld)
+    {
+        neuik_TextEdit_InvalidateWrap(te);
+    }
+
+    te->highlightIsSet = FALSE;
+    te->clickHeld      = FALSE;
+    te->vertMovePos    = -1;
+    neuik_TextEdit_ShowLine(te, eBase, te->cursorLine);
+
+    if (te->cursorLine != oldCursorLn || te->cursorPos != oldCursorPos)
+    {
+        neuik_Element_TriggerCallback(te, NEUIK_CALLBACK_ON_CURSOR_MOVED);
+    }
+    neuik_Element_RequestRedraw(te, eBase->eSt.rLoc, eBase->eSt.rSize);
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_TextEdit_Undo
+ *
+ *  Description:   Undo the most recent edit of a NEUIK_TextEdit. A run of 
+ *                 typing (or of erasing) is undone as a single edit. If `done`
+ *                 is not NULL, it is set to FALSE when there was nothing to 
+ *                 undo.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_TextEdit_Undo(
+    NEUIK_TextEdit * te,
+    int            * done)
+{
+    return neuik_TextEdit_StepHistory(te, FALSE, done);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_TextEdit_Redo
+ *
+ *  Description:   Redo the edit most recently undone with NEUIK_TextEdit_Undo.
+ *                 Any new edit discards the edits which could be redone. If 
+ *                 `done` is not NULL, it is set to FALSE when there was 
+ *                 nothing to redo.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_TextEdit_Redo(
+    NEUIK_TextEdit * te,
+    int            * done)
+{
+    return neuik_TextEdit_StepHistory(te, TRUE, done);
 }
 
 
@@ -618,6 +3238,7 @@ int NEUIK_TextEdit_GetText(
         "Failure in `neuik_TextBlock_GetLineCount()`.",  // [3]
         "Failure in `neuik_TextBlock_GetLineLength()`.", // [4]
         "Failure in `neuik_TextBlock_GetSection()`.",    // [5]
+        "Failure in `neuik_TextEdit_LoadThroughLine()`.", // [6]
     };
 
     if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
@@ -631,6 +3252,15 @@ int NEUIK_TextEdit_GetText(
         goto out;
     }
 
+    /*------------------------------------------------------------------------*/
+    /* If a file is still being loaded, the rest of it is needed now.         */
+    /*------------------------------------------------------------------------*/
+    if (neuik_TextEdit_LoadAll(te))
+    {
+        eNum = 6;
+        goto out;
+    }
+
     /*------------------------------------------------------------------------*/
     /* Get text contents from TextBlock.                                      */
     /*------------------------------------------------------------------------*/
@@ -787,6 +3417,7 @@ int NEUIK_TextEdit_Configure(
     int                    boolVal    = FALSE;
     int                    typeMixup  = FALSE;
     int                    fontSize;
+    int                    maxLines;
     va_list                args;
     RenderSize             rSize;
     RenderLoc              rLoc;
@@ -805,6 +3436,8 @@ int NEUIK_TextEdit_Configure(
         "FontBold",
         "FontItalic",
         "FontMono",
+        "AutoScroll",
+        "WordWrap",
         NULL,
     };
     /*------------------------------------------------------------------------*/
@@ -817,6 +3450,7 @@ int NEUIK_TextEdit_Configure(
         "FontColor",
         "FontSize",
         "FontColor",
+        "MaxLines",
         NULL,
     };
     static char            funcName[] = "NEUIK_TextEdit_Configure";
@@ -835,6 +3469,7 @@ int NEUIK_TextEdit_Configure(
         "FontColor value invalid; should be comma separated RGBA.", // [12]
         "FontColor value invalid; RGBA value range is 0-255.",      // [13]
         "FontSize value is invalid; must be int.",                  // [14]
+        "MaxLines value is invalid; must be a non-negative int.",   // [15]
     };
 
     if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
@@ -945,6 +3580,20 @@ int NEUIK_TextEdit_Configure(
                 aCfg->fontMono = boolVal;
                 doRedraw = 1;
             }
+            else if (!strcmp("AutoScroll", name))
+            {
+                te->autoScroll = boolVal;
+            }
+            else if (!strcmp("WordWrap", name))
+            {
+                if (aCfg->wordWrap != boolVal)
+                {
+                    aCfg->wordWrap = boolVal;
+                    te->vertPanPx  = 0;
+                    te->panCursor  = 0;
+                    doRedraw = 1;
+                }
+            }
             else 
             {
                 /*------------------------------------------------------------*/
@@ -1090,6 +3739,25 @@ int NEUIK_TextEdit_Configure(
                 aCfg->fontSize = fontSize;
                 doRedraw = 1;
             }
+            else if (!strcmp("MaxLines", name))
+            {
+                ns = sscanf(value, "%d", &maxLines);
+                /*------------------------------------------------------------*/
+                /* Check for EOF, incorrect # of values, & out of range vals. */
+                /*------------------------------------------------------------*/
+            #ifndef WIN32
+                if (ns == EOF || ns < 1 || maxLines < 0)
+            #else
+                if (ns < 1 || maxLines < 0)
+            #endif /* WIN32 */
+                {
+                    NEUIK_RaiseError(funcName, errMsgs[15]);
+                }
+                else
+                {
+                    te->maxLines = (size_t)(maxLines);
+                }
+            }
             else
             {
                 typeMixup = FALSE;
@@ -1146,6 +3814,126 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* Crop a rect vertically to the text area of a TextEdit (rows [top, bot)).  */
+/* If `srcY` is non-NULL it is set to the number of rows cropped from the    */
+/* top. Returns TRUE if any part of the rect remains visible.                 */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_ClipRowsToView(
+    SDL_Rect * rect,
+    int        top,
+    int        bot,
+    int      * srcY)
+{
+    int cropTop = 0;
+
+    if (rect->y < top)
+    {
+        cropTop  = top - rect->y;
+        rect->y  = top;
+        rect->h -= cropTop;
+    }
+    if (rect->y + rect->h > bot)
+    {
+        rect->h = bot - rect->y;
+    }
+    if (srcY != NULL) *srcY = cropTop;
+
+    return (rect->h > 0);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Check that nothing outside of the band [top, bot) of a TextEdit is to be   */
+/* redrawn (i.e., the rows outside of the band are fully masked).             */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_IsMaskedOutsideBand(
+    neuik_MaskMap * maskMap,
+    int             h,
+    int             top,
+    int             bot)
+{
+    int         y;
+    int         nRegions;
+    const int * regionX0;
+    const int * regionXf;
+
+    for (y = 0; y < h; y++)
+    {
+        if (y == top)
+        {
+            y = bot - 1;
+            continue;
+        }
+        if (neuik_MaskMap_GetUnmaskedRegionsOnHLine(
+            maskMap, y, &nRegions, &regionX0, &regionXf))
+        {
+            return FALSE;
+        }
+        if (nRegions > 0) return FALSE;
+    }
+    return TRUE;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Check whether the view of a TextEdit scrolled since the last frame can be  */
+/* shifted by copying lines from that frame; this needs whole line panning,   */
+/* no word wrap, and drawing directly onto the frame of the window.           */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_CanShiftView(
+    NEUIK_TextEdit * te,
+    SDL_Renderer   * rend,
+    NEUIK_Window   * win)
+{
+    if (win == NULL || win->lastFrame == NULL) return FALSE;
+    if ((SDL_Renderer*)(win->rend) != rend)    return FALSE;
+    if (te->wrapCache != NULL)                 return FALSE;
+
+    return (te->frameAligned && te->vertPanPx == 0 &&
+        te->vertPanLn > te->framePanLn);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Copy the lines in view which precede `firstLn` from their positions within */
+/* the last frame of the window (the view having since scrolled down).        */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_ShiftView(
+    NEUIK_TextEdit * te,
+    NEUIK_Window   * win,
+    RenderLoc        rl,
+    int              w,
+    float            blankH,
+    size_t           firstLn)
+{
+    size_t   row;
+    size_t   nShift;
+    SDL_Rect srcRect;
+    SDL_Rect dstRect;
+
+    nShift = (size_t)(te->vertPanLn - te->framePanLn);
+    for (row = 0; te->vertPanLn + row < firstLn; row++)
+    {
+        dstRect.x = rl.x;
+        dstRect.w = w;
+        dstRect.y = rl.y + (int)(2.0 + (float)(row)*blankH);
+        dstRect.h = rl.y + (int)(2.0 + (float)(row + 1)*blankH) - dstRect.y;
+
+        srcRect   = dstRect;
+        srcRect.y = rl.y + (int)(2.0 + (float)(row + nShift)*blankH);
+        if (SDL_RenderCopy((SDL_Renderer*)(win->rend), 
+            (SDL_Texture*)(win->lastFrame), &srcRect, &dstRect))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_Element_Render__TextEdit
@@ -1166,7 +3954,6 @@ int neuik_Element_Render__TextEdit(
     SDL_Renderer  * xRend, /* the external renderer to prepare the texture for */
     int             mock)  /* If true; calculate sizes/locations but don't draw */
 {
-    char                   tempChar;          /* a temporary character */
     float                  yPos        = 0;
     float                  blankH      = 0;
     int                    blankW      = 0;
@@ -1183,16 +3970,44 @@ int neuik_Element_Render__TextEdit(
     int                    scrollX     = 0;
     int                    scrollY     = 0;
     int                    scrollDrawn = FALSE;
-    int                    partialDraw = FALSE;
+    int                    dirtyOnly   = FALSE; /* only redraw dirty lines */
+    int                    rowsChanged = FALSE; /* a dirty line was rewrapped */
+    int                    dirtyTop    = 0;     /* band of the dirty lines */
+    int                    dirtyBot    = 0;
     int                    borderX     = 0;
-    size_t                 lineLen;
+    int                    lineY       = 0;    /* top of the current line */
+    int                    rowY        = 0;    /* top of the current row */
+    int                    wrapW       = 0;    /* word wrap width */
+    int                    hlLine      = FALSE; /* line is (partly) selected */
+    int                    hlToEnd     = FALSE; /* selection passes line end */
+    int                    clipTop     = 0;    /* top of the text area */
+    int                    clipBot     = 0;    /* bottom of the text area */
+    size_t                 findLen     = 0;    /* length of the search pattern */
+    size_t                 lineLen     = 0;
     size_t                 lineCtr;
     size_t                 nLines;
+    size_t                 nRows       = 1;    /* rows of the current line */
+    size_t                 rowsAbove   = 0;    /* rows above the current line */
+    size_t                 prevRows    = 0;    /* rows of the line when last drawn */
+    size_t                 dirtyFirst  = 0;    /* dirty lines to redraw */
+    size_t                 dirtyLast   = 0;
+    size_t                 rowCtr;
+    size_t                 segStart    = 0;    /* first byte of the row */
+    size_t                 segEnd      = 0;    /* end of the row (exclusive) */
+    size_t                 selStart    = 0;    /* selection within the line */
+    size_t                 selEnd      = 0;
+    size_t                 hlStart     = 0;    /* selection within the row */
+    size_t                 hlEnd       = 0;
+    const size_t         * rowStart    = NULL; /* offsets of the rows */
+    double                 topRow      = 0.0;
     double                 scrollFrac  = 0.0;
     double                 scrollPct   = 0.0;
     double                 viewFrac    = 0.0;
     double                 viewPct     = 0.0;
     char                 * lineBytes   = NULL;
+    char                 * matchPtr    = NULL; /* search match within a line */
+    char                 * rowBytes    = NULL; /* start of the current row */
+    char                   rowEndChar;
     RenderLoc              rl;
     SDL_Rect               srcRect;
     SDL_Rect               rect;
@@ -1201,12 +4016,14 @@ int neuik_Element_Render__TextEdit(
     const NEUIK_Color    * bgClr       = NULL;
     const NEUIK_Color    * bClr        = NULL; /* border color */
     SDL_Renderer         * rend        = NULL;
-    SDL_Texture          * tTex        = NULL; /* text texture */
+    SDL_Texture          * tTex        = NULL; /* text texture (cache owned) */
     TTF_Font             * font        = NULL;
     NEUIK_ElementBase    * eBase       = NULL;
     neuik_MaskMap        * maskMap     = NULL;
     NEUIK_TextEdit       * te          = NULL;
     NEUIK_TextEditConfig * aCfg        = NULL; /* the active textEntry config */
+    neuik_TextLayout     * layout      = NULL; /* layout of the current line */
+    int                    rowX        = 0;    /* offset of the row in the line */
     static char            funcName[]  = "neuik_Element_Render__TextEdit";
     static char          * errMsgs[]   = {"", // [0] no error
         "Argument `elem` is not of TextEdit class.",                     // [1]
@@ -1217,9 +4034,18 @@ int neuik_Element_Render__TextEdit(
         "FontSet_GetFont returned NULL.",                                // [6]
         "", // [7]
         "Failure in function `neuik_TextBlock_GetLineCount`.",           // [8]
-        "Failure in function `neuik_TextBlock_GetLine`.",                // [9]
+        "Failure in function `neuik_TextBlock_GetLineIntoBuffer`.",      // [9]
         "Failure in function `neuik_TextBlock_GetLineLength`.",          // [10]
         "Failure in neuik_Element_RedrawBackground().",                  // [11]
+        "Failure in function `neuik_TextEdit_LoadThroughLine`.",        // [12]
+        "Failure in function `neuik_TextEdit_PrepareLineCache`.",       // [13]
+        "Failure in function `neuik_TextEdit_GetLineTexture`.",         // [14]
+        "Failure in function `neuik_TextEdit_PrepareWrapCache`.",       // [15]
+        "Failure in function `neuik_TextEdit_GetWrapBreaks`.",          // [16]
+        "Failure in `neuik_Window_FillTranspMaskFromLoc()`",             // [17]
+        "Failure in `neuik_MaskMap_UnmaskAll()`",                        // [18]
+        "Failure in `neuik_GetTextLayout()`",                            // [19]
+        "Failure in `SDL_RenderCopy()`",                                 // [20]
     };
 
     te = (NEUIK_TextEdit *)elem;
@@ -1313,6 +4139,52 @@ int neuik_Element_Render__TextEdit(
         goto out;
     }
 
+    /*------------------------------------------------------------------------*/
+    /* If only some lines have changed (e.g., typing or cursor movement), the */
+    /* rest of the TextEdit is kept from the previous frame. This is only     */
+    /* possible if nothing outside of the band of those lines is to be redrawn*/
+    /* (this also catches any full redraw requested in the meantime).         */
+    /*------------------------------------------------------------------------*/
+    if (te->dirtyLines && 
+        !neuik_Window_FullRedrawInProgress(eBase->eSt.window))
+    {
+        blankH = 1.1*(float)(TTF_FontHeight(font));
+        if (neuik_TextEdit_GetDirtyBand(te, blankH, rSize->h, 
+            &dirtyFirst, &dirtyLast, &dirtyTop, &dirtyBot))
+        {
+            if (neuik_Window_FillTranspMaskFromLoc(eBase->eSt.window, 
+                maskMap, eBase->eSt.rLoc.x, eBase->eSt.rLoc.y))
+            {
+                eNum = 17;
+                goto out;
+            }
+            dirtyOnly = neuik_TextEdit_IsMaskedOutsideBand(
+                maskMap, rSize->h, dirtyTop, dirtyBot);
+
+            /*----------------------------------------------------------------*/
+            /* If the view scrolled, the lines above the band move up by the  */
+            /* lines scrolled; copy them from the last frame.                 */
+            /*----------------------------------------------------------------*/
+            if (dirtyOnly && te->dirtyScroll)
+            {
+                dirtyOnly = neuik_TextEdit_CanShiftView(
+                    te, rend, (NEUIK_Window*)(eBase->eSt.window));
+                if (dirtyOnly && neuik_TextEdit_ShiftView(te, 
+                    (NEUIK_Window*)(eBase->eSt.window), eBase->eSt.rLoc, 
+                    rSize->w, blankH, dirtyFirst))
+                {
+                    eNum = 20;
+                    goto out;
+                }
+            }
+            if (!dirtyOnly && neuik_MaskMap_UnmaskAll(maskMap))
+            {
+                eNum = 18;
+                goto out;
+            }
+        }
+    }
+
     /*------------------------------------------------------------------------*/
     /* Mark off the rounded sections of the button within the MaskMap.        */
     /*------------------------------------------------------------------------*/
@@ -1345,6 +4217,16 @@ int neuik_Element_Render__TextEdit(
 
     rl = eBase->eSt.rLoc;
 
+    /*------------------------------------------------------------------------*/
+    /* If a file is being loaded, make sure the lines in view are resident.   */
+    /*------------------------------------------------------------------------*/
+    if (neuik_TextEdit_LoadThroughLine(te, 
+        te->vertPanLn + 2 + (size_t)(rSize->h/TTF_FontHeight(font))))
+    {
+        eNum = 12;
+        goto out;
+    }
+
     /*------------------------------------------------------------------------*/
     /* Redraw the contained text and highlighting (if present)                */
     /*------------------------------------------------------------------------*/
@@ -1376,19 +4258,65 @@ int neuik_Element_Render__TextEdit(
     /*------------------------------------------------------------------------*/
     if (!hasText) goto draw_border;
 
-    TTF_SizeText(font, " ", &textW, &textH);
+    TTF_SizeUTF8(font, " ", &textW, &textH);
     blankW = (int)(0.65*(float)(textW));
     blankH = 1.1*(float)(TTF_FontHeight(font));
 
+    /*------------------------------------------------------------------------*/
+    /* Make sure the line texture cache matches the current renderer/font/    */
+    /* color and is large enough to hold every line in view.                  */
+    /*------------------------------------------------------------------------*/
+    if (neuik_TextEdit_PrepareLineCache(te, rend, font, fgClr, 
+        2 + (size_t)((float)(rSize->h)/blankH)))
+    {
+        eNum = 13;
+        goto out;
+    }
+    clipTop = rl.y + 2;
+    clipBot = rl.y + rSize->h - 2;
+    if (te->findPattern != NULL)
+    {
+        findLen = strlen(te->findPattern);
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* When word wrap is enabled, lines which are too long for the view are   */
+    /* wrapped onto several rows (rather than being panned).                  */
+    /*------------------------------------------------------------------------*/
+    if (aCfg->wordWrap)
+    {
+        wrapW = rSize->w - 20;
+        if (neuik__HighDPI_Scaling > 1.0)
+        {
+            wrapW = rSize->w - (10 + (int)(10.0*neuik__HighDPI_Scaling));
+        }
+        if (neuik_TextEdit_PrepareWrapCache(te, font, wrapW, blankH, 
+            2 + (size_t)((float)(rSize->h)/blankH)))
+        {
+            eNum = 15;
+            goto out;
+        }
+    }
+    else if (te->wrapCache != NULL)
+    {
+        neuik_TextEdit_FreeWrapCache(te);
+    }
+
     /*------------------------------------------------------------------------*/
     /* There appears to be one or more lines of valid text in the Block.      */
     /* Place the lines one-at-a-time where they should go.                    */
     /*------------------------------------------------------------------------*/
-    yPos = 2.0;
     for (lineCtr = te->vertPanLn; lineCtr < nLines; lineCtr++)
     {
-        partialDraw = FALSE;
-        if ((int)(yPos) > rSize->h)
+        nRows = 1;
+
+        /*--------------------------------------------------------------------*/
+        /* The top of the line (the first line of a partially scrolled view   */
+        /* may start above the top of the text area).                         */
+        /*--------------------------------------------------------------------*/
+        yPos  = 2.0 + (float)(rowsAbove)*blankH;
+        lineY = rl.y + (int)(yPos) - (int)(te->vertPanPx);
+        if (lineY - rl.y > rSize->h)
         {
             /*----------------------------------------------------------------*/
             /* The next line of text exists at a position in excess of what   */
@@ -1396,251 +4324,229 @@ int neuik_Element_Render__TextEdit(
             /*----------------------------------------------------------------*/
             break;
         }
-        if (te->vertPanLn > 0 && lineCtr == te->vertPanLn)
+        if (dirtyOnly && (lineCtr < dirtyFirst || lineCtr > dirtyLast))
         {
             /*----------------------------------------------------------------*/
-            /* This line of text is the first line of text shown in a view    */
-            /* that is partially scrolled. The top of the line will need to   */
-            /* be cropped.                                                    */
+            /* This line is unchanged and is kept from the previous frame.    */
             /*----------------------------------------------------------------*/
-            partialDraw = TRUE;
+            if (lineCtr > dirtyLast) break;
+            rowsAbove += neuik_TextEdit_GetWrapRows(te, lineCtr);
+            continue;
         }
 
-        if (neuik_TextBlock_GetLine(te->textBlk, lineCtr, &lineBytes))
+        /*--------------------------------------------------------------------*/
+        /* Copy the line into the reusable line buffer; this avoids an        */
+        /* allocation for every visible line on every frame.                  */
+        /*--------------------------------------------------------------------*/
+        if (neuik_TextBlock_GetLineIntoBuffer(te->textBlk, lineCtr, 
+            &te->lineBuf, &te->lineBufSize, &lineLen))
         {
             eNum = 9;
             goto out;
         }
+        lineBytes = te->lineBuf;
 
         if (lineBytes[0] != '\0')
         {
-            /* Determine the full size of the rendered text content */
-            TTF_SizeText(font, lineBytes, &textW, &textH);
-            textWFull = textW;
-
             /*----------------------------------------------------------------*/
-            /* Create an SDL_Surface for the text within the element          */
+            /* Find the rows of the line (a single row unless word wrapped).  */
+            /* If a redrawn line now wraps differently, the lines beneath it  */
+            /* have moved.                                                    */
             /*----------------------------------------------------------------*/
-            textHFull = 1.1*(float)(textH);
-            te->textSurf = SDL_CreateRGBSurface(
-                0, textW+blankW, (int)(textHFull), 32, 0, 0, 0, 0);
-            if (te->textSurf == NULL)
+            prevRows = neuik_TextEdit_GetWrapRows(te, lineCtr);
+            if (neuik_TextEdit_GetWrapBreaks(te, lineCtr, lineBytes, 
+                &rowStart, &nRows))
             {
-                eNum = 8;
+                eNum = 16;
                 goto out;
             }
-
-            te->textRend = SDL_CreateSoftwareRenderer(te->textSurf);
-            if (te->textRend == NULL)
+            if (dirtyOnly && nRows != prevRows)
             {
-                eNum = 9;
-                goto out;
+                rowsChanged = TRUE;
             }
 
             /*----------------------------------------------------------------*/
-            /* Fill the background with it's color                            */
-            /*----------------------------------------------------------------*/
-            SDL_SetRenderDrawColor(
-                te->textRend, bgClr->r, bgClr->g, bgClr->b, 255);
-            SDL_RenderClear(te->textRend);
-
-            /*----------------------------------------------------------------*/
-            /* Render the Text now, it will be copied on after highlighting.  */
+            /* The offsets of the cursor, highlight and search matches are    */
+            /* looked up in the layout of the line.                           */
             /*----------------------------------------------------------------*/
-            tTex = NEUIK_RenderText(
-                lineBytes, font, *fgClr, te->textRend, &textW, &textH);
-            if (tTex == NULL)
+            if (neuik_GetTextLayout(font, lineBytes, lineLen, &layout))
             {
-                eNum = 6;
+                eNum = 19;
                 goto out;
             }
 
             /*----------------------------------------------------------------*/
-            /* Check for and fill in highlight text selection background.     */
+            /* Determine the portion of this line which is highlighted.       */
             /*----------------------------------------------------------------*/
-            if ( (eBase->eSt.hasFocus && te->highlightIsSet) &&
+            hlLine = (eBase->eSt.hasFocus && te->highlightIsSet) &&
                     (lineCtr >= te->highlightStartLine && 
-                     lineCtr <= te->highlightEndLine))
+                     lineCtr <= te->highlightEndLine);
+            selStart = 0;
+            selEnd   = lineLen;
+            if (lineCtr == te->highlightStartLine)
             {
-                rect.x = 0;
-                rect.y = 0;
-                rect.w = textW + 1;
-                rect.h = (int)(textHFull);
+                selStart = te->highlightStartPos;
+            }
+            if (lineCtr == te->highlightEndLine)
+            {
+                selEnd = te->highlightEndPos;
+            }
+
+            for (rowCtr = 0; rowCtr < nRows; rowCtr++)
+            {
+                rowY = lineY + (int)((float)(rowCtr)*blankH);
+                if (rowY > clipBot) break;
+                if (rowY + (int)(blankH) < clipTop) continue;
 
-                textW = 0;
-                textH = 0;
-                /* determine the point of the start of the bgkd highlight */
-                if (lineCtr > te->highlightStartLine)
+                /*------------------------------------------------------------*/
+                /* Temporarily terminate the line at the end of this row.     */
+                /*------------------------------------------------------------*/
+                segStart = rowStart[rowCtr];
+                segEnd   = lineLen;
+                if (rowCtr + 1 < nRows)
                 {
-                    /*--------------------------------------------------------*/
-                    /* The start of the line will be highlighted.             */
-                    /*--------------------------------------------------------*/
-                    if (lineCtr < te->highlightEndLine)
-                    {
-                        /*----------------------------------------------------*/
-                        /* highlight the entire line.                         */
-                        /*----------------------------------------------------*/
-                        TTF_SizeText(font, lineBytes, &textW, &textH);
-                        textW += blankW;
-                    }
-                    else if (te->highlightEndPos != 0)
-                    {
-                        /*----------------------------------------------------*/
-                        /* The highlight ends within this line.               */
-                        /*----------------------------------------------------*/
-                        tempChar = lineBytes[te->highlightEndPos];
-                        lineBytes[te->highlightEndPos] = '\0';
-                        TTF_SizeText(font, lineBytes, &textW, &textH);
-                        lineBytes[te->highlightEndPos] = tempChar;
-                    }
+                    segEnd = rowStart[rowCtr + 1];
                 }
-                else if (lineCtr == te->highlightStartLine)
-                {
-                    /*--------------------------------------------------------*/
-                    /* The highlighted block starts on this line.             */
-                    /*--------------------------------------------------------*/
-                    if (te->highlightStartPos != 0)
-                    {
-                        tempChar = lineBytes[te->highlightStartPos];
-                        lineBytes[te->highlightStartPos] = '\0';
-                        TTF_SizeText(font, lineBytes, &textW, &textH);
-                        lineBytes[te->highlightStartPos] = tempChar;
-                    }
-                    rect.x += textW;
+                rowEndChar = lineBytes[segEnd];
+                lineBytes[segEnd] = '\0';
+                rowBytes = lineBytes + segStart;
+                rowX     = neuik_TextLayout_GetX(layout, segStart);
 
-                    /*--------------------------------------------------------*/
-                    /* Determine the point of the start of the bgkd highlight */
-                    /*--------------------------------------------------------*/
-                    lineLen = strlen(lineBytes);
+                /*------------------------------------------------------------*/
+                /* Get the rendered text of this row; rows which have not     */
+                /* changed since they were last drawn reuse their texture.    */
+                /*------------------------------------------------------------*/
+                tTex = neuik_TextEdit_GetLineTexture(te, rend, font, 
+                    rowBytes, &textWFull, &textH);
+                if (tTex == NULL)
+                {
+                    lineBytes[segEnd] = rowEndChar;
+                    eNum = 14;
+                    goto out;
+                }
+                textHFull = 1.1*(float)(textH);
 
-                    if (te->highlightEndLine > lineCtr)
-                    {
-                        /*----------------------------------------------------*/
-                        /* highlight the rest of the line.                    */
-                        /*----------------------------------------------------*/
-                        TTF_SizeText(font, 
-                            lineBytes + te->highlightStartPos, 
-                            &textW, &textH);
-                        textW += blankW;
-                    }
-                    else
+                /*------------------------------------------------------------*/
+                /* Fill in the background of any search matches in the row.   */
+                /*------------------------------------------------------------*/
+                if (findLen > 0)
+                {
+                    bgClr = &(aCfg->bgColorFind);
+                    SDL_SetRenderDrawColor(
+                        rend, bgClr->r, bgClr->g, bgClr->b, 255);
+                    for (matchPtr = strstr(rowBytes, te->findPattern); 
+                        matchPtr != NULL; 
+                        matchPtr = strstr(matchPtr + findLen, te->findPattern))
                     {
-                        tempChar = lineBytes[te->highlightEndPos];
-                        lineBytes[te->highlightEndPos] = '\0';
-                        TTF_SizeText(font, 
-                            lineBytes + te->highlightStartPos, 
-                            &textW, &textH);
-                        lineBytes[te->highlightEndPos] = tempChar;
+                        textW = neuik_TextLayout_GetX(layout, 
+                            matchPtr - lineBytes);
+                        rect.x = rl.x + 6 + (textW - rowX);
+
+                        rect.y = rowY;
+                        rect.w = neuik_TextLayout_GetX(layout, 
+                            matchPtr - lineBytes + findLen) - textW;
+                        rect.h = (int)(textHFull);
+                        if (neuik_TextEdit_ClipRowsToView(
+                            &rect, clipTop, clipBot, NULL))
+                        {
+                            SDL_RenderFillRect(rend, &rect);
+                        }
                     }
+                    bgClr = &(aCfg->bgColor);
                 }
-                hlWidth = textW;
-                rect.w = hlWidth;
-
-                bgClr = &(aCfg->bgColorHl);
-                SDL_SetRenderDrawColor(
-                    te->textRend, bgClr->r, bgClr->g, bgClr->b, 255);
-                SDL_RenderFillRect(te->textRend, &rect);
-                bgClr = &(aCfg->bgColor);
-            }
-
-            /*----------------------------------------------------------------*/
-            /* Copy over the previously rendered text.                        */
-            /*----------------------------------------------------------------*/
-            rect.x = 0;
-            rect.y = 0;
-            rect.w = textWFull + 1;
-            rect.h = (int)(textHFull);
 
-            SDL_RenderCopy(te->textRend, tTex, NULL, &rect);
-
-            /*----------------------------------------------------------------*/
-            /* Draw the cursor (if TextEdit is focused)                       */
-            /*----------------------------------------------------------------*/
-            if (eBase->eSt.hasFocus && te->cursorLine == lineCtr)
-            {
                 /*------------------------------------------------------------*/
-                /* Draw the cursor line into the TextEdit element             */
+                /* Check for and fill in highlight text selection background. */
+                /* The highlight is drawn beneath the (cached) row of text.   */
+                /* If the selection continues onto the following line, the    */
+                /* final row is highlighted a little past its end.            */
                 /*------------------------------------------------------------*/
-                SDL_SetRenderDrawColor(
-                    te->textRend, fgClr->r, fgClr->g, fgClr->b, 255);
-
-                tempChar = lineBytes[te->cursorPos];
-                if (tempChar == '\0')
+                hlStart = (selStart > segStart) ? selStart : segStart;
+                hlEnd   = (selEnd   < segEnd)   ? selEnd   : segEnd;
+                hlToEnd = (lineCtr < te->highlightEndLine && 
+                    rowCtr + 1 == nRows);
+                if (hlLine && hlStart <= hlEnd && (hlStart < hlEnd || hlToEnd))
                 {
-                    rect.x = textWFull - 2;
-                }
-                else
-                {
-                    lineBytes[te->cursorPos] = '\0';
-                    TTF_SizeText(font, lineBytes, &textW, &textH);
-                    lineBytes[te->cursorPos] = tempChar;
-
-                    /* this will be the position of the cursor */
-                    rect.x = textW;
-                }
-                te->cursorX = rect.x;
-                SDL_RenderDrawLine(te->textRend, 
-                    rect.x, rect.y, 
-                    rect.x, rect.y + rect.h); 
-                SDL_RenderDrawLine(te->textRend, 
-                    rect.x+1, rect.y, 
-                    rect.x+1, rect.y + rect.h); 
-            }
+                    textW  = neuik_TextLayout_GetX(layout, hlStart);
+                    rect.x = rl.x + 6 + (textW - rowX);
 
-            SDL_RenderPresent(te->textRend);
-            te->textTex = SDL_CreateTextureFromSurface(rend, te->textSurf);
-            if (te->textTex == NULL)
-            {
-                eNum = 7;
-                goto out;
-            }
+                    hlWidth = neuik_TextLayout_GetX(layout, hlEnd) - textW;
+                    if (hlToEnd)
+                    {
+                        hlWidth += blankW;
+                    }
 
-            rect.x = rl.x + 6;
-            rect.y = rl.y + (int)(yPos);
-            rect.w = textWFull + blankW;
-            rect.h = (int)(textHFull);
+                    rect.y = rowY;
+                    rect.w = hlWidth;
+                    rect.h = (int)(textHFull);
+                    if (neuik_TextEdit_ClipRowsToView(
+                        &rect, clipTop, clipBot, NULL))
+                    {
+                        bgClr = &(aCfg->bgColorHl);
+                        SDL_SetRenderDrawColor(
+                            rend, bgClr->r, bgClr->g, bgClr->b, 255);
+                        SDL_RenderFillRect(rend, &rect);
+                        bgClr = &(aCfg->bgColor);
+                    }
+                }
 
-            if (partialDraw)
-            {
                 /*------------------------------------------------------------*/
-                /* This line of text is the first line of text shown in a     */
-                /* view that is partially scrolled. The top of the line will  */
-                /* need to be cropped.                                        */
+                /* Copy over the (visible portion of the) rendered text.      */
                 /*------------------------------------------------------------*/
+                SDL_QueryTexture(tTex, NULL, NULL, &srcRect.w, &srcRect.h);
                 srcRect.x = 0;
-                srcRect.y = te->vertPanPx;
-                srcRect.w = textWFull + blankW;
-                srcRect.h = (int)(blankH) - te->vertPanPx;
-
+                rect.x = rl.x + 6;
+                rect.y = rowY;
+                rect.w = srcRect.w;
                 rect.h = srcRect.h;
+                if (neuik_TextEdit_ClipRowsToView(&rect, clipTop, clipBot, 
+                    &srcRect.y))
+                {
+                    srcRect.h = rect.h;
+                    SDL_RenderCopy(rend, tTex, &srcRect, &rect);
+                }
 
-                SDL_RenderCopy(rend, te->textTex, &srcRect, &rect);
-                ConditionallyDestroyTexture(&tTex);
-            }
-            else if ((int)(yPos) + (int)(textHFull) <= rSize->h - 2)
-            {
-                /*------------------------------------------------------------*/
-                /* This line of text has enough vertical space to be fully    */
-                /* drawn.                                                     */
-                /*------------------------------------------------------------*/
-                SDL_RenderCopy(rend, te->textTex, NULL, &rect);
-                ConditionallyDestroyTexture(&tTex);
-            }
-            else
-            {
                 /*------------------------------------------------------------*/
-                /* The next line of text only has enough space to be drawn    */
-                /* partially.                                                 */
+                /* Draw the cursor (if TextEdit is focused and the cursor is  */
+                /* within this row).                                          */
                 /*------------------------------------------------------------*/
-                srcRect.x = 0;
-                srcRect.y = 0;
-                srcRect.w = textWFull + blankW;
-                srcRect.h = rSize->h - (2 + (int)(yPos));
-
-                rect.h = srcRect.h;
+                if (eBase->eSt.hasFocus && te->cursorLine == lineCtr &&
+                    te->cursorPos >= segStart && 
+                    (te->cursorPos < segEnd || rowCtr + 1 == nRows))
+                {
+                    if (te->cursorPos >= segEnd)
+                    {
+                        rect.x = textWFull - 2;
+                    }
+                    else
+                    {
+                        /* this will be the position of the cursor */
+                        rect.x = neuik_TextLayout_GetX(layout, 
+                            te->cursorPos) - rowX;
+                    }
+                    te->cursorX = rect.x;
 
-                SDL_RenderCopy(rend, te->textTex, &srcRect, &rect);
-                ConditionallyDestroyTexture(&tTex);
+                    /*--------------------------------------------------------*/
+                    /* Draw the cursor line into the TextEdit element         */
+                    /*--------------------------------------------------------*/
+                    rect.x += rl.x + 6;
+                    rect.y = rowY;
+                    rect.w = 2;
+                    rect.h = (int)(textHFull);
+                    if (neuik_TextEdit_ClipRowsToView(&rect, clipTop, 
+                        clipBot, NULL))
+                    {
+                        SDL_SetRenderDrawColor(
+                            rend, fgClr->r, fgClr->g, fgClr->b, 255);
+                        SDL_RenderDrawLine(rend, 
+                            rect.x, rect.y, 
+                            rect.x, rect.y + rect.h); 
+                        SDL_RenderDrawLine(rend, 
+                            rect.x+1, rect.y, 
+                            rect.x+1, rect.y + rect.h); 
+                    }
+                }
+                lineBytes[segEnd] = rowEndChar;
             }
         }
         else
@@ -1658,21 +4564,24 @@ int neuik_Element_Render__TextEdit(
                      lineCtr < te->highlightEndLine))
             {
                 rect.x = rl.x + 6;
-                rect.y = rl.y + (int)(yPos);
+                rect.y = lineY;
                 rect.w = blankW + 1;
                 rect.h = (int)(blankH);
 
-                bgClr = &(aCfg->bgColorHl);
-                SDL_SetRenderDrawColor(
-                    rend, bgClr->r, bgClr->g, bgClr->b, 255);
-                SDL_RenderFillRect(rend, &rect);
-                bgClr = &(aCfg->bgColor);
+                if (neuik_TextEdit_ClipRowsToView(&rect, clipTop, clipBot, NULL))
+                {
+                    bgClr = &(aCfg->bgColorHl);
+                    SDL_SetRenderDrawColor(
+                        rend, bgClr->r, bgClr->g, bgClr->b, 255);
+                    SDL_RenderFillRect(rend, &rect);
+                    bgClr = &(aCfg->bgColor);
+                }
             }
 
             /*----------------------------------------------------------------*/
             /* This is a blank line but the cursor may be present.            */
             /*----------------------------------------------------------------*/
-            TTF_SizeText(font, " ", &textW, &textH);
+            TTF_SizeUTF8(font, " ", &textW, &textH);
             textHFull = 1.1*(float)(textH);
 
             /*----------------------------------------------------------------*/
@@ -1683,55 +4592,46 @@ int neuik_Element_Render__TextEdit(
                 /*------------------------------------------------------------*/
                 /* Position the cursor at the start of the line.              */
                 /*------------------------------------------------------------*/
+                te->cursorX = 0;
                 rect.x = rl.x + 6;
-                rect.y = rl.y + (int)(yPos);
+                rect.y = lineY;
+                rect.w = 2;
                 rect.h = (int)(textHFull);
 
-                SDL_SetRenderDrawColor(rend, fgClr->r, fgClr->g, fgClr->b, 255);
-                SDL_RenderDrawLine(rend, 
-                    rect.x, rect.y, 
-                    rect.x, rect.y + rect.h); 
-                SDL_RenderDrawLine(rend, 
-                    rect.x+1, rect.y, 
-                    rect.x+1, rect.y + rect.h); 
+                if (neuik_TextEdit_ClipRowsToView(
+                    &rect, clipTop, clipBot, NULL))
+                {
+                    SDL_SetRenderDrawColor(
+                        rend, fgClr->r, fgClr->g, fgClr->b, 255);
+                    SDL_RenderDrawLine(rend, 
+                        rect.x, rect.y, 
+                        rect.x, rect.y + rect.h); 
+                    SDL_RenderDrawLine(rend, 
+                        rect.x+1, rect.y, 
+                        rect.x+1, rect.y + rect.h); 
+                }
             }
         }
 
-        yPos += blankH;
-        if (partialDraw)
-        {
-            yPos -= (float)(te->vertPanPx);
-        }
-
-        if (lineBytes != NULL)
-        {
-            free(lineBytes);
-            lineBytes = NULL;
-        }
-        if (te->textTex != NULL)
-        {
-            SDL_DestroyTexture(te->textTex);
-            te->textTex = NULL;
-        }
-        if (te->textSurf != NULL)
-        {
-            SDL_FreeSurface(te->textSurf);
-            te->textSurf = NULL;
-        }
-        if (te->textRend != NULL)
-        {
-            SDL_DestroyRenderer(te->textRend);
-            te->textRend = NULL;
-        }
+        rowsAbove += nRows;
+        lineBytes = NULL;
     }
 
     /*------------------------------------------------------------------------*/
-    /* Update the scroll and view percentages; used for the scrollbar.        */
+    /* Update the scroll and view percentages; used for the scrollbar. With   */
+    /* word wrap these are measured in (visual) rows rather than lines.       */
     /*------------------------------------------------------------------------*/
+    nLines = neuik_TextEdit_GetTotalLineCount(te);
+    topRow = (double)(te->vertPanLn);
+    if (te->wrapCache != NULL)
+    {
+        topRow = (double)(neuik_TextEdit_GetWrapRowOfLine(te, te->vertPanLn));
+        nLines = neuik_TextEdit_GetWrapRowOfLine(te, nLines);
+    }
     scrollPct = 100.0*(
-        ((double)(te->vertPanLn) + ((double)(te->vertPanPx) / (double)(blankH))) /
+        (topRow + ((double)(te->vertPanPx) / (double)(blankH))) /
             (double)(nLines));
-    if (nLines == te->vertPanLn + 1)
+    if (nLines <= topRow + 1)
     {
         scrollPct = 100.0;      
     }
@@ -1862,12 +4762,19 @@ draw_border:
             rl.x + (rSize->w - 3) - ctr, rl.y + (rSize->h - 2) - ctr);
     }
 out:
-    if (eBase != NULL)
+    if (eBase != NULL && !mock)
     {
-        if (!mock) eBase->eSt.doRedraw = 0;
+        eBase->eSt.doRedraw = 0;
+        te->dirtyLines      = FALSE;
+        te->dirtyScroll     = FALSE;
+        te->framePanLn      = te->vertPanLn;
+        te->frameAligned    = (te->vertPanPx == 0);
+        if (rowsChanged)
+        {
+            neuik_Element_RequestRedraw(te, eBase->eSt.rLoc, eBase->eSt.rSize);
+        }
     }
 
-    ConditionallyDestroyTexture(&tTex);
     if (maskMap != NULL) neuik_Object_Free(maskMap);
 
     if (eNum > 0)
@@ -129,6 +129,7 @@ NEUIK_TextEditConfig * NEUIK_GetDefaultTextEditConfig()
         COLOR_LBLUE,              // SDL_Color       bgColorHl
         COLOR_WHITE,              // SDL_Color       fgColorHl
         COLOR_DBLUE,              // SDL_Color       bgColorSelect
+        COLOR_LYELLOW,            // SDL_Color       bgColorFind
         COLOR_GRAY,               // SDL_Color       borderColor
         COLOR_DGRAY,              // SDL_Color       borderColorDark
         COLOR_GRAY,               // SDL_Color       bgScrollColor
@@ -139,6 +140,7 @@ NEUIK_TextEditConfig * NEUIK_GetDefaultTextEditConfig()
         NEUIK_RESTRICT_NONE,      // int             restriction
         NULL,                     // char          * restrict_str
         10,                       // int             emptySpaces
+        FALSE,                    // int             wordWrap
     };
     static char   funcName[] = "NEUIK_GetDefaultTextEditConfig";
     static char * errMsgs[] = {"", // [0] no error
@@ -396,6 +398,7 @@ int NEUIK_TextEditConfig_Copy(
     dst->bgColorHl         = src->bgColorHl;
     dst->fgColorHl         = src->fgColorHl;
     dst->bgColorSelect     = src->bgColorSelect;
+    dst->bgColorFind       = src->bgColorFind;
     dst->borderColor       = src->borderColor;
     dst->borderColorDark   = src->borderColorDark;
     dst->bgScrollColor     = src->bgScrollColor;
@@ -405,6 +408,7 @@ int NEUIK_TextEditConfig_Copy(
     dst->fontEmWidth       = src->fontEmWidth;
     dst->restriction       = src->restriction;
     dst->emptySpaces       = src->emptySpaces;
+    dst->wordWrap          = src->wordWrap;
 out:
     if (eNum > 0)
     {
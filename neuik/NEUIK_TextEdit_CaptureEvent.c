@@ -22,6 +22,7 @@
 #include "NEUIK_Element_internal.h"
 #include "NEUIK_Window_internal.h"
 #include "NEUIK_platform.h"
+#include "neuik_UTF8.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
 
@@ -48,10 +49,19 @@ static char          * errMsgs[]  = {"", // [ 0] no error
     "Failure in function `neuik_TextBlock_DeleteChar`.",             // [ 8]
     "Failure in function `neuik_TextBlock_MergeLines`.",             // [ 9]
     "Failure in function `neuik_TextBlock_DeleteSection`.",          // [10]
-    "Failure in function `neuik_TextBlock_GetLine`.",                // [11]
+    "Failure in function `neuik_TextBlock_GetLineIntoBuffer`.",      // [11]
     "Failure in function `neuik_TextBlock_GetSection`.",             // [12]
     "Failure in function `neuik_TextBlock_InsertText`.",             // [13]
     "Failure in function `neuik_getTextSelectionAtPos`.",            // [14]
+    "Failure in function `neuik_TextEdit_LoadThroughLine`.",         // [15]
+    "Failure in function `neuik_TextEdit_GetWrapPosAt`.",            // [16]
+    "Failure in function `neuik_TextEdit_WrapMoveVertical`.",        // [17]
+    "Failure in function `neuik_TextHistory_InsertText`.",           // [18]
+    "Failure in function `neuik_TextHistory_DeleteSection`.",        // [19]
+    "Failure in function `NEUIK_TextEdit_Undo`.",                    // [20]
+    "Failure in function `NEUIK_TextEdit_Redo`.",                    // [21]
+    "Failure in function `neuik_TextEdit_RequestLineRedraw`.",       // [22]
+    "Failure in function `neuik_GetTextLayout`.",                    // [23]
 };
 
 
@@ -70,22 +80,22 @@ int neuik_TextEdit_UpdatePanCursor(
 {
     int                    eNum       = 0; /* which error to report (if any) */
     int                    textW      = 0;
-    int                    textH      = 0;
     int                    normWidth  = 0;
     int                    lineLen    = 0;
     size_t                 textLen    = 0;
-    char                   tempChar;
     char                 * lineBytes  = NULL;
     TTF_Font             * font       = NULL;
     NEUIK_ElementBase    * eBase      = NULL;
     NEUIK_TextEditConfig * aCfg       = NULL; /* the active textEntry config */
+    neuik_TextLayout     * layout     = NULL;
     static char            funcName[] = "neuik_TextEdit_UpdatePanCursor";
     static char          * errMsgs2[] = {"", // [0] no error
         "Argument `te` is not of TextEdit class.",                     // [1]
         "Argument `te` caused `neuik_Object_GetClassObject` to fail.", // [2]
         "Failure in function `neuik_TextBlock_GetLength`.",            // [3]
         "FontSet_GetFont returned NULL.",                              // [4]
-        "Failure in function `neuik_TextBlock_GetLine`.",              // [5]
+        "Failure in function `neuik_TextBlock_GetLineIntoBuffer`.",    // [5]
+        "Failure in function `neuik_GetTextLayout`.",                  // [6]
     };
 
     if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
@@ -113,6 +123,15 @@ int neuik_TextEdit_UpdatePanCursor(
         goto out;
     }
 
+    /*------------------------------------------------------------------------*/
+    /* Word wrapped lines are never panned.                                   */
+    /*------------------------------------------------------------------------*/
+    if (te->wrapCache != NULL)
+    {
+        te->panCursor = 0;
+        goto out;
+    }
+
     /*------------------------------------------------------------------------*/
     /* Select the correct entry config to use (pointer or internal)           */
     /*------------------------------------------------------------------------*/
@@ -135,15 +154,24 @@ int neuik_TextEdit_UpdatePanCursor(
     /* Before proceeding, check to see where the cursor is located within the */
     /* currently visible TextEdit field.                                     */
     /*------------------------------------------------------------------------*/
-    if (neuik_TextBlock_GetLine(te->textBlk, te->cursorLine, &lineBytes))
+    if (neuik_TextBlock_GetLineIntoBuffer(te->textBlk, te->cursorLine, 
+        &te->lineBuf, &te->lineBufSize, &textLen))
     {
         eNum = 5;
         goto out;
     }
-    lineLen = strlen(lineBytes);
+    lineBytes = te->lineBuf;
+    lineLen   = textLen;
 
-    TTF_SizeText(font, lineBytes, &textW, &textH);
-    textW++;
+    /*------------------------------------------------------------------------*/
+    /* The (cached) layout of the line gives both its width and the cursorX.  */
+    /*------------------------------------------------------------------------*/
+    if (neuik_GetTextLayout(font, lineBytes, textLen, &layout))
+    {
+        eNum = 6;
+        goto out;
+    }
+    textW = layout->charX[layout->nChars] + 1;
     normWidth = (eBase->eSt.rSize).w - 12; 
     if (textW < normWidth) 
     {
@@ -167,13 +195,7 @@ int neuik_TextEdit_UpdatePanCursor(
         /*--------------------------------------------------------------------*/
         /* Update the cursorX position                                        */
         /*--------------------------------------------------------------------*/
-        tempChar = lineBytes[te->cursorPos];
-        if (tempChar != '\0')
-        {
-            lineBytes[te->cursorPos] = '\0';
-        }
-        TTF_SizeText(font, lineBytes, &(te->cursorX), &textH);
-        lineBytes[te->cursorPos] = tempChar;
+        te->cursorX = neuik_TextLayout_GetX(layout, te->cursorPos);
 
 
         switch (cursorChange)
@@ -208,7 +230,6 @@ out:
     {
         NEUIK_RaiseError(funcName, errMsgs2[eNum]);
     }
-    if (lineBytes != NULL) free(lineBytes);
 
     return eNum;
 }
@@ -594,6 +615,8 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseWheelEvent(
     unsigned int           oldVertPanPx = 0;
     int                    eNum         = 0; /* which error to report (if any) */
     size_t                 nLines       = 0;
+    size_t                 nRows        = 0; /* rows (word wrapped lines) */
+    size_t                 lineH        = 0; /* height of a (wrapped) line */
     TTF_Font             * font         = NULL;
     SDL_MouseWheelEvent  * mWheelEv     = NULL;
     NEUIK_TextEdit       * te           = NULL;
@@ -681,7 +704,7 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseWheelEvent(
     /*------------------------------------------------------------------------*/
     /* Calculate the height of a line of text at the specified font & size.   */
     /*------------------------------------------------------------------------*/
-    TTF_SizeText(font, " ", &textW, &textH);
+    TTF_SizeUTF8(font, " ", &textW, &textH);
     blankH = (int)(1.1*textH);
 
     oldVertPanLn = te->vertPanLn;
@@ -707,7 +730,8 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseWheelEvent(
                 break;
             }
             te->vertPanLn--;
-            te->vertPanPx += blankH;
+            te->vertPanPx += blankH*neuik_TextEdit_GetWrapRows(
+                te, te->vertPanLn);
             if (te->vertPanPx < VERT_PAN_PX)
             {
                 continue;
@@ -723,10 +747,16 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseWheelEvent(
         /*--------------------------------------------------------------------*/
         te->vertPanPx += VERT_PAN_PX;
 
-        if (te->vertPanPx > blankH)
+        /*--------------------------------------------------------------------*/
+        /* A word wrapped line may occupy several rows.                       */
+        /*--------------------------------------------------------------------*/
+        for (;;)
         {
-            te->vertPanLn += te->vertPanPx / blankH;
-            te->vertPanPx = te->vertPanPx % blankH;
+            lineH = blankH*neuik_TextEdit_GetWrapRows(te, te->vertPanLn);
+            if (te->vertPanPx <= lineH) break;
+
+            te->vertPanPx -= lineH;
+            te->vertPanLn++;
         }
         if (te->vertPanLn + 1 > nLines)
         {
@@ -738,8 +768,9 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseWheelEvent(
             }
         }
 
-        if ((nLines < eBase->eSt.rSize.h - 2) && 
-            (nLines*blankH < eBase->eSt.rSize.h - 2))
+        nRows = neuik_TextEdit_GetWrapRowOfLine(te, nLines);
+        if ((nRows < eBase->eSt.rSize.h - 2) && 
+            (nRows*blankH < eBase->eSt.rSize.h - 2))
         {
             /*----------------------------------------------------------------*/
             /* All contents of the text should be visible without any need    */
@@ -778,6 +809,28 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* Get the cursor position (byte offset) within a line of text which is       */
+/* closest to a horizontal offset (relative to the start of the line).        */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_GetPosAtX(
+    TTF_Font   * font,
+    const char * lineBytes,
+    size_t       lineLen,
+    int          x,
+    size_t     * pos)
+{
+    neuik_TextLayout * layout = NULL;
+
+    if (neuik_GetTextLayout(font, lineBytes, lineLen, &layout)) return 1;
+
+    *pos = neuik_TextLayout_GetPosAtX(layout, x);
+    return 0;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_Element_CaptureEvent__TextEdit_MouseEvent
@@ -794,14 +847,12 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
     int                    doContinue   = FALSE;
     int                    evCaptured   = FALSE;
     int                    textW        = 0;
-    int                    textH        = 0;
     float                  textHFull    = 0;
-    int                    charW        = 0;
     int                    eNum         = 0; /* which error to report (if any) */
-    int                    lastW        = 0; /* position of previous char */
     int                    normWidth    = 0;
     int                    yRel         = 0;
     float                  yPos         = 0;
+    float                  rowY         = 0; /* offset within the line */
     int                    clickLnFound = FALSE;
     int                    shift_held   = FALSE;
     int                    sel0         = 0; /* This stores the starting     */
@@ -813,12 +864,14 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
     size_t                 lineLen      = 0;
     size_t                 nLines       = 0;
     size_t                 clickLine    = 0;
+    size_t                 clickRow     = 0; /* row within a wrapped line */
+    size_t                 lineRows     = 1;
     size_t                 oldCursorPos = 0;
     size_t                 oldCursorLn  = 0;
-    size_t                 ctr          = 0;
-    char                   aChar        = 0;
     char                 * lineBytes    = NULL; /* FREE at exit */
+    size_t                 lineBytesSize = 0;   /* bytes alloc. for lineBytes */
     TTF_Font             * font         = NULL;
+    neuik_TextLayout     * layout       = NULL;
     SDL_Rect               rect         = {0, 0, 0 ,0};
     SDL_Keymod             keyMod;
     RenderSize             rSize;
@@ -898,6 +951,7 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
                 mouseButEv->x <= eBase->eSt.rLoc.x + eBase->eSt.rSize.w)
             {
                 /* This mouse click originated within this textEdit */
+                neuik_TextHistory_Break(te->history);
                 if (!eBase->eSt.hasFocus)
                 {
                     /*--------------------------------------------------------*/
@@ -954,8 +1008,10 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
         yPos = 2.0;
         for (lineCtr = te->vertPanLn; lineCtr < nLines; lineCtr++)
         {
-            yPos += textHFull;
-            if (te->vertPanLn > 0 && lineCtr == te->vertPanLn)
+            lineRows = neuik_TextEdit_GetWrapRows(te, lineCtr);
+            yPos += textHFull*(float)(lineRows);
+            if ((te->vertPanLn > 0 || te->vertPanPx > 0) && 
+                lineCtr == te->vertPanLn)
             {
                 /*------------------------------------------------------------*/
                 /* This line of text is the first line of text shown in a     */
@@ -968,6 +1024,10 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
             {
                 clickLnFound = TRUE;
                 clickLine = lineCtr;
+
+                /* the row of a (word wrapped) line which was clicked */
+                rowY = (float)(yRel) - (yPos - textHFull*(float)(lineRows));
+                if (rowY > 0) clickRow = (size_t)(rowY/textHFull);
                 break;
             }
         }
@@ -977,7 +1037,8 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
             /*----------------------------------------------------------------*/
             /* Get the overall location of the current text                   */
             /*----------------------------------------------------------------*/
-            if (neuik_TextBlock_GetLine(te->textBlk, clickLine, &lineBytes))
+            if (neuik_TextBlock_GetLineIntoBuffer(te->textBlk, clickLine, 
+                &lineBytes, &lineBytesSize, &lineLen))
             {
                 eNum = 11;
                 goto out;
@@ -992,7 +1053,12 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
                 if (*lineBytes != '\0')
                 {
                     normWidth = (eBase->eSt.rSize).w - 12; 
-                    TTF_SizeText(font, lineBytes, &textW, &textH);
+                    if (neuik_GetTextLayout(font, lineBytes, lineLen, &layout))
+                    {
+                        eNum = 23;
+                        goto out;
+                    }
+                    textW  = layout->charX[layout->nChars];
                     rect.w = textW;
 
                     if (textW < normWidth) 
@@ -1116,8 +1182,8 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
 
             if (lineLen > 0)
             {
-                if (lineBytes != NULL) free(lineBytes);
-                if (neuik_TextBlock_GetLine(te->textBlk, clickLine, &lineBytes))
+                if (neuik_TextBlock_GetLineIntoBuffer(te->textBlk, clickLine, 
+                    &lineBytes, &lineBytesSize, NULL))
                 {
                     eNum = 11;
                     goto out;
@@ -1153,6 +1219,25 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
                 goto out;
             }
         }
+        else if (te->wrapCache != NULL)
+        {
+            /*----------------------------------------------------------------*/
+            /* Move the cursor within the clicked row of a wrapped line.      */
+            /*----------------------------------------------------------------*/
+            if (neuik_TextBlock_GetLineIntoBuffer(te->textBlk, clickLine, 
+                &lineBytes, &lineBytesSize, NULL))
+            {
+                eNum = 11;
+                goto out;
+            }
+            if (neuik_TextEdit_GetWrapPosAt(te, clickLine, lineBytes, clickRow,
+                mouseButEv->x - (eBase->eSt.rLoc.x + 6), &(te->cursorPos)))
+            {
+                eNum = 16;
+                goto out;
+            }
+            te->vertMovePos = te->cursorPos;
+        }
         else if (te->panCursor == 0 && 
             mouseButEv->x <= eBase->eSt.rLoc.x + rect.x)
         {
@@ -1184,59 +1269,33 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
             /*----------------------------------------------------------------*/
             /* move the cursor somewhere within the line.                     */
             /*----------------------------------------------------------------*/
-            if (lineBytes != NULL) free(lineBytes);
-            if (neuik_TextBlock_GetLine(te->textBlk, clickLine, &lineBytes))
+            if (neuik_TextBlock_GetLineIntoBuffer(te->textBlk, clickLine, 
+                &lineBytes, &lineBytesSize, NULL))
             {
                 eNum = 11;
                 goto out;
             }
 
-            for (ctr = 1;;ctr++)
+            if (neuik_TextEdit_GetPosAtX(font, lineBytes, lineLen,
+                (mouseButEv->x + te->panCursor) - (eBase->eSt.rLoc.x + rect.x),
+                &(te->cursorPos)))
             {
-                aChar = lineBytes[ctr];
-
-                lineBytes[ctr] = '\0';
-                TTF_SizeText(font, lineBytes, &textW, &textH);
-                lineBytes[ctr] = aChar;
-
-                if (mouseButEv->x + te->panCursor <= 
-                    eBase->eSt.rLoc.x + rect.x + textW)
-                {
-                    /* cursor will be before this char */
-                    te->cursorPos   = ctr - 1;
-                    te->vertMovePos = te->cursorPos;
-                    charW = textW - lastW;
-                    if (mouseButEv->x + te->panCursor <= 
-                        eBase->eSt.rLoc.x + rect.x + textW - charW/3)
-                    {
-                        /* cursor will be before this char */
-                        te->cursorPos = ctr - 1;
-                    }
-                    else
-                    {
-                        /* cursor will be after char */
-                        te->cursorPos = ctr;
-                    }
+                eNum = 23;
+                goto out;
+            }
+            te->vertMovePos = te->cursorPos;
 
-                    /*--------------------------------------------------------*/
-                    /* Update the cursor Panning (if necessary).              */
-                    /*--------------------------------------------------------*/
-                    if (oldCursorPos > te->cursorPos)
-                    {
-                        neuik_TextEdit_UpdatePanCursor(te, 
-                            CURSORPAN_MOVE_BACK);
-                    }
-                    else
-                    {
-                        neuik_TextEdit_UpdatePanCursor(te, 
-                            CURSORPAN_MOVE_FORWARD);
-                    }
-                    break;
-                }
-                lastW = textW;
-                if (aChar == '\0') break;
+            /*----------------------------------------------------------------*/
+            /* Update the cursor Panning (if necessary).                      */
+            /*----------------------------------------------------------------*/
+            if (oldCursorPos > te->cursorPos)
+            {
+                neuik_TextEdit_UpdatePanCursor(te, CURSORPAN_MOVE_BACK);
+            }
+            else
+            {
+                neuik_TextEdit_UpdatePanCursor(te, CURSORPAN_MOVE_FORWARD);
             }
-            lineBytes[ctr] = aChar;
         }
         te->clickOrigin     = te->cursorPos;
         te->timeClickMinus2 = te->timeLastClick;
@@ -1340,8 +1399,10 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
             yPos = 2.0;
             for (lineCtr = te->vertPanLn; lineCtr < nLines; lineCtr++)
             {
-                yPos += textHFull;
-                if (te->vertPanLn > 0 && lineCtr == te->vertPanLn)
+                lineRows = neuik_TextEdit_GetWrapRows(te, lineCtr);
+                yPos += textHFull*(float)(lineRows);
+                if ((te->vertPanLn > 0 || te->vertPanPx > 0) && 
+                    lineCtr == te->vertPanLn)
                 {
                     /*--------------------------------------------------------*/
                     /* This line of text is the first line of text shown in a */
@@ -1354,6 +1415,10 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
                 {
                     clickLnFound = TRUE;
                     clickLine = lineCtr;
+
+                    /* the row of a (word wrapped) line under the mouse */
+                    rowY = (float)(yRel) - (yPos - textHFull*(float)(lineRows));
+                    if (rowY > 0) clickRow = (size_t)(rowY/textHFull);
                     break;
                 }
             }
@@ -1377,8 +1442,8 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
                 /*------------------------------------------------------------*/
                 /* Get the overall location of the current text               */
                 /*------------------------------------------------------------*/
-                if (lineBytes != NULL) free(lineBytes);
-                if (neuik_TextBlock_GetLine(te->textBlk, clickLine, &lineBytes))
+                if (neuik_TextBlock_GetLineIntoBuffer(te->textBlk, clickLine, 
+                    &lineBytes, &lineBytesSize, &lineLen))
                 {
                     eNum = 11;
                     goto out;
@@ -1392,7 +1457,13 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
                     if (*lineBytes != '\0')
                     {
                         normWidth = (eBase->eSt.rSize).w - 12; 
-                        TTF_SizeText(font, lineBytes, &textW, &textH);
+                        if (neuik_GetTextLayout(
+                            font, lineBytes, lineLen, &layout))
+                        {
+                            eNum = 23;
+                            goto out;
+                        }
+                        textW  = layout->charX[layout->nChars];
                         rect.w = textW;
 
                         if (textW < normWidth) 
@@ -1470,7 +1541,25 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
             /* If continuing, this TextEdit contains text and so the cursor   */
             /* placement could have been changed.                             */
             /*----------------------------------------------------------------*/
-            if (te->panCursor == 0 && 
+            if (clickLnFound && te->wrapCache != NULL)
+            {
+                /* move the cursor within the row of a wrapped line */
+                if (neuik_TextBlock_GetLineIntoBuffer(te->textBlk, clickLine, 
+                    &lineBytes, &lineBytesSize, NULL))
+                {
+                    eNum = 11;
+                    goto out;
+                }
+                if (neuik_TextEdit_GetWrapPosAt(te, clickLine, lineBytes, 
+                    clickRow, mouseMotEv->x - (eBase->eSt.rLoc.x + 6), 
+                    &(te->cursorPos)))
+                {
+                    eNum = 16;
+                    goto out;
+                }
+                te->vertMovePos = te->cursorPos;
+            }
+            else if (te->panCursor == 0 && 
                 mouseMotEv->x <= eBase->eSt.rLoc.x + rect.x)
             {
                 /* move the cursor position all the way to the start */
@@ -1502,63 +1591,38 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
                     goto out;
                 }
 
-                if (lineBytes != NULL) free(lineBytes);
-                if (neuik_TextBlock_GetLine(te->textBlk, clickLine, &lineBytes))
+                if (neuik_TextBlock_GetLineIntoBuffer(te->textBlk, clickLine, 
+                    &lineBytes, &lineBytesSize, NULL))
                 {
                     eNum = 11;
                     goto out;
                 }
 
-                if (lineLen > 1)
+                if (lineLen > 0)
                 {
                     oldCursorPos = te->cursorPos;
 
-                    for (ctr = 0; ctr < lineLen; ctr++)
+                    if (neuik_TextEdit_GetPosAtX(font, lineBytes, lineLen,
+                        (mouseMotEv->x + te->panCursor) - 
+                        (eBase->eSt.rLoc.x + rect.x), &(te->cursorPos)))
                     {
-                        aChar = lineBytes[ctr];
-
-                        lineBytes[ctr] = '\0';
-                        TTF_SizeText(font, lineBytes, &textW, &textH);
-                        lineBytes[ctr] = aChar;
-
-                        if (mouseMotEv->x + te->panCursor <= 
-                            eBase->eSt.rLoc.x + rect.x + textW)
-                        {
-                            /* cursor will be before this char */
-                            te->cursorPos   = ctr - 1;
-                            charW = textW - lastW;
-                            if (mouseMotEv->x + te->panCursor <= 
-                                eBase->eSt.rLoc.x + rect.x + textW - charW/3)
-                            {
-                                /* cursor will be before this char */
-                                te->cursorPos = ctr - 1;
-                            }
-                            else
-                            {
-                                /* cursor will be after char */
-                                te->cursorPos = ctr;
-                            }
-                            te->vertMovePos = te->cursorPos;
+                        eNum = 23;
+                        goto out;
+                    }
+                    te->vertMovePos = te->cursorPos;
 
-                            /*------------------------------------------------*/
-                            /* Update the cursor Panning (if necessary).      */
-                            /*------------------------------------------------*/
-                            if (oldCursorPos > te->cursorPos)
-                            {
-                                neuik_TextEdit_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_BACK);
-                            }
-                            else
-                            {
-                                neuik_TextEdit_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_FORWARD);
-                            }
-                            break;
-                        }
-                        lastW = textW;
-                        if (aChar == '\0') break;
+                    /*--------------------------------------------------------*/
+                    /* Update the cursor Panning (if necessary).              */
+                    /*--------------------------------------------------------*/
+                    if (oldCursorPos > te->cursorPos)
+                    {
+                        neuik_TextEdit_UpdatePanCursor(te, CURSORPAN_MOVE_BACK);
+                    }
+                    else
+                    {
+                        neuik_TextEdit_UpdatePanCursor(te, 
+                            CURSORPAN_MOVE_FORWARD);
                     }
-                    lineBytes[ctr] = aChar;
                 }
                 else
                 {
@@ -1631,9 +1695,12 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_TextInputEvent(
 {
     int                  evCaptured   = 0;
     int                  eNum         = 0; /* which error to report (if any) */
-    size_t               inpLen       = 0; /* length of text input */
+    int                  hadHighlight = FALSE;
     size_t               oldCursorPos = 0;
     size_t               oldCursorLn  = 0;
+    size_t               oldNLines    = 0;
+    unsigned long long   oldVertPanLn = 0;
+    unsigned int         oldVertPanPx = 0;
     char               * clipText     = NULL;
     SDL_TextInputEvent * textInpEv    = NULL;
     NEUIK_TextEdit     * te           = NULL;
@@ -1663,17 +1730,21 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_TextInputEvent(
 
     oldCursorPos = te->cursorPos;
     oldCursorLn  = te->cursorLine;
+    oldNLines    = te->textBlk->nLines;
+    oldVertPanLn = te->vertPanLn;
+    oldVertPanPx = te->vertPanPx;
+    hadHighlight = te->highlightIsSet;
 
     /*------------------------------------------------------------------------*/
     /* First delete the currently highlighted section (if it exists).         */
     /*------------------------------------------------------------------------*/
     if (te->highlightIsSet)
     {
-        if (neuik_TextBlock_DeleteSection(te->textBlk,
+        if (neuik_TextHistory_DeleteSection(te->history, te->textBlk,
             te->highlightStartLine, te->highlightStartPos, 
-            te->highlightEndLine, te->highlightEndPos))
+            te->highlightEndLine, te->highlightEndPos, TEXTHISTORY_EDIT))
         {
-            eNum = 10;
+            eNum = 19;
             goto out;
         }
         te->cursorLine     = te->highlightStartLine;
@@ -1682,25 +1753,16 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_TextInputEvent(
     }
 
     /*------------------------------------------------------------------------*/
-    /* Now insert the new character(s)                                        */
+    /* Now insert the new character(s); a multibyte (UTF-8) character arrives */
+    /* as a single text input event.                                          */
     /*------------------------------------------------------------------------*/
-    inpLen = strlen(textInpEv->text);
-    if (strlen(textInpEv->text) == 1)
-    {
-        if (neuik_TextBlock_InsertChar(te->textBlk, 
-            te->cursorLine, te->cursorPos, textInpEv->text[0]))
-        {
-            printf("InsertChar `%c` at [%u:%u]\n", textInpEv->text[0],
-                (unsigned int)(te->cursorLine), (unsigned int)(te->cursorPos));
-            eNum = 5;
-            goto out;
-        }
-    }
-    else
+    if (neuik_TextHistory_InsertText(te->history, te->textBlk,
+        te->cursorLine, te->cursorPos, textInpEv->text, TEXTHISTORY_TYPING,
+        &te->cursorLine, &te->cursorPos))
     {
-        fprintf(stderr, "[TODO] neuik_Element_CaptureEvent__TextEdit: add chars for inpLen > 1\n");
+        eNum = 18;
+        goto out;
     }
-    te->cursorPos += inpLen;
 
     neuik_TextEdit_UpdatePanCursor(te, CURSORPAN_TEXT_INSERTED);
 
@@ -1709,9 +1771,27 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_TextInputEvent(
         neuik_Element_TriggerCallback(te, NEUIK_CALLBACK_ON_CURSOR_MOVED);
     }
 
-    rSize = eBase->eSt.rSize;
-    rLoc  = eBase->eSt.rLoc;
-    neuik_Element_RequestRedraw(te, rLoc, rSize);
+    /*------------------------------------------------------------------------*/
+    /* Typing within a line (which doesn't scroll the view or rewrap the line)*/
+    /* only requires that line to be redrawn.                                 */
+    /*------------------------------------------------------------------------*/
+    if (!hadHighlight && te->wrapCache == NULL &&
+        te->textBlk->nLines == oldNLines &&
+        te->vertPanLn == oldVertPanLn && te->vertPanPx == oldVertPanPx)
+    {
+        if (neuik_TextEdit_RequestLineRedraw(te, 
+            te->cursorLine, te->cursorLine))
+        {
+            eNum = 22;
+            goto out;
+        }
+    }
+    else
+    {
+        rSize = eBase->eSt.rSize;
+        rLoc  = eBase->eSt.rLoc;
+        neuik_Element_RequestRedraw(te, rLoc, rSize);
+    }
     evCaptured = NEUIK_EVENTSTATE_CAPTURED;
 out:
     if (eNum > 0)
@@ -1724,6 +1804,37 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* Get the position of the character which precedes (or follows) a position   */
+/* within a line of a TextEdit; multibyte characters are stepped over whole.  */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_GetAdjacentPos(
+    NEUIK_TextEdit * te,
+    size_t           lineNo,
+    size_t           pos,
+    int              forward,
+    size_t         * adjPos)
+{
+    if (neuik_TextBlock_GetLineIntoBuffer(te->textBlk, lineNo, 
+        &te->lineBuf, &te->lineBufSize, NULL))
+    {
+        return 1;
+    }
+
+    if (forward)
+    {
+        *adjPos = neuik_UTF8_NextPos(te->lineBuf, pos);
+    }
+    else
+    {
+        *adjPos = neuik_UTF8_PrevPos(te->lineBuf, pos);
+    }
+    return 0;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_Element_CaptureEvent__TextEdit_KeyDownEvent
@@ -1739,11 +1850,18 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
 {
     int                 evCaptured   = 0;
     int                 doRedraw     = 0;
+    int                 textChanged  = FALSE;
+    int                 hadHighlight = FALSE;
+    int                 wrapMoved    = FALSE; /* cursor moved by a row */
     int                 eNum         = 0; /* which error to report (if any) */
     size_t              lineLen      = 0;
     size_t              nLines       = 0;
+    size_t              adjPos       = 0; /* position of an adjacent char */
     size_t              oldCursorPos = 0;
     size_t              oldCursorLn  = 0;
+    size_t              oldNLines    = 0;
+    unsigned long long  oldVertPanLn = 0;
+    unsigned int        oldVertPanPx = 0;
     char              * clipText     = NULL;
     NEUIK_TextEdit    * te           = NULL;
     NEUIK_ElementBase * eBase        = NULL;
@@ -1773,6 +1891,10 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
 
     oldCursorPos = te->cursorPos;
     oldCursorLn  = te->cursorLine;
+    oldNLines    = te->textBlk->nLines;
+    oldVertPanLn = te->vertPanLn;
+    oldVertPanPx = te->vertPanPx;
+    hadHighlight = te->highlightIsSet;
 
     keyEv  = (SDL_KeyboardEvent*)(ev);
     keyMod = SDL_GetModState();
@@ -1794,7 +1916,12 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
                 }
                 else if (te->cursorPos > 0)
                 {
-                    te->cursorPos--;
+                    if (neuik_TextEdit_GetAdjacentPos(te, te->cursorLine, 
+                        te->cursorPos, FALSE, &(te->cursorPos)))
+                    {
+                        eNum = 11;
+                        goto out;
+                    }
                     doRedraw = 1;
                 }
                 else if (te->cursorPos == 0 && te->cursorLine > 0)
@@ -1832,7 +1959,12 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
                         te->highlightBeginLine = te->cursorLine;
                         te->highlightBeginPos  = te->cursorPos;
                     }
-                    te->cursorPos--;
+                    if (neuik_TextEdit_GetAdjacentPos(te, te->cursorLine, 
+                        te->cursorPos, FALSE, &(te->cursorPos)))
+                    {
+                        eNum = 11;
+                        goto out;
+                    }
 
                     if (te->cursorLine < te->highlightBeginLine ||
                             (te->cursorLine == te->highlightBeginLine &&
@@ -1946,7 +2078,12 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
                     }
                     if (te->cursorPos < lineLen)
                     {
-                        te->cursorPos++;
+                        if (neuik_TextEdit_GetAdjacentPos(te, te->cursorLine, 
+                            te->cursorPos, TRUE, &(te->cursorPos)))
+                        {
+                            eNum = 11;
+                            goto out;
+                        }
                         doRedraw = 1;
                     }
                     else if (te->cursorPos == lineLen && 
@@ -1988,7 +2125,12 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
                         te->highlightBeginLine = te->cursorLine;
                         te->highlightBeginPos  = te->cursorPos;
                     }
-                    te->cursorPos++;
+                    if (neuik_TextEdit_GetAdjacentPos(te, te->cursorLine, 
+                        te->cursorPos, TRUE, &(te->cursorPos)))
+                    {
+                        eNum = 11;
+                        goto out;
+                    }
                     doRedraw = 1;
 
                     if (te->cursorLine > te->highlightBeginLine ||
@@ -2066,13 +2208,21 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
                 /*------------------------------------------------------------*/
                 if (te->cursorPos > 0)
                 {
-                    if (neuik_TextBlock_DeleteChar(te->textBlk, 
-                        te->cursorLine, (te->cursorPos-1)))
+                    /* erase the whole (possibly multibyte) character */
+                    if (neuik_TextEdit_GetAdjacentPos(te, te->cursorLine, 
+                        te->cursorPos, FALSE, &adjPos))
                     {
-                        eNum = 8;
+                        eNum = 11;
                         goto out;
                     }
-                    te->cursorPos -= 1;
+                    if (neuik_TextHistory_DeleteSection(te->history,
+                        te->textBlk, te->cursorLine, adjPos,
+                        te->cursorLine, te->cursorPos, TEXTHISTORY_ERASING))
+                    {
+                        eNum = 19;
+                        goto out;
+                    }
+                    te->cursorPos = adjPos;
                     doRedraw = 1;
                 }
                 else if (te->cursorLine > 0 && te->cursorPos == 0)
@@ -2089,11 +2239,11 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_TextBlock_MergeLines(te->textBlk,
-                        (te->cursorLine - 1)))
+                    if (neuik_TextHistory_DeleteSection(te->history,
+                        te->textBlk, (te->cursorLine - 1), lineLen,
+                        te->cursorLine, 0, TEXTHISTORY_ERASING))
                     {
-                        /* ERR: problem reported from textBlock */
-                        eNum = 9;
+                        eNum = 19;
                         goto out;
                     }
                     te->cursorLine--;
@@ -2106,11 +2256,12 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
                 /*------------------------------------------------------------*/
                 /* There is text highlighting within the line.                */
                 /*------------------------------------------------------------*/
-                if (neuik_TextBlock_DeleteSection(te->textBlk,
-                    te->highlightStartLine, te->highlightStartPos, 
-                    te->highlightEndLine, te->highlightEndPos))
+                if (neuik_TextHistory_DeleteSection(te->history, 
+                    te->textBlk, te->highlightStartLine, 
+                    te->highlightStartPos, te->highlightEndLine, 
+                    te->highlightEndPos, TEXTHISTORY_EDIT))
                 {
-                    eNum = 10;
+                    eNum = 19;
                     goto out;
                 }
                 te->cursorLine     = te->highlightStartLine;
@@ -2119,6 +2270,7 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
                 doRedraw           = 1;
             }
             neuik_TextEdit_UpdatePanCursor(te, CURSORPAN_TEXT_DELTETED);
+            textChanged = TRUE;
             break;
 
         case SDLK_DELETE:
@@ -2135,48 +2287,35 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
                     eNum = 6;
                     goto out;
                 }
-                if (lineLen == 0 && (te->textBlk->nLines > te->cursorLine))
+                if (te->cursorPos < lineLen)
                 {
-                    /*--------------------------------------------------------*/
-                    /* The cursor is in the final position of a line that is  */
-                    /* not the final line. A delete here will combine the     */
-                    /* current line to the following line.                    */
-                    /*--------------------------------------------------------*/
-                    if (neuik_TextBlock_MergeLines(te->textBlk, te->cursorLine))
+                    if (neuik_TextEdit_GetAdjacentPos(te, te->cursorLine, 
+                        te->cursorPos, TRUE, &adjPos))
                     {
-                        /* ERR: problem reported from textBlock */
-                        eNum = 9;
+                        eNum = 11;
                         goto out;
                     }
-                    doRedraw = 1;
-                }
-                else if (te->cursorPos < lineLen)
-                {
-                    /*--------------------------------------------------------*/
-                    /* Prevent the deletion of the final terminating NULL     */
-                    /* character.                                             */
-                    /*--------------------------------------------------------*/
-                    if (neuik_TextBlock_DeleteChar(te->textBlk,
-                        te->cursorLine, te->cursorPos))
+                    if (neuik_TextHistory_DeleteSection(te->history,
+                        te->textBlk, te->cursorLine, te->cursorPos,
+                        te->cursorLine, adjPos, TEXTHISTORY_ERASING))
                     {
-                        eNum = 8;
+                        eNum = 19;
                         goto out;
                     }
                     doRedraw = 1;
                 }
-                else if (
-                    (te->cursorPos == lineLen) &&
-                    (te->textBlk->nLines > te->cursorLine))
+                else if (te->textBlk->nLines > te->cursorLine + 1)
                 {
                     /*--------------------------------------------------------*/
                     /* The cursor is in the final position of a line that is  */
                     /* not the final line. A delete here will combine the     */
                     /* current line to the following line.                    */
                     /*--------------------------------------------------------*/
-                    if (neuik_TextBlock_MergeLines(te->textBlk, te->cursorLine))
+                    if (neuik_TextHistory_DeleteSection(te->history,
+                        te->textBlk, te->cursorLine, lineLen,
+                        (te->cursorLine + 1), 0, TEXTHISTORY_ERASING))
                     {
-                        /* ERR: problem reported from textBlock */
-                        eNum = 9;
+                        eNum = 19;
                         goto out;
                     }
                     doRedraw = 1;
@@ -2187,11 +2326,12 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
                 /*------------------------------------------------------------*/
                 /* There is text highlighting within the line.                */
                 /*------------------------------------------------------------*/
-                if (neuik_TextBlock_DeleteSection(te->textBlk,
-                    te->highlightStartLine, te->highlightStartPos, 
-                    te->highlightEndLine, te->highlightEndPos))
+                if (neuik_TextHistory_DeleteSection(te->history, 
+                    te->textBlk, te->highlightStartLine, 
+                    te->highlightStartPos, te->highlightEndLine, 
+                    te->highlightEndPos, TEXTHISTORY_EDIT))
                 {
-                    eNum = 10;
+                    eNum = 19;
                     goto out;
                 }
                 te->cursorLine     = te->highlightStartLine;
@@ -2200,9 +2340,25 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
                 doRedraw           = 1;
             }
             neuik_TextEdit_UpdatePanCursor(te, CURSORPAN_TEXT_DELTETED);
+            textChanged = TRUE;
             break;
 
         case SDLK_UP:
+            /*----------------------------------------------------------------*/
+            /* With word wrap, move up by a row rather than by a line.        */
+            /*----------------------------------------------------------------*/
+            if (neuik_TextEdit_WrapMoveVertical(te, FALSE, 
+                (keyMod & KMOD_SHIFT) ? TRUE : FALSE, &wrapMoved))
+            {
+                eNum = 17;
+                goto out;
+            }
+            if (wrapMoved)
+            {
+                doRedraw = TRUE;
+                break;
+            }
+
             /* Move the cursor to the start of the line of text */
             if (te->cursorLine > 0)
             {
@@ -2351,6 +2507,21 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
             break;
 
         case SDLK_DOWN:
+            /*----------------------------------------------------------------*/
+            /* With word wrap, move down by a row rather than by a line.      */
+            /*----------------------------------------------------------------*/
+            if (neuik_TextEdit_WrapMoveVertical(te, TRUE, 
+                (keyMod & KMOD_SHIFT) ? TRUE : FALSE, &wrapMoved))
+            {
+                eNum = 17;
+                goto out;
+            }
+            if (wrapMoved)
+            {
+                doRedraw = TRUE;
+                break;
+            }
+
             /* Move the cursor to the end of the line of text */
             if (neuik_TextBlock_GetLineCount(te->textBlk, &lineLen))
             {
@@ -2516,47 +2687,14 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
             /*----------------------------------------------------------------*/
             /* Insert a line break.                                           */
             /*----------------------------------------------------------------*/
-            if (neuik_TextBlock_GetLineLength(te->textBlk,
-                te->cursorLine, &lineLen))
+            if (neuik_TextHistory_InsertText(te->history, te->textBlk,
+                te->cursorLine, te->cursorPos, "\n", TEXTHISTORY_TYPING,
+                &te->cursorLine, &te->cursorPos))
             {
-                /* ERR: problem reported from textBlock */
-                eNum = 6;
+                eNum = 18;
                 goto out;
             }
 
-            if (te->cursorPos == lineLen)
-            {
-                /* cursor is at the end of the current text */
-                if (neuik_TextBlock_InsertChar(te->textBlk, 
-                    te->cursorLine, te->cursorPos, '\n'))
-                {
-                    eNum = 5;
-                    goto out;
-                }
-            }
-            else if (te->cursorPos == 0)
-            {
-                /* cursor is at the start of the current text */
-                if (neuik_TextBlock_InsertChar(te->textBlk, 
-                    te->cursorLine, te->cursorPos, '\n'))
-                {
-                    eNum = 5;
-                    goto out;
-                }
-            }
-            else
-            {
-                /* cursor is somewhere in the middle of the text */
-                if (neuik_TextBlock_InsertChar(te->textBlk, 
-                    te->cursorLine, te->cursorPos, '\n'))
-                {
-                    eNum = 5;
-                    goto out;
-                }
-            }
-            te->cursorLine += 1;
-            te->cursorPos   = 0;
-
             neuik_TextEdit_UpdatePanCursor(te, CURSORPAN_TEXT_INSERTED);
             rSize = eBase->eSt.rSize;
             rLoc  = eBase->eSt.rLoc;
@@ -2730,11 +2868,11 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
             /*----------------------------------------------------------------*/
             /* Delete the section of highlighted text                         */
             /*----------------------------------------------------------------*/
-            if (neuik_TextBlock_DeleteSection(te->textBlk,
+            if (neuik_TextHistory_DeleteSection(te->history, te->textBlk,
                 te->highlightStartLine, te->highlightStartPos, 
-                te->highlightEndLine, te->highlightEndPos))
+                te->highlightEndLine, te->highlightEndPos, TEXTHISTORY_EDIT))
             {
-                eNum = 10;
+                eNum = 19;
                 goto out;
             }
             te->cursorLine     = te->highlightStartLine;
@@ -2752,11 +2890,11 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
             /*----------------------------------------------------------------*/
             /* Delete the section of highlighted text                         */
             /*----------------------------------------------------------------*/
-            if (neuik_TextBlock_DeleteSection(te->textBlk,
+            if (neuik_TextHistory_DeleteSection(te->history, te->textBlk,
                 te->highlightStartLine, te->highlightStartPos, 
-                te->highlightEndLine, te->highlightEndPos))
+                te->highlightEndLine, te->highlightEndPos, TEXTHISTORY_EDIT))
             {
-                eNum = 10;
+                eNum = 19;
                 goto out;
             }
             te->cursorLine     = te->highlightStartLine;
@@ -2776,21 +2914,53 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
             goto out;
         }
 
-        if (neuik_TextBlock_InsertText(te->textBlk,
-            te->cursorLine, te->cursorPos, clipText,
+        if (neuik_TextHistory_InsertText(te->history, te->textBlk,
+            te->cursorLine, te->cursorPos, clipText, TEXTHISTORY_EDIT,
             &te->cursorLine, &te->cursorPos))
         {
-            eNum = 13;
+            eNum = 18;
             goto out;
         }
 
         neuik_TextEdit_UpdatePanCursor(te, CURSORPAN_TEXT_ADD_REMOVE);
-        rSize = eBase->eSt.rSize;
-        rLoc  = eBase->eSt.rLoc;
-        neuik_Element_RequestRedraw(te, rLoc, rSize);
+        textChanged = TRUE;
+        doRedraw    = TRUE;
+    }
+    else if (neuik_KeyShortcut_Redo(keyEv, keyMod))
+    {
+        /*--------------------------------------------------------------------*/
+        /* Redo is checked first; on some platforms its shortcut is the undo  */
+        /* shortcut with an added SHIFT modifier.                             */
+        /*--------------------------------------------------------------------*/
+        if (NEUIK_TextEdit_Redo(te, NULL))
+        {
+            eNum = 21;
+            goto out;
+        }
+        neuik_TextEdit_UpdatePanCursor(te, CURSORPAN_TEXT_ADD_REMOVE);
+        evCaptured = NEUIK_EVENTSTATE_CAPTURED;
+    }
+    else if (neuik_KeyShortcut_Undo(keyEv, keyMod))
+    {
+        if (NEUIK_TextEdit_Undo(te, NULL))
+        {
+            eNum = 20;
+            goto out;
+        }
+        neuik_TextEdit_UpdatePanCursor(te, CURSORPAN_TEXT_ADD_REMOVE);
+        evCaptured = NEUIK_EVENTSTATE_CAPTURED;
     }
     else if (neuik_KeyShortcut_SelectAll(keyEv, keyMod))
     {
+        /*--------------------------------------------------------------------*/
+        /* A file which is still being loaded must be loaded in full.         */
+        /*--------------------------------------------------------------------*/
+        if (neuik_TextEdit_LoadAll(te))
+        {
+            eNum = 15;
+            goto out;
+        }
+
         /*--------------------------------------------------------------------*/
         /* Get the total number of lines and the length of the final line.    */
         /*--------------------------------------------------------------------*/
@@ -2832,9 +3002,29 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
             neuik_Element_TriggerCallback(te, NEUIK_CALLBACK_ON_CURSOR_MOVED);
         }
 
-        rSize = eBase->eSt.rSize;
-        rLoc  = eBase->eSt.rLoc;
-        neuik_Element_RequestRedraw(te, rLoc, rSize);
+        /*--------------------------------------------------------------------*/
+        /* If the view, the selection, and the other lines are unchanged, only*/
+        /* the lines the cursor moved between (or the line that was edited)  */
+        /* need to be redrawn. An edited line may rewrap (word wrap).         */
+        /*--------------------------------------------------------------------*/
+        if (!hadHighlight && !te->highlightIsSet &&
+            !(textChanged && te->wrapCache != NULL) &&
+            te->textBlk->nLines == oldNLines &&
+            te->vertPanLn == oldVertPanLn && te->vertPanPx == oldVertPanPx)
+        {
+            if (neuik_TextEdit_RequestLineRedraw(te, 
+                oldCursorLn, te->cursorLine))
+            {
+                eNum = 22;
+                goto out;
+            }
+        }
+        else
+        {
+            rSize = eBase->eSt.rSize;
+            rLoc  = eBase->eSt.rLoc;
+            neuik_Element_RequestRedraw(te, rLoc, rSize);
+        }
     }
     evCaptured = NEUIK_EVENTSTATE_CAPTURED;
 out:
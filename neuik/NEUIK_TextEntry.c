@@ -29,6 +29,7 @@
 #include "NEUIK_platform.h"
 #include "NEUIK_TextEntry.h"
 #include "NEUIK_TextEntry_internal.h"
+#include "neuik_UTF8.h"
 #include "NEUIK_Element_internal.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
@@ -198,9 +199,11 @@ int neuik_Object_New__TextEntry(
         goto out;
     }
     /* Allocation successful */
-    te->text[0] = '\0';
+    te->text[0]      = '\0';
+    te->text[sLen-1] = '\0';
     te->textLen = 0;
     te->textAllocSize = sLen;
+    te->gapStart = 0;
 
     /*------------------------------------------------------------------------*/
     /* All allocations successful                                             */
@@ -300,14 +303,12 @@ int NEUIK_MakeTextEntry(
     NEUIK_TextEntry ** tePtr, /* [out] The newly created NEUIK_TextEntry. */
     const char       * text)  /* [in]  Initial TextEntry text. */
 {
-    size_t            sLen       = 1;
     int               eNum       = 0; /* which error to report (if any) */
     NEUIK_TextEntry * te         = NULL;
     static char       funcName[] = "NEUIK_MakeTextEntry";
     static char     * errMsgs[]  = {"", // [0] no error
         "Failure in function `neuik_Object_New__TextEntry`.", // [1]
-        "Failure to allocate memory.",                        // [2]
-        "Failure to reallocate memory.",                      // [3]
+        "Failure in function `neuik_TextEntry_InsertText`.",  // [2]
     };
 
     if (neuik_Object_New__TextEntry((void**)tePtr))
@@ -320,58 +321,13 @@ int NEUIK_MakeTextEntry(
     if (text == NULL)
     {
         /* textEntry will contain no text */
-        if (te->text != NULL) te->text[0] = '\0';
         goto out;
     }
-    else if (text[0] == '\0')
-    {
-        /* textEntry will contain no text */
-        if (te->text != NULL) te->text[0] = '\0';
-        goto out;
-    }
-    else
-    {
-        te->textLen  = strlen(text);    
-        sLen        += te->textLen; 
-    }
-
-    /*------------------------------------------------------------------------*/
-    /* Make sure the allocated text buffer is large enough to store the text  */
-    /*------------------------------------------------------------------------*/
-    if (te->text == NULL)
-    {
-        /*--------------------------------------------------------------------*/
-        /* Memory not currently allocated; allocate now.                      */
-        /*--------------------------------------------------------------------*/
-        te->text = (char*)malloc((sLen+10)*sizeof(char));
-        if (te->text == NULL)
-        {
-            eNum = 2;
-            goto out;
-        }
-        te->textAllocSize = sLen+10;
-    }
-    else if (sLen > te->textAllocSize)
-    {
-        /*--------------------------------------------------------------------*/
-        /* Reallocate memory so that the string can be fit.                   */
-        /*--------------------------------------------------------------------*/
-        te->text = (char*)realloc(te->text, (sLen+10)*sizeof(char));
-        if (te->text == NULL)
-        {
-            eNum = 3;
-            goto out;
-        }
-        te->textAllocSize = sLen+10;
-    }
 
-    if (text != NULL)
+    if (neuik_TextEntry_InsertText(te, 0, text, strlen(text)))
     {
-        strcpy(te->text, text);
-    }
-    else
-    {
-        te->text[0] = '\0';
+        eNum = 2;
+        goto out;
     }
 out:
     if (eNum > 0)
@@ -511,7 +467,7 @@ int neuik_Element_GetMinSize__TextEntry(
     }
 
     /* this textEntry does not contain text */
-    TTF_SizeText(font, " ", &tW, &tH);
+    TTF_SizeUTF8(font, " ", &tW, &tH);
 
     rSize->w = tW + aCfg->fontEmWidth;
     rSize->h = 2 + (int)(1.5 * (float)TTF_FontHeight(font));
@@ -549,15 +505,13 @@ int NEUIK_TextEntry_SetText(
     NEUIK_TextEntry * te,
     const char      * text)
 {
-    size_t          sLen    = 1;
-    size_t          textLen = 0;
     RenderSize      rSize;
     RenderLoc       rLoc;
     int             eNum    = 0; /* which error to report (if any) */
     static char     funcName[] = "NEUIK_TextEntry_SetText";
     static char   * errMsgs[] = {"", // [0] no error
         "Argument `te` is not of TextEntry class.",         // [1]
-        "Failure to allocate memory.",                      // [2]
+        "Failure in function `neuik_TextEntry_InsertText`.", // [2]
         "Failure in `neuik_Element_GetSizeAndLocation()`.", // [3]
     };
 
@@ -570,49 +524,17 @@ int NEUIK_TextEntry_SetText(
     /*------------------------------------------------------------------------*/
     /* Set the new TextEntry text contents                                    */
     /*------------------------------------------------------------------------*/
-    if (text == NULL){
-        /* textentry will contain no text */
-        if (te->textAllocSize > 0)
-        {
-            te->text[0] = '\0';
-        }
-    }
-    else if (text[0] == '\0')
-    {
-        /* textentry will contain no text */
-        if (te->textAllocSize > 0)
-        {
-            te->text[0] = '\0';
-        }
-    }
-    else
+    te->textLen  = 0;
+    te->gapStart = 0;
+    if (text != NULL)
     {
-        textLen = strlen(text);
-        if (textLen > te->textAllocSize)
+        if (neuik_TextEntry_InsertText(te, 0, text, strlen(text)))
         {
-            sLen += textLen;
-            if (te->text != NULL) {
-                te->text = (char*)realloc(te->text, sLen*sizeof(char));
-                if (te->text == NULL) {
-                    eNum = 2;
-                    goto out;
-                }
-            }
-            else
-            {
-                te->text = (char*)malloc(sLen*sizeof(char));
-                if (te->text == NULL) {
-                    eNum = 2;
-                    goto out;
-                }
-            }
-            te->textAllocSize = sLen;
+            eNum = 2;
+            goto out;
         }
-        /* Allocation successful */
-        strcpy(te->text, text);
     }
 
-    te->textLen        = textLen;
     te->highlightBegin = -1;
     te->highlightStart = -1;
     te->highlightEnd   = -1;
@@ -672,6 +594,7 @@ const char * NEUIK_TextEntry_GetText(
     }
     else
     {
+        neuik_TextEntry_CloseGap(te);
         rvPtr = te->text;
     }
 out:
@@ -684,6 +607,257 @@ out:
     return rvPtr;
 }
 
+
+/*----------------------------------------------------------------------------*/
+/* The text of a TextEntry is held within a gap buffer. The unused portion of */
+/* the allocation (the gap) is kept at the last edit position so that runs of */
+/* insertions or deletions at the cursor don't need to shift the text after  */
+/* it. The text is laid out as follows:                                       */
+/*                                                                            */
+/*   [0, gapStart)                     text before the gap                    */
+/*   [gapStart, gapStart + gapSize)    the gap                                */
+/*   [gapStart + gapSize, allocSize-1) text after the gap                     */
+/*                                                                            */
+/* where `gapSize = textAllocSize - 1 - textLen`. The final byte of the       */
+/* allocation is always NUL, so the text after the gap is a NUL terminated    */
+/* string. Rendering and event handling read the text on both sides of the   */
+/* gap; only readers outside of the TextEntry (e.g., GetText, the clipboard)  */
+/* call `neuik_TextEntry_CloseGap` to make `te->text` a single string.        */
+/*----------------------------------------------------------------------------*/
+#define TEXTENTRY_GAP_SIZE(te) ((te)->textAllocSize - 1 - (te)->textLen)
+
+
+/*----------------------------------------------------------------------------*/
+/* Move the gap of a TextEntry text buffer to the specified position.         */
+/*----------------------------------------------------------------------------*/
+static void neuik_TextEntry_MoveGap(
+    NEUIK_TextEntry * te,
+    size_t            pos)
+{
+    size_t gapSize;
+
+    gapSize = TEXTENTRY_GAP_SIZE(te);
+    if (pos < te->gapStart)
+    {
+        memmove(te->text + pos + gapSize, te->text + pos, te->gapStart - pos);
+    }
+    else if (pos > te->gapStart)
+    {
+        memmove(te->text + te->gapStart, te->text + te->gapStart + gapSize, 
+            pos - te->gapStart);
+    }
+    te->gapStart = pos;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEntry_CloseGap
+ *
+ *  Description:   Move the gap to the end of the text so that `te->text` is a
+ *                 contiguous, NULL-terminated string.
+ *
+ ******************************************************************************/
+void neuik_TextEntry_CloseGap(
+    NEUIK_TextEntry * te)
+{
+    if (te->text == NULL) return;
+
+    if (te->gapStart != te->textLen)
+    {
+        neuik_TextEntry_MoveGap(te, te->textLen);
+    }
+    te->text[te->textLen] = '\0';
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEntry_GetTextLayout
+ *
+ *  Description:   Get the layout of the text of a TextEntry in a font, read 
+ *                 from both sides of the gap. The `text` of the layout is a 
+ *                 contiguous copy of the text (valid until the next layout).
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextEntry_GetTextLayout(
+    NEUIK_TextEntry   * te,
+    TTF_Font          * font,
+    neuik_TextLayout ** layoutPtr)
+{
+    if (te->text == NULL)
+    {
+        return neuik_GetTextLayout(font, NULL, 0, layoutPtr);
+    }
+    return neuik_GetSplitTextLayout(font, te->text, te->gapStart, 
+        te->text + te->gapStart + TEXTENTRY_GAP_SIZE(te), 
+        te->textLen - te->gapStart, layoutPtr);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEntry_PrevPos
+ *
+ *  Description:   Get the position of the character which precedes byte
+ *                 position `pos` of the text of a TextEntry. The gap is moved
+ *                 to `pos` (the cursor), as it would be for the next edit.
+ *
+ *  Returns:       The position of the preceding character (0 at the start).
+ *
+ ******************************************************************************/
+size_t neuik_TextEntry_PrevPos(
+    NEUIK_TextEntry * te,
+    size_t            pos)
+{
+    if (te->text == NULL || pos == 0) return 0;
+    if (pos > te->textLen) pos = te->textLen;
+
+    neuik_TextEntry_MoveGap(te, pos);
+    return neuik_UTF8_PrevPos(te->text, pos);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEntry_NextPos
+ *
+ *  Description:   Get the position of the character which follows the one at 
+ *                 byte position `pos` of the text of a TextEntry. The gap is 
+ *                 moved to `pos` (the cursor), as it would be for the next 
+ *                 edit.
+ *
+ *  Returns:       The position of the following character (`pos` at the end).
+ *
+ ******************************************************************************/
+size_t neuik_TextEntry_NextPos(
+    NEUIK_TextEntry * te,
+    size_t            pos)
+{
+    size_t nBytes;
+
+    if (te->text == NULL || pos >= te->textLen) return te->textLen;
+
+    neuik_TextEntry_MoveGap(te, pos);
+    nBytes = neuik_UTF8_CharSize(te->text + pos + TEXTENTRY_GAP_SIZE(te));
+    if (nBytes == 0 || nBytes > te->textLen - pos) nBytes = 1;
+
+    return pos + nBytes;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEntry_InsertText
+ *
+ *  Description:   Insert text at the specified position of a TextEntry. The 
+ *                 text buffer grows geometrically when the gap is too small.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextEntry_InsertText(
+    NEUIK_TextEntry * te,
+    size_t            pos,
+    const char      * text,
+    size_t            textLen)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    size_t        newSize;
+    char        * newText;
+    static char   funcName[] = "neuik_TextEntry_InsertText";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `pos` is beyond the end of the text.", // [1]
+        "Failure to reallocate memory.",                 // [2]
+    };
+
+    if (pos > te->textLen)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (textLen == 0) goto out;
+
+    if (te->text == NULL || TEXTENTRY_GAP_SIZE(te) < textLen)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Grow the buffer; with the gap at the end, the new space is simply  */
+        /* appended to it.                                                    */
+        /*--------------------------------------------------------------------*/
+        neuik_TextEntry_CloseGap(te);
+        newSize = 2*(te->textLen + textLen + 1);
+        newText = (char*)realloc(te->text, newSize*sizeof(char));
+        if (newText == NULL)
+        {
+            eNum = 2;
+            goto out;
+        }
+        te->text          = newText;
+        te->textAllocSize = newSize;
+        te->gapStart      = te->textLen;
+        te->text[newSize-1] = '\0';
+    }
+
+    neuik_TextEntry_MoveGap(te, pos);
+    memcpy(te->text + pos, text, textLen);
+    te->gapStart += textLen;
+    te->textLen  += textLen;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEntry_DeleteText
+ *
+ *  Description:   Delete `nBytes` bytes of text starting at the specified 
+ *                 position of a TextEntry.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextEntry_DeleteText(
+    NEUIK_TextEntry * te,
+    size_t            pos,
+    size_t            nBytes)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_TextEntry_DeleteText";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Specified section extends beyond the end of the text.", // [1]
+    };
+
+    if (pos > te->textLen || nBytes > te->textLen - pos)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (nBytes == 0) goto out;
+
+    /*------------------------------------------------------------------------*/
+    /* With the gap at `pos`, the deleted text is absorbed into the gap.      */
+    /*------------------------------------------------------------------------*/
+    neuik_TextEntry_MoveGap(te, pos);
+    te->textLen -= nBytes;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
 void neuik_TextEntry_Configure_capture_segv(
     int sig_num)
 {
@@ -886,7 +1060,6 @@ int neuik_Element_Render__TextEntry(
     SDL_Renderer  * xRend, /* the external renderer to prepare the texture for */
     int             mock)  /* If true; calculate sizes/locations but don't draw */
 {
-    char                    tempChar   = 0; /* a temporary character */
     int                     borderW    = 1; /* width of entry border line */
     int                     ctr        = 0;
     int                     eNum       = 0; /* which error to report (if any) */
@@ -909,6 +1082,7 @@ int neuik_Element_Render__TextEntry(
     neuik_MaskMap         * maskMap    = NULL;
     NEUIK_TextEntry       * te         = NULL;
     NEUIK_TextEntryConfig * aCfg       = NULL; /* the active textEntry config */
+    neuik_TextLayout      * layout     = NULL;
     static char             funcName[] = "neuik_Element_Render__TextEntry";
     static char           * errMsgs[]  = {"", // [0] no error
         "Argument `elem` is not of TextEntry class.",                    // [1]
@@ -919,6 +1093,8 @@ int neuik_Element_Render__TextEntry(
         "FontSet_GetFont returned NULL.",                                // [6]
         "", // [7]
         "Failure in neuik_Element_RedrawBackground().",                  // [8]
+        "Failure in `SDL_CreateSoftwareRenderer()`.",                    // [9]
+        "Failure in `neuik_GetTextLayout()`.",                           // [10]
     };
 
     te = (NEUIK_TextEntry *)elem;
@@ -974,7 +1150,7 @@ int neuik_Element_Render__TextEntry(
     /*------------------------------------------------------------------------*/
     if (te->text != NULL)
     {
-        if (te->text[0] != '\0')
+        if (te->textLen > 0)
         {
             /* Determine the full size of the rendered text content */
             font = NEUIK_FontSet_GetFont(aCfg->fontSet, aCfg->fontSize,
@@ -1008,10 +1184,23 @@ int neuik_Element_Render__TextEntry(
     /*------------------------------------------------------------------------*/
     if (te->text != NULL)
     {
-        if (te->text[0] != '\0')
+        if (te->textLen > 0)
         {
-            /* Determine the full size of the rendered text content */
-            TTF_SizeText(font, te->text, &textW, &textH);
+            /*----------------------------------------------------------------*/
+            /* Character positions (highlight and cursor) are looked up in    */
+            /* the layout rather than by measuring each prefix of the text.   */
+            /* The layout reads both sides of the gap and holds a contiguous  */
+            /* copy of the text, which is what is measured and rendered.      */
+            /*----------------------------------------------------------------*/
+            if (neuik_TextEntry_GetTextLayout(te, font, &layout))
+            {
+                eNum = 10;
+                goto out;
+            }
+
+            /* The full size of the rendered text content (from its layout) */
+            textW = layout->charX[layout->nChars];
+            textH = TTF_FontHeight(font);
             textWFull = textW;
 
             /*----------------------------------------------------------------*/
@@ -1042,7 +1231,7 @@ int neuik_Element_Render__TextEntry(
             /*----------------------------------------------------------------*/
             /* Render the Text now, it will be copied on after highlighting   */
             /*----------------------------------------------------------------*/
-            tTex = NEUIK_RenderText(te->text, font, *fgClr, te->textRend, &textW, &textH);
+            tTex = NEUIK_RenderText(layout->text, font, *fgClr, te->textRend, &textW, &textH);
             if (tTex == NULL)
             {
                 eNum = 6;
@@ -1059,31 +1248,12 @@ int neuik_Element_Render__TextEntry(
                 rect.w = textW;
                 rect.h = (int)(1.1*textH);
 
-                textW = 0;
-                textH = 0;
                 /* determine the point of the start of the bgkd highlight */
-                if (te->highlightStart != 0)
-                {
-                    tempChar = te->text[te->highlightStart];
-                    te->text[te->highlightStart] = '\0';
-                    TTF_SizeText(font, te->text, &textW, &textH);
-                    te->text[te->highlightStart] = tempChar;
-                }
-                rect.x += textW;
+                rect.x += neuik_TextLayout_GetX(layout, te->highlightStart);
 
-                /* determine the point of the start of the bgkd highlight */
-                if (te->highlightEnd < te->textLen)
-                {
-                    tempChar = te->text[1 + te->highlightEnd];
-                    te->text[1 + te->highlightEnd] = '\0';
-                    TTF_SizeText(font, te->text + te->highlightStart, &textW, &textH);
-                    te->text[1 + te->highlightEnd] = tempChar;
-                }
-                else
-                {
-                    TTF_SizeText(font, te->text + te->highlightStart, &textW, &textH);
-                }
-                hlWidth = textW;
+                /* determine the width of the bgkd highlight */
+                hlWidth = neuik_TextLayout_GetX(layout, 1 + te->highlightEnd) -
+                    neuik_TextLayout_GetX(layout, te->highlightStart);
                 rect.w = hlWidth;
 
                 bgClr = &(aCfg->bgColorHl);
@@ -1111,19 +1281,14 @@ int neuik_Element_Render__TextEntry(
                 /*------------------------------------------------------------*/
                 SDL_SetRenderDrawColor(te->textRend, fgClr->r, fgClr->g, fgClr->b, 255);
 
-                tempChar = te->text[te->cursorPos];
-                if (tempChar == '\0')
+                if (te->cursorPos >= te->textLen)
                 {
                     rect.x = textWFull - 1;
                 }
                 else
                 {
-                    te->text[te->cursorPos] = '\0';
-                    TTF_SizeText(font, te->text, &textW, &textH);
-                    te->text[te->cursorPos] = tempChar;
-
                     /* this will be the positin of the cursor */
-                    rect.x = textW;
+                    rect.x = neuik_TextLayout_GetX(layout, te->cursorPos);
                 }
                 te->cursorX = rect.x;
                 SDL_RenderDrawLine(te->textRend, 
@@ -1186,7 +1351,7 @@ int neuik_Element_Render__TextEntry(
 
         if (textWFull < normWidth) 
         {
-            TTF_SizeText(font, te->text, &textW, &textH);
+            textW = textWFull;
 
             rect.x = rl.x;
             rect.y = rl.y + 1;
@@ -1212,8 +1377,6 @@ int neuik_Element_Render__TextEntry(
         }
         else
         {
-            TTF_SizeText(font, te->text, &textW, &textH);
-
             rect.x = rl.x + 6;
             rect.y = rl.y + 1;
             rect.w = normWidth;
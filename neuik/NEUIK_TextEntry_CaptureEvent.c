@@ -22,6 +22,7 @@
 #include "NEUIK_Element_internal.h"
 #include "NEUIK_Window_internal.h"
 #include "NEUIK_platform.h"
+#include "neuik_UTF8.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
 
@@ -32,6 +33,9 @@ static char * errMsgs[]  = {"", // [0] no error
     "Failed to get text from clipboard.",                            // [2]
     "Argument `elem` is not of TextEntry class.",                    // [3]
     "Argument `elem` caused `neuik_Object_GetClassObject` to fail.", // [4]
+    "Failure in function `neuik_TextEntry_InsertText`.",             // [5]
+    "Failure in function `neuik_TextEntry_DeleteText`.",             // [6]
+    "Failure in function `neuik_TextEntry_GetTextLayout`.",          // [7]
 };
 
 
@@ -50,17 +54,17 @@ int neuik_TextEntry_UpdatePanCursor(
 {
     int                     eNum       = 0; /* which error to report (if any) */
     int                     textW      = 0;
-    int                     textH      = 0;
     int                     normWidth  = 0;
-    char                    tempChar;
     TTF_Font              * font       = NULL;
     NEUIK_ElementBase     * eBase      = NULL;
     NEUIK_TextEntryConfig * aCfg       = NULL; /* the active textEntry config */
+    neuik_TextLayout      * layout     = NULL;
     static char             funcName[] = "neuik_TextEntry_UpdatePanCursor";
     static char           * errMsgs[] = {"", // [0] no error
         "Argument `te` is not of TextEntry class.",                    // [1]
         "Argument `te` caused `neuik_Object_GetClassObject` to fail.", // [2]
         "FontSet_GetFont returned NULL.",                              // [3]
+        "Failure in `neuik_TextEntry_GetTextLayout()`.",               // [4]
     };
 
     if (!neuik_Object_IsClass(te, neuik__Class_TextEntry))
@@ -87,7 +91,7 @@ int neuik_TextEntry_UpdatePanCursor(
         }
         goto out;
     }
-    if (te->text[0] == '\0') 
+    if (te->textLen == 0) 
     {
         te->panCursor = 0;
         if (neuik__Report_Debug)
@@ -108,7 +112,7 @@ int neuik_TextEntry_UpdatePanCursor(
     /*------------------------------------------------------------------------*/
     if (te->text != NULL)
     {
-        if (te->text[0] != '\0')
+        if (te->textLen > 0)
         {
             /* Determine the full size of the rendered text content */
             font = NEUIK_FontSet_GetFont(aCfg->fontSet, aCfg->fontSize,
@@ -121,16 +125,27 @@ int neuik_TextEntry_UpdatePanCursor(
         }
     }
 
+    /*------------------------------------------------------------------------*/
+    /* The layout reads the text on both sides of the gap; its `text` is a    */
+    /* contiguous copy of the text which can be measured as a string.         */
+    /*------------------------------------------------------------------------*/
+    if (neuik_TextEntry_GetTextLayout(te, font, &layout))
+    {
+        eNum = 4;
+        goto out;
+    }
+
     /*------------------------------------------------------------------------*/
     /* Before proceeding, check to see where the cursor is located within the */
-    /* currently visible TextEntry field.                                     */
+    /* currently visible TextEntry field (the layout ends at the text width). */
     /*------------------------------------------------------------------------*/
-    TTF_SizeText(font, te->text, &textW, &textH);
+    textW = layout->charX[layout->nChars];
     textW++;
     normWidth = (eBase->eSt.rSize).w - 12; 
     if (neuik__Report_Debug)
     {
-        printf("textW: %d, normWidth %d, `%s`\n", textW, normWidth, te->text);
+        printf("textW: %d, normWidth %d, `%s`\n", textW, normWidth, 
+            layout->text);
     }
     if (textW < normWidth) 
     {
@@ -158,13 +173,7 @@ int neuik_TextEntry_UpdatePanCursor(
         /*--------------------------------------------------------------------*/
         /* Update the cursorX position                                        */
         /*--------------------------------------------------------------------*/
-        tempChar = te->text[te->cursorPos];
-        if (tempChar != '\0')
-        {
-            te->text[te->cursorPos] = '\0';
-        }
-        TTF_SizeText(font, te->text, &(te->cursorX), &textH);
-        te->text[te->cursorPos] = tempChar;
+        te->cursorX = neuik_TextLayout_GetX(layout, te->cursorPos);
 
 
         switch (cursorChange)
@@ -221,6 +230,27 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* Get the cursor position (byte offset) closest to an x-offset within the    */
+/* text of a TextEntry.                                                       */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEntry_GetPosAtX(
+    NEUIK_TextEntry * te,
+    TTF_Font        * font,
+    int               x,
+    size_t          * pos)
+{
+    neuik_TextLayout * layout = NULL;
+
+    if (neuik_TextEntry_GetTextLayout(te, font, &layout)) return 1;
+
+    *pos = neuik_TextLayout_GetPosAtX(layout, x);
+    return 0;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_Element_CaptureEvent__TextEntry_MouseEvent
@@ -236,17 +266,13 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_MouseEvent(
 {
     neuik_EventState        evCaptured   = NEUIK_EVENTSTATE_NOT_CAPTURED;
     int                     textW        = 0;
-    int                     textH        = 0;
-    int                     charW        = 0;
     int                     doContinue   = 0;
     int                     eNum         = 0; /* which error to report (if any) */
-    int                     lastW        = 0; /* position of previous char */
     int                     normWidth    = 0;
     size_t                  oldCursorPos = 0;
-    size_t                  ctr;
-    char                    aChar;
     char                  * clipText     = NULL;
     TTF_Font              * font         = NULL;
+    neuik_TextLayout      * layout       = NULL;
     SDL_Rect                rect         = {0, 0, 0 ,0};
     SDL_Keymod              keyMod;
     RenderSize              rSize;
@@ -342,7 +368,7 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_MouseEvent(
         /*--------------------------------------------------------------------*/
         if (te->text != NULL)
         {
-            if (te->text[0] != '\0')
+            if (te->textLen > 0)
             {
                 doContinue = 1;
                 font = NEUIK_FontSet_GetFont(aCfg->fontSet, aCfg->fontSize,
@@ -352,9 +378,14 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_MouseEvent(
                     eNum = 1;
                     goto out;
                 }
+                if (neuik_TextEntry_GetTextLayout(te, font, &layout))
+                {
+                    eNum = 7;
+                    goto out;
+                }
 
                 normWidth = (eBase->eSt.rSize).w - 12; 
-                TTF_SizeText(font, te->text, &textW, &textH);
+                textW = layout->charX[layout->nChars];
                 rect.w = textW;
 
                 if (textW < normWidth) 
@@ -419,71 +450,28 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_MouseEvent(
             else
             {
                 /* move the cursor somewhere within the text */
-                if (te->textLen > 1)
+                oldCursorPos = te->cursorPos;
+                if (neuik_TextEntry_GetPosAtX(te, font,
+                    (mouseButEv->x + te->panCursor) -
+                    (eBase->eSt.rLoc.x + rect.x),
+                    &(te->cursorPos)))
                 {
-                    oldCursorPos = te->cursorPos;
-                    for (ctr = 1;;ctr++)
-                    {
-                        aChar = te->text[ctr];
-
-                        te->text[ctr] = '\0';
-                        TTF_SizeText(font, te->text, &textW, &textH);
-                        te->text[ctr] = aChar;
+                    eNum = 7;
+                    goto out;
+                }
 
-                        if (mouseButEv->x + te->panCursor <= eBase->eSt.rLoc.x + rect.x + textW)
-                        {
-                            /* cursor will be before this char */
-                            te->cursorPos = ctr - 1;
-                            charW = textW - lastW;
-                            if (mouseButEv->x + te->panCursor <= 
-                                eBase->eSt.rLoc.x + rect.x + textW - charW/3)
-                            {
-                                /* cursor will be before this char */
-                                te->cursorPos = ctr - 1;
-                            }
-                            else
-                            {
-                                /* cursor will be after char */
-                                te->cursorPos = ctr;
-                            }
-
-                            /*------------------------------------------------*/
-                            /* Update the cursor Panning (if necessary)       */
-                            /*------------------------------------------------*/
-                            if (oldCursorPos > te->cursorPos)
-                            {
-                                neuik_TextEntry_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_BACK);
-                            }
-                            else
-                            {
-                                neuik_TextEntry_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_FORWARD);
-                            }
-                            break;
-                        }
-                        lastW = textW;
-                        if (aChar == '\0') break;
-                    }
-                    te->text[ctr] = aChar;
-                    te->highlightBegin = -1; /* unhighlight text */
+                /*------------------------------------------------------------*/
+                /* Update the cursor Panning (if necessary)                   */
+                /*------------------------------------------------------------*/
+                if (oldCursorPos > te->cursorPos)
+                {
+                    neuik_TextEntry_UpdatePanCursor(te, CURSORPAN_MOVE_BACK);
                 }
                 else
                 {
-                    TTF_SizeText(font, te->text, &textW, &textH);
-
-                    if (mouseButEv->x <= eBase->eSt.rLoc.x + rect.x + textW/2)
-                    {
-                        /* cursor will be before this char */
-                        te->cursorPos = 0;
-                    }
-                    else
-                    {
-                        /* cursor will be after char */
-                        te->cursorPos = 1;
-                    }
-                    te->highlightBegin = -1; /* unhighlight text */
+                    neuik_TextEntry_UpdatePanCursor(te, CURSORPAN_MOVE_FORWARD);
                 }
+                te->highlightBegin = -1; /* unhighlight text */
             }
             te->clickOrigin   = te->cursorPos;
             te->timeLastClick = SDL_GetTicks();
@@ -522,69 +510,26 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_MouseEvent(
             else
             {
                 /* move the cursor somewhere within the text */
-                if (te->textLen > 1)
+                oldCursorPos = te->cursorPos;
+                if (neuik_TextEntry_GetPosAtX(te, font,
+                    (mouseButEv->x + te->panCursor) -
+                    (eBase->eSt.rLoc.x + rect.x),
+                    &(te->cursorPos)))
                 {
-                    oldCursorPos = te->cursorPos;
-                    for (ctr = 1;;ctr++)
-                    {
-                        aChar = te->text[ctr];
-
-                        te->text[ctr] = '\0';
-                        TTF_SizeText(font, te->text, &textW, &textH);
-                        te->text[ctr] = aChar;
+                    eNum = 7;
+                    goto out;
+                }
 
-                        if (mouseButEv->x + te->panCursor <= 
-                            eBase->eSt.rLoc.x + rect.x + textW)
-                        {
-                            /* cursor will be before this char */
-                            te->cursorPos = ctr - 1;
-                            charW = textW - lastW;
-                            if (mouseButEv->x + te->panCursor <= 
-                                eBase->eSt.rLoc.x + rect.x + textW - charW/3)
-                            {
-                                /* cursor will be before this char */
-                                te->cursorPos = ctr - 1;
-                            }
-                            else
-                            {
-                                /* cursor will be after char */
-                                te->cursorPos = ctr;
-                            }
-
-                            /*------------------------------------------------*/
-                            /* Update the cursor Panning (if necessary)       */
-                            /*------------------------------------------------*/
-                            if (oldCursorPos > te->cursorPos)
-                            {
-                                neuik_TextEntry_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_BACK);
-                            }
-                            else
-                            {
-                                neuik_TextEntry_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_FORWARD);
-                            }
-                            break;
-                        }
-                        lastW = textW;
-                        if (aChar == '\0') break;
-                    }
-                    te->text[ctr] = aChar;
+                /*------------------------------------------------------------*/
+                /* Update the cursor Panning (if necessary)                   */
+                /*------------------------------------------------------------*/
+                if (oldCursorPos > te->cursorPos)
+                {
+                    neuik_TextEntry_UpdatePanCursor(te, CURSORPAN_MOVE_BACK);
                 }
                 else
                 {
-                    TTF_SizeText(font, te->text, &textW, &textH);
-
-                    if (mouseButEv->x <= eBase->eSt.rLoc.x + rect.x + textW/2)
-                    {
-                        /* cursor will be before this char */
-                        te->cursorPos = 0;
-                    }
-                    else
-                    {
-                        /* cursor will be after char */
-                        te->cursorPos = 1;
-                    }
+                    neuik_TextEntry_UpdatePanCursor(te, CURSORPAN_MOVE_FORWARD);
                 }
             }
 
@@ -662,7 +607,7 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_MouseEvent(
             /*----------------------------------------------------------------*/
             if (te->text != NULL)
             {
-                if (te->text[0] != '\0')
+                if (te->textLen > 0)
                 {
                     doContinue = 1;
                     font = NEUIK_FontSet_GetFont(aCfg->fontSet, aCfg->fontSize,
@@ -672,10 +617,15 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_MouseEvent(
                         eNum = 1;
                         goto out;
                     }
+                    if (neuik_TextEntry_GetTextLayout(te, font, &layout))
+                    {
+                        eNum = 7;
+                        goto out;
+                    }
 
 
                     normWidth = (eBase->eSt.rSize).w - 12; 
-                    TTF_SizeText(font, te->text, &textW, &textH);
+                    textW = layout->charX[layout->nChars];
                     rect.w = textW;
 
                     if (textW < normWidth) 
@@ -722,73 +672,28 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_MouseEvent(
             else
             {
                 /* move the cursor somewhere within the text */
-                if (te->textLen > 1)
+                oldCursorPos = te->cursorPos;
+                if (neuik_TextEntry_GetPosAtX(te, font,
+                    (mouseMotEv->x + te->panCursor) -
+                    (eBase->eSt.rLoc.x + rect.x),
+                    &(te->cursorPos)))
                 {
-                    oldCursorPos = te->cursorPos;
-
-                    for (ctr = 1;;ctr++)
-                    {
-                        aChar = te->text[ctr];
-
-                        te->text[ctr] = '\0';
-                        TTF_SizeText(font, te->text, &textW, &textH);
-                        te->text[ctr] = aChar;
+                    eNum = 7;
+                    goto out;
+                }
 
-                        if (mouseMotEv->x + te->panCursor <= 
-                            eBase->eSt.rLoc.x + rect.x + textW)
-                        {
-                            /* cursor will be before this char */
-                            te->cursorPos = ctr - 1;
-                            charW = textW - lastW;
-                            if (mouseMotEv->x + te->panCursor <= 
-                                eBase->eSt.rLoc.x + rect.x + textW - charW/3)
-                            {
-                                /* cursor will be before this char */
-                                te->cursorPos = ctr - 1;
-                            }
-                            else
-                            {
-                                /* cursor will be after char */
-                                te->cursorPos = ctr;
-                            }
-
-                            /*--------------------------------------------*/
-                            /* Update the cursor Panning (if necessary)   */
-                            /*--------------------------------------------*/
-                            if (oldCursorPos > te->cursorPos)
-                            {
-                                neuik_TextEntry_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_BACK);
-                            }
-                            else
-                            {
-                                neuik_TextEntry_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_FORWARD);
-                            }
-                            break;
-                        }
-                        lastW = textW;
-                        if (aChar == '\0') break;
-                    }
-                    te->text[ctr] = aChar;
-                    te->highlightBegin = -1; /* unhighlight text */
+                /*------------------------------------------------------------*/
+                /* Update the cursor Panning (if necessary)                   */
+                /*------------------------------------------------------------*/
+                if (oldCursorPos > te->cursorPos)
+                {
+                    neuik_TextEntry_UpdatePanCursor(te, CURSORPAN_MOVE_BACK);
                 }
                 else
                 {
-                    TTF_SizeText(font, te->text, &textW, &textH);
-
-                    if (mouseMotEv->x <= eBase->eSt.rLoc.x + rect.x + textW/2)
-                    {
-                        /* cursor will be before this char */
-                        te->cursorPos = 0;
-                    }
-                    else
-                    {
-                        /* cursor will be after char */
-                        te->cursorPos = 1;
-                    }
-                    te->highlightBegin = -1; /* unhighlight text */
+                    neuik_TextEntry_UpdatePanCursor(te, CURSORPAN_MOVE_FORWARD);
                 }
+                te->highlightBegin = -1; /* unhighlight text */
             }
 
             /* Set text highlight (if applicable) */
@@ -838,12 +743,6 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_TextInputEvent(
     neuik_EventState     evCaptured = NEUIK_EVENTSTATE_NOT_CAPTURED;
     int                  eNum       = 0; /* which error to report (if any) */
     size_t               inpLen     = 0; /* length of text input */
-    size_t               newSize    = 0; /* realloated text buf size */
-    size_t               stopPos;
-    size_t               hlOffset;       /* highlight offset (for copy) */
-    size_t               aPos;
-    size_t               ctr;
-    char                 aChar;
     char               * clipText   = NULL;
     SDL_TextInputEvent * textInpEv;
     NEUIK_TextEntry    * te         = NULL;
@@ -877,131 +776,26 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_TextInputEvent(
         /* Existing text was highlighted when text input was received.        */
         /* This will result in the highlighted text being replaced.           */
         /*--------------------------------------------------------------------*/
-        if (te->highlightStart == 0)
+        /* delete the highlighted block of text */
+        if (neuik_TextEntry_DeleteText(te, te->highlightStart,
+            1 + (te->highlightEnd - te->highlightStart)))
         {
-            /*----------------------------------------------------------------*/
-            /* a block of text will be deleted, (block @ start)               */
-            /*----------------------------------------------------------------*/
-            if (te->highlightEnd + 1 != te->textLen)
-            {
-                /* we are not deleting the entire contents */
-
-                for (ctr = 0;; ctr++)
-                {
-                    aChar = te->text[ctr + te->highlightEnd + 1];
-                    te->text[ctr] = aChar;
-
-                    if (aChar == '\0') break;
-                }
-                te->textLen = strlen(te->text);
-            }
-            else
-            {
-                /* delete entire contents of the string */
-                te->textLen = 0;
-                te->text[0] = '\0';
-            }
-            te->cursorPos = 0;
-        }
-        else if (te->highlightEnd + 1 == te->textLen)
-        {
-            /*----------------------------------------------------------------*/
-            /* a block of text will be deleted, (block @ end)                 */
-            /*----------------------------------------------------------------*/
-            te->text[te->highlightStart] = '\0';
-            te->textLen   = te->highlightStart;
-            te->cursorPos = te->textLen;
-        }
-        else
-        {
-            /*----------------------------------------------------------------*/
-            /* a block of text will be deleted, (block in middle)             */
-            /*----------------------------------------------------------------*/
-            te->cursorPos = te->highlightStart;
-
-            hlOffset = 1 + (te->highlightEnd - te->highlightStart);
-            for (ctr = te->highlightStart;; ctr++)
-            {
-                aChar = te->text[ctr + hlOffset];
-                te->text[ctr] = aChar;
-
-                if (aChar == '\0') break;
-            }
-            te->textLen = strlen(te->text);
+            eNum = 6;
+            goto out;
         }
+        te->cursorPos = te->highlightStart;
 
         te->cursorPos = te->highlightStart;
         te->highlightBegin = -1;
     }
 
     inpLen = strlen(textInpEv->text);
-    if (te->cursorPos == te->textLen)
+    if (neuik_TextEntry_InsertText(te, te->cursorPos, textInpEv->text, inpLen))
     {
-        /* cursor is at the end of the current text */
-        if (inpLen + te->textLen < te->textAllocSize)
-        {
-            /* the text buffer will need to be resized to fit this text */
-            newSize = 2 * (inpLen + te->textLen);
-            te->text = (char*)realloc(te->text, newSize*sizeof(char));
-        }
-        strcat(te->text, textInpEv->text);
-        te->textLen   += inpLen;
-        te->cursorPos += inpLen;
-    }
-    else if (te->cursorPos == 0)
-    {
-        /* cursor is at the start of the current text */
-        if (inpLen + te->textLen < te->textAllocSize)
-        {
-            /* the text buffer will need to be resized to fit this text */
-            newSize = 2 * (inpLen + te->textLen);
-            te->text = (char*)realloc(te->text, newSize*sizeof(char));
-        }
-
-        /* first move over the old text */
-        for (ctr = te->textLen + inpLen; ctr >= inpLen; ctr--)
-        {
-            te->text[ctr] = te->text[ctr - inpLen];
-        }
-
-        /* now copy in the new text */
-        for (ctr = 0;; ctr++)
-        {
-            if (textInpEv->text[ctr] == 0) break;
-
-            te->text[ctr] = textInpEv->text[ctr];
-        }
-        te->textLen   += inpLen;
-        te->cursorPos += inpLen;
-    }
-    else
-    {
-        /* cursor is somewhere in the middle of the text */
-        if (inpLen + te->textLen < te->textAllocSize)
-        {
-            /* the text buffer will need to be resized to fit this text */
-            newSize = 2 * (inpLen + te->textLen);
-            te->text = (char*)realloc(te->text, newSize*sizeof(char));
-        }
-
-        /* first move over the old text */
-        stopPos = (te->cursorPos - 1) + inpLen; 
-        for (ctr = te->textLen + inpLen; ctr >= stopPos; ctr--)
-        {
-            te->text[ctr] = te->text[ctr - inpLen];
-        }
-
-        /* now copy in the new text */
-        for (ctr = 0;; ctr++)
-        {
-            aPos = te->cursorPos + ctr;
-            if (textInpEv->text[ctr] == 0) break;
-
-            te->text[aPos] = textInpEv->text[ctr];
-        }
-        te->textLen   += inpLen;
-        te->cursorPos += inpLen;
+        eNum = 5;
+        goto out;
     }
+    te->cursorPos += inpLen;
 
     neuik_TextEntry_UpdatePanCursor(te, CURSORPAN_TEXT_INSERTED);
     rSize = eBase->eSt.rSize;
@@ -1036,15 +830,8 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_KeyDownEvent(
     int                 doRedraw     = 0;
     int                 eNum         = 0; /* which error to report (if any) */
     size_t              inpLen       = 0;  /* length of text input */
-    size_t              newSize      = 0;  /* realloated text buf size */
-    size_t              stopPos;
-    size_t              hlOffset;         /* highlight offset (for copy) */
-    size_t              aPos;
-    size_t              ctr;
     char                aChar;
     char              * clipText     = NULL;
-    char              * srcPos       = NULL;
-    char              * destPos      = NULL;
     SDL_Keymod          keyMod;
     SDL_KeyboardEvent * keyEv;
     NEUIK_TextEntry   * te         = NULL;
@@ -1092,7 +879,7 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_KeyDownEvent(
                 }
                 else if (te->cursorPos > 0)
                 {
-                    te->cursorPos--;
+                    te->cursorPos = neuik_TextEntry_PrevPos(te, te->cursorPos);
                 }
                 doRedraw        = 1;
                 te->clickOrigin = -1;
@@ -1110,7 +897,7 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_KeyDownEvent(
                     {
                         te->highlightBegin = te->cursorPos;
                     }
-                    te->cursorPos--;
+                    te->cursorPos = neuik_TextEntry_PrevPos(te, te->cursorPos);
 
                     if (te->cursorPos < te->highlightBegin)
                     {
@@ -1145,7 +932,7 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_KeyDownEvent(
                 }
                 else if (te->cursorPos < te->textLen)
                 {
-                    te->cursorPos++;
+                    te->cursorPos = neuik_TextEntry_NextPos(te, te->cursorPos);
                 }
                 doRedraw        = 1;
                 te->clickOrigin = -1;
@@ -1162,7 +949,7 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_KeyDownEvent(
                         te->highlightBegin = te->cursorPos;
                     }
 
-                    te->cursorPos++;
+                    te->cursorPos = neuik_TextEntry_NextPos(te, te->cursorPos);
                     doRedraw = 1;
 
                     if (te->cursorPos > te->highlightBegin)
@@ -1189,15 +976,16 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_KeyDownEvent(
                 /*------------------------------------------------------------*/
                 if (te->cursorPos > 0)
                 {
-                    srcPos  = te->text + te->cursorPos;
-                    for (;; srcPos++)
+                    /* erase the whole (possibly multibyte) character */
+                    inpLen = te->cursorPos - 
+                        neuik_TextEntry_PrevPos(te, te->cursorPos);
+                    if (neuik_TextEntry_DeleteText(te, 
+                        te->cursorPos - inpLen, inpLen))
                     {
-                        destPos = srcPos - 1;
-                        *destPos = *srcPos;
-                        if (*srcPos == 0) break;
+                        eNum = 6;
+                        goto out;
                     }
-                    te->textLen   -= 1;
-                    te->cursorPos -= 1;
+                    te->cursorPos -= inpLen;
                     doRedraw = 1;
                 }
             }
@@ -1206,58 +994,14 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_KeyDownEvent(
                 /*------------------------------------------------------------*/
                 /* There is text highlighting within the line                 */
                 /*------------------------------------------------------------*/
-                if (te->highlightStart == 0)
-                {
-                    /*--------------------------------------------------------*/
-                    /* a block of text will be deleted, (block @ start)       */
-                    /*--------------------------------------------------------*/
-                    if (te->highlightEnd + 1 != te->textLen)
-                    {
-                        /* we are not deleting the entire contents */
-
-                        for (ctr = 0;; ctr++)
-                        {
-                            aChar = te->text[ctr + te->highlightEnd + 1];
-                            te->text[ctr] = aChar;
-
-                            if (aChar == '\0') break;
-                        }
-                        te->textLen = strlen(te->text);
-                    }
-                    else
-                    {
-                        /* delete entire contents of the string */
-                        te->textLen = 0;
-                        te->text[0] = '\0';
-                    }
-                    te->cursorPos      = 0;
-                }
-                else if (te->highlightEnd + 1 == te->textLen)
+                /* delete the highlighted block of text */
+                if (neuik_TextEntry_DeleteText(te, te->highlightStart,
+                    1 + (te->highlightEnd - te->highlightStart)))
                 {
-                    /*--------------------------------------------------------*/
-                    /* a block of text will be deleted, (block @ end)         */
-                    /*--------------------------------------------------------*/
-                    te->text[te->highlightStart] = '\0';
-                    te->textLen   = te->highlightStart;
-                    te->cursorPos = te->textLen;
-                }
-                else
-                {
-                    /*--------------------------------------------------------*/
-                    /* a block of text will be deleted, (block in middle)     */
-                    /*--------------------------------------------------------*/
-                    te->cursorPos = te->highlightStart;
-
-                    hlOffset = 1 + (te->highlightEnd - te->highlightStart);
-                    for (ctr = te->highlightStart;; ctr++)
-                    {
-                        aChar = te->text[ctr + hlOffset];
-                        te->text[ctr] = aChar;
-
-                        if (aChar == '\0') break;
-                    }
-                    te->textLen = strlen(te->text);
+                    eNum = 6;
+                    goto out;
                 }
+                te->cursorPos = te->highlightStart;
 
                 te->highlightBegin = -1;
                 doRedraw           = 1;
@@ -1274,15 +1018,14 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_KeyDownEvent(
                 /*------------------------------------------------------------*/
                 if (te->cursorPos < te->textLen)
                 {
-                    srcPos  = te->text + (te->cursorPos + 1);
-                    for (;; srcPos++)
+                    inpLen = neuik_TextEntry_NextPos(te, te->cursorPos) - 
+                        te->cursorPos;
+                    if (neuik_TextEntry_DeleteText(te, te->cursorPos, inpLen))
                     {
-                        destPos = srcPos - 1;
-                        *destPos = *srcPos;
-                        if (*srcPos == 0) break;
+                        eNum = 6;
+                        goto out;
                     }
-                    te->textLen -= 1;
-                    doRedraw     = 1;
+                    doRedraw = 1;
                 }
             }
             else
@@ -1290,58 +1033,14 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_KeyDownEvent(
                 /*------------------------------------------------------------*/
                 /* There is text highlighting within the line                 */
                 /*------------------------------------------------------------*/
-                if (te->highlightStart == 0)
+                /* delete the highlighted block of text */
+                if (neuik_TextEntry_DeleteText(te, te->highlightStart,
+                    1 + (te->highlightEnd - te->highlightStart)))
                 {
-                    /*--------------------------------------------------------*/
-                    /* a block of text will be deleted, (block @ start)       */
-                    /*--------------------------------------------------------*/
-                    if (te->highlightEnd + 1 != te->textLen)
-                    {
-                        /* we are not deleting the entire contents */
-
-                        for (ctr = 0;; ctr++)
-                        {
-                            aChar = te->text[ctr + te->highlightEnd + 1];
-                            te->text[ctr] = aChar;
-
-                            if (aChar == '\0') break;
-                        }
-                        te->textLen = strlen(te->text);
-                    }
-                    else
-                    {
-                        /* delete entire contents of the string */
-                        te->textLen = 0;
-                        te->text[0] = '\0';
-                    }
-                    te->cursorPos      = 0;
-                }
-                else if (te->highlightEnd + 1 == te->textLen)
-                {
-                    /*--------------------------------------------------------*/
-                    /* a block of text will be deleted, (block @ end)         */
-                    /*--------------------------------------------------------*/
-                    te->text[te->highlightStart] = '\0';
-                    te->textLen   = te->highlightStart;
-                    te->cursorPos = te->textLen;
-                }
-                else
-                {
-                    /*--------------------------------------------------------*/
-                    /* a block of text will be deleted, (block in middle)     */
-                    /*--------------------------------------------------------*/
-                    te->cursorPos = te->highlightStart;
-
-                    hlOffset = 1 + (te->highlightEnd - te->highlightStart);
-                    for (ctr = te->highlightStart;; ctr++)
-                    {
-                        aChar = te->text[ctr + hlOffset];
-                        te->text[ctr] = aChar;
-
-                        if (aChar == '\0') break;
-                    }
-                    te->textLen = strlen(te->text);
+                    eNum = 6;
+                    goto out;
                 }
+                te->cursorPos = te->highlightStart;
 
                 te->highlightBegin = -1;
                 doRedraw           = 1;
@@ -1438,6 +1137,8 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_KeyDownEvent(
     {
         if (te->highlightBegin != -1)
         {
+            /* the clipboard reads the text as a single string */
+            neuik_TextEntry_CloseGap(te);
             aChar = te->text[te->highlightEnd + 1];
             te->text[te->highlightEnd + 1] = '\0';
 
@@ -1449,6 +1150,8 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_KeyDownEvent(
     {
         if (te->highlightBegin != -1)
         {
+            /* the clipboard reads the text as a single string */
+            neuik_TextEntry_CloseGap(te);
             aChar = te->text[te->highlightEnd + 1];
             te->text[te->highlightEnd + 1] = '\0';
 
@@ -1458,58 +1161,14 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_KeyDownEvent(
             /*----------------------------------------------------------------*/
             /* There is text highlighting within the line                     */
             /*----------------------------------------------------------------*/
-            if (te->highlightStart == 0)
-            {
-                /*------------------------------------------------------------*/
-                /* a block of text will be deleted, (block @ start)           */
-                /*------------------------------------------------------------*/
-                if (te->highlightEnd + 1 != te->textLen)
-                {
-                    /* we are not deleting the entire contents */
-
-                    for (ctr = 0;; ctr++)
-                    {
-                        aChar = te->text[ctr + te->highlightEnd + 1];
-                        te->text[ctr] = aChar;
-
-                        if (aChar == '\0') break;
-                    }
-                    te->textLen = strlen(te->text);
-                }
-                else
-                {
-                    /* delete entire contents of the string */
-                    te->textLen = 0;
-                    te->text[0] = '\0';
-                }
-                te->cursorPos      = 0;
-            }
-            else if (te->highlightEnd + 1 == te->textLen)
-            {
-                /*------------------------------------------------------------*/
-                /* a block of text will be deleted, (block @ end)             */
-                /*------------------------------------------------------------*/
-                te->text[te->highlightStart] = '\0';
-                te->textLen   = te->highlightStart;
-                te->cursorPos = te->textLen;
-            }
-            else
+            /* delete the highlighted block of text */
+            if (neuik_TextEntry_DeleteText(te, te->highlightStart,
+                1 + (te->highlightEnd - te->highlightStart)))
             {
-                /*------------------------------------------------------------*/
-                /* a block of text will be deleted, (block in middle)         */
-                /*------------------------------------------------------------*/
-                te->cursorPos = te->highlightStart;
-
-                hlOffset = 1 + (te->highlightEnd - te->highlightStart);
-                for (ctr = te->highlightStart;; ctr++)
-                {
-                    aChar = te->text[ctr + hlOffset];
-                    te->text[ctr] = aChar;
-
-                    if (aChar == '\0') break;
-                }
-                te->textLen = strlen(te->text);
+                eNum = 6;
+                goto out;
             }
+            te->cursorPos = te->highlightStart;
 
             te->highlightBegin = -1;
             doRedraw           = 1;
@@ -1524,58 +1183,14 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_KeyDownEvent(
             /*----------------------------------------------------------------*/
             /* There is text highlighting within the line                     */
             /*----------------------------------------------------------------*/
-            if (te->highlightStart == 0)
+            /* delete the highlighted block of text */
+            if (neuik_TextEntry_DeleteText(te, te->highlightStart,
+                1 + (te->highlightEnd - te->highlightStart)))
             {
-                /*------------------------------------------------------------*/
-                /* a block of text will be deleted, (block @ start)           */
-                /*------------------------------------------------------------*/
-                if (te->highlightEnd + 1 != te->textLen)
-                {
-                    /* we are not deleting the entire contents */
-
-                    for (ctr = 0;; ctr++)
-                    {
-                        aChar = te->text[ctr + te->highlightEnd + 1];
-                        te->text[ctr] = aChar;
-
-                        if (aChar == '\0') break;
-                    }
-                    te->textLen = strlen(te->text);
-                }
-                else
-                {
-                    /* delete entire contents of the string */
-                    te->textLen = 0;
-                    te->text[0] = '\0';
-                }
-                te->cursorPos      = 0;
-            }
-            else if (te->highlightEnd + 1 == te->textLen)
-            {
-                /*------------------------------------------------------------*/
-                /* a block of text will be deleted, (block @ end)             */
-                /*------------------------------------------------------------*/
-                te->text[te->highlightStart] = '\0';
-                te->textLen   = te->highlightStart;
-                te->cursorPos = te->textLen;
-            }
-            else
-            {
-                /*------------------------------------------------------------*/
-                /* a block of text will be deleted, (block in middle)         */
-                /*------------------------------------------------------------*/
-                te->cursorPos = te->highlightStart;
-
-                hlOffset = 1 + (te->highlightEnd - te->highlightStart);
-                for (ctr = te->highlightStart;; ctr++)
-                {
-                    aChar = te->text[ctr + hlOffset];
-                    te->text[ctr] = aChar;
-
-                    if (aChar == '\0') break;
-                }
-                te->textLen = strlen(te->text);
+                eNum = 6;
+                goto out;
             }
+            te->cursorPos = te->highlightStart;
 
             te->highlightBegin = -1;
         }
@@ -1589,73 +1204,12 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_KeyDownEvent(
         }
 
         inpLen = strlen(clipText);
-        if (te->cursorPos == te->textLen)
-        {
-            /* cursor is at the end of the current text */
-            if (inpLen + te->textLen < te->textAllocSize)
-            {
-                /* the text buffer will need to be resized to fit this text */
-                newSize = 2 * (inpLen + te->textLen);
-                te->text = (char*)realloc(te->text, newSize*sizeof(char));
-            }
-            strcat(te->text, clipText);
-            te->textLen   += inpLen;
-            te->cursorPos += inpLen;
-        }
-        else if (te->cursorPos == 0)
-        {
-            /* cursor is at the start of the current text */
-            if (inpLen + te->textLen < te->textAllocSize)
-            {
-                /* the text buffer will need to be resized to fit this text */
-                newSize = 2 * (inpLen + te->textLen);
-                te->text = (char*)realloc(te->text, newSize*sizeof(char));
-            }
-
-            /* first move over the old text */
-            for (ctr = te->textLen + inpLen; ctr >= inpLen; ctr--)
-            {
-                te->text[ctr] = te->text[ctr - inpLen];
-            }
-
-            /* now copy in the new text */
-            for (ctr = 0;; ctr++)
-            {
-                if (clipText[ctr] == 0) break;
-
-                te->text[ctr] = clipText[ctr];
-            }
-            te->textLen   += inpLen;
-            te->cursorPos += inpLen;
-        }
-        else
+        if (neuik_TextEntry_InsertText(te, te->cursorPos, clipText, inpLen))
         {
-            /* cursor is somewhere in the middle of the text */
-            if (inpLen + te->textLen < te->textAllocSize)
-            {
-                /* the text buffer will need to be resized to fit this text */
-                newSize = 2 * (inpLen + te->textLen);
-                te->text = (char*)realloc(te->text, newSize*sizeof(char));
-            }
-
-            /* first move over the old text */
-            stopPos = (te->cursorPos - 1) + inpLen; 
-            for (ctr = te->textLen + inpLen; ctr >= stopPos; ctr--)
-            {
-                te->text[ctr] = te->text[ctr - inpLen];
-            }
-
-            /* now copy in the new text */
-            for (ctr = 0;; ctr++)
-            {
-                aPos = te->cursorPos + ctr;
-                if (clipText[ctr] == 0) break;
-
-                te->text[aPos] = clipText[ctr];
-            }
-            te->textLen   += inpLen;
-            te->cursorPos += inpLen;
+            eNum = 5;
+            goto out;
         }
+        te->cursorPos += inpLen;
 
         // neuik_TextEntry_UpdateCursorX(te);
         neuik_TextEntry_UpdatePanCursor(te, CURSORPAN_TEXT_ADD_REMOVE);
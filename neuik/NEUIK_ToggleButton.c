@@ -460,12 +460,12 @@ int neuik_Element_GetMinSize__ToggleButton(
     if (btn->text != NULL)
     {
         /* this button contains text */
-        TTF_SizeText(font, btn->text, &tW, &tH);
+        TTF_SizeUTF8(font, btn->text, &tW, &tH);
     }
     else
     {
         /* this button does not contain text */
-        TTF_SizeText(font, " ", &tW, &tH);
+        TTF_SizeUTF8(font, " ", &tW, &tH);
     }
 
     rSize->w = tW + aCfg->fontEmWidth;
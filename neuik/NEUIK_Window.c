@@ -1110,7 +1110,7 @@ int NEUIK_Window_Create(
             goto out;
         }
 
-        if (neuik_Element_GetMinSize(w->elem, &rSize))
+        if (neuik_Element_GetMinSizeParallel(w->elem, &rSize))
         {
             eNum = 5;
             goto out;
@@ -1896,7 +1896,7 @@ int NEUIK_Window_Redraw(
             goto out;
         }
 
-        if (neuik_Element_GetMinSize(w->elem, &rSize))
+        if (neuik_Element_GetMinSizeParallel(w->elem, &rSize))
         {
             eNum = 2;
             goto out;
@@ -15,6 +15,7 @@
  ******************************************************************************/
 #include <stdio.h>
 #include "NEUIK_error.h"
+#include "neuik_internal.h"
 
 
 int          inGUIBacktrace      = 0; /* set to 1 only during a GUI backtrace */
@@ -67,6 +68,8 @@ void NEUIK_RaiseError(
         return; /* ignore new errors during a backtrace */
     }
 
+    /* errors may be raised from (min-size) worker threads */
+    neuik_LockShared();
     for (ctr = 0; ctr <= maxErrors; ctr++)
     {
         if (errorList[ctr] == NULL)
@@ -91,5 +94,6 @@ void NEUIK_RaiseError(
     {
         errorsOmitted += 1;
     }
+    neuik_UnlockShared();
 }
 
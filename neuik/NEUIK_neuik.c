@@ -22,6 +22,8 @@
 #include "neuik_classes.h"
 #include "NEUIK_neuik.h"
 #include "NEUIK_error.h"
+#include "NEUIK_Element_internal.h"
+#include "neuik_UTF8.h"
 
 int           neuik__isInitialized = 0;
 neuik_SetID   neuik__SetID_NEUIK   = -1;
@@ -45,6 +47,7 @@ int NEUIK_Init()
         "Failed to Initialize SDL2_ttf.",   // [2]
         "Failed to Initialize SDL2_image.", // [3]
         "Failed to Register Class Set.",    // [4]
+        "Failed to Initialize threading.",  // [5]
     };
 
     if (!neuik__isInitialized)
@@ -74,6 +77,11 @@ int NEUIK_Init()
             eNum = 3;
             goto out;
         }
+        if (neuik_InitThreadSupport())
+        {
+            eNum = 5;
+            goto out;
+        }
 
         /*--------------------------------------------------------------------*/
         /* Register the "NEUIK" class set                                     */
@@ -127,6 +135,7 @@ int NEUIK_Init()
         neuik_RegisterClass_ProgressBarConfig();
         neuik_RegisterClass_ProgressBar();
         neuik_RegisterClass_Stack();
+        neuik_RegisterClass_ScrollPane();
 
 
         neuik_RegisterClass_MaskMap();
@@ -179,7 +188,10 @@ void NEUIK_Quit()
     if (neuik__isInitialized)
     {
         IMG_Quit();
+        neuik_Element_QuitMinSizeWorkers();
+        neuik_FreeTextLayouts();
         TTF_Quit();
+        neuik_QuitThreadSupport();
         SDL_Quit();
     }
     neuik__isInitialized = 0;
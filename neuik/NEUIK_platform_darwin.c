@@ -15,6 +15,10 @@
  ******************************************************************************/
 #include <SDL.h>
 #include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include "NEUIK_platform.h"
 
@@ -74,6 +78,18 @@ int neuik_KeyShortcut_Undo(
 }
 
 
+/* Cmd + Shift + Z */
+int neuik_KeyShortcut_Redo(
+        SDL_KeyboardEvent  * keyEv, 
+        SDL_Keymod           keyMod)
+{
+    if (keyMod & KMOD_GUI && keyMod & KMOD_SHIFT && 
+        keyEv->keysym.sym == SDLK_z) return 1;
+
+    return 0;
+}
+
+
 /* Cmd + S */
 int neuik_KeyShortcut_Save(
         SDL_KeyboardEvent  * keyEv, 
@@ -117,3 +133,68 @@ int neuik_KeyShortcut_Find(
     return 0;
 }
 
+
+/*----------------------------------------------------------------------------*/
+/* Map a file into memory (read-only). An empty file is reported as a         */
+/* successful mapping of zero bytes with `*data` set to NULL.                 */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+int neuik_MapFile(
+        const char  * fileName,
+        const char ** data,
+        size_t      * length,
+        void       ** handle)
+{
+    int           fd;
+    void        * addr;
+    struct stat   st;
+
+    *data   = NULL;
+    *length = 0;
+    *handle = NULL;
+
+    fd = open(fileName, O_RDONLY);
+    if (fd < 0) return 1;
+
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+    {
+        close(fd);
+        return 1;
+    }
+    if (st.st_size == 0)
+    {
+        close(fd);
+        return 0;
+    }
+
+    addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    /*------------------------------------------------------------------------*/
+    /* The mapping holds its own reference to the file.                       */
+    /*------------------------------------------------------------------------*/
+    close(fd);
+    if (addr == MAP_FAILED) return 1;
+
+    /*------------------------------------------------------------------------*/
+    /* The file is expected to be read from front to back.                    */
+    /*------------------------------------------------------------------------*/
+    madvise(addr, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+    *data   = (const char*)addr;
+    *length = (size_t)st.st_size;
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Release a mapping created by `neuik_MapFile`.                              */
+/*----------------------------------------------------------------------------*/
+void neuik_UnmapFile(
+        const char  * data,
+        size_t        length,
+        void        * handle)
+{
+    if (data == NULL || length == 0) return;
+
+    munmap((void*)data, length);
+}
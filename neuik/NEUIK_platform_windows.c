@@ -15,6 +15,7 @@
  ******************************************************************************/
 #include <SDL.h>
 #include <stdio.h>
+#include <windows.h>
 
 #include "NEUIK_platform.h"
 
@@ -74,6 +75,19 @@ int neuik_KeyShortcut_Undo(
 }
 
 
+/* Ctrl + Y; Ctrl + Shift + Z */
+int neuik_KeyShortcut_Redo(
+        SDL_KeyboardEvent  * keyEv, 
+        SDL_Keymod           keyMod)
+{
+    if (keyMod & KMOD_CTRL && keyEv->keysym.sym == SDLK_y) return 1;
+    if (keyMod & KMOD_CTRL && keyMod & KMOD_SHIFT && 
+        keyEv->keysym.sym == SDLK_z) return 1;
+
+    return 0;
+}
+
+
 /* Ctrl + S */
 int neuik_KeyShortcut_Save(
         SDL_KeyboardEvent  * keyEv, 
@@ -117,3 +131,72 @@ int neuik_KeyShortcut_Find(
     return 0;
 }
 
+
+/*----------------------------------------------------------------------------*/
+/* Map a file into memory (read-only). An empty file is reported as a         */
+/* successful mapping of zero bytes with `*data` set to NULL.                 */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+int neuik_MapFile(
+        const char  * fileName,
+        const char ** data,
+        size_t      * length,
+        void       ** handle)
+{
+    HANDLE          fh;
+    HANDLE          mh;
+    LARGE_INTEGER   fSize;
+    void          * addr;
+
+    *data   = NULL;
+    *length = 0;
+    *handle = NULL;
+
+    fh = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL,
+        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (fh == INVALID_HANDLE_VALUE) return 1;
+
+    if (!GetFileSizeEx(fh, &fSize))
+    {
+        CloseHandle(fh);
+        return 1;
+    }
+    if (fSize.QuadPart == 0)
+    {
+        CloseHandle(fh);
+        return 0;
+    }
+
+    mh = CreateFileMappingA(fh, NULL, PAGE_READONLY, 0, 0, NULL);
+    /*------------------------------------------------------------------------*/
+    /* The mapping object holds its own reference to the file.                */
+    /*------------------------------------------------------------------------*/
+    CloseHandle(fh);
+    if (mh == NULL) return 1;
+
+    addr = MapViewOfFile(mh, FILE_MAP_READ, 0, 0, 0);
+    if (addr == NULL)
+    {
+        CloseHandle(mh);
+        return 1;
+    }
+
+    *data   = (const char*)addr;
+    *length = (size_t)fSize.QuadPart;
+    *handle = (void*)mh;
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Release a mapping created by `neuik_MapFile`.                              */
+/*----------------------------------------------------------------------------*/
+void neuik_UnmapFile(
+        const char  * data,
+        size_t        length,
+        void        * handle)
+{
+    if (data != NULL) UnmapViewOfFile((LPCVOID)data);
+    if (handle != NULL) CloseHandle((HANDLE)handle);
+}
@@ -166,9 +166,9 @@ SDL_Texture * NEUIK_RenderText(
     color.b = textColor.b;
     color.a = textColor.a;
 
-    TTF_SizeText(font, textStr, rvW, rvH);
+    TTF_SizeUTF8(font, textStr, rvW, rvH);
 
-    surf = TTF_RenderText_Blended(font, textStr, color);
+    surf = TTF_RenderUTF8_Blended(font, textStr, color);
     if (surf != NULL)
     {
         rvTex = SDL_CreateTextureFromSurface(renderer, surf);
@@ -234,9 +234,9 @@ SDL_Surface * NEUIK_RenderTextAsSurface(
     color.b = textColor.b;
     color.a = textColor.a;
 
-    TTF_SizeText(font, textStr, rvW, rvH);
+    TTF_SizeUTF8(font, textStr, rvW, rvH);
 
-    surf = TTF_RenderText_Blended(font, textStr, color);
+    surf = TTF_RenderUTF8_Blended(font, textStr, color);
     if (surf == NULL)
     {
         eNum = 2;
@@ -525,9 +525,9 @@ SDL_Texture* NEUIK_RenderText_Solid(
     color.b = textColor.b;
     color.a = textColor.a;
 
-    TTF_SizeText(font, textStr, rvW, rvH);
+    TTF_SizeUTF8(font, textStr, rvW, rvH);
 
-    surf = TTF_RenderText_Solid(font, textStr, color);
+    surf = TTF_RenderUTF8_Solid(font, textStr, color);
     if (surf != NULL)
     {
         rvTex = SDL_CreateTextureFromSurface(renderer, surf);
@@ -595,9 +595,9 @@ SDL_Texture* NEUIK_RenderTextSolid(
     color.b = textColor.b;
     color.a = textColor.a;
 
-    TTF_SizeText(font, textStr, rvW, rvH);
+    TTF_SizeUTF8(font, textStr, rvW, rvH);
 
-    surf = TTF_RenderText_Solid(font, textStr, color);
+    surf = TTF_RenderUTF8_Solid(font, textStr, color);
     if (surf != NULL)
     {
         rvTex = SDL_CreateTextureFromSurface(renderer, surf);
@@ -48,6 +48,7 @@ int NEUIK_Object_Free(
 #include "NEUIK_PlotData.h"
 #include "NEUIK_ProgressBar.h"
 // #include "NEUIK_PopupMenu.h"
+#include "NEUIK_ScrollPane.h"
 #include "NEUIK_Stack.h"
 #include "NEUIK_StockImage.h"
 #include "NEUIK_TextEdit.h"
@@ -32,6 +32,7 @@ typedef struct {
 		NEUIK_Element        * elems;        /* child elements of this container */
 		unsigned int           n_allocated;  /* number of element slots allocated */
 		unsigned int           n_used;       /* number of element slots in use */
+		unsigned int           modCount;     /* bumped when elements are removed, moved or inserted (not appended) */
 		neuik_Container_Type   cType;        /* identify the container as single or multi */
 		int                    shownIfEmpty; /* [bool] whether container is visible without children shown */
 		int                    redrawAll;    /* [bool] if all child elements must be redrawn */
@@ -78,11 +79,35 @@ int
 			int             n,
 			NEUIK_Element * elem);
 
+int 
+	NEUIK_Container_InsertElements(
+			NEUIK_Element         cont,
+			int                   index,
+			int                   nElems,
+			const NEUIK_Element * elems);
+
+int 
+	NEUIK_Container_Reserve(
+			NEUIK_Element cont,
+			int           nElems);
+
 int
 	NEUIK_Container_RemoveElement(
 			NEUIK_Element cont,
 			NEUIK_Element elem);
 
+int
+	NEUIK_Container_RemoveRange(
+			NEUIK_Element cont,
+			int           index,
+			int           nElems);
+
+int
+	NEUIK_Container_MoveElement(
+			NEUIK_Element cont,
+			int           from,
+			int           to);
+
 int
 	NEUIK_Container_SetElement(
 			NEUIK_Element cont,
@@ -23,5 +23,19 @@ int
 	neuik_Container_RequestFullRedraw(
 			NEUIK_Element cont);
 
+int 
+	neuik_Container_InsertElements(
+			NEUIK_Element         cont,
+			int                   index,
+			int                   nElems,
+			const NEUIK_Element * elems);
+
+int 
+	neuik_Container_RenderStoredLayout(
+			NEUIK_Element   cont,
+			RenderLoc     * rlMod,
+			SDL_Renderer  * xRend,
+			int             mock);
+
 
 #endif /* NEUIK_CONTAINER_INTERNAL_H */
@@ -100,6 +100,11 @@ typedef struct {
 	RenderSize              minSizeOld; /* Minimum size of the element (previous frame) */
     enum neuik_minsize      wDelta;     /* How min elem width changed (rel. to previous frame) */
     enum neuik_minsize      hDelta;     /* How min elem height changed (rel. to previous frame) */
+	int                     layoutDirty; /* if the child layout must be recomputed */
+	RenderSize              layoutSize;  /* size the child layout was computed for */
+	RenderLoc               layoutLoc;   /* location the child layout was computed for */
+	int                     minSizePending; /* if minSizeNext awaits use by GetMinSize */
+	RenderSize              minSizeNext;    /* min size measured by a parallel min-size pass */
 } NEUIK_ElementState;
 
 
@@ -170,6 +175,14 @@ int
 			NEUIK_Element    elem,
 			RenderSize     * rSize);
 
+int
+	neuik_Element_GetMinSizeParallel(
+			NEUIK_Element    elem,
+			RenderSize     * rSize);
+
+void
+	neuik_Element_QuitMinSizeWorkers();
+
 int
 	neuik_Element_GetLocation(
 			NEUIK_Element   elem,
@@ -266,6 +279,20 @@ int
 			NEUIK_Element   elem,
 			void          * win);
 
+int
+	neuik_Element_InvalidateLayout(
+			NEUIK_Element elem);
+
+int
+	neuik_Element_IsLayoutValid(
+			NEUIK_Element   elem,
+			RenderSize    * rSize);
+
+void
+	neuik_Element_StoreLayout(
+			NEUIK_Element   elem,
+			RenderSize    * rSize);
+
 void
 	neuik_Element_StoreSizeAndLocation(
 			NEUIK_Element elem,
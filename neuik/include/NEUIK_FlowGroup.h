@@ -37,6 +37,7 @@ typedef struct {
 		NEUIK_FlowGroup_FillDirn FillSecond;
 		int                      maxHItems; // 0 = no limit
 		int                      maxVItems; // 0 = no limit
+		void                   * cache;     // cached child sizes and line breaks
 } NEUIK_FlowGroup;
 
 int NEUIK_NewFlowGroup(NEUIK_FlowGroup **);
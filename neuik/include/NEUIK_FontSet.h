@@ -63,6 +63,19 @@ neuik_ptrTo_TTF_Font
 			int             useBold,
 			int             useItalic);
 
+/*----------------------------------------------------------------------------*/
+/* Fonts private to a thread which measures text alongside others.            */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_FontSet_BeginThreadFonts();
+
+void
+	neuik_FontSet_EndThreadFonts();
+
+neuik_ptrTo_TTF_Font
+	neuik_FontSet_GetSharedFont(
+			neuik_ptrTo_TTF_Font font);
+
 int 
 	NEUIK_GetTTFLocation(
 			const char * fName, 
@@ -29,6 +29,7 @@ typedef struct {
 		int          squareElems; /* If elems should all be square in shape */
 		int          selected;
 		int          isActive;
+		void       * virt;     /* virtual cell state (NULL if not virtual) */
 } NEUIK_GridLayout;
 
 int 
@@ -94,5 +95,39 @@ int
 			const char       * set0,
 			...);
 
+/*----------------------------------------------------------------------------*/
+/* Virtual GridLayouts do not hold an element for each cell; the application  */
+/* gives the number of columns and rows and a function which binds the        */
+/* contents of cell (col, row) into a recycled cell element. If `*cell` is    */
+/* NULL, the bind function must create the cell element. Only the shown      */
+/* cells (plus a few cells of overscan) are ever bound, measured or rendered; */
+/* column widths and row heights are cached from the cells measured so far.   */
+/*----------------------------------------------------------------------------*/
+int 
+	NEUIK_GridLayout_SetVirtual(
+			NEUIK_GridLayout * grid,
+			int                nCols,
+			int                nRows,
+			int             (* bindFn)(NEUIK_Element * cell, int col, int row, void * arg),
+			void             * bindArg);
+
+int 
+	NEUIK_GridLayout_SetVirtualCount(
+			NEUIK_GridLayout * grid,
+			int                nCols,
+			int                nRows);
+
+int 
+	NEUIK_GridLayout_UpdateCell(
+			NEUIK_GridLayout * grid,
+			int                col,
+			int                row);
+
+int 
+	NEUIK_GridLayout_ScrollToCell(
+			NEUIK_GridLayout * grid,
+			int                col,
+			int                row);
+
 
 #endif /* NEUIK_GRIDLAYOUT_H */
@@ -27,6 +27,7 @@ typedef struct {
 		NEUIK_LabelConfig * cfg;
 		NEUIK_LabelConfig * cfgPtr; /* if NULL, the non-Pointer version is used */
 		char              * text;
+		void              * layout;  /* cached line breaks, sizes and textures */
 		int                 needsRedraw;
 } NEUIK_Label;
 
@@ -18,6 +18,7 @@
 
 #include "NEUIK_Element.h"
 #include "NEUIK_ListRow.h"
+#include "NEUIK_LabelConfig.h"
 
 typedef struct {
 		neuik_Object objBase;        /* this structure is requied to be an neuik object */
@@ -31,8 +32,23 @@ typedef struct {
 		NEUIK_Color  colorBGSelect;  /* color to use for the selected row(s) */
 		NEUIK_Color  colorBGOdd;     /* color to use for unselected odd rows */
 		NEUIK_Color  colorBGEven;    /* color to use for unselected even rows */
+		void       * virt;           /* virtual row state (NULL if not virtual) */
+		void       * sel;            /* selected row ranges (private) */
+		void       * view;           /* sort/filter view of the rows (private) */
 } NEUIK_ListGroup;
 
+/*----------------------------------------------------------------------------*/
+/* The layout of one column of cells built by `NEUIK_ListGroup_AddTable()`.   */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+		enum neuik_HJustify   HJustify;  /* justification of the column cells */
+		int                   HFill;     /* cells fill space horizontally */
+		float                 HScale;    /* relative share of the filled space */
+		int                   PadLeft;
+		int                   PadRight;
+		NEUIK_LabelConfig   * labelCfg;  /* shared cell config (NULL: default) */
+} NEUIK_ListColumn;
+
 int 
 	NEUIK_NewListGroup(
 			NEUIK_ListGroup ** lgPtr);
@@ -52,4 +68,124 @@ int
 			NEUIK_ListRow   * row0, 
 			...);
 
+/*----------------------------------------------------------------------------*/
+/* Append `nRows` rows of `nCols` Label cells; `cells` holds the cell strings */
+/* row by row (NULL for an empty cell). All of the rows share `style` (or the */
+/* default ListRow style if NULL), which must outlive them.                   */
+/*----------------------------------------------------------------------------*/
+int 
+	NEUIK_ListGroup_AddTable(
+			NEUIK_ListGroup          * lg, 
+			int                        nCols, 
+			const NEUIK_ListColumn   * cols, 
+			int                        nRows, 
+			const char * const       * cells, 
+			const NEUIK_ListRowStyle * style);
+
+/*----------------------------------------------------------------------------*/
+/* Virtual ListGroups do not hold a row for each entry; the application gives */
+/* the number of rows and a function which fills (binds) the contents of row  */
+/* `rowInd` into a recycled ListRow. `isNew` is set the first time a ListRow  */
+/* is bound (when it is still empty). Only the shown rows (plus a few rows of */
+/* overscan) are ever bound or laid out.                                      */
+/*----------------------------------------------------------------------------*/
+int 
+	NEUIK_ListGroup_SetVirtual(
+			NEUIK_ListGroup * lg, 
+			int               nRows, 
+			int            (* bindFn)(NEUIK_ListRow * row, int rowInd, int isNew, void * arg),
+			void            * bindArg);
+
+int 
+	NEUIK_ListGroup_SetRowCount(
+			NEUIK_ListGroup * lg, 
+			int               nRows);
+
+int 
+	NEUIK_ListGroup_ScrollToRow(
+			NEUIK_ListGroup * lg, 
+			int               rowInd);
+
+int 
+	NEUIK_ListGroup_GetSelectedRow(
+			NEUIK_ListGroup * lg, 
+			int             * rowInd);
+
+/*----------------------------------------------------------------------------*/
+/* The selected rows are kept as a sorted set of row index ranges; `ranges`   */
+/* holds `nRanges` pairs of (first, last) row indices and stays valid until   */
+/* the selection changes. Multiple rows can only be selected (with shift and  */
+/* ctrl) after multi-selection has been enabled.                              */
+/*----------------------------------------------------------------------------*/
+int 
+	NEUIK_ListGroup_SetMultiSelect(
+			NEUIK_ListGroup * lg, 
+			int               allowMulti);
+
+int 
+	NEUIK_ListGroup_SelectRows(
+			NEUIK_ListGroup * lg, 
+			int               first, 
+			int               last, 
+			int               addToSelection);
+
+int 
+	NEUIK_ListGroup_IsRowSelected(
+			NEUIK_ListGroup * lg, 
+			int               rowInd);
+
+int 
+	NEUIK_ListGroup_GetSelectedRanges(
+			NEUIK_ListGroup  * lg, 
+			int              * nRanges, 
+			const int       ** ranges);
+
+/*----------------------------------------------------------------------------*/
+/* Sort and filter views over the rows of a (non-virtual) ListGroup. The rows */
+/* are reordered and shown/hidden in place; they are never recreated. Keys    */
+/* and filters refer to rows by their model index: the order in which the     */
+/* rows were added (rows added later are appended to the view). All other     */
+/* functions use the current (view) position of a row. Removing rows resets  */
+/* the model order to the current order of the rows.                          */
+/*----------------------------------------------------------------------------*/
+int 
+	NEUIK_ListGroup_SortRows(
+			NEUIK_ListGroup * lg, 
+			const double    * keys, 
+			int               descending);
+
+int 
+	NEUIK_ListGroup_ClearSort(
+			NEUIK_ListGroup * lg);
+
+int 
+	NEUIK_ListGroup_SetFilter(
+			NEUIK_ListGroup * lg, 
+			int            (* filterFn)(NEUIK_ListRow * row, int modelRow, void * arg),
+			void            * filterArg);
+
+/*----------------------------------------------------------------------------*/
+/* Replace the filter with one which only hides more rows (`narrows` = 1) or  */
+/* only shows more rows (`narrows` = 0); only the rows which could change are */
+/* tested.                                                                    */
+/*----------------------------------------------------------------------------*/
+int 
+	NEUIK_ListGroup_RefineFilter(
+			NEUIK_ListGroup * lg, 
+			int            (* filterFn)(NEUIK_ListRow * row, int modelRow, void * arg),
+			void            * filterArg,
+			int               narrows);
+
+int 
+	NEUIK_ListGroup_RefilterRows(
+			NEUIK_ListGroup * lg, 
+			int               firstModelRow, 
+			int               lastModelRow);
+
+int 
+	NEUIK_ListGroup_GetModelRow(
+			NEUIK_ListGroup * lg, 
+			int               rowInd, 
+			int             * modelRow);
+
 #endif /* NEUIK_LISTGROUP_H */
@@ -0,0 +1,31 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2019, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_LISTGROUP_INTERNAL_H
+#define NEUIK_LISTGROUP_INTERNAL_H
+
+#include "NEUIK_ListGroup.h"
+
+
+void 
+	neuik_ListGroup_RowSelectionChanged(
+			NEUIK_Element lg);
+
+int 
+	neuik_ListGroup_IsManagingSelection(
+			NEUIK_Element lg);
+
+
+#endif /* NEUIK_LISTGROUP_INTERNAL_H */
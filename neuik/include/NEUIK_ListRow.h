@@ -19,6 +19,17 @@
 #include "NEUIK_Element.h"
 
 
+/*----------------------------------------------------------------------------*/
+/* A ListRow style may be shared (read-only) by any number of ListRows; it is */
+/* not copied, so it must remain valid for as long as rows are using it.      */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+		int          HSpacing;
+		NEUIK_Color  colorBGSelect; /* color to use for the selected row(s) */
+		NEUIK_Color  colorBGOdd;    /* color to use for unselected odd rows */
+		NEUIK_Color  colorBGEven;   /* color to use for unselected even rows */
+} NEUIK_ListRowStyle;
+
 typedef struct {
 		neuik_Object objBase;       /* this structure is requied to be an neuik object */
 		int          isOddRow;      /* 1 if an odd-numbered row; 0 otherwise */
@@ -32,8 +43,11 @@ typedef struct {
 		NEUIK_Color  colorBGSelect; /* color to use for the selected row(s) */
 		NEUIK_Color  colorBGOdd;    /* color to use for unselected odd rows */
 		NEUIK_Color  colorBGEven;   /* color to use for unselected even rows */
+		const NEUIK_ListRowStyle * style; /* if not NULL, used instead of the above */
 } NEUIK_ListRow;
 
+const NEUIK_ListRowStyle * NEUIK_GetDefaultListRowStyle();
+
 int 
 	NEUIK_NewListRow(
 			NEUIK_ListRow ** row);
@@ -43,6 +57,11 @@ int
 			NEUIK_ListRow * row,
 			int             spacing);
 
+int 
+	NEUIK_ListRow_SetStyle(
+			NEUIK_ListRow            * row,
+			const NEUIK_ListRowStyle * style);
+
 int 
 	NEUIK_ListRow_IsSelected(
 			NEUIK_ListRow * row);
@@ -32,6 +32,8 @@ typedef struct {
 	float         lineThickness;
 	int           lineColorSpecified;
 	NEUIK_Color   lineColor;
+	unsigned int  seenStateMod; /* PlotData `stateMod` when last refreshed */
+	unsigned int  seenBaseMod;  /* PlotData `ring.baseMod` when last refreshed */
 } neuik_PlotDataConfig;
 
 typedef struct {
@@ -54,6 +54,10 @@ int
 			NEUIK_PlotData * data,
 			const char     * label);
 
+int
+	NEUIK_Plot2D_RefreshPlotData(
+			NEUIK_Plot2D * plt);
+
 int 
 	NEUIK_Plot2D_RemovePlotData(
 			NEUIK_Plot2D * plt,
@@ -19,6 +19,16 @@
 #include "NEUIK_Element.h"
 
 
+/*----------------------------------------------------------------------------*/
+/* How the array supplied to NEUIK_PlotData_SetValues32/64 is held.           */
+/*----------------------------------------------------------------------------*/
+typedef enum {
+	NEUIK_PLOTDATA_COPY,   /* the values are copied into the PlotData */
+	NEUIK_PLOTDATA_TAKE,   /* the PlotData takes ownership of (and frees) the array */
+	NEUIK_PLOTDATA_BORROW, /* the array is used in place; the caller keeps it valid */
+} NEUIK_PlotDataOwnership;
+
+
 typedef struct {
 		neuik_Object   objBase;    /* this structure is requied to be an neuik object */
 		char         * uniqueName; /* unique name for this plot data. */
@@ -29,6 +39,7 @@ typedef struct {
 		unsigned int   nUsed;      /* Number of data slots in use */
 		int            precision;  /* 32bit (32) or 64bit (64) */
 		int            boundsSet;  /*  */
+		int            borrowed;   /* [bool] data_32/data_64 is owned by the caller */
 		float        * data_32;    /* Used for storing 32bit float values */
 		double       * data_64;    /* Used for storing 64bit float values */
 		struct {
@@ -43,6 +54,19 @@ typedef struct {
 			double y_min;
 			double y_max;
 		} bounds_64;
+		struct {
+			unsigned int   cap;       /* capacity (in X,Y points); 0 if not a ring buffer */
+			unsigned int   head;      /* index of the oldest X,Y point in data_32/data_64 */
+			unsigned int   baseMod;   /* stateMod when the ring buffer was (re)started; */
+	                                  /* later changes to stateMod are appends only. */
+			unsigned int   nAppended; /* number of points appended since baseMod */
+			unsigned int * minQ;      /* monotonic deque of point indices (running y_min) */
+			unsigned int * maxQ;      /* monotonic deque of point indices (running y_max) */
+			unsigned int   minHead;
+			unsigned int   minLen;
+			unsigned int   maxHead;
+			unsigned int   maxLen;
+		} ring;
 } NEUIK_PlotData;
 
 
@@ -72,6 +96,37 @@ int
 			int              precision,
 			const char     * valStr);
 
+int
+	NEUIK_PlotData_SetValues32(
+			NEUIK_PlotData          * pd,
+			const float             * xy,
+			unsigned int              nPoints,
+			NEUIK_PlotDataOwnership   ownership);
+
+int
+	NEUIK_PlotData_SetValues64(
+			NEUIK_PlotData          * pd,
+			const double            * xy,
+			unsigned int              nPoints,
+			NEUIK_PlotDataOwnership   ownership);
+
+int
+	NEUIK_PlotData_SetRingCapacity(
+			NEUIK_PlotData * pd,
+			unsigned int     capacity);
+
+int
+	NEUIK_PlotData_AppendPoints32(
+			NEUIK_PlotData * pd,
+			const float    * xy,
+			unsigned int     nPoints);
+
+int
+	NEUIK_PlotData_AppendPoints64(
+			NEUIK_PlotData * pd,
+			const double   * xy,
+			unsigned int     nPoints);
+
 int
 	NEUIK_PlotData_WriteValuesToASCIIFile(
 			NEUIK_PlotData * pd,
@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2017, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_SCROLLPANE_H
+#define NEUIK_SCROLLPANE_H
+
+#include "NEUIK_Element.h"
+
+
+typedef struct {
+		neuik_Object   objBase;  /* this structure is requied to be an neuik object */
+		int            scrollX;  /* horizontal offset of the visible content (px) */
+		int            scrollY;  /* vertical offset of the visible content (px) */
+		void         * cache;    /* cached viewport contents (private) */
+} NEUIK_ScrollPane;
+
+
+/*******************************************************************************
+ *
+ *  A ScrollPane is a single element container which shows a viewport onto its
+ *  contained element. The contained element is laid out at its full size once
+ *  and the rendered viewport is retained between frames; scrolling shifts the
+ *  retained pixels and only renders the strip of content that becomes exposed.
+ *
+ *  The contained element is set with `NEUIK_Container_SetElement()`. Mouse
+ *  wheel events which are not captured by the contained element scroll the
+ *  pane.
+ *
+ ******************************************************************************/
+int 
+	NEUIK_NewScrollPane(
+			NEUIK_ScrollPane ** spPtr);
+
+int 
+	NEUIK_ScrollPane_ScrollTo(
+			NEUIK_ScrollPane * sp,
+			int                x,
+			int                y);
+
+int 
+	NEUIK_ScrollPane_ScrollBy(
+			NEUIK_ScrollPane * sp,
+			int                dx,
+			int                dy);
+
+int 
+	NEUIK_ScrollPane_GetScrollOffset(
+			NEUIK_ScrollPane * sp,
+			int              * x,
+			int              * y);
+
+
+#endif /* NEUIK_SCROLLPANE_H */
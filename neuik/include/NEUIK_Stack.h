@@ -26,6 +26,7 @@ typedef struct {
 		NEUIK_Element * elemActive;
 		int             selected;
 		int             isActive;
+		void          * pages;      /* retained page surfaces (private) */
 } NEUIK_Stack;
 
 int 
@@ -37,4 +38,25 @@ int
 			NEUIK_Stack   * stk,
 			NEUIK_Element   elem);
 
+/*----------------------------------------------------------------------------*/
+/* Stacks can retain the rendered contents of recently shown pages (up to a   */
+/* budget in bytes). Switching back to a retained page is a single copy; the  */
+/* page is then only updated where it has changed. Inactive pages may also be */
+/* rendered ahead of time (i.e. while the application is idle).               */
+/*----------------------------------------------------------------------------*/
+int 
+	NEUIK_Stack_SetPageCacheBudget(
+			NEUIK_Stack   * stk,
+			size_t          nBytes);
+
+int 
+	NEUIK_Stack_PrerenderPage(
+			NEUIK_Stack   * stk,
+			NEUIK_Element   elem);
+
+int 
+	NEUIK_Stack_PrerenderNextPage(
+			NEUIK_Stack   * stk,
+			int           * nLeft);
+
 #endif /* NEUIK_STACK_H */
@@ -22,6 +22,7 @@
 #include "NEUIK_Event.h"
 #include "NEUIK_Element.h"
 #include "neuik_TextBlock.h"
+#include "neuik_TextHistory.h"
 #include "NEUIK_TextEditConfig.h"
 
 
@@ -33,6 +34,15 @@ typedef struct {
 		void                 * textTex;       /*  `SDL_Texture *` */ 
 		void                 * textRend;      /*  `SDL_Renderer*` */ 
 		neuik_TextBlock      * textBlk;
+		char                 * lineBuf;       /* reusable line buffer (render/pan) */
+		size_t                 lineBufSize;   /* bytes allocated for `lineBuf` */
+		void                 * fileLoad;      /* file being loaded (NULL if none) */
+		void                 * lineCache;     /* textures of recently drawn lines */
+		void                 * wrapCache;     /* word wrap points and row index */
+		char                 * findPattern;   /* highlighted search pattern (NULL=none) */
+		neuik_TextHistory    * history;       /* undo/redo edit log */
+		size_t                 maxLines;      /* lines kept by AppendText (0=no limit) */
+		int                    autoScroll;    /* view follows appended text */
 		double                 scrollPct;     /* percent of total TextEdit lines scrolled from top */
 		double                 viewPct;       /* percent of total TextEdit lines currently viewed */
 		size_t                 cursorLine;    /* line on which the cursor is */
@@ -59,6 +69,13 @@ typedef struct {
 		size_t                 clickOriginLine; /* cursorLine @ start of select click */
 		int                    clickHeld;       /* click being held following select click */
 		int                    needsRedraw;
+		int                    dirtyLines;      /* only the dirty lines need redrawing */
+		size_t                 dirtyFirstLn;    /* first dirty line */
+		size_t                 dirtyLastLn;     /* final dirty line */
+		int                    dirtyScroll;     /* view scrolled down by whole lines since */
+												/* the last frame (see framePanLn). */
+		unsigned long long     framePanLn;      /* vertPanLn of the last frame drawn */
+		int                    frameAligned;    /* vertPanPx was zero in the last frame */
 		unsigned int           timeLastClick;
 		unsigned int           timeClickMinus2; /* time at which the penultimate */
 												/* preceding click was clicked.*/
@@ -90,6 +107,46 @@ int
 			NEUIK_TextEdit * te,
 			const char     * text);
 
+int
+	NEUIK_TextEdit_AppendText(
+			NEUIK_TextEdit * te,
+			const char     * text);
+
+int
+	NEUIK_TextEdit_Find(
+			NEUIK_TextEdit * te,
+			const char     * pattern,
+			size_t        ** starts,
+			size_t        ** ends,
+			size_t         * nMatches);
+
+int
+	NEUIK_TextEdit_FindNext(
+			NEUIK_TextEdit * te,
+			int            * found);
+
+int
+	NEUIK_TextEdit_ReplaceAll(
+			NEUIK_TextEdit * te,
+			const char     * pattern,
+			const char     * replacement,
+			size_t         * nReplaced);
+
+int
+	NEUIK_TextEdit_Undo(
+			NEUIK_TextEdit * te,
+			int            * done);
+
+int
+	NEUIK_TextEdit_Redo(
+			NEUIK_TextEdit * te,
+			int            * done);
+
+int
+	NEUIK_TextEdit_LoadFile(
+			NEUIK_TextEdit * te,
+			const char     * fileName);
+
 int 
 	NEUIK_TextEdit_Configure(
 			NEUIK_TextEdit * te,
@@ -36,6 +36,7 @@ typedef struct {
 		NEUIK_Color     bgColorHl;         /* background color used when highlighted */
 		NEUIK_Color     fgColorHl;         /* foreground color used when highlighted */
 		NEUIK_Color     bgColorSelect;     /* border color used when selected */
+		NEUIK_Color     bgColorFind;       /* background color of search matches */
 		NEUIK_Color     borderColor;       /* color used for the textEdit border */
 		NEUIK_Color     borderColorDark;   /* color used for the textEdit border */
 		NEUIK_Color     bgScrollColor;     /* background color for the textEdit scrollbar */
@@ -46,6 +47,7 @@ typedef struct {
 		int             restriction;       /* limit what can be put into the text */
 		char          * restrict_str;      /* used for custom text restrictions */
 		int             emptySpaces;       /* used to size the empty textEdit */
+		int             wordWrap;          /* (bool) wrap long lines at word boundaries */
 } NEUIK_TextEditConfig;
 
 NEUIK_TextEditConfig * NEUIK_GetDefaultTextEditConfig();
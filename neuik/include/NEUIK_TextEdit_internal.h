@@ -56,4 +56,48 @@ void
 	neuik_Element_Defocus__TextEdit(
 			NEUIK_Element);
 
+int
+	neuik_TextEdit_LoadThroughLine(
+			NEUIK_TextEdit * te,
+			size_t           lineNo);
+
+int
+	neuik_TextEdit_LoadAll(
+			NEUIK_TextEdit * te);
+
+int
+	neuik_TextEdit_RequestLineRedraw(
+			NEUIK_TextEdit * te,
+			size_t           firstLn,
+			size_t           lastLn);
+
+/*----------------------------------------------------------------------------*/
+/* Word wrap (see `WordWrap` in NEUIK_TextEdit_Configure)                     */
+/*----------------------------------------------------------------------------*/
+size_t
+	neuik_TextEdit_GetWrapRows(
+			NEUIK_TextEdit * te,
+			size_t           lineNo);
+
+size_t
+	neuik_TextEdit_GetWrapRowOfLine(
+			NEUIK_TextEdit * te,
+			size_t           lineNo);
+
+int
+	neuik_TextEdit_GetWrapPosAt(
+			NEUIK_TextEdit * te,
+			size_t           lineNo,
+			char           * lineBytes,
+			size_t           row,
+			int              x,
+			size_t         * pos);
+
+int
+	neuik_TextEdit_WrapMoveVertical(
+			NEUIK_TextEdit * te,
+			int              down,
+			int              extendSel,
+			int            * moved);
+
 #endif /* NEUIK_TEXTEDIT_INTERNAL_H */
@@ -34,6 +34,7 @@ typedef struct {
 		char                  * text;
 		size_t                  textLen;       /* current length of the text */
 		size_t                  textAllocSize; /* current mem alloc for text */
+		size_t                  gapStart;      /* start of the gap within text */
 		size_t                  cursorPos;     /* position of cursor in text */
 		int                     cursorX;       /* px pos of cursor (not considering pan) */
 		int                     selected;
@@ -20,6 +20,8 @@
 #include "NEUIK_render.h"
 #include "NEUIK_structs_basic.h"
 #include "NEUIK_Element_internal.h"
+#include "NEUIK_TextEntry.h"
+#include "neuik_UTF8.h"
 // #include "neuik_classes.h"
 
 extern int neuik__isInitialized;
@@ -49,4 +51,23 @@ void
 	neuik_Element_Defocus__TextEntry(
 		NEUIK_Element);
 
+void
+	neuik_TextEntry_CloseGap(
+		NEUIK_TextEntry * te);
+int
+	neuik_TextEntry_InsertText(
+		NEUIK_TextEntry * te, size_t pos, const char * text, size_t textLen);
+int
+	neuik_TextEntry_DeleteText(
+		NEUIK_TextEntry * te, size_t pos, size_t nBytes);
+int
+	neuik_TextEntry_GetTextLayout(
+		NEUIK_TextEntry * te, TTF_Font * font, neuik_TextLayout ** layoutPtr);
+size_t
+	neuik_TextEntry_PrevPos(
+		NEUIK_TextEntry * te, size_t pos);
+size_t
+	neuik_TextEntry_NextPos(
+		NEUIK_TextEntry * te, size_t pos);
+
 #endif /* NEUIK_TEXTENTRY_INTERNAL_H */
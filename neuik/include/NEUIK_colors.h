@@ -34,6 +34,7 @@
 #define COLOR_DBLUE      { 45,  90, 220, 255}
 #define COLOR_PBAR_LBLUE {103, 150, 166, 255}
 #define COLOR_PBAR_DBLUE { 70, 120, 166, 255}
+#define COLOR_LYELLOW    {255, 236, 140, 255}
 
 #define COLOR_PLOTLINE_01 {  0,  69, 134, 255} // Dark Blue
 #define COLOR_PLOTLINE_02 {255,  66,  14, 255} // Dark Orange
@@ -24,10 +24,14 @@ int neuik_KeyShortcut_Copy(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
 int neuik_KeyShortcut_Paste(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
 int neuik_KeyShortcut_SelectAll(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
 int neuik_KeyShortcut_Undo(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
+int neuik_KeyShortcut_Redo(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
 int neuik_KeyShortcut_Save(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
 int neuik_KeyShortcut_New(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
 int neuik_KeyShortcut_NewWindow(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
 int neuik_KeyShortcut_Find(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
 
+int neuik_MapFile(const char * fileName, const char ** data, size_t * length, void ** handle);
+void neuik_UnmapFile(const char * data, size_t length, void * handle);
+
 
 #endif /* NEUIK_PLATFORM_H */
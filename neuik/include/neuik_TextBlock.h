@@ -40,9 +40,41 @@ typedef struct {
 	unsigned int           overProvisionPct;  /* percent of textBlockData required to be unused. */
 	neuik_TextBlockData *  firstBlock;
 	neuik_TextBlockData *  lastBlock;
+	neuik_TextBlockData *  spareBlock;        /* recycled data block (NULL if none) */
 	neuik_TextBlockData ** chapters;      /*  */
 } neuik_TextBlock;
 
+/*----------------------------------------------------------------------------*/
+/* A contiguous run of bytes stored within a TextBlock. The data pointed to   */
+/* is owned by the TextBlock (or a caller buffer) and is NOT NUL terminated.  */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+	const char * data;   /* first byte of the span */
+	size_t       length; /* number of bytes within the span */
+} neuik_TextBlockSpan;
+
+/*----------------------------------------------------------------------------*/
+/* Iterator state used to walk the spans of a line or section in place.       */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+	neuik_TextBlockData * block;    /* block containing the next span */
+	neuik_TextBlockData * endBlock; /* block containing the end of the range */
+	size_t                position; /* offset of the next span within block */
+	size_t                endPos;   /* offset of the range end within endBlock */
+	int                   lineOnly; /* stop at the first line ending */
+	int                   done;     /* no more spans remain */
+} neuik_TextBlockIter;
+
+/*----------------------------------------------------------------------------*/
+/* A range of text within a TextBlock (e.g. the location of a search match).  */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+	size_t startLineNo;
+	size_t startLinePos;
+	size_t endLineNo;
+	size_t endLinePos;
+} neuik_TextBlockRange;
+
 int
 	neuik_NewTextBlock(
 			neuik_TextBlock ** tblkPtr,
@@ -54,6 +86,32 @@ int
 			neuik_TextBlock * tblk,
 			const char      * text);
 
+/*----------------------------------------------------------------------------*/
+/* Remove all of the text from a TextBlock (leaving a single empty line).     */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_Clear(
+			neuik_TextBlock * tblk);
+
+/*----------------------------------------------------------------------------*/
+/* Append text (which need not be NUL terminated) to the end of a TextBlock.  */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_AppendText(
+			neuik_TextBlock * tblk,
+			const char      * text,
+			size_t            textLen);
+
+/*----------------------------------------------------------------------------*/
+/* Drop whole data blocks from the start of a TextBlock so long as at least   */
+/* `maxLines` lines remain; reports the number of lines removed.              */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_DropLeadingBlocks(
+			neuik_TextBlock * tblk,
+			size_t            maxLines,
+			size_t          * nDropped);
+
 /*----------------------------------------------------------------------------*/
 /* Get the number of bytes contained by the TextBlock.                        */
 /*----------------------------------------------------------------------------*/
@@ -88,6 +146,16 @@ int
 			size_t            lineNo,
 			size_t          * length);
 
+/*----------------------------------------------------------------------------*/
+/* Get the lengths of a run of consecutive lines in a single pass.            */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_GetLineLengths(
+			neuik_TextBlock * tblk,
+			size_t            firstLineNo,
+			size_t            nLengths,
+			size_t          * lengths);
+
 /*----------------------------------------------------------------------------*/
 /* Get a copy of the text contained by a line in a TextBlock                  */
 /*----------------------------------------------------------------------------*/
@@ -97,6 +165,60 @@ int
 			size_t            lineNo,
 			char           ** lineData);
 
+/*----------------------------------------------------------------------------*/
+/* Prepare an iterator over the text of a line (line ending not included)     */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_InitLineIter(
+			neuik_TextBlock     * tblk,
+			size_t                lineNo,
+			neuik_TextBlockIter * iter);
+
+/*----------------------------------------------------------------------------*/
+/* Prepare an iterator over the text of a section (line endings included)     */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_InitSectionIter(
+			neuik_TextBlock     * tblk,
+			size_t                startLineNo,
+			size_t                startLinePos,
+			size_t                endLineNo,
+			size_t                endLinePos,
+			neuik_TextBlockIter * iter);
+
+/*----------------------------------------------------------------------------*/
+/* Get the next span of an iterator without copying; `hasSpan` is set to 0    */
+/* once the iterator has been exhausted.                                      */
+/*----------------------------------------------------------------------------*/
+void
+	neuik_TextBlockIter_Next(
+			neuik_TextBlockIter * iter,
+			neuik_TextBlockSpan * span,
+			int                 * hasSpan);
+
+/*----------------------------------------------------------------------------*/
+/* Get a view of a line. Points into the TextBlock unless the line crosses a  */
+/* block boundary, in which case it is assembled within the supplied buffer.  */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_GetLineView(
+			neuik_TextBlock     * tblk,
+			size_t                lineNo,
+			char                * buf,
+			size_t                bufSize,
+			neuik_TextBlockSpan * view);
+
+/*----------------------------------------------------------------------------*/
+/* Copy a line into a reusable (growable) NUL terminated buffer.              */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_GetLineIntoBuffer(
+			neuik_TextBlock  * tblk,
+			size_t             lineNo,
+			char            ** bufPtr,
+			size_t           * bufSize,
+			size_t           * lineLen);
+
 /*----------------------------------------------------------------------------*/
 /* Get a copy of the specified textSection from a TextBlock                   */
 /*----------------------------------------------------------------------------*/
@@ -121,6 +243,38 @@ int
 			size_t            endLinePos,
 			size_t          * secLen);
 
+/*----------------------------------------------------------------------------*/
+/* Find the first occurrence of a pattern at or after the specified position. */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_FindNext(
+			neuik_TextBlock      * tblk,
+			const char           * pattern,
+			size_t                 startLineNo,
+			size_t                 startLinePos,
+			int                  * found,
+			neuik_TextBlockRange * match);
+
+/*----------------------------------------------------------------------------*/
+/* Find all occurrences of a pattern (the returned array is caller freed).    */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_FindAll(
+			neuik_TextBlock       * tblk,
+			const char            * pattern,
+			neuik_TextBlockRange ** matches,
+			size_t                * nMatches);
+
+/*----------------------------------------------------------------------------*/
+/* Replace all occurrences of a pattern with the replacement text.            */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_ReplaceAll(
+			neuik_TextBlock * tblk,
+			const char      * pattern,
+			const char      * replacement,
+			size_t          * nReplaced);
+
 /*----------------------------------------------------------------------------*/
 /* Replace an actual line of data with another                                */
 /*----------------------------------------------------------------------------*/
@@ -21,6 +21,8 @@
 /* Internal Function Prototypes                                               */
 /*----------------------------------------------------------------------------*/
 int neuik_Object_Free__TextBlock(void * ptr);
+int neuik_TextBlock_RecycleDataBlock__noErrChecks(
+	neuik_TextBlock * tblk, neuik_TextBlockData * block);
 
 
 #endif /* NEUIK_TEXTBLOCK_INTERNAL_H */
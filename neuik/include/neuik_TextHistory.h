@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_TEXTHISTORY_H
+#define NEUIK_TEXTHISTORY_H
+
+#include "neuik_TextBlock.h"
+
+/*----------------------------------------------------------------------------*/
+/* The kind of an edit; runs of typing (or of erasing) are coalesced so that  */
+/* they are undone together.                                                  */
+/*----------------------------------------------------------------------------*/
+#define TEXTHISTORY_EDIT    0 /* never coalesced with preceding edits */
+#define TEXTHISTORY_TYPING  1
+#define TEXTHISTORY_ERASING 2
+
+/*----------------------------------------------------------------------------*/
+/* A single recorded edit. The inserted (or deleted) text is not held by the  */
+/* edit itself; it is a range within the append-only text of the history.     */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+	int    isInsert;     /* text was inserted (otherwise it was deleted) */
+	int    kind;         /* TEXTHISTORY_EDIT, _TYPING, or _ERASING */
+	size_t group;        /* edits of the same group are undone together */
+	size_t startLineNo;
+	size_t startLinePos;
+	size_t endLineNo;    /* end of the edited section (exclusive) */
+	size_t endLinePos;
+	size_t textOffset;   /* location of the edit text within `text` */
+	size_t textLen;
+} neuik_TextHistoryEdit;
+
+typedef struct {
+	char                  * text;       /* append-only store of edit text */
+	size_t                  textLen;
+	size_t                  textAlloc;
+	neuik_TextHistoryEdit * edits;
+	size_t                  nEdits;     /* number of recorded edits */
+	size_t                  nApplied;   /* edits [nApplied, nEdits) may be redone */
+	size_t                  editsAlloc;
+	size_t                  nGroups;
+	int                     canJoin;    /* the next edit may join the last group */
+} neuik_TextHistory;
+
+
+int
+	neuik_NewTextHistory(
+			neuik_TextHistory ** histPtr);
+
+int
+	neuik_TextHistory_Free(
+			neuik_TextHistory * hist);
+
+/*----------------------------------------------------------------------------*/
+/* Discard all of the recorded edits.                                         */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextHistory_Clear(
+			neuik_TextHistory * hist);
+
+/*----------------------------------------------------------------------------*/
+/* Prevent the next edit from being coalesced with the preceding edits.       */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextHistory_Break(
+			neuik_TextHistory * hist);
+
+/*----------------------------------------------------------------------------*/
+/* Insert text into a TextBlock and record the edit.                          */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextHistory_InsertText(
+			neuik_TextHistory * hist,
+			neuik_TextBlock   * tblk,
+			size_t              lineNo,
+			size_t              linePos,
+			const char        * text,
+			int                 kind,
+			size_t            * finalLineNo,
+			size_t            * finalLinePos);
+
+/*----------------------------------------------------------------------------*/
+/* Delete a section of a TextBlock and record the edit.                       */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextHistory_DeleteSection(
+			neuik_TextHistory * hist,
+			neuik_TextBlock   * tblk,
+			size_t              startLineNo,
+			size_t              startLinePos,
+			size_t              endLineNo,
+			size_t              endLinePos,
+			int                 kind);
+
+/*----------------------------------------------------------------------------*/
+/* Revert the most recent group of edits.                                     */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextHistory_Undo(
+			neuik_TextHistory * hist,
+			neuik_TextBlock   * tblk,
+			int               * done,
+			size_t            * cursorLineNo,
+			size_t            * cursorLinePos);
+
+/*----------------------------------------------------------------------------*/
+/* Reapply the most recently undone group of edits.                           */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextHistory_Redo(
+			neuik_TextHistory * hist,
+			neuik_TextBlock   * tblk,
+			int               * done,
+			size_t            * cursorLineNo,
+			size_t            * cursorLinePos);
+
+#endif /* NEUIK_TEXTHISTORY_H */
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_UTF8_H
+#define NEUIK_UTF8_H
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+/*----------------------------------------------------------------------------*/
+/* The horizontal layout of a string of UTF-8 text in a font; the byte offset */
+/* and the x-offset at which each character (codepoint) starts. A layout is   */
+/* measured once (from glyph advances and kerning) and is kept in a small     */
+/* cache keyed by font and text.                                              */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+	TTF_Font      * font;
+	char          * text;      /* copy of the measured text (the cache key) */
+	size_t          nBytes;
+	size_t          nChars;    /* number of characters (codepoints) */
+	size_t        * charPos;   /* byte offset of each char; [nChars] = nBytes */
+	int           * charX;     /* x-offset of each char; [nChars] = width */
+	size_t          allocated; /* entries allocated in charPos/charX */
+	unsigned int    hash;
+	unsigned long   lastUse;
+} neuik_TextLayout;
+
+
+/*----------------------------------------------------------------------------*/
+/* Number of bytes in the UTF-8 character at `str` (zero at the terminating   */
+/* NUL). Invalid bytes are treated as single byte characters.                 */
+/*----------------------------------------------------------------------------*/
+size_t
+	neuik_UTF8_CharSize(
+			const char * str);
+
+/*----------------------------------------------------------------------------*/
+/* Position of the character which follows (or precedes) the character at a  */
+/* byte position within a NUL terminated string.                              */
+/*----------------------------------------------------------------------------*/
+size_t
+	neuik_UTF8_NextPos(
+			const char * str,
+			size_t       pos);
+
+size_t
+	neuik_UTF8_PrevPos(
+			const char * str,
+			size_t       pos);
+
+/*----------------------------------------------------------------------------*/
+/* Get the layout of `nBytes` of text in a font. The layout is owned by the   */
+/* cache and remains valid until the next call to `neuik_GetTextLayout`.      */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_GetTextLayout(
+			TTF_Font          * font,
+			const char        * text,
+			size_t              nBytes,
+			neuik_TextLayout ** layoutPtr);
+
+/*----------------------------------------------------------------------------*/
+/* Get the layout of text held in two parts (`text1` followed by `text2`);    */
+/* the `text` of the layout is a contiguous copy of the whole text.           */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_GetSplitTextLayout(
+			TTF_Font          * font,
+			const char        * text1,
+			size_t              nBytes1,
+			const char        * text2,
+			size_t              nBytes2,
+			neuik_TextLayout ** layoutPtr);
+
+/*----------------------------------------------------------------------------*/
+/* The x-offset of a byte position within laid out text; O(log n).            */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextLayout_GetX(
+			const neuik_TextLayout * layout,
+			size_t                   pos);
+
+/*----------------------------------------------------------------------------*/
+/* The (character boundary) byte position closest to an x-offset; a position  */
+/* is after a character once the x-offset is past two-thirds of it; O(log n). */
+/*----------------------------------------------------------------------------*/
+size_t
+	neuik_TextLayout_GetPosAtX(
+			const neuik_TextLayout * layout,
+			int                      x);
+
+/*----------------------------------------------------------------------------*/
+/* Release all cached text layouts (e.g., before the fonts are closed).       */
+/*----------------------------------------------------------------------------*/
+void
+	neuik_FreeTextLayouts();
+
+#endif /* NEUIK_UTF8_H */
@@ -58,6 +58,7 @@ extern neuik_Class * neuik__Class_ToggleButtonConfig;
 extern neuik_Class * neuik__Class_Container;
 extern neuik_Class * neuik__Class_Frame;
 extern neuik_Class * neuik__Class_Stack;
+extern neuik_Class * neuik__Class_ScrollPane;
 
 /*----------------------------------------------------------------------------*/
 /* Registered class implementations : Internal Objects                        */
@@ -113,6 +114,7 @@ int neuik_RegisterClass_ToggleButton();
 int neuik_RegisterClass_ToggleButtonConfig();
 int neuik_RegisterClass_Transformer();
 int neuik_RegisterClass_Stack();
+int neuik_RegisterClass_ScrollPane();
 
 
 int neuik_RegisterClass_MaskMap();
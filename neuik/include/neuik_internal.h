@@ -37,6 +37,27 @@ typedef enum {
 
 extern neuik_FatalError neuik_Fatal;
 
+/*----------------------------------------------------------------------------*/
+/* Recursion guards; the depth of each is tracked separately for each thread  */
+/* so that element trees may be measured from several threads at once.        */
+/*----------------------------------------------------------------------------*/
+typedef enum {
+	NEUIK_RECURSE_ELEMENT_GETMINSIZE,
+	NEUIK_RECURSE_CONTAINER_ISSHOWN,
+	NEUIK_RECURSE_GRIDLAYOUT_ISSHOWN,
+	NEUIK_RECURSE_NGUARDS,
+} neuik_RecursionGuard;
+
+/*----------------------------------------------------------------------------*/
+/* neuik_ThreadState                                                          */
+/*                                                                            */
+/* State which is kept separately for each thread that calls into NEUIK.      */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+	int    nRecurse[NEUIK_RECURSE_NGUARDS]; /* current depth of each guard */
+	void * fonts;                           /* (neuik_ThreadFonts *) private fonts (or NULL) */
+} neuik_ThreadState;
+
 /*----------------------------------------------------------------------------*/
 /* neuik_Object    Function Table                                             */
 /*----------------------------------------------------------------------------*/
@@ -134,6 +155,24 @@ int
 int
 	neuik_HasFatalError();
 
+/*----------------------------------------------------------------------------*/
+/* Thread support                                                             */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_InitThreadSupport();
+
+void
+	neuik_QuitThreadSupport();
+
+neuik_ThreadState *
+	neuik_GetThreadState();
+
+void
+	neuik_LockShared();
+
+void
+	neuik_UnlockShared();
+
 int 
 	neuik_Object_New(
 			neuik_Class  * objClass,
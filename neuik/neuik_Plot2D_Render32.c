@@ -46,6 +46,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
     neuik_MaskMap        ** lineMask)
 {
     unsigned int  uCtr       = 0;
+    unsigned int  slot       = 0; /* index of the point within the data array */
     int           firstPt    = TRUE;
     int           isVert     = FALSE;
     int           lastPtOut  = FALSE;
@@ -139,13 +140,16 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
     pxDeltaY = (yRangeMax - yRangeMin)/((double)(ticZoneH));
 
     /*------------------------------------------------------------------------*/
-    /* Iterate through the points in the PlotData set.                        */
+    /* Iterate through the points in the PlotData set; in append mode the     */
+    /* data array is a ring buffer starting at ring.head.                     */
     /*------------------------------------------------------------------------*/
+    slot = data->ring.head;
     for (uCtr = 0; uCtr < data->nPoints; uCtr++)
     {
         isVert = FALSE;
-        ptX_32 = data->data_32[uCtr*2];
-        ptY_32 = data->data_32[(uCtr*2)+1];
+        ptX_32 = data->data_32[slot*2];
+        ptY_32 = data->data_32[(slot*2)+1];
+        if (++slot == data->ring.cap) slot = 0;
 
         maskPtX1 = maskPtX2;
         maskPtY1 = maskPtY2;
@@ -0,0 +1,122 @@
+package neuik
+
+/*
+#cgo pkg-config: sdl2
+#cgo LDFLAGS: -lSDL2_ttf -lSDL2_image
+#include "NEUIK.h"
+*/
+import "C"
+
+import (
+	"errors"
+	"unsafe"
+)
+
+type PlotData C.NEUIK_PlotData
+
+func MakePlotData(uniqueName string, precision int) (pd *PlotData, e error) {
+	var (
+		cPD   *C.NEUIK_PlotData
+		cName *C.char
+	)
+	cName = C.CString(uniqueName)
+
+	if C.NEUIK_MakePlotData(&cPD, cName, C.int(precision)) != 0 {
+		e = errors.New("`NEUIK_MakePlotData()` Failed; call `neuik.BacktraceErrors()` for details.")
+	}
+
+	pd = (*PlotData)(cPD)
+	if cName != nil {
+		C.free(unsafe.Pointer(cName))
+	}
+
+	return pd, e
+}
+
+// SetValues32 stores the X,Y pairs in `xy` (sorted by ascending X value).
+// The slice is handed to C in place; C copies it into its own buffer since
+// cgo does not allow C to hold on to Go memory after the call returns.
+func (pd *PlotData) SetValues32(xy []float32) (e error) {
+	var cXY *C.float
+
+	if len(xy)%2 != 0 {
+		return errors.New("`PlotData.SetValues32()` Failed; `xy` must hold X,Y pairs.")
+	}
+	if len(xy) > 0 {
+		cXY = (*C.float)(unsafe.Pointer(&xy[0]))
+	}
+
+	if C.NEUIK_PlotData_SetValues32((*C.NEUIK_PlotData)(pd), cXY,
+		C.uint(len(xy)/2), C.NEUIK_PLOTDATA_COPY) != 0 {
+		e = errors.New("`NEUIK_PlotData_SetValues32()` Failed; call `neuik.BacktraceErrors()` for details.")
+	}
+
+	return e
+}
+
+// SetValues64 is the 64bit counterpart of SetValues32.
+func (pd *PlotData) SetValues64(xy []float64) (e error) {
+	var cXY *C.double
+
+	if len(xy)%2 != 0 {
+		return errors.New("`PlotData.SetValues64()` Failed; `xy` must hold X,Y pairs.")
+	}
+	if len(xy) > 0 {
+		cXY = (*C.double)(unsafe.Pointer(&xy[0]))
+	}
+
+	if C.NEUIK_PlotData_SetValues64((*C.NEUIK_PlotData)(pd), cXY,
+		C.uint(len(xy)/2), C.NEUIK_PLOTDATA_COPY) != 0 {
+		e = errors.New("`NEUIK_PlotData_SetValues64()` Failed; call `neuik.BacktraceErrors()` for details.")
+	}
+
+	return e
+}
+
+// SetRingCapacity switches the PlotData into append mode, holding at most
+// `capacity` X,Y points; a capacity of zero returns it to a normal data set.
+func (pd *PlotData) SetRingCapacity(capacity uint) (e error) {
+	if C.NEUIK_PlotData_SetRingCapacity((*C.NEUIK_PlotData)(pd), C.uint(capacity)) != 0 {
+		e = errors.New("`NEUIK_PlotData_SetRingCapacity()` Failed; call `neuik.BacktraceErrors()` for details.")
+	}
+
+	return e
+}
+
+// AppendPoints32 appends the X,Y pairs in `xy` to a PlotData in append mode.
+func (pd *PlotData) AppendPoints32(xy []float32) (e error) {
+	var cXY *C.float
+
+	if len(xy)%2 != 0 {
+		return errors.New("`PlotData.AppendPoints32()` Failed; `xy` must hold X,Y pairs.")
+	}
+	if len(xy) > 0 {
+		cXY = (*C.float)(unsafe.Pointer(&xy[0]))
+	}
+
+	if C.NEUIK_PlotData_AppendPoints32((*C.NEUIK_PlotData)(pd), cXY,
+		C.uint(len(xy)/2)) != 0 {
+		e = errors.New("`NEUIK_PlotData_AppendPoints32()` Failed; call `neuik.BacktraceErrors()` for details.")
+	}
+
+	return e
+}
+
+// AppendPoints64 is the 64bit counterpart of AppendPoints32.
+func (pd *PlotData) AppendPoints64(xy []float64) (e error) {
+	var cXY *C.double
+
+	if len(xy)%2 != 0 {
+		return errors.New("`PlotData.AppendPoints64()` Failed; `xy` must hold X,Y pairs.")
+	}
+	if len(xy) > 0 {
+		cXY = (*C.double)(unsafe.Pointer(&xy[0]))
+	}
+
+	if C.NEUIK_PlotData_AppendPoints64((*C.NEUIK_PlotData)(pd), cXY,
+		C.uint(len(xy)/2)) != 0 {
+		e = errors.New("`NEUIK_PlotData_AppendPoints64()` Failed; call `neuik.BacktraceErrors()` for details.")
+	}
+
+	return e
+}
@@ -403,7 +403,8 @@ int neuik_NewTextBlock(
         eNum = 3;
         goto out;
     }
-    tblk->lastBlock = tblk->firstBlock;
+    tblk->lastBlock  = tblk->firstBlock;
+    tblk->spareBlock = NULL;
 
     /*------------------------------------------------------------------------*/
     /* Allocate the chapters pointers.                                        */
@@ -472,6 +473,15 @@ int neuik_Object_Free__TextBlock(
         }
     }
 
+    if (tblk->spareBlock != NULL)
+    {
+        if (neuik_TextBlockData_Free(tblk->spareBlock))
+        {
+            eNum = 3;
+            goto out;
+        }
+    }
+
     /*------------------------------------------------------------------------*/
     /* Free the list of pointers to chapters.                                 */
     /*------------------------------------------------------------------------*/
@@ -515,10 +525,16 @@ int neuik_TextBlock_AppendDataBlock(
     }
 
     /*------------------------------------------------------------------------*/
-    /* Go to the current final data block and add one more after that         */
+    /* Go to the current final data block and add one more after that; a      */
+    /* previously dropped block is reused if one is available.                */
     /*------------------------------------------------------------------------*/
     lastBlock = tblk->lastBlock;
-    if (neuik_NewTextBlockData(
+    if (tblk->spareBlock != NULL)
+    {
+        lastBlock->nextBlock = tblk->spareBlock;
+        tblk->spareBlock     = NULL;
+    }
+    else if (neuik_NewTextBlockData(
         (neuik_TextBlockData **)&(lastBlock->nextBlock), tblk->blockSize))
     {
         eNum = 2;
@@ -547,7 +563,7 @@ int neuik_TextBlock_AppendDataBlock(
                 eNum = 3;
                 goto out;
             }
-
+            tblk->chaptersAllocated += DefaultChaptersAllocated;
         }
 
         tblk->chapters[tblk->nChapters] = lastBlock;
@@ -570,29 +586,145 @@ int neuik_TextBlock_SetText(
     neuik_TextBlock * tblk,
     const char      * text)
 {
-    int                   ctr              = 0;
-    int                   firstLineNo      = 0;
-    int                   writeBufferBytes = 0; /* Num. of bytes in w buffer. */
-    size_t                dataLen          = 0;
-    size_t                textLen          = 0;
-    size_t                charCtr          = 0;
-    size_t                allByteCtr       = 0;
-    size_t                writeCtr         = 0;
-    size_t                blockLines       = 0;
-    size_t                lineCtr          = 1;
-    size_t                nBlocksRequried  = 0;
-    unsigned int          maxInitBlockFill = 0;
-    unsigned int          remainingBytes   = 0;
-    char                  writeBuffer[3];
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_TextBlock_SetText";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Output argument `tblk` is NULL.",                   // [1]
+        "Argument `text` is NULL.",                          // [2]
+        "Failure in function `neuik_TextBlock_Clear`.",      // [3]
+        "Failure in function `neuik_TextBlock_AppendText`.", // [4]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (text == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Drop the old contents (and any surplus data blocks) and then fill the  */
+    /* TextBlock using the bulk append path.                                  */
+    /*------------------------------------------------------------------------*/
+    if (neuik_TextBlock_Clear(tblk))
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (neuik_TextBlock_AppendText(tblk, text, strlen(text)))
+    {
+        eNum = 4;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Remove all of the text from a TextBlock; all but the first data block are  */
+/* freed and the TextBlock is left holding a single empty line.               */
+/*----------------------------------------------------------------------------*/
+int neuik_TextBlock_Clear(
+    neuik_TextBlock * tblk)
+{
+    neuik_TextBlockData * thisData   = NULL;
+    neuik_TextBlockData * nextData   = NULL;
+    int                   eNum       = 0; /* which error to report (if any) */
+    static char           funcName[] = "neuik_TextBlock_Clear";
+    static char         * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",                        // [1]
+        "Failure in function `neuik_TextBlockData_Free`.", // [2]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Free all of the data blocks following the first data block.            */
+    /*------------------------------------------------------------------------*/
+    nextData = tblk->firstBlock->nextBlock;
+    for (;;)
+    {
+        if (nextData == NULL) break;
+
+        thisData = nextData;
+        nextData = (neuik_TextBlockData*)thisData->nextBlock;
+
+        if (neuik_TextBlock_RecycleDataBlock__noErrChecks(tblk, thisData))
+        {
+            eNum = 2;
+            goto out;
+        }
+    }
+
+    thisData = tblk->firstBlock;
+    thisData->firstLineNo = 0;
+    thisData->nLines      = 0;
+    thisData->bytesInUse  = 0;
+    thisData->nextBlock   = NULL;
+    thisData->data[0]     = '\0';
+
+    tblk->lastBlock   = thisData;
+    tblk->chapters[0] = thisData;
+    tblk->nDataBlocks = 1;
+    tblk->nChapters   = 1;
+    tblk->length      = 0;
+    tblk->nLines      = 1;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Append text to the end of a TextBlock. The text is written directly into   */
+/* the final data block (new blocks are added as the old ones fill up) so the */
+/* cost of an append is proportional to the length of the appended text and  */
+/* not to the size of the TextBlock.                                          */
+/*                                                                            */
+/* The supplied text does not need to be NUL terminated. A `\r\n` pair split  */
+/* across two separate appends is stored as two separate line endings.       */
+/*----------------------------------------------------------------------------*/
+int neuik_TextBlock_AppendText(
+    neuik_TextBlock * tblk,
+    const char      * text,
+    size_t            textLen)
+{
+    size_t                fillLimit;   /* max bytes to place in a new block */
+    size_t                room;        /* bytes available in the final block */
+    size_t                runLen;      /* bytes until the next line ending */
+    size_t                copyLen;
+    size_t                endLen;      /* length of the line ending sequence */
+    size_t                textPos  = 0;
+    const char          * nextLF   = NULL;
+    const char          * nextCR   = NULL;
+    const char          * lineEnd  = NULL;
     neuik_TextBlockData * aBlock;
+    neuik_TextBlockData * prevBlock;
     int                   eNum       = 0; /* which error to report (if any) */
-    static char           funcName[] = "neuik_TextBlock_SetText";
+    static char           funcName[] = "neuik_TextBlock_AppendText";
     static char         * errMsgs[]  = {"", // [0] no error
-        "Output argument `tblk` is NULL.",                        // [1]
+        "Argument `tblk` is NULL.",                               // [1]
         "Argument `text` is NULL.",                               // [2]
         "Failure in function `neuik_TextBlock_AppendDataBlock`.", // [3]
         "Invalid value set for `tblk->overProvisionPct`.",        // [4]
-        "A contained `TextBlockData` struct is NULL.",            // [5]
     };
 
     if (tblk == NULL)
@@ -612,260 +744,231 @@ int neuik_TextBlock_SetText(
     }
 
     /*------------------------------------------------------------------------*/
-    /* Determine the number of data blocks required to load this text.        */
+    /* Leave the configured amount of free space in each block so that later  */
+    /* edits of the appended text can usually be done in place.               */
     /*------------------------------------------------------------------------*/
-    dataLen = strlen(text);
-    textLen = dataLen;
+    fillLimit = (tblk->blockSize * (100 - tblk->overProvisionPct)) / 100;
+    if (fillLimit < 4) fillLimit = tblk->blockSize;
 
-    /*------------------------------------------------------------------------*/
-    /* Count the number of (`\r`,`\n`, and `\r\n`) combos in the text and add */
-    /* in the extra required space for line terminating `\0` chars.           */
-    /*------------------------------------------------------------------------*/
-    if (textLen > 1)
+    while (textPos < textLen)
     {
-        for (charCtr = 1; charCtr < textLen; charCtr++)
+        aBlock = tblk->lastBlock;
+        room   = 0;
+        if (aBlock->bytesInUse < fillLimit)
         {
-            if (text[charCtr-1] == '\r' && text[charCtr-1] == '\n')
-            {
-                /*------------------------------------------------------------*/
-                /* This is a CR-LF line ending (m$-windows-style)             */
-                /*------------------------------------------------------------*/
-                lineCtr++;
-                charCtr++;
-            }
-            else if (text[charCtr-1] == '\r')
+            room = fillLimit - aBlock->bytesInUse;
+        }
+
+        /*--------------------------------------------------------------------*/
+        /* Locate the next line ending. The position of the next `\n` is kept */
+        /* between iterations so the text is only scanned once.               */
+        /*--------------------------------------------------------------------*/
+        if (nextLF == NULL || nextLF < text + textPos)
+        {
+            nextLF = memchr(text + textPos, '\n', textLen - textPos);
+            if (nextLF == NULL) nextLF = text + textLen;
+        }
+        if (nextCR == NULL)
+        {
+            nextCR = memchr(text + textPos, '\r', nextLF - (text + textPos));
+            if (nextCR == NULL) nextCR = nextLF;
+        }
+        lineEnd = (nextCR < nextLF) ? nextCR : nextLF;
+        runLen  = lineEnd - (text + textPos);
+
+        if (runLen > 0)
+        {
+            if (room == 0)
             {
-                /*------------------------------------------------------------*/
-                /* This is a CR line ending (macos-style)                     */
-                /*------------------------------------------------------------*/
-                lineCtr++;
+                goto new_block;
             }
-            else if (text[charCtr-1] == '\n')
+            if (runLen + 3 > room && runLen + 3 <= fillLimit &&
+                aBlock->bytesInUse > 0 &&
+                aBlock->data[aBlock->bytesInUse - 1] == '\0')
             {
                 /*------------------------------------------------------------*/
-                /* This is a LF line ending (linux-style)                     */
+                /* Rather than splitting a short line across two blocks,     */
+                /* start it at the beginning of a new block; this keeps most  */
+                /* blocks ending on a line boundary.                          */
                 /*------------------------------------------------------------*/
-                lineCtr++;
+                goto new_block;
             }
-        }
-        if (text[charCtr-1] == '\n' || text[charCtr-1] == '\r')
-        {
             /*----------------------------------------------------------------*/
-            /* This would be a final single character trailing newline        */
+            /* Copy over as much of the line text as will fit in this block.  */
             /*----------------------------------------------------------------*/
-            lineCtr++;
+            copyLen = (runLen < room) ? runLen : room;
+            memcpy(aBlock->data + aBlock->bytesInUse, text + textPos, copyLen);
+            aBlock->bytesInUse += copyLen;
+            aBlock->data[aBlock->bytesInUse] = '\0';
+            tblk->length += copyLen;
+            textPos      += copyLen;
+            continue;
         }
-    }
-    textLen += lineCtr;
-    remainingBytes = textLen;
 
-    /*------------------------------------------------------------------------*/
-    /* Calculate the size of a filled DataBlock (when overprovisioning is     */
-    /* considered).                                                           */
-    /*------------------------------------------------------------------------*/
-    maxInitBlockFill = 
-        (unsigned int)(((100.0 - (float)(tblk->overProvisionPct))/100.0) *
-        (float)(tblk->blockSize));
+        if (lineEnd == text + textLen)
+        {
+            break;
+        }
+
+        /*--------------------------------------------------------------------*/
+        /* Store the line ending sequence followed by a `\0` separator.       */
+        /*--------------------------------------------------------------------*/
+        endLen = 1;
+        if (*lineEnd == '\r' && textPos + 1 < textLen && lineEnd[1] == '\n')
+        {
+            endLen = 2;
+        }
+        if (room < endLen + 1)
+        {
+            goto new_block;
+        }
+
+        memcpy(aBlock->data + aBlock->bytesInUse, lineEnd, endLen);
+        aBlock->bytesInUse += endLen;
+        aBlock->data[aBlock->bytesInUse++] = '\0';
+        aBlock->data[aBlock->bytesInUse]   = '\0';
+        aBlock->nLines++;
+        tblk->nLines++;
+        tblk->length += endLen;
+        textPos      += endLen;
+        nextCR = NULL;
+        continue;
 
-    nBlocksRequried = textLen/maxInitBlockFill;
-    if (textLen % maxInitBlockFill > 0)
+    new_block:
+        /*--------------------------------------------------------------------*/
+        /* The final data block is full; add a new one after it.              */
+        /*--------------------------------------------------------------------*/
+        if (neuik_TextBlock_AppendDataBlock(tblk))
+        {
+            eNum = 3;
+            goto out;
+        }
+        prevBlock = tblk->lastBlock->previousBlock;
+        tblk->lastBlock->firstLineNo = prevBlock->firstLineNo + prevBlock->nLines;
+    }
+out:
+    if (eNum > 0)
     {
-        nBlocksRequried++;
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
     }
+    return eNum;
+}
 
-    /*------------------------------------------------------------------------*/
-    /* If not enough data blocks are allocated, allocate more now.            */
-    /*------------------------------------------------------------------------*/
-    if (nBlocksRequried > tblk->nDataBlocks)
+
+/*----------------------------------------------------------------------------*/
+/* Reset a data block and hold on to it for reuse by a later call to          */
+/* `neuik_TextBlock_AppendDataBlock` (only a single spare block is kept).     */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+int neuik_TextBlock_RecycleDataBlock__noErrChecks(
+    neuik_TextBlock     * tblk,
+    neuik_TextBlockData * block)
+{
+    if (tblk->spareBlock != NULL)
     {
-        while (tblk->nDataBlocks < nBlocksRequried)
-        {
-            if (neuik_TextBlock_AppendDataBlock(tblk))
-            {
-                eNum = 3;
-                goto out;
-            }
-        }
+        return neuik_TextBlockData_Free(block);
     }
 
-    /*------------------------------------------------------------------------*/
-    /* If too many data blocks are allocated, free some now.                  */
-    /*------------------------------------------------------------------------*/
-    if (nBlocksRequried < tblk->nDataBlocks)
+    block->firstLineNo   = 0;
+    block->nLines        = 0;
+    block->bytesInUse    = 0;
+    block->previousBlock = NULL;
+    block->nextBlock     = NULL;
+    block->data[0]       = '\0';
+
+    tblk->spareBlock = block;
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Drop whole data blocks from the start of a TextBlock so long as at least   */
+/* `maxLines` lines remain. This allows a TextBlock to be used as a bounded   */
+/* ring of lines (e.g., for a log viewer). Only blocks which end on a line    */
+/* boundary are dropped and the final data block is never dropped.            */
+/*----------------------------------------------------------------------------*/
+int neuik_TextBlock_DropLeadingBlocks(
+    neuik_TextBlock * tblk,
+    size_t            maxLines,
+    size_t          * nDropped)
+{
+    size_t                dropLines  = 0;
+    size_t                dropBytes  = 0;
+    size_t                blockCtr   = 0;
+    neuik_TextBlockData * aBlock;
+    int                   eNum       = 0; /* which error to report (if any) */
+    static char           funcName[] = "neuik_TextBlock_DropLeadingBlocks";
+    static char         * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",                        // [1]
+        "Output argument `nDropped` is NULL.",             // [2]
+        "Failure in function `neuik_TextBlockData_Free`.", // [3]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (nDropped == NULL)
     {
-        #pragma message("[TODO]: `neuik_TextBlock_SetText` Implement Data Block trim")
+        eNum = 2;
+        goto out;
     }
+    *nDropped = 0;
 
-    /*------------------------------------------------------------------------*/
-    /* Begin copying over data into the data blocks.                          */
-    /*------------------------------------------------------------------------*/
-    if (nBlocksRequried == 1)
+    for (;;)
     {
-        /*--------------------------------------------------------------------*/
-        /* The text data will fit within a single data block.                 */
-        /*--------------------------------------------------------------------*/
         aBlock = tblk->firstBlock;
-
-        if (textLen > 1)
+        if (aBlock->nextBlock == NULL) break;
+        if (tblk->nLines - aBlock->nLines < maxLines) break;
+        if (aBlock->bytesInUse == 0 || 
+            aBlock->data[aBlock->bytesInUse - 1] != '\0')
         {
             /*----------------------------------------------------------------*/
-            /* Copying over data one byte at a time taking special care to    */
-            /* include a `\0` character after each line ending sequence.      */
-            /*----------------------------------------------------------------*/
-            for (charCtr = 1; charCtr < textLen; charCtr++)
-            {
-                if (text[charCtr-1] == '\r' && text[charCtr-1] == '\n')
-                {
-                    /*--------------------------------------------------------*/
-                    /* This is a CR-LF line ending (m$-windows-style)         */
-                    /*--------------------------------------------------------*/
-                    charCtr++;
-                    aBlock->data[writeCtr++] = '\r';
-                    aBlock->data[writeCtr++] = '\n';
-                    aBlock->data[writeCtr++] = '\0';
-                }
-                else if (text[charCtr-1] == '\r')
-                {
-                    /*--------------------------------------------------------*/
-                    /* This is a CR line ending (macos-style)                 */
-                    /*--------------------------------------------------------*/
-                    aBlock->data[writeCtr++] = '\r';
-                    aBlock->data[writeCtr++] = '\0';
-                }
-                else if (text[charCtr-1] == '\n')
-                {
-                    /*--------------------------------------------------------*/
-                    /* This is a LF line ending (linux-style)                 */
-                    /*--------------------------------------------------------*/
-                    aBlock->data[writeCtr++] = '\n';
-                    aBlock->data[writeCtr++] = '\0';
-                }
-                else
-                {
-                    aBlock->data[writeCtr++] = text[charCtr-1];
-                }
-            }
-            /*----------------------------------------------------------------*/
-            /* This would be a final single trailing character                */
+            /* The final line in this block continues into the next block.    */
             /*----------------------------------------------------------------*/
-            aBlock->data[writeCtr++] = text[charCtr];
+            break;
         }
 
-        aBlock->bytesInUse = textLen;
-        tblk->nLines       = lineCtr;
-        aBlock->nLines     = lineCtr;
-    }
-    else
-    {
-        /*--------------------------------------------------------------------*/
-        /* The text data will need to occupy multiple data blocks.            */
-        /*--------------------------------------------------------------------*/
-        charCtr    = 1;
-        aBlock = tblk->firstBlock;
-        for (ctr = 0; ctr < nBlocksRequried; ctr++)
+        dropLines += aBlock->nLines;
+        dropBytes += aBlock->bytesInUse - aBlock->nLines;
+        tblk->nLines -= aBlock->nLines;
+
+        tblk->firstBlock = aBlock->nextBlock;
+        tblk->firstBlock->previousBlock = NULL;
+        tblk->nDataBlocks--;
+
+        if (neuik_TextBlock_RecycleDataBlock__noErrChecks(tblk, aBlock))
         {
-            blockLines = 0;
-            if (aBlock == NULL)
-            {
-                eNum = 5;
-                goto out;
-            }
-            if (allByteCtr >= textLen)
-            {
-                /*------------------------------------------------------------*/
-                /* There are no more characters which could be put into this  */
-                /* DataBlock.                                                 */
-                /*------------------------------------------------------------*/
-                aBlock->bytesInUse = textLen % maxInitBlockFill;
-                printf("[1]Setting final block bytesInUse to `%zu`\n", aBlock->bytesInUse);
-                break;
-            }
-            if (ctr > 0)
-            {
-                /*------------------------------------------------------------*/
-                /* Set the first line number for the data block.              */
-                /*------------------------------------------------------------*/
-                aBlock->firstLineNo = firstLineNo;
-            }
+            eNum = 3;
+            goto out;
+        }
+    }
 
-            /*----------------------------------------------------------------*/
-            /* Copy over data one byte at a time taking special care to       */
-            /* include a `\0` character after each line ending sequence.      */
-            /*----------------------------------------------------------------*/
-            for (writeCtr = 0; writeCtr <= maxInitBlockFill;)
-            {
-                for (; writeBufferBytes > 0; writeBufferBytes--)
-                {
-                    aBlock->data[writeCtr++] = writeBuffer[0];
-                    allByteCtr++;
-                    if (writeBuffer[0] != '\0')
-                    {
-                        charCtr++;
-                    }
-                    if (writeBuffer[0] == '\0')
-                    {
-                        blockLines++;
-                    }
-                    if (writeBufferBytes > 1)
-                    {
-                        writeBuffer[0] = writeBuffer[1];
-                        writeBuffer[1] = writeBuffer[2];
-                    }
-                }
+    if (dropLines == 0) goto out;
 
-                if (allByteCtr == textLen)
-                {
-                    /*--------------------------------------------------------*/
-                    /* This means that we have hit the end of the src data.   */
-                    /*--------------------------------------------------------*/
-                    aBlock->bytesInUse = remainingBytes;
-                    break;
-                }
-                if (text[charCtr-1] == '\r' && text[charCtr] == '\n')
-                {
-                    /*--------------------------------------------------------*/
-                    /* This is a CR-LF line ending (m$-windows-style)         */
-                    /*--------------------------------------------------------*/
-                    writeBufferBytes = 3;
-                    writeBuffer[0] = '\r';
-                    writeBuffer[1] = '\n';
-                    writeBuffer[2] = '\0';
-                }
-                else if (text[charCtr-1] == '\r')
-                {
-                    /*--------------------------------------------------------*/
-                    /* This is a CR line ending (macos-style)                 */
-                    /*--------------------------------------------------------*/
-                    writeBufferBytes = 2;
-                    writeBuffer[0] = '\r';
-                    writeBuffer[1] = '\0';
-                }
-                else if (text[charCtr-1] == '\n')
-                {
-                    /*--------------------------------------------------------*/
-                    /* This is a LF line ending (linux-style)                 */
-                    /*--------------------------------------------------------*/
-                    writeBufferBytes = 2;
-                    writeBuffer[0] = '\n';
-                    writeBuffer[1] = '\0';
-                }
-                else
-                {
-                    writeBufferBytes = 1;
-                    writeBuffer[0] = text[charCtr-1];
-                }
-            }
-            aBlock->bytesInUse = writeCtr;
-            aBlock->nLines     = blockLines;
-            firstLineNo += blockLines;
-            remainingBytes -= writeCtr;
+    if (tblk->length >= dropBytes)
+    {
+        tblk->length -= dropBytes;
+    }
 
-            aBlock = aBlock->nextBlock;
+    /*------------------------------------------------------------------------*/
+    /* Renumber the remaining blocks and rebuild the chapter index.           */
+    /*------------------------------------------------------------------------*/
+    tblk->nChapters = 0;
+    aBlock = tblk->firstBlock;
+    for (blockCtr = 0; aBlock != NULL; blockCtr++)
+    {
+        aBlock->firstLineNo -= dropLines;
+        if (blockCtr == 0 || (blockCtr + 1) % tblk->chapterSize == 0)
+        {
+            tblk->chapters[tblk->nChapters++] = aBlock;
         }
-
-        tblk->nLines = lineCtr;
+        aBlock = aBlock->nextBlock;
     }
-    tblk->length = dataLen;
+    *nDropped = dropLines;
 out:
     if (eNum > 0)
     {
@@ -1175,16 +1278,26 @@ int neuik_TextBlock_GetPositionInLine__noErrChecks (
             byteCtr++;
         }
 
-        data = data->nextBlock;
-        if (data == NULL)
+        if (data->nextBlock == NULL)
         {
             /*----------------------------------------------------------------*/
             /* This means that this line was the final line in the TextBlock. */
+            /* The position just past its final byte is still a valid point   */
+            /* (e.g., for appending characters to the end of the text).       */
             /*----------------------------------------------------------------*/
-            goto out;
-        }
-
-        byteCtr--;
+            if (byteCtr == byteNo)
+            {
+                *blockPtr = data;
+                *offset   = position;
+            }
+            else
+            {
+                hasErr = 1;
+            }
+            goto out;
+        }
+        data = data->nextBlock;
+
         position = 0;
     }
 out:
@@ -1294,26 +1407,17 @@ int neuik_TextBlock_GetLineLength__noErrChecks(
         /*--------------------------------------------------------------------*/
         for (; position < final; position++)
         {
-            (*length)++;
-            if (data->data[position] == '\n' || data->data[position] == '\r')
+            if (data->data[position] == '\n' || data->data[position] == '\r' ||
+                data->data[position] == '\0')
             {
                 /*------------------------------------------------------------*/
                 /* This is the end of the line that we were looking for.      */
-                /* Don't include the line break/newline characters in the     */
-                /* line length.                                               */
+                /* Don't include the line break/newline characters (or the    */
+                /* line terminating `\0`) in the line length.                 */
                 /*------------------------------------------------------------*/
-                if (*length > 0) (*length)--;
                 goto out;
             }
-        }
-
-        if (lineNo == tblk->nLines - 1 && *length == 1 && 
-            data->data[position] == 0)
-        {
-            /*----------------------------------------------------------------*/
-            /* This indicates a final line which contains nothing.            */
-            /*----------------------------------------------------------------*/
-            *length = 0;
+            (*length)++;
         }
 
         data = data->nextBlock;
@@ -1379,6 +1483,113 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* Get the lengths of `nLengths` consecutive lines starting at `firstLineNo`. */
+/* The line separators are found with memchr, so this is considerably faster  */
+/* than calling `GetLineLength` for each line.                                */
+/*----------------------------------------------------------------------------*/
+int neuik_TextBlock_GetLineLengths(
+    neuik_TextBlock * tblk,
+    size_t            firstLineNo,
+    size_t            nLengths,
+    size_t          * lengths)
+{
+    int                   eNum       = 0; /* which error to report (if any) */
+    size_t                lineCtr    = 0;
+    size_t                rawLen     = 0; /* bytes of the line (incl. endings) */
+    size_t                nEndChars  = 0; /* trailing line ending characters */
+    size_t                position   = 0;
+    size_t                stop       = 0;
+    size_t                back       = 0;
+    const char          * hit        = NULL;
+    neuik_TextBlockData * data       = NULL;
+    static char           funcName[] = "neuik_TextBlock_GetLineLengths";
+    static char         * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",                        // [1]
+        "Output argument `lengths` is NULL.",              // [2]
+        "Requested Lines not in TextBlock.",               // [3]
+        "Failure in `GetPositionLineStart__noErrChecks`.", // [4]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (lengths == NULL && nLengths > 0)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (nLengths == 0) goto out;
+    if (firstLineNo + nLengths > tblk->nLines)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    if (neuik_TextBlock_GetPositionLineStart__noErrChecks(tblk,
+        firstLineNo, &data, &position))
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    for (; data != NULL && lineCtr < nLengths; data = data->nextBlock)
+    {
+        while (position < data->bytesInUse)
+        {
+            hit  = memchr(data->data + position, '\0',
+                data->bytesInUse - position);
+            stop = (hit == NULL) ? data->bytesInUse :
+                (size_t)(hit - data->data);
+
+            /*----------------------------------------------------------------*/
+            /* Line endings directly precede the `\0` separator, but may lie  */
+            /* in an earlier block than the separator itself.                 */
+            /*----------------------------------------------------------------*/
+            for (back = stop; back > position; back--)
+            {
+                if (data->data[back-1] != '\n' && data->data[back-1] != '\r')
+                {
+                    break;
+                }
+            }
+            if (back > position) nEndChars = 0;
+            nEndChars += stop - back;
+            rawLen    += stop - position;
+
+            if (hit == NULL)
+            {
+                position = data->bytesInUse;
+                break;
+            }
+            lengths[lineCtr++] = rawLen - nEndChars;
+            rawLen    = 0;
+            nEndChars = 0;
+            position  = stop + 1;
+            if (lineCtr == nLengths) break;
+        }
+        position = 0;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* The final line in the TextBlock is not followed by a separator.        */
+    /*------------------------------------------------------------------------*/
+    if (lineCtr < nLengths)
+    {
+        lengths[lineCtr++] = rawLen - nEndChars;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
 /*----------------------------------------------------------------------------*/
 /* Get a copy of the text contained by a line in a TextBlock                  */
 /*----------------------------------------------------------------------------*/
@@ -1474,7 +1685,8 @@ int neuik_TextBlock_GetLine(
         /*--------------------------------------------------------------------*/
         for (; position < final; position++)
         {
-            if (data->data[position] == '\n' || data->data[position] == '\r')
+            if (data->data[position] == '\n' || data->data[position] == '\r' ||
+                data->data[position] == '\0')
             {
                 /*------------------------------------------------------------*/
                 /* This is the end of the line that we were looking for.      */
@@ -1508,42 +1720,22 @@ out:
 
 
 /*----------------------------------------------------------------------------*/
-/* Get a copy of the specified textSection from a TextBlock                   */
+/* Prepare an iterator over the text of a line (line ending not included).    */
+/* The spans returned by the iterator point directly into the TextBlock and   */
+/* remain valid only until the TextBlock is next modified.                    */
 /*----------------------------------------------------------------------------*/
-int neuik_TextBlock_GetSection(
-    neuik_TextBlock  * tblk,
-    size_t             startLineNo,
-    size_t             startLinePos,
-    size_t             endLineNo,
-    size_t             endLinePos,
-    char            ** secData)
+int neuik_TextBlock_InitLineIter(
+    neuik_TextBlock     * tblk,
+    size_t                lineNo,
+    neuik_TextBlockIter * iter)
 {
-    neuik_TextBlockData * aBlock;
-    neuik_TextBlockData * startBlock;
-    neuik_TextBlockData * endBlock;
-    size_t                ctr;
-    size_t                rawSize;
-    size_t                copyCtr;
-    size_t                writeCtr;
-    size_t                copySize;
-    size_t                startLineLen;
-    size_t                endLineLen;
-    size_t                startPosition;
-    size_t                endPosition;
-    char                  aChar;
-    char                  copyChar;
-    char                * writeStr = NULL;
-    int                   eNum       = 0; /* which error to report (if any) */
-    static char           funcName[] = "neuik_TextBlock_GetSection";
-    static char         * errMsgs[]  = {"", // [0] no error
-        "Argument `tblk` is NULL.", // [1]
-        "Failure in function `neuik_TextBlock_GetLineLength`.",        // [2]
-        "Argument `startLinePos` has value in excess of line length.", // [3]
-        "Argument `endLinePos` has value in excess of line length.",   // [4]
-        "Fundamental error in basic function `GetPositionInLine`.",    // [5]
-        "Output argument `secData` is NULL.",                          // [6]
-        "Requested Line not in TextBlock.",                            // [7]
-        "Failure to allocate memory.",                                 // [8]
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_TextBlock_InitLineIter";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",                                    // [1]
+        "Output argument `iter` is NULL.",                             // [2]
+        "Requested Line not in TextBlock.",                            // [3]
+        "Fundamental error in basic function `GetPositionLineStart`.", // [4]
     };
 
     if (tblk == NULL)
@@ -1551,14 +1743,130 @@ int neuik_TextBlock_GetSection(
         eNum = 1;
         goto out;
     }
-    if (secData == NULL)
+    if (iter == NULL)
     {
-        eNum = 6;
+        eNum = 2;
         goto out;
     }
-    if (startLineNo > tblk->nLines || endLineNo > tblk->nLines)
+    if (lineNo >= tblk->nLines)
     {
-        eNum = 7;
+        eNum = 3;
+        goto out;
+    }
+
+    if (neuik_TextBlock_GetPositionLineStart__noErrChecks(tblk, 
+        lineNo, &(iter->block), &(iter->position)))
+    {
+        eNum = 4;
+        goto out;
+    }
+    iter->endBlock = NULL;
+    iter->endPos   = 0;
+    iter->lineOnly = 1;
+    iter->done     = 0;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Locate the data block and offset of a position within a line by walking    */
+/* forward from the start of the line one data block at a time.               */
+/*                                                                            */
+/* Returns : 1 if the call failed; 0 if successful                            */
+/*                                                                            */
+/* [noErrChecks] :                                                            */
+/*    This function does not check for NULL pointer arguments. Appropriate    */
+/*    checks should be done externally before calling this function.          */
+/*----------------------------------------------------------------------------*/
+int neuik_TextBlock_LocateLinePos__noErrChecks(
+    neuik_TextBlock      * tblk,
+    size_t                 lineNo,
+    size_t                 linePos,
+    neuik_TextBlockData ** blockPtr,
+    size_t               * offset)
+{
+    int                   hasErr    = 0;
+    size_t                available = 0;
+    size_t                position  = 0;
+    neuik_TextBlockData * block     = NULL;
+
+    if (neuik_TextBlock_GetPositionLineStart__noErrChecks(tblk, 
+        lineNo, &block, &position))
+    {
+        hasErr = 1;
+        goto out;
+    }
+
+    for (;;)
+    {
+        available = block->bytesInUse - position;
+        if (linePos <= available)
+        {
+            position += linePos;
+            break;
+        }
+        linePos -= available;
+
+        block = block->nextBlock;
+        if (block == NULL)
+        {
+            hasErr = 1;
+            goto out;
+        }
+        position = 0;
+    }
+
+    *blockPtr = block;
+    *offset   = position;
+out:
+    return hasErr;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Prepare an iterator over the text of a section (line endings included).    */
+/*----------------------------------------------------------------------------*/
+int neuik_TextBlock_InitSectionIter(
+    neuik_TextBlock     * tblk,
+    size_t                startLineNo,
+    size_t                startLinePos,
+    size_t                endLineNo,
+    size_t                endLinePos,
+    neuik_TextBlockIter * iter)
+{
+    size_t        startLineLen;
+    size_t        endLineLen;
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_TextBlock_InitSectionIter";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",                                    // [1]
+        "Output argument `iter` is NULL.",                             // [2]
+        "Requested Line not in TextBlock.",                            // [3]
+        "Failure in function `neuik_TextBlock_GetLineLength`.",        // [4]
+        "Argument `startLinePos` has value in excess of line length.", // [5]
+        "Argument `endLinePos` has value in excess of line length.",   // [6]
+        "Fundamental error in basic function `LocateLinePos`.",        // [7]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (iter == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (startLineNo >= tblk->nLines || endLineNo >= tblk->nLines)
+    {
+        eNum = 3;
         goto out;
     }
 
@@ -1567,65 +1875,449 @@ int neuik_TextBlock_GetSection(
     /*------------------------------------------------------------------------*/
     if (neuik_TextBlock_GetLineLength(tblk, startLineNo, &startLineLen))
     {
-        eNum = 2;
+        eNum = 4;
         goto out;
     }
     if (startLinePos > startLineLen)
     {
-        eNum = 3;
+        eNum = 5;
         goto out;
     }
     if (neuik_TextBlock_GetLineLength(tblk, endLineNo, &endLineLen))
     {
-        eNum = 2;
+        eNum = 4;
         goto out;
     }
     if (endLinePos > endLineLen)
     {
-        eNum = 4;
+        eNum = 6;
         goto out;
     }
 
-    if (neuik_TextBlock_GetPositionInLine__noErrChecks(
-        tblk, startLineNo, startLinePos, &startBlock, &startPosition))
+    if (neuik_TextBlock_LocateLinePos__noErrChecks(tblk, 
+        startLineNo, startLinePos, &(iter->block), &(iter->position)))
     {
-        eNum = 5;
+        eNum = 7;
         goto out;
     }
-    if (neuik_TextBlock_GetPositionInLine__noErrChecks(
-        tblk, endLineNo, endLinePos, &endBlock, &endPosition))
+    if (neuik_TextBlock_LocateLinePos__noErrChecks(tblk, 
+        endLineNo, endLinePos, &(iter->endBlock), &(iter->endPos)))
     {
-        eNum = 5;
+        eNum = 7;
         goto out;
     }
+    iter->lineOnly = 0;
+    iter->done     = 0;
 
-    /*------------------------------------------------------------------------*/
-    /* Determine the overall size of the string that is to be returned        */
-    /*------------------------------------------------------------------------*/
-    if (startBlock == endBlock)
+    if (startLineNo > endLineNo || 
+        (startLineNo == endLineNo && startLinePos >= endLinePos))
     {
         /*--------------------------------------------------------------------*/
-        /* The section being copied is all contained within a single block    */
+        /* Nothing is selected, there is nothing to iterate over.             */
         /*--------------------------------------------------------------------*/
-        if (startLineNo == endLineNo && startLinePos > endLinePos)
-        {
-            /*----------------------------------------------------------------*/
-            /* Nothing is selected, there is nothing to be done.              */
-            /*----------------------------------------------------------------*/
-            goto out;
-        }
+        iter->done = 1;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
 
-        /*--------------------------------------------------------------------*/
-        /* The section being copied is one or more characters                 */
-        /*--------------------------------------------------------------------*/
-        copySize = endPosition - startPosition;
 
-        (*secData) = (char *)malloc((copySize+1)*sizeof(char));
-        writeStr = *secData;
-        if (writeStr == NULL)
+/*----------------------------------------------------------------------------*/
+/* Get the next span of an iterator without copying any data. The `\0` line   */
+/* separators used internally by the TextBlock are never part of a span.      */
+/*----------------------------------------------------------------------------*/
+void neuik_TextBlockIter_Next(
+    neuik_TextBlockIter * iter,
+    neuik_TextBlockSpan * span,
+    int                 * hasSpan)
+{
+    size_t                limit;
+    size_t                start;
+    const char          * data;
+    const char          * stop;
+    neuik_TextBlockData * block;
+
+    *hasSpan = 0;
+    for (;;)
+    {
+        block = iter->block;
+        if (iter->done || block == NULL)
         {
-            eNum = 8;
-            goto out;
+            iter->done = 1;
+            return;
+        }
+
+        limit = block->bytesInUse;
+        if (!iter->lineOnly && block == iter->endBlock)
+        {
+            limit = iter->endPos;
+        }
+        data = block->data;
+
+        if (!iter->lineOnly)
+        {
+            /*----------------------------------------------------------------*/
+            /* Step over the `\0` separators which follow each line ending.   */
+            /*----------------------------------------------------------------*/
+            while (iter->position < limit && data[iter->position] == '\0')
+            {
+                iter->position++;
+            }
+        }
+
+        if (iter->position < limit)
+        {
+            start = iter->position;
+            if (iter->lineOnly)
+            {
+                /*------------------------------------------------------------*/
+                /* A line ends at the first `\n` or `\r` character (or at the */
+                /* `\0` which terminates the final line of the TextBlock).    */
+                /*------------------------------------------------------------*/
+                stop = memchr(data + start, '\n', limit - start);
+                if (stop != NULL) limit = stop - data;
+                stop = memchr(data + start, '\r', limit - start);
+                if (stop != NULL) limit = stop - data;
+                stop = memchr(data + start, '\0', limit - start);
+                if (stop != NULL) limit = stop - data;
+                if (limit < block->bytesInUse) iter->done = 1;
+            }
+            else
+            {
+                stop = memchr(data + start, '\0', limit - start);
+                if (stop != NULL) limit = stop - data;
+            }
+
+            iter->position = limit;
+            if (limit > start)
+            {
+                span->data   = data + start;
+                span->length = limit - start;
+                *hasSpan     = 1;
+                return;
+            }
+            continue;
+        }
+
+        if (!iter->lineOnly && block == iter->endBlock)
+        {
+            iter->done = 1;
+            return;
+        }
+        iter->block    = block->nextBlock;
+        iter->position = 0;
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Get a view of a line in a TextBlock. If the line is stored contiguously,   */
+/* the view points directly into the TextBlock and no data is copied. If the  */
+/* line crosses a block boundary, it is assembled within the supplied buffer. */
+/* Should the buffer be too small, `view->data` is set to NULL and            */
+/* `view->length` reports the number of bytes required.                       */
+/*                                                                            */
+/* NOTE: The view is not NUL terminated and is only valid until the next      */
+/*       modification of the TextBlock (or buffer).                           */
+/*----------------------------------------------------------------------------*/
+int neuik_TextBlock_GetLineView(
+    neuik_TextBlock     * tblk,
+    size_t                lineNo,
+    char                * buf,
+    size_t                bufSize,
+    neuik_TextBlockSpan * view)
+{
+    int                   hasSpan    = 0;
+    int                   fits       = TRUE;
+    neuik_TextBlockIter   iter;
+    neuik_TextBlockSpan   span;
+    int                   eNum       = 0; /* which error to report (if any) */
+    static char           funcName[] = "neuik_TextBlock_GetLineView";
+    static char         * errMsgs[]  = {"", // [0] no error
+        "Output argument `view` is NULL.",                     // [1]
+        "Failure in function `neuik_TextBlock_InitLineIter`.", // [2]
+    };
+
+    if (view == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    view->data   = "";
+    view->length = 0;
+
+    if (neuik_TextBlock_InitLineIter(tblk, lineNo, &iter))
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    neuik_TextBlockIter_Next(&iter, &span, &hasSpan);
+    if (!hasSpan) goto out;
+    *view = span;
+
+    neuik_TextBlockIter_Next(&iter, &span, &hasSpan);
+    if (!hasSpan) goto out;
+
+    /*------------------------------------------------------------------------*/
+    /* This line crosses one (or more) block boundaries; assemble the line    */
+    /* within the caller supplied buffer.                                     */
+    /*------------------------------------------------------------------------*/
+    if (buf == NULL || view->length + span.length > bufSize)
+    {
+        fits = FALSE;
+    }
+    else
+    {
+        memcpy(buf, view->data, view->length);
+    }
+    view->data = buf;
+
+    for (; hasSpan; neuik_TextBlockIter_Next(&iter, &span, &hasSpan))
+    {
+        if (fits && view->length + span.length <= bufSize)
+        {
+            memcpy(buf + view->length, span.data, span.length);
+        }
+        else
+        {
+            fits = FALSE;
+        }
+        view->length += span.length;
+    }
+
+    if (!fits)
+    {
+        view->data = NULL;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Copy a line of a TextBlock into a reusable NUL terminated buffer. The      */
+/* buffer is only reallocated when it is too small to hold the line, so a     */
+/* caller which keeps the buffer between calls avoids per-call allocations.   */
+/*----------------------------------------------------------------------------*/
+int neuik_TextBlock_GetLineIntoBuffer(
+    neuik_TextBlock  * tblk,
+    size_t             lineNo,
+    char            ** bufPtr,  /* [in/out] buffer (may point to NULL) */
+    size_t           * bufSize, /* [in/out] number of bytes allocated */
+    size_t           * lineLen) /* [out] length of the line (may be NULL) */
+{
+    int                   hasSpan    = 0;
+    size_t                writePos   = 0;
+    size_t                newSize    = 0;
+    char                * newBuf     = NULL;
+    neuik_TextBlockIter   iter;
+    neuik_TextBlockSpan   span;
+    int                   eNum       = 0; /* which error to report (if any) */
+    static char           funcName[] = "neuik_TextBlock_GetLineIntoBuffer";
+    static char         * errMsgs[]  = {"", // [0] no error
+        "Output argument `bufPtr` is NULL.",                   // [1]
+        "Output argument `bufSize` is NULL.",                  // [2]
+        "Failure in function `neuik_TextBlock_InitLineIter`.", // [3]
+        "Failure to reallocate memory.",                       // [4]
+    };
+
+    if (bufPtr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (bufSize == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (*bufPtr == NULL)
+    {
+        *bufSize = 0;
+    }
+
+    if (neuik_TextBlock_InitLineIter(tblk, lineNo, &iter))
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    for (;;)
+    {
+        neuik_TextBlockIter_Next(&iter, &span, &hasSpan);
+        if (!hasSpan) span.length = 0;
+
+        if (writePos + span.length + 1 > *bufSize)
+        {
+            /*----------------------------------------------------------------*/
+            /* Grow the buffer geometrically so that repeated calls on longer */
+            /* and longer lines do not reallocate each time.                  */
+            /*----------------------------------------------------------------*/
+            newSize = (*bufSize > 0) ? *bufSize : 128;
+            while (newSize < writePos + span.length + 1)
+            {
+                newSize *= 2;
+            }
+            newBuf = (char*) realloc(*bufPtr, newSize*sizeof(char));
+            if (newBuf == NULL)
+            {
+                eNum = 4;
+                goto out;
+            }
+            *bufPtr  = newBuf;
+            *bufSize = newSize;
+        }
+        if (!hasSpan) break;
+
+        memcpy(*bufPtr + writePos, span.data, span.length);
+        writePos += span.length;
+    }
+    (*bufPtr)[writePos] = '\0';
+
+    if (lineLen != NULL)
+    {
+        *lineLen = writePos;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Get a copy of the specified textSection from a TextBlock                   */
+/*----------------------------------------------------------------------------*/
+int neuik_TextBlock_GetSection(
+    neuik_TextBlock  * tblk,
+    size_t             startLineNo,
+    size_t             startLinePos,
+    size_t             endLineNo,
+    size_t             endLinePos,
+    char            ** secData)
+{
+    neuik_TextBlockData * aBlock;
+    neuik_TextBlockData * startBlock;
+    neuik_TextBlockData * endBlock;
+    size_t                ctr;
+    size_t                rawSize;
+    size_t                copyCtr;
+    size_t                writeCtr;
+    size_t                copySize;
+    size_t                startLineLen;
+    size_t                endLineLen;
+    size_t                startPosition;
+    size_t                endPosition;
+    char                  aChar;
+    char                  copyChar;
+    char                * writeStr = NULL;
+    int                   eNum       = 0; /* which error to report (if any) */
+    static char           funcName[] = "neuik_TextBlock_GetSection";
+    static char         * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.", // [1]
+        "Failure in function `neuik_TextBlock_GetLineLength`.",        // [2]
+        "Argument `startLinePos` has value in excess of line length.", // [3]
+        "Argument `endLinePos` has value in excess of line length.",   // [4]
+        "Fundamental error in basic function `GetPositionInLine`.",    // [5]
+        "Output argument `secData` is NULL.",                          // [6]
+        "Requested Line not in TextBlock.",                            // [7]
+        "Failure to allocate memory.",                                 // [8]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (secData == NULL)
+    {
+        eNum = 6;
+        goto out;
+    }
+    if (startLineNo > tblk->nLines || endLineNo > tblk->nLines)
+    {
+        eNum = 7;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Make sure we weren't given an impossible start or end location.        */
+    /*------------------------------------------------------------------------*/
+    if (neuik_TextBlock_GetLineLength(tblk, startLineNo, &startLineLen))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (startLinePos > startLineLen)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (neuik_TextBlock_GetLineLength(tblk, endLineNo, &endLineLen))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (endLinePos > endLineLen)
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    if (neuik_TextBlock_GetPositionInLine__noErrChecks(
+        tblk, startLineNo, startLinePos, &startBlock, &startPosition))
+    {
+        eNum = 5;
+        goto out;
+    }
+    if (neuik_TextBlock_GetPositionInLine__noErrChecks(
+        tblk, endLineNo, endLinePos, &endBlock, &endPosition))
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Determine the overall size of the string that is to be returned        */
+    /*------------------------------------------------------------------------*/
+    if (startBlock == endBlock)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The section being copied is all contained within a single block    */
+        /*--------------------------------------------------------------------*/
+        if (startLineNo == endLineNo && startLinePos > endLinePos)
+        {
+            /*----------------------------------------------------------------*/
+            /* Nothing is selected, there is nothing to be done.              */
+            /*----------------------------------------------------------------*/
+            goto out;
+        }
+
+        /*--------------------------------------------------------------------*/
+        /* The section being copied is one or more characters                 */
+        /*--------------------------------------------------------------------*/
+        copySize = endPosition - startPosition;
+
+        (*secData) = (char *)malloc((copySize+1)*sizeof(char));
+        writeStr = *secData;
+        if (writeStr == NULL)
+        {
+            eNum = 8;
+            goto out;
         }
 
         /*--------------------------------------------------------------------*/
@@ -1652,7 +2344,7 @@ int neuik_TextBlock_GetSection(
         /* Calculate the number of characters in the selection.               */
         /*====================================================================*/
         rawSize = startBlock->bytesInUse - startPosition;
-        for (ctr = startPosition+1; ctr < startBlock->bytesInUse; ctr++)
+        for (ctr = startPosition; ctr < startBlock->bytesInUse; ctr++)
         {
             aChar = startBlock->data[ctr];
             if (aChar == '\0')
@@ -1692,7 +2384,7 @@ int neuik_TextBlock_GetSection(
         if (aBlock == endBlock)
         {
             rawSize += endPosition;
-            for (ctr = 0; ctr <= endPosition; ctr++)
+            for (ctr = 0; ctr < endPosition; ctr++)
             {
                 aChar = aBlock->data[ctr];
                 if (aChar == '\0')
@@ -1757,7 +2449,7 @@ int neuik_TextBlock_GetSection(
         /*--------------------------------------------------------------------*/
         if (aBlock == endBlock)
         {
-            for (ctr = 0; ctr <= endPosition; ctr++)
+            for (ctr = 0; ctr < endPosition; ctr++)
             {
                 copyChar = aBlock->data[ctr];
                 if (copyChar != '\0')
@@ -1980,9 +2672,568 @@ out:
 
 
 /*----------------------------------------------------------------------------*/
-/* Replace an actual line of data with another                                */
+/* Called for each match located by `neuik_TextBlock_Scan__noErrChecks`; a    */
+/* non-zero return value stops the scan.                                      */
 /*----------------------------------------------------------------------------*/
-int
+typedef int (*neuik_TextBlockMatchFn)(
+    void *, neuik_TextBlockData *, size_t, size_t, size_t);
+
+
+/*----------------------------------------------------------------------------*/
+/* Check whether a pattern is stored at the specified position of a data      */
+/* block. The comparison continues into the following blocks when the match  */
+/* crosses a block boundary.                                                  */
+/*                                                                            */
+/* Returns : 1 if the pattern is present; 0 otherwise.                        */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextBlock_MatchAt__noErrChecks(
+    neuik_TextBlockData * block,
+    size_t                offset,
+    const char          * pattern,
+    size_t                patLen)
+{
+    size_t nCmp;
+
+    while (patLen > 0 && block != NULL)
+    {
+        nCmp = block->bytesInUse - offset;
+        if (nCmp > patLen) nCmp = patLen;
+
+        if (memcmp(block->data + offset, pattern, nCmp) != 0) return 0;
+        pattern += nCmp;
+        patLen  -= nCmp;
+
+        block  = block->nextBlock;
+        offset = 0;
+    }
+    return (patLen == 0);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Scan a TextBlock for (non-overlapping) occurrences of a pattern, starting  */
+/* at the given data block position which corresponds to `lineNo`/`linePos`.  */
+/* Candidate positions are located with `memchr` on the first byte of the     */
+/* pattern and the line count is advanced with `memchr` on the `\0` line      */
+/* separators; each match is passed to `matchFn` which may stop the scan by   */
+/* returning a non-zero value. The pattern may not contain a line ending.     */
+/*                                                                            */
+/* [noErrChecks] :                                                            */
+/*    This function does not check for NULL pointer arguments. Appropriate    */
+/*    checks should be done externally before calling this function.          */
+/*----------------------------------------------------------------------------*/
+static void neuik_TextBlock_Scan__noErrChecks(
+    neuik_TextBlockData    * block,
+    size_t                   offset,
+    size_t                   lineNo,
+    size_t                   linePos,
+    const char             * pattern,
+    size_t                   patLen,
+    neuik_TextBlockMatchFn   matchFn,
+    void                   * matchCtx)
+{
+    size_t       end;
+    size_t       stop;
+    size_t       skip = 0; /* bytes of a match which remain to be stepped over */
+    const char * data;
+    const char * cand;
+    const char * sep;
+
+    for (; block != NULL; block = block->nextBlock, offset = 0)
+    {
+        data = block->data;
+        end  = block->bytesInUse;
+
+        if (skip > 0)
+        {
+            /*----------------------------------------------------------------*/
+            /* The previous match crossed into this block.                    */
+            /*----------------------------------------------------------------*/
+            stop = (skip < end) ? skip : end;
+            offset  += stop;
+            linePos += stop;
+            skip    -= stop;
+            if (skip > 0) continue;
+        }
+
+        while (offset < end)
+        {
+            cand = memchr(data + offset, pattern[0], end - offset);
+            stop = (cand != NULL) ? (size_t)(cand - data) : end;
+
+            /*----------------------------------------------------------------*/
+            /* Count the lines which end before the candidate position.       */
+            /*----------------------------------------------------------------*/
+            while ((sep = memchr(data + offset, '\0', stop - offset)) != NULL)
+            {
+                lineNo++;
+                linePos = 0;
+                offset  = (sep - data) + 1;
+            }
+            linePos += stop - offset;
+            offset   = stop;
+            if (cand == NULL) break;
+
+            if (!neuik_TextBlock_MatchAt__noErrChecks(
+                block, offset, pattern, patLen))
+            {
+                offset++;
+                linePos++;
+                continue;
+            }
+
+            if (matchFn(matchCtx, block, offset, lineNo, linePos)) return;
+
+            stop = end - offset;
+            if (stop > patLen) stop = patLen;
+            offset  += stop;
+            linePos += stop;
+            skip     = patLen - stop;
+        }
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Check that a search pattern is usable; matches may not span lines.         */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextBlock_IsValidPattern(
+    const char * pattern)
+{
+    if (pattern == NULL)     return 0;
+    if (pattern[0] == '\0')  return 0;
+    if (strpbrk(pattern, "\r\n") != NULL) return 0;
+    return 1;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Match callback used by `neuik_TextBlock_FindNext`; keeps the first match.  */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextBlock_FindNextMatchFn(
+    void                * ctx,
+    neuik_TextBlockData * block,
+    size_t                offset,
+    size_t                lineNo,
+    size_t                linePos)
+{
+    neuik_TextBlockRange * match = (neuik_TextBlockRange*)ctx;
+
+    match->startLineNo  = lineNo;
+    match->startLinePos = linePos;
+    return 1;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlock_FindNext
+ *
+ *  Description:   Find the first occurrence of a pattern at or after the 
+ *                 specified position. Matches are confined to a single line; 
+ *                 the pattern may not contain a line ending.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlock_FindNext(
+    neuik_TextBlock      * tblk,
+    const char           * pattern,
+    size_t                 startLineNo,
+    size_t                 startLinePos,
+    int                  * found,
+    neuik_TextBlockRange * match)
+{
+    size_t                position;
+    size_t                patLen;
+    neuik_TextBlockData * block;
+    neuik_TextBlockRange  aMatch;
+    int                   eNum       = 0; /* which error to report (if any) */
+    static char           funcName[] = "neuik_TextBlock_FindNext";
+    static char         * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",                                // [1]
+        "Argument `pattern` is invalid (empty or has line ending).", // [2]
+        "Output argument is NULL.",                                // [3]
+        "Requested Line not in TextBlock.",                        // [4]
+        "Fundamental error in basic function `LocateLinePos`.",    // [5]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (!neuik_TextBlock_IsValidPattern(pattern))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (found == NULL || match == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (startLineNo >= tblk->nLines)
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (neuik_TextBlock_LocateLinePos__noErrChecks(tblk, 
+        startLineNo, startLinePos, &block, &position))
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    patLen = strlen(pattern);
+    aMatch.startLineNo = tblk->nLines; /* no match */
+    neuik_TextBlock_Scan__noErrChecks(block, position, 
+        startLineNo, startLinePos, pattern, patLen, 
+        neuik_TextBlock_FindNextMatchFn, &aMatch);
+
+    *found = FALSE;
+    if (aMatch.startLineNo < tblk->nLines)
+    {
+        *found = TRUE;
+        aMatch.endLineNo  = aMatch.startLineNo;
+        aMatch.endLinePos = aMatch.startLinePos + patLen;
+        *match = aMatch;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Collected matches of `neuik_TextBlock_FindAll`.                            */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    neuik_TextBlockRange * matches;
+    size_t                 nMatches;
+    size_t                 nAlloc;
+    size_t                 patLen;
+    int                    failed;  /* a memory allocation failed */
+} neuik_TextBlockFindAll;
+
+
+/*----------------------------------------------------------------------------*/
+/* Match callback used by `neuik_TextBlock_FindAll`; appends every match.     */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextBlock_FindAllMatchFn(
+    void                * ctx,
+    neuik_TextBlockData * block,
+    size_t                offset,
+    size_t                lineNo,
+    size_t                linePos)
+{
+    size_t                   newAlloc;
+    neuik_TextBlockRange   * newMatches;
+    neuik_TextBlockRange   * match;
+    neuik_TextBlockFindAll * fa = (neuik_TextBlockFindAll*)ctx;
+
+    if (fa->nMatches == fa->nAlloc)
+    {
+        newAlloc   = (fa->nAlloc > 0) ? 2*fa->nAlloc : 64;
+        newMatches = (neuik_TextBlockRange*)realloc(fa->matches, 
+            newAlloc*sizeof(neuik_TextBlockRange));
+        if (newMatches == NULL)
+        {
+            fa->failed = TRUE;
+            return 1;
+        }
+        fa->matches = newMatches;
+        fa->nAlloc  = newAlloc;
+    }
+
+    match = &(fa->matches[fa->nMatches++]);
+    match->startLineNo  = lineNo;
+    match->startLinePos = linePos;
+    match->endLineNo    = lineNo;
+    match->endLinePos   = linePos + fa->patLen;
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlock_FindAll
+ *
+ *  Description:   Find all (non-overlapping) occurrences of a pattern within a
+ *                 TextBlock. The returned array of ranges is ordered by 
+ *                 position and must be freed by the caller (it is NULL if 
+ *                 there were no matches).
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlock_FindAll(
+    neuik_TextBlock       * tblk,
+    const char            * pattern,
+    neuik_TextBlockRange ** matches,
+    size_t                * nMatches)
+{
+    neuik_TextBlockFindAll fa         = {NULL, 0, 0, 0, FALSE};
+    int                    eNum       = 0; /* which error to report (if any) */
+    static char            funcName[] = "neuik_TextBlock_FindAll";
+    static char          * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",                                // [1]
+        "Argument `pattern` is invalid (empty or has line ending).", // [2]
+        "Output argument is NULL.",                                // [3]
+        "Failure to allocate memory.",                             // [4]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (!neuik_TextBlock_IsValidPattern(pattern))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (matches == NULL || nMatches == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    fa.patLen = strlen(pattern);
+    neuik_TextBlock_Scan__noErrChecks(tblk->firstBlock, 0, 
+        0, 0, pattern, fa.patLen, 
+        neuik_TextBlock_FindAllMatchFn, &fa);
+    if (fa.failed)
+    {
+        if (fa.matches != NULL) free(fa.matches);
+        eNum = 4;
+        goto out;
+    }
+
+    *matches  = fa.matches;
+    *nMatches = fa.nMatches;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* State of `neuik_TextBlock_ReplaceAll`; the text is copied into a new       */
+/* TextBlock with each match substituted by the replacement text.             */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    neuik_TextBlock     * dst;
+    neuik_TextBlockData * block;   /* position up to which text was copied */
+    size_t                offset;
+    const char          * replacement;
+    size_t                replLen;
+    size_t                patLen;
+    size_t                nReplaced;
+    int                   failed;  /* a call to AppendText failed */
+} neuik_TextBlockReplaceAll;
+
+
+/*----------------------------------------------------------------------------*/
+/* Copy the stored text which falls between two data block positions into     */
+/* the destination TextBlock (the internal `\0` separators are skipped).      */
+/*                                                                            */
+/* Returns : 1 if the call failed; 0 if successful                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextBlock_CopyRange__noErrChecks(
+    neuik_TextBlock     * dst,
+    neuik_TextBlockData * block,
+    size_t                offset,
+    neuik_TextBlockData * endBlock,
+    size_t                endOffset)
+{
+    size_t       end;
+    const char * sep;
+
+    for (; block != NULL; block = block->nextBlock, offset = 0)
+    {
+        end = (block == endBlock) ? endOffset : block->bytesInUse;
+        while (offset < end)
+        {
+            sep = memchr(block->data + offset, '\0', end - offset);
+            if (sep == NULL)
+            {
+                if (neuik_TextBlock_AppendText(dst, 
+                    block->data + offset, end - offset)) return 1;
+                break;
+            }
+            if (neuik_TextBlock_AppendText(dst, 
+                block->data + offset, (sep - block->data) - offset)) return 1;
+            offset = (sep - block->data) + 1;
+        }
+        if (block == endBlock) break;
+    }
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Match callback used by `neuik_TextBlock_ReplaceAll`.                       */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextBlock_ReplaceAllMatchFn(
+    void                * ctx,
+    neuik_TextBlockData * block,
+    size_t                offset,
+    size_t                lineNo,
+    size_t                linePos)
+{
+    size_t                      nSkip;
+    neuik_TextBlockReplaceAll * ra = (neuik_TextBlockReplaceAll*)ctx;
+
+    if (neuik_TextBlock_CopyRange__noErrChecks(ra->dst, 
+            ra->block, ra->offset, block, offset) ||
+        neuik_TextBlock_AppendText(ra->dst, ra->replacement, ra->replLen))
+    {
+        ra->failed = TRUE;
+        return 1;
+    }
+    ra->nReplaced++;
+
+    /*------------------------------------------------------------------------*/
+    /* Resume copying after the end of the match (which may be in a later     */
+    /* data block).                                                           */
+    /*------------------------------------------------------------------------*/
+    nSkip = ra->patLen;
+    while (offset + nSkip > block->bytesInUse && block->nextBlock != NULL)
+    {
+        nSkip -= block->bytesInUse - offset;
+        block  = block->nextBlock;
+        offset = 0;
+    }
+    ra->block  = block;
+    ra->offset = offset + nSkip;
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlock_ReplaceAll
+ *
+ *  Description:   Replace every (non-overlapping) occurrence of a pattern with
+ *                 the replacement text (which may contain line endings). The 
+ *                 text is rebuilt in a single pass rather than being edited in
+ *                 place one match at a time.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlock_ReplaceAll(
+    neuik_TextBlock * tblk,
+    const char      * pattern,
+    const char      * replacement,
+    size_t          * nReplaced)
+{
+    neuik_TextBlock           swap;
+    neuik_Object              objBase;
+    neuik_TextBlockReplaceAll ra;
+    int                       eNum       = 0; /* which error to report (if any) */
+    static char               funcName[] = "neuik_TextBlock_ReplaceAll";
+    static char             * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",                                // [1]
+        "Argument `pattern` is invalid (empty or has line ending).", // [2]
+        "Argument `replacement` is NULL.",                         // [3]
+        "Failure in function `neuik_NewTextBlock`.",               // [4]
+        "Failure in function `neuik_TextBlock_AppendText`.",       // [5]
+        "Failure in function `neuik_Object_Free`.",                // [6]
+    };
+
+    ra.dst = NULL;
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (!neuik_TextBlock_IsValidPattern(pattern))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (replacement == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    if (neuik_NewTextBlock(&ra.dst, tblk->blockSize, tblk->chapterSize))
+    {
+        eNum = 4;
+        goto out;
+    }
+    ra.dst->overProvisionPct = tblk->overProvisionPct;
+    ra.block       = tblk->firstBlock;
+    ra.offset      = 0;
+    ra.replacement = replacement;
+    ra.replLen     = strlen(replacement);
+    ra.patLen      = strlen(pattern);
+    ra.nReplaced   = 0;
+    ra.failed      = FALSE;
+
+    neuik_TextBlock_Scan__noErrChecks(tblk->firstBlock, 0, 
+        0, 0, pattern, ra.patLen, 
+        neuik_TextBlock_ReplaceAllMatchFn, &ra);
+    if (ra.failed)
+    {
+        eNum = 5;
+        goto out;
+    }
+    if (nReplaced != NULL) *nReplaced = ra.nReplaced;
+    if (ra.nReplaced == 0) goto out;
+
+    /*------------------------------------------------------------------------*/
+    /* Copy over the text following the final match.                          */
+    /*------------------------------------------------------------------------*/
+    if (neuik_TextBlock_CopyRange__noErrChecks(ra.dst, ra.block, ra.offset, 
+        tblk->lastBlock, tblk->lastBlock->bytesInUse))
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Swap the rebuilt contents into the original TextBlock (which keeps its */
+    /* identity); the old contents are freed along with the new object.       */
+    /*------------------------------------------------------------------------*/
+    swap            = *tblk;
+    objBase         = ra.dst->objBase;
+    *tblk           = *ra.dst;
+    tblk->objBase   = swap.objBase;
+    *ra.dst         = swap;
+    ra.dst->objBase = objBase;
+out:
+    if (ra.dst != NULL)
+    {
+        if (neuik_Object_Free(ra.dst))
+        {
+            if (eNum == 0) eNum = 6;
+        }
+    }
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Replace an actual line of data with another                                */
+/*----------------------------------------------------------------------------*/
+int
     neuik_TextBlock_ReplaceLine(
             neuik_TextBlock * tblk,
             size_t            lineNo,
@@ -2018,6 +3269,223 @@ int
             const char      * lineData);
 
 
+/*----------------------------------------------------------------------------*/
+/* Rebuild the chapter index of a TextBlock after data blocks have been added */
+/* to or removed from the middle of the chain of blocks.                      */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextBlock_RebuildChapters__noErrChecks(
+    neuik_TextBlock * tblk)
+{
+    size_t                blockCtr;
+    size_t                nNeeded;
+    neuik_TextBlockData * aBlock;
+    neuik_TextBlockData ** chapters;
+
+    nNeeded = 1 + (tblk->nDataBlocks/tblk->chapterSize);
+    if (nNeeded > tblk->chaptersAllocated)
+    {
+        chapters = (neuik_TextBlockData**) realloc(tblk->chapters,
+            (nNeeded + DefaultChaptersAllocated)*sizeof(neuik_TextBlockData*));
+        if (chapters == NULL)
+        {
+            return 1;
+        }
+        tblk->chapters          = chapters;
+        tblk->chaptersAllocated = nNeeded + DefaultChaptersAllocated;
+    }
+
+    tblk->nChapters = 0;
+    aBlock = tblk->firstBlock;
+    for (blockCtr = 0; aBlock != NULL; blockCtr++)
+    {
+        if (blockCtr == 0 || (blockCtr + 1) % tblk->chapterSize == 0)
+        {
+            tblk->chapters[tblk->nChapters++] = aBlock;
+        }
+        aBlock = aBlock->nextBlock;
+    }
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Insert raw block data (text in which each line ending is already followed  */
+/* by a `\0` separator) at a position within a data block. If the block lacks */
+/* the space for it, the block is split and new data blocks are linked in     */
+/* after it. Line endings are never split across two blocks.                  */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextBlock_InsertRaw__noErrChecks(
+    neuik_TextBlock     * tblk,
+    neuik_TextBlockData * aBlock,
+    size_t                position,
+    const char          * raw,
+    size_t                rawLen,
+    size_t                nNewLines)
+{
+    int                   hasErr    = 0;
+    size_t                fillLimit;
+    size_t                tailLen;
+    size_t                chunk;
+    size_t                srcLen;
+    size_t                srcPos;
+    size_t                ctr;
+    size_t                nBlocksAdded = 0;
+    const char          * src;
+    char                * tail      = NULL;
+    neuik_TextBlockData * newBlock;
+    neuik_TextBlockData * aNext;
+
+    if (aBlock->bytesInUse + rawLen < aBlock->bytesAllocated)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Simply shift over the following bytes to make room.                */
+        /*--------------------------------------------------------------------*/
+        memmove(aBlock->data + position + rawLen, aBlock->data + position,
+            aBlock->bytesInUse - position);
+        memcpy(aBlock->data + position, raw, rawLen);
+        aBlock->bytesInUse += rawLen;
+        aBlock->data[aBlock->bytesInUse] = '\0';
+        aBlock->nLines += nNewLines;
+    }
+    else
+    {
+        /*--------------------------------------------------------------------*/
+        /* Split the block at the insert position; the inserted data and then */
+        /* the former tail of the block are written out across as many new    */
+        /* blocks as are needed.                                              */
+        /*--------------------------------------------------------------------*/
+        tailLen = aBlock->bytesInUse - position;
+        tail    = (char*) malloc(tailLen + 1);
+        if (tail == NULL)
+        {
+            hasErr = 1;
+            goto out;
+        }
+        memcpy(tail, aBlock->data + position, tailLen);
+        for (ctr = position; ctr < aBlock->bytesInUse; ctr++)
+        {
+            if (aBlock->data[ctr] == '\0') aBlock->nLines--;
+        }
+        aBlock->bytesInUse = position;
+
+        aNext = aBlock->nextBlock;
+        src    = raw;
+        srcLen = rawLen;
+        srcPos = 0;
+        for (;;)
+        {
+            if (srcPos == srcLen)
+            {
+                if (src == tail || tailLen == 0) break;
+                src    = tail;
+                srcLen = tailLen;
+                srcPos = 0;
+                continue;
+            }
+
+            fillLimit = (aBlock->bytesAllocated*(100 - tblk->overProvisionPct))/100;
+            if (fillLimit + 2 > aBlock->bytesAllocated || fillLimit < 4)
+            {
+                fillLimit = aBlock->bytesAllocated - 2;
+            }
+
+            chunk = 0;
+            if (aBlock->bytesInUse < fillLimit)
+            {
+                chunk = fillLimit - aBlock->bytesInUse;
+            }
+            if (chunk > srcLen - srcPos)
+            {
+                chunk = srcLen - srcPos;
+            }
+            /*----------------------------------------------------------------*/
+            /* Don't split a line ending from its `\0` separator.             */
+            /*----------------------------------------------------------------*/
+            while (chunk > 0 && srcPos + chunk < srcLen &&
+                (src[srcPos + chunk - 1] == '\r' || 
+                 src[srcPos + chunk - 1] == '\n') &&
+                aBlock->bytesInUse + chunk < aBlock->bytesAllocated)
+            {
+                chunk++;
+            }
+
+            if (chunk == 0)
+            {
+                /*------------------------------------------------------------*/
+                /* This block is full; link in another one after it.          */
+                /*------------------------------------------------------------*/
+                if (tblk->spareBlock != NULL)
+                {
+                    newBlock         = tblk->spareBlock;
+                    tblk->spareBlock = NULL;
+                }
+                else if (neuik_NewTextBlockData(&newBlock, tblk->blockSize))
+                {
+                    hasErr = 1;
+                    goto out;
+                }
+                newBlock->firstLineNo   = aBlock->firstLineNo + aBlock->nLines;
+                newBlock->nLines        = 0;
+                newBlock->bytesInUse    = 0;
+                newBlock->previousBlock = aBlock;
+                newBlock->nextBlock     = aNext;
+                if (aNext != NULL)
+                {
+                    aNext->previousBlock = newBlock;
+                }
+                else
+                {
+                    tblk->lastBlock = newBlock;
+                }
+                aBlock->data[aBlock->bytesInUse] = '\0';
+                aBlock->nextBlock = newBlock;
+                aBlock = newBlock;
+                tblk->nDataBlocks++;
+                nBlocksAdded++;
+                continue;
+            }
+
+            memcpy(aBlock->data + aBlock->bytesInUse, src + srcPos, chunk);
+            for (ctr = 0; ctr < chunk; ctr++)
+            {
+                if (src[srcPos + ctr] == '\0') aBlock->nLines++;
+            }
+            aBlock->bytesInUse += chunk;
+            srcPos             += chunk;
+        }
+        aBlock->data[aBlock->bytesInUse] = '\0';
+
+        if (nBlocksAdded > 0 && 
+            neuik_TextBlock_RebuildChapters__noErrChecks(tblk))
+        {
+            hasErr = 1;
+            goto out;
+        }
+    }
+
+    tblk->nLines += nNewLines;
+    tblk->length += rawLen - nNewLines;
+
+    /*------------------------------------------------------------------------*/
+    /* Adjust the firstLineNo on all subsequent blocks.                       */
+    /*------------------------------------------------------------------------*/
+    if (nNewLines > 0)
+    {
+        for (aNext = aBlock->nextBlock; aNext != NULL; aNext = aNext->nextBlock)
+        {
+            aNext->firstLineNo += nNewLines;
+        }
+    }
+out:
+    if (tail != NULL) free(tail);
+    return hasErr;
+}
+
+
 /*----------------------------------------------------------------------------*/
 /* Insert a character at the specified position                               */
 /*----------------------------------------------------------------------------*/
@@ -2028,10 +3496,10 @@ int neuik_TextBlock_InsertChar(
     char              newChar)
 {
     neuik_TextBlockData * aBlock;
-    size_t                copyCtr;
     size_t                lineLen;
     size_t                lineBreakByte = 0;
     size_t                position;
+    char                  rawChars[2];
     int                   eNum       = 0; /* which error to report (if any) */
     static char           funcName[] = "neuik_TextBlock_InsertChar";
     static char         * errMsgs[]  = {"", // [0] no error
@@ -2039,6 +3507,7 @@ int neuik_TextBlock_InsertChar(
         "Failure in function `neuik_TextBlock_GetLineLength`.",        // [2]
         "Argument `byteNo` has value in excess of line length.",       // [3]
         "Fundamental error in basic function `GetPositionLineStart`.", // [4]
+        "Failure to allocate memory.",                                 // [5]
     };
 
     if (tblk == NULL)
@@ -2074,54 +3543,22 @@ int neuik_TextBlock_InsertChar(
         goto out;
     }
 
-    if (newChar == '\n')
-    {
-        lineBreakByte = 1;
-    }
-
     /*------------------------------------------------------------------------*/
-    /* It is likely that line data will need to be shifted over to accomodate */
-    /* this new character.                                                    */
+    /* A line ending is followed by a `\0` line separator.                    */
     /*------------------------------------------------------------------------*/
-    if (aBlock->bytesInUse + lineBreakByte < aBlock->bytesAllocated)
-    {
-        /*--------------------------------------------------------------------*/
-        /* Simply shift over the bytes by one                                 */
-        /*--------------------------------------------------------------------*/
-        aBlock->data[1 + aBlock->bytesInUse] = '\0';
-        for (copyCtr = aBlock->bytesInUse; copyCtr > position; copyCtr--)
-        {
-            aBlock->data[copyCtr] = aBlock->data[copyCtr-1];
-        }
-        aBlock->data[position] = newChar;
-        aBlock->bytesInUse++;
-
-        if (newChar == '\n')
-        {
-            /*----------------------------------------------------------------*/
-            /* Shift over the bytes by one more character                     */
-            /*----------------------------------------------------------------*/
-            aBlock->data[1 + aBlock->bytesInUse] = '\0';
-            for (copyCtr = aBlock->bytesInUse; copyCtr > position; copyCtr--)
-            {
-                aBlock->data[copyCtr] = aBlock->data[copyCtr-1];
-            }
-            aBlock->data[position+1] = '\0';
-            aBlock->bytesInUse++;
-        }
-    }
-    else
+    rawChars[0] = newChar;
+    rawChars[1] = '\0';
+    if (newChar == '\n')
     {
-        #pragma message("[TODO] `neuik_TextBlock_InsertChar` Complex byte Shift")
+        lineBreakByte = 1;
     }
 
-    if (newChar == '\n')
+    if (neuik_TextBlock_InsertRaw__noErrChecks(tblk, aBlock, position, 
+        rawChars, 1 + lineBreakByte, lineBreakByte))
     {
-        tblk->nLines++;
-        aBlock->nLines++;
+        eNum = 5;
+        goto out;
     }
-    // printf("neuik_TextBlock_InsertChar(): [%u:%u] `%s`\n", 
-    //  lineNo, byteNo, aBlock->data);
 out:
     if (eNum > 0)
     {
@@ -2145,15 +3582,13 @@ int neuik_TextBlock_InsertText(
 {
     neuik_TextBlockData * aBlock;
     size_t                textLen;
-    size_t                copyCtr;
     size_t                charCtr;
     size_t                lineLen;
     size_t                startPosition;
-    size_t                startOfCopy;
-    size_t                endOfCopy;
     size_t                writeCtr         = 0;
     size_t                posCtr           = 0;
     size_t                lineCtr          = 0;
+    char                * raw              = NULL;
     int                   eNum       = 0; /* which error to report (if any) */
     static char           funcName[] = "neuik_TextBlock_InsertText";
     static char         * errMsgs[]  = {"", // [0] no error
@@ -2163,6 +3598,7 @@ int neuik_TextBlock_InsertText(
         "Failure in function `neuik_TextBlock_GetLineLength`.",        // [4]
         "Argument `linePos` has value in excess of line length.",      // [5]
         "Fundamental error in basic function `GetPositionLineStart`.", // [6]
+        "Failure to allocate memory.",                                 // [7]
     };
 
     if (tblk == NULL)
@@ -2201,6 +3637,8 @@ int neuik_TextBlock_InsertText(
     /*------------------------------------------------------------------------*/
     /* Determine the length of the text to insert.                            */
     /*------------------------------------------------------------------------*/
+    *finalLineNo  = lineNo;
+    *finalLinePos = linePos;
     textLen = strlen(text);
     if (textLen == 0)
     {
@@ -2208,60 +3646,28 @@ int neuik_TextBlock_InsertText(
     }
 
     /*------------------------------------------------------------------------*/
-    /* Count the number of (`\r`,`\n`, and `\r\n`) combos in the text and add */
-    /* in the extra required space for line terminating `\0` chars.           */
+    /* Convert the text into block data; each (`\r`,`\n`, and `\r\n`) line    */
+    /* ending is followed by a line terminating `\0` char.                    */
     /*------------------------------------------------------------------------*/
-    if (textLen > 1)
+    raw = (char*) malloc(2*textLen);
+    if (raw == NULL)
     {
-        for (charCtr = 1; charCtr < textLen; charCtr++)
-        {
-            if (text[charCtr-1] == '\r' && text[charCtr-1] == '\n')
-            {
-                /*------------------------------------------------------------*/
-                /* This is a CR-LF line ending (m$-windows-style)             */
-                /*------------------------------------------------------------*/
-                lineCtr++;
-                charCtr++;
-                posCtr = 0;
-            }
-            else if (text[charCtr-1] == '\r')
-            {
-                /*------------------------------------------------------------*/
-                /* This is a CR line ending (macos-style)                     */
-                /*------------------------------------------------------------*/
-                lineCtr++;
-                posCtr = 0;
-            }
-            else if (text[charCtr-1] == '\n')
-            {
-                /*------------------------------------------------------------*/
-                /* This is a LF line ending (linux-style)                     */
-                /*------------------------------------------------------------*/
-                lineCtr++;
-                posCtr = 0;
-            }
-            else
-            {
-                posCtr++;
-            }
-        }
-        if (text[charCtr] == '\r' || text[charCtr] == '\n')
+        eNum = 7;
+        goto out;
+    }
+    for (charCtr = 0; charCtr < textLen; charCtr++)
+    {
+        raw[writeCtr++] = text[charCtr];
+        if (text[charCtr] == '\r' && text[charCtr+1] == '\n')
         {
             /*----------------------------------------------------------------*/
-            /* This would be a final single character trailing newline        */
+            /* This is a CR-LF line ending (m$-windows-style)                 */
             /*----------------------------------------------------------------*/
-            lineCtr++;
-            posCtr = 0;
-        }
-        else
-        {
-            posCtr++;
+            raw[writeCtr++] = text[++charCtr];
         }
-    }
-    else if (textLen == 1)
-    {
-        if (text[0] == '\n' || text[0] == '\r')
+        if (text[charCtr] == '\r' || text[charCtr] == '\n')
         {
+            raw[writeCtr++] = '\0';
             lineCtr++;
             posCtr = 0;
         }
@@ -2271,91 +3677,11 @@ int neuik_TextBlock_InsertText(
         }
     }
 
-    /*------------------------------------------------------------------------*/
-    /* Determine if the receiving data block has enough extra space to hold   */
-    /* the addtional text in its entirety.                                    */
-    /*------------------------------------------------------------------------*/
-    if (aBlock->bytesInUse + (textLen + lineCtr) < aBlock->bytesAllocated)
-    {
-        startOfCopy = (aBlock->bytesInUse - 1) + (textLen + lineCtr); 
-        endOfCopy   = startPosition + (textLen + lineCtr);
-
-        /*--------------------------------------------------------------------*/
-        /* Shift over the existing data to make room for the new text         */
-        /*--------------------------------------------------------------------*/
-        for (copyCtr = startOfCopy; copyCtr >= endOfCopy; copyCtr--)
-        {
-            aBlock->data[copyCtr] = aBlock->data[copyCtr - (textLen + lineCtr)];
-        }
-        aBlock->bytesInUse += (textLen + lineCtr);
-        aBlock->data[aBlock->bytesInUse] = '\0';
-
-
-        /*--------------------------------------------------------------------*/
-        /* Copy over the new text into the desired location                   */
-        /*--------------------------------------------------------------------*/
-        if (textLen > 1)
-        {
-            /*----------------------------------------------------------------*/
-            /* Copying over data one byte at a time taking special care to    */
-            /* include a `\0` character after each line ending sequence.      */
-            /*----------------------------------------------------------------*/
-            writeCtr = startPosition;
-            for (charCtr = 1; charCtr <= textLen; charCtr++)
-            {
-                if (text[charCtr-1] == '\r' && text[charCtr] == '\n')
-                {
-                    /*--------------------------------------------------------*/
-                    /* This is a CR-LF line ending (m$-windows-style)         */
-                    /*--------------------------------------------------------*/
-                    charCtr++;
-                    aBlock->data[writeCtr++] = '\r';
-                    aBlock->data[writeCtr++] = '\n';
-                    aBlock->data[writeCtr++] = '\0';
-                    tblk->nLines++;
-                    aBlock->nLines++;
-                }
-                else if (text[charCtr-1] == '\r')
-                {
-                    /*--------------------------------------------------------*/
-                    /* This is a CR line ending (macos-style)                 */
-                    /*--------------------------------------------------------*/
-                    aBlock->data[writeCtr++] = '\r';
-                    aBlock->data[writeCtr++] = '\0';
-                    tblk->nLines++;
-                    aBlock->nLines++;
-                }
-                else if (text[charCtr-1] == '\n')
-                {
-                    /*--------------------------------------------------------*/
-                    /* This is a LF line ending (linux-style)                 */
-                    /*--------------------------------------------------------*/
-                    aBlock->data[writeCtr++] = '\n';
-                    aBlock->data[writeCtr++] = '\0';
-                    tblk->nLines++;
-                    aBlock->nLines++;
-                }
-                else
-                {
-
-                    aBlock->data[writeCtr++] = text[charCtr-1];
-                }
-            }
-        }
-        else if (textLen == 1)
-        {
-            aBlock->data[startPosition] = text[0];
-            if (text[0] == '\n' || text[0] == '\r')
-            {
-                aBlock->data[startPosition + 1] = '\0';
-                tblk->nLines++;
-                aBlock->nLines++;
-            }
-        }
-    }
-    else
+    if (neuik_TextBlock_InsertRaw__noErrChecks(tblk, aBlock, startPosition, 
+        raw, writeCtr, lineCtr))
     {
-        #pragma message("[TODO]: `neuik_TextBlock_InsertText` Insert Text into multiple blocks.")
+        eNum = 7;
+        goto out;
     }
 
     /*------------------------------------------------------------------------*/
@@ -2371,6 +3697,7 @@ int neuik_TextBlock_InsertText(
         *finalLinePos = linePos + posCtr;
     }
 out:
+    if (raw != NULL) free(raw);
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -2599,19 +3926,15 @@ int neuik_TextBlock_DeleteSection(
     neuik_TextBlockData * startBlock;
     neuik_TextBlockData * endBlock;
     neuik_TextBlockData * aBlock;   /* the current active block. */
-    neuik_TextBlockData * refBlock; /* A block being referenced. */
     neuik_TextBlockData * rmBlock;  /* pointer used for blocks being removed. */
     size_t                checkCtr;
-    size_t                copyCtr;
-    size_t                copyOffset;
-    size_t                endOfCopy;
     size_t                startLineLen;
     size_t                endLineLen;
     size_t                startPosition;
     size_t                endPosition;
-    char                  remChar;
-    int                   zeroCtr;        /* counter for zeroing out trailing values */
-    int                   nLineMod   = 0; /* modifier for number of lines */
+    size_t                nBytesRm   = 0; /* number of bytes removed */
+    size_t                nLinesRm   = 0; /* number of line endings removed */
+    size_t                nBlockRm   = 0; /* number of data blocks removed */
     int                   eNum       = 0; /* which error to report (if any) */
     static char           funcName[] = "neuik_TextBlock_DeleteSection";
     static char         * errMsgs[]  = {"", // [0] no error
@@ -2620,6 +3943,8 @@ int neuik_TextBlock_DeleteSection(
         "Argument `startLineNo` has value in excess of line length.",  // [3]
         "Argument `endLineNo` has value in excess of line length.",    // [4]
         "Fundamental error in basic function `GetPositionInLine`.",    // [5]
+        "Failure in function `neuik_TextBlockData_Free`.",             // [6]
+        "Failure to reallocate memory.",                               // [7]
     };
 
     if (tblk == NULL)
@@ -2653,6 +3978,15 @@ int neuik_TextBlock_DeleteSection(
         goto out;
     }
 
+    /*------------------------------------------------------------------------*/
+    /* The section end is exclusive; an empty section has nothing to delete.  */
+    /*------------------------------------------------------------------------*/
+    if (startLineNo > endLineNo || 
+        (startLineNo == endLineNo && startLinePos >= endLinePos))
+    {
+        goto out;
+    }
+
     if (neuik_TextBlock_GetPositionInLine__noErrChecks(
         tblk, startLineNo, startLinePos, &startBlock, &startPosition))
     {
@@ -2671,257 +4005,155 @@ int neuik_TextBlock_DeleteSection(
         /*--------------------------------------------------------------------*/
         /* The section being deleted is all contained within a single block   */
         /*--------------------------------------------------------------------*/
-        if (startLineNo == endLineNo && startLinePos > endLinePos)
+        for (checkCtr = startPosition; checkCtr < endPosition; checkCtr++)
         {
-            /*----------------------------------------------------------------*/
-            /* Nothing is selected, there is nothing to be done.              */
-            /*----------------------------------------------------------------*/
-            goto out;
+            if (startBlock->data[checkCtr] == '\0') nLinesRm++;
         }
+        nBytesRm = endPosition - startPosition;
 
+        memmove(startBlock->data + startPosition, 
+            startBlock->data + endPosition, 
+            startBlock->bytesInUse - endPosition);
+        startBlock->bytesInUse -= nBytesRm;
+        memset(startBlock->data + startBlock->bytesInUse, 0, 
+            1 + startBlock->bytesAllocated - startBlock->bytesInUse);
+        startBlock->nLines -= nLinesRm;
+    }
+    else
+    {
         /*--------------------------------------------------------------------*/
-        /* The section being deleted is one or more characters                */
-        /*--------------------------------------------------------------------*/
-        copyOffset = endPosition - startPosition;
-
-        /*--------------------------------------------------------------------*/
-        /* Check for any captured lineBreaks/newline characters               */
+        /* The section being deleted spans more than one block. First chop    */
+        /* off the tail of the starting block.                                */
         /*--------------------------------------------------------------------*/
-        for (checkCtr = startPosition; checkCtr <= endPosition; checkCtr++)
+        for (checkCtr = startPosition; 
+             checkCtr < startBlock->bytesInUse; 
+             checkCtr++)
         {
-            remChar = startBlock->data[checkCtr];
-            if (remChar == '\0')
+            if (startBlock->data[checkCtr] == '\0')
             {
-                /*------------------------------------------------------------*/
-                /* Shift over the bytes by one more character                 */
-                /*------------------------------------------------------------*/
-                tblk->nLines--;
-                nLineMod--;
+                nLinesRm++;
                 startBlock->nLines--;
             }
         }
+        nBytesRm += startBlock->bytesInUse - startPosition;
+        startBlock->bytesInUse = startPosition;
+        memset(startBlock->data + startBlock->bytesInUse, 0, 
+            1 + startBlock->bytesAllocated - startBlock->bytesInUse);
 
-        if (startBlock->nextBlock == NULL && checkCtr == startBlock->bytesInUse 
-            && startBlock->data[checkCtr] == '\0')
-        {
-            /*----------------------------------------------------------------*/
-            /* This section is ended with an empty line (no trailing newline) */
-            /*----------------------------------------------------------------*/
-            tblk->nLines++;
-            nLineMod++;
-            startBlock->nLines++;
-            startBlock->bytesInUse = startPosition;
-
-            for (zeroCtr = startPosition; 
-                 zeroCtr <= startBlock->bytesAllocated; 
-                 zeroCtr++)
-            {
-                startBlock->data[zeroCtr] = '\0';
-            }
-        }
-        else
+        /*--------------------------------------------------------------------*/
+        /* Completely remove all fully encapsulated inner blocks.             */
+        /*--------------------------------------------------------------------*/
+        aBlock = startBlock->nextBlock;
+        while (aBlock != endBlock)
         {
-            endOfCopy  = startBlock->bytesInUse - copyOffset;
+            rmBlock = aBlock;
+            aBlock  = aBlock->nextBlock;
 
-            /*----------------------------------------------------------------*/
-            /* Simply shift over the bytes by one at a time.                  */
-            /*----------------------------------------------------------------*/
-            for (copyCtr = startPosition; copyCtr < endOfCopy; copyCtr++)
+            nLinesRm += rmBlock->nLines;
+            nBytesRm += rmBlock->bytesInUse;
+
+            startBlock->nextBlock = aBlock;
+            aBlock->previousBlock = startBlock;
+            tblk->nDataBlocks--;
+            nBlockRm++;
+            if (neuik_TextBlock_RecycleDataBlock__noErrChecks(tblk, rmBlock))
             {
-                /*------------------------------------------------------------*/
-                /* First store the value of the deleted character.            */
-                /*------------------------------------------------------------*/
-                startBlock->data[copyCtr] = startBlock->data[copyCtr+copyOffset];
+                eNum = 6;
+                goto out;
             }
-            startBlock->bytesInUse -= copyOffset;
-            startBlock->data[startBlock->bytesInUse] = '\0';
         }
-    }
-    else
-    {
-        /*--------------------------------------------------------------------*/
-        /* The section being deleted spans more than one block                */
-        /*--------------------------------------------------------------------*/
 
-        /*====================================================================*/
-        /* Chop off the desired portion from the final block in the section.  */
-        /*====================================================================*/
-        /* Check for any captured lineBreaks/newline characters               */
         /*--------------------------------------------------------------------*/
-        nLineMod = 0;
-        for (checkCtr = 0; checkCtr <= endPosition; checkCtr++)
+        /* Chop off the head of the final block in the section.               */
+        /*--------------------------------------------------------------------*/
+        for (checkCtr = 0; checkCtr < endPosition; checkCtr++)
         {
-            remChar = endBlock->data[checkCtr];
-            if (remChar == '\0')
+            if (endBlock->data[checkCtr] == '\0')
             {
-                /*------------------------------------------------------------*/
-                /* Shift over the bytes by one more character                 */
-                /*------------------------------------------------------------*/
-                tblk->nLines--;
-                nLineMod--;
+                nLinesRm++;
                 endBlock->nLines--;
             }
         }
-
-        if (endBlock->nextBlock == NULL && checkCtr == endBlock->bytesInUse 
-            && endBlock->data[checkCtr] == '\0')
-        {
-            /*----------------------------------------------------------------*/
-            /* All content from the final block should be deleted. So delete  */
-            /* the block entirely.                                            */
-            /*----------------------------------------------------------------*/
-            printf("Deletion of a final block!\n");
-
-            tblk->nLines++;
-            nLineMod++;
-            aBlock = endBlock->previousBlock;
-            aBlock->nextBlock = NULL;
-            tblk->nChapters--;
-            tblk->lastBlock = aBlock;
-
-            printf("TODO: Free TextBlockData!!!!\n");
-            #pragma message("[TODO] `neuik_TextBlock_DeleteSection` Free TextBlockData!!!!")
-
-        }
-        else
-        {
-            copyOffset = endPosition;
-            endOfCopy  = endBlock->bytesInUse - copyOffset;
-
-            /*----------------------------------------------------------------*/
-            /* Simply shift over the bytes by one at a time.                  */
-            /*----------------------------------------------------------------*/
-            for (copyCtr = 0; copyCtr <= endOfCopy; copyCtr++)
-            {
-                /*------------------------------------------------------------*/
-                /* First store the value of the deleted character.            */
-                /*------------------------------------------------------------*/
-                endBlock->data[copyCtr] = endBlock->data[copyCtr+copyOffset];
-            }
-
-            endBlock->bytesInUse -= copyOffset;
-            for (zeroCtr = 1 + endBlock->bytesInUse; 
-                 zeroCtr <= endBlock->bytesAllocated; 
-                 zeroCtr++)
-            {
-                endBlock->data[zeroCtr] = '\0';
-            }
-        }
+        nBytesRm += endPosition;
+        memmove(endBlock->data, endBlock->data + endPosition, 
+            endBlock->bytesInUse - endPosition);
+        endBlock->bytesInUse -= endPosition;
+        memset(endBlock->data + endBlock->bytesInUse, 0, 
+            1 + endBlock->bytesAllocated - endBlock->bytesInUse);
+        endBlock->firstLineNo = startBlock->firstLineNo + startBlock->nLines;
 
         /*--------------------------------------------------------------------*/
-        /* Adjust subsequent blocks (those following this block).             */
+        /* Don't leave an emptied block within the chain.                     */
         /*--------------------------------------------------------------------*/
-        aBlock = endBlock;
-        aBlock = aBlock->nextBlock;
-        for (;;)
+        rmBlock = NULL;
+        if (endBlock->bytesInUse == 0)
         {
-            if (aBlock == NULL) break;
-
-            aBlock->firstLineNo += nLineMod;
-
-            aBlock = aBlock->nextBlock;
+            rmBlock = endBlock;
         }
-
-        /*====================================================================*/
-        /* Completely remove all fully encapsulated inner blocks until the    */
-        /* startBlock is reached.                                             */
-        /*====================================================================*/
-        nLineMod = 0;
-        aBlock = endBlock;
-        aBlock = aBlock->previousBlock;
-        for (;;)
+        else if (startBlock->bytesInUse == 0)
         {
-            if (aBlock == NULL) break;
-            if (aBlock == startBlock) break;
-
-            /*----------------------------------------------------------------*/
-            /* Adjust the TextBlock total line count and increment the        */
-            /* TextBlockData start line modifier.                             */
-            /*----------------------------------------------------------------*/
-            tblk->nLines -= aBlock->nLines;
-            nLineMod     -= aBlock->nLines;
-
-            /*----------------------------------------------------------------*/
-            /* Remove the links to this block from the doubly linked list.    */
-            /*----------------------------------------------------------------*/
-            /* Update the nextBlock pointer for the preceding block.          */
-            /*----------------------------------------------------------------*/
-            refBlock = aBlock->previousBlock;
-            refBlock->nextBlock = aBlock->nextBlock;
-            /*----------------------------------------------------------------*/
-            /* Update the previousBlock pointer for the following block.      */
-            /*----------------------------------------------------------------*/
-            refBlock = aBlock->nextBlock;
-            refBlock->previousBlock = aBlock->previousBlock;
-
-            rmBlock = aBlock;
-            aBlock  = rmBlock->previousBlock;
-            neuik_TextBlockData_Free(rmBlock);
+            rmBlock = startBlock;
         }
-
-        /*--------------------------------------------------------------------*/
-        /* Adjust subsequent blocks starting lines.                           */
-        /*--------------------------------------------------------------------*/
-        if (nLineMod != 0)
+        if (rmBlock != NULL)
         {
-
-            aBlock = endBlock;
-            for (;;)
+            if (rmBlock->previousBlock != NULL)
             {
-                if (aBlock == NULL) break;
-
-                aBlock->firstLineNo += nLineMod;
-
-                aBlock = aBlock->nextBlock;
+                ((neuik_TextBlockData *)(rmBlock->previousBlock))->nextBlock = 
+                    rmBlock->nextBlock;
             }
-        }
-
-        /*====================================================================*/
-        /* Chop off the desired portion from the first block in the section.  */
-        /*====================================================================*/
-        nLineMod = 0;
-        for (checkCtr = startPosition+1; checkCtr < startBlock->bytesInUse; checkCtr++)
-        {
-            remChar = startBlock->data[checkCtr];
-            if (remChar == '\0')
+            else
             {
-                /*------------------------------------------------------------*/
-                /* Shift over the bytes by one more character                 */
-                /*------------------------------------------------------------*/
-                tblk->nLines--;
-                nLineMod--;
-                startBlock->nLines--;
+                tblk->firstBlock = rmBlock->nextBlock;
+            }
+            if (rmBlock->nextBlock != NULL)
+            {
+                ((neuik_TextBlockData *)(rmBlock->nextBlock))->previousBlock = 
+                    rmBlock->previousBlock;
+            }
+            else
+            {
+                tblk->lastBlock = rmBlock->previousBlock;
+            }
+            if (rmBlock == endBlock)
+            {
+                endBlock = startBlock;
+            }
+            tblk->nDataBlocks--;
+            nBlockRm++;
+            if (neuik_TextBlock_RecycleDataBlock__noErrChecks(tblk, rmBlock))
+            {
+                eNum = 6;
+                goto out;
             }
         }
-        startBlock->bytesInUse = startPosition;
-        for (zeroCtr = startBlock->bytesInUse; 
-             zeroCtr <= startBlock->bytesAllocated; 
-             zeroCtr++)
-        {
-            startBlock->data[zeroCtr] = '\0';
-        }
+    }
+
+    tblk->nLines -= nLinesRm;
+    if (tblk->length >= nBytesRm - nLinesRm)
+    {
+        tblk->length -= nBytesRm - nLinesRm;
     }
 
     /*------------------------------------------------------------------------*/
     /* Adjust the firstLineNo on all subsequent blocks if an end of line char */
     /* (or more) was deleted.                                                 */
     /*------------------------------------------------------------------------*/
-    if (nLineMod == 0) {
-        goto out;
+    if (nLinesRm > 0)
+    {
+        for (aBlock = endBlock->nextBlock; aBlock != NULL; 
+             aBlock = aBlock->nextBlock)
+        {
+            aBlock->firstLineNo -= nLinesRm;
+        }
     }
 
     /*------------------------------------------------------------------------*/
-    /* Adjust subsequent blocks (after the initial block).                    */
+    /* Rebuild the chapter index if any data blocks were removed.             */
     /*------------------------------------------------------------------------*/
-    aBlock = startBlock;
-    aBlock = aBlock->nextBlock;
-    for (;;)
+    if (nBlockRm > 0 && neuik_TextBlock_RebuildChapters__noErrChecks(tblk))
     {
-        if (aBlock == NULL) break;
-
-        aBlock->firstLineNo += nLineMod;
-
-        aBlock = aBlock->nextBlock;
+        eNum = 7;
+        goto out;
     }
 out:
     if (eNum > 0)
@@ -0,0 +1,779 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "NEUIK_error.h"
+#include "NEUIK_defs.h"
+#include "neuik_TextHistory.h"
+
+/*----------------------------------------------------------------------------*/
+/* A TextHistory is an edit log kept alongside a TextBlock. Each edit is a    */
+/* small fixed size descriptor (what kind of edit, where it happened, and the */
+/* location of its text); the inserted or deleted text is written once to an  */
+/* append-only text store and is never modified afterwards. Undoing or        */
+/* redoing an edit therefore never copies the document, and the memory used   */
+/* is proportional to the amount of text edited rather than to the size of   */
+/* the document.                                                              */
+/*----------------------------------------------------------------------------*/
+
+#define TEXTHISTORY_INITIAL_TEXT  1024
+#define TEXTHISTORY_INITIAL_EDITS 64
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_NewTextHistory
+ *
+ *  Description:   Allocate and initialize a new (empty) TextHistory.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_NewTextHistory(
+    neuik_TextHistory ** histPtr)
+{
+    neuik_TextHistory * hist       = NULL;
+    int                 eNum       = 0; /* which error to report (if any) */
+    static char         funcName[] = "neuik_NewTextHistory";
+    static char       * errMsgs[]  = {"", // [0] no error
+        "Output argument `histPtr` is NULL.", // [1]
+        "Failure to allocate memory.",        // [2]
+    };
+
+    if (histPtr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    hist = (neuik_TextHistory*) malloc(sizeof(neuik_TextHistory));
+    (*histPtr) = hist;
+    if (hist == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    hist->text       = NULL;
+    hist->textLen    = 0;
+    hist->textAlloc  = 0;
+    hist->edits      = NULL;
+    hist->nEdits     = 0;
+    hist->nApplied   = 0;
+    hist->editsAlloc = 0;
+    hist->nGroups    = 0;
+    hist->canJoin    = FALSE;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextHistory_Free
+ *
+ *  Description:   Free all memory associated with a TextHistory.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextHistory_Free(
+    neuik_TextHistory * hist)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_TextHistory_Free";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `hist` is NULL.", // [1]
+    };
+
+    if (hist == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    if (hist->text  != NULL) free(hist->text);
+    if (hist->edits != NULL) free(hist->edits);
+    free(hist);
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextHistory_Clear
+ *
+ *  Description:   Discard all of the recorded edits (e.g., after the contents
+ *                 of the associated TextBlock were replaced). The allocated
+ *                 memory is kept for reuse.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextHistory_Clear(
+    neuik_TextHistory * hist)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_TextHistory_Clear";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `hist` is NULL.", // [1]
+    };
+
+    if (hist == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    hist->textLen  = 0;
+    hist->nEdits   = 0;
+    hist->nApplied = 0;
+    hist->canJoin  = FALSE;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextHistory_Break
+ *
+ *  Description:   Prevent the next edit from being coalesced with the edits
+ *                 which precede it (e.g., after the cursor has been moved).
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextHistory_Break(
+    neuik_TextHistory * hist)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_TextHistory_Break";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `hist` is NULL.", // [1]
+    };
+
+    if (hist == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    hist->canJoin = FALSE;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Discard the edits which could have been redone; a new edit replaces them.  */
+/* Their text is at the end of the text store, so it is released as well.     */
+/*----------------------------------------------------------------------------*/
+static void neuik_TextHistory_DropRedo__noErrChecks(
+    neuik_TextHistory * hist)
+{
+    if (hist->nApplied < hist->nEdits)
+    {
+        hist->textLen = hist->edits[hist->nApplied].textOffset;
+        hist->nEdits  = hist->nApplied;
+        hist->canJoin = FALSE;
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Append text to the text store of a TextHistory. Room for one extra byte is */
+/* always kept so that any stored text can be temporarily NUL terminated.     */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextHistory_StoreText__noErrChecks(
+    neuik_TextHistory * hist,
+    const char        * text,
+    size_t              textLen)
+{
+    size_t   newAlloc;
+    char   * newText;
+
+    if (hist->textLen + textLen + 1 > hist->textAlloc)
+    {
+        newAlloc = hist->textAlloc;
+        if (newAlloc == 0) newAlloc = TEXTHISTORY_INITIAL_TEXT;
+        while (hist->textLen + textLen + 1 > newAlloc)
+        {
+            newAlloc *= 2;
+        }
+        newText = (char*) realloc(hist->text, newAlloc);
+        if (newText == NULL)
+        {
+            return 1;
+        }
+        hist->text      = newText;
+        hist->textAlloc = newAlloc;
+    }
+    memcpy(hist->text + hist->textLen, text, textLen);
+    hist->textLen += textLen;
+    hist->text[hist->textLen] = '\0';
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Add a new (blank) edit to the end of the edit log.                         */
+/*                                                                            */
+/* Returns: NULL if there is an error; a pointer to the new edit otherwise.   */
+/*----------------------------------------------------------------------------*/
+static neuik_TextHistoryEdit * neuik_TextHistory_NewEdit__noErrChecks(
+    neuik_TextHistory * hist)
+{
+    size_t                  newAlloc;
+    neuik_TextHistoryEdit * newEdits;
+    neuik_TextHistoryEdit * edit;
+
+    if (hist->nEdits >= hist->editsAlloc)
+    {
+        newAlloc = 2*hist->editsAlloc;
+        if (newAlloc == 0) newAlloc = TEXTHISTORY_INITIAL_EDITS;
+        newEdits = (neuik_TextHistoryEdit*) realloc(hist->edits,
+            newAlloc*sizeof(neuik_TextHistoryEdit));
+        if (newEdits == NULL)
+        {
+            return NULL;
+        }
+        hist->edits      = newEdits;
+        hist->editsAlloc = newAlloc;
+    }
+    edit = &(hist->edits[hist->nEdits]);
+    memset(edit, 0, sizeof(neuik_TextHistoryEdit));
+    hist->nEdits++;
+    hist->nApplied = hist->nEdits;
+    return edit;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Get the position which follows a run of text starting at a position.      */
+/*----------------------------------------------------------------------------*/
+static void neuik_TextHistory_Advance(
+    const char * text,
+    size_t       textLen,
+    size_t     * lineNo,
+    size_t     * linePos)
+{
+    size_t ctr;
+
+    for (ctr = 0; ctr < textLen; ctr++)
+    {
+        if (text[ctr] == '\r' && ctr + 1 < textLen && text[ctr+1] == '\n')
+        {
+            ctr++;
+        }
+        if (text[ctr] == '\r' || text[ctr] == '\n')
+        {
+            (*lineNo)++;
+            *linePos = 0;
+        }
+        else
+        {
+            (*linePos)++;
+        }
+    }
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextHistory_InsertText
+ *
+ *  Description:   Insert text into a TextBlock and record the edit. Typed text
+ *                 (TEXTHISTORY_TYPING) which directly follows the preceding
+ *                 typed text extends that edit rather than adding another. An
+ *                 insert at the location of a directly preceding deletion of
+ *                 a selection is undone together with that deletion.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextHistory_InsertText(
+    neuik_TextHistory * hist,
+    neuik_TextBlock   * tblk,
+    size_t              lineNo,
+    size_t              linePos,
+    const char        * text,
+    int                 kind,
+    size_t            * finalLineNo,
+    size_t            * finalLinePos)
+{
+    int                     join       = FALSE;
+    int                     extend     = FALSE;
+    size_t                  textLen    = 0;
+    size_t                  textOffset = 0;
+    size_t                  group      = 0;
+    neuik_TextHistoryEdit * last       = NULL;
+    neuik_TextHistoryEdit * edit       = NULL;
+    int                     eNum       = 0; /* which error to report (if any) */
+    static char             funcName[] = "neuik_TextHistory_InsertText";
+    static char           * errMsgs[]  = {"", // [0] no error
+        "Argument `hist` is NULL.",                          // [1]
+        "Argument `tblk` is NULL.",                          // [2]
+        "Argument `text` is NULL.",                          // [3]
+        "Failure in function `neuik_TextBlock_InsertText`.", // [4]
+        "Failure to allocate memory.",                       // [5]
+    };
+
+    if (hist == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (tblk == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (text == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    *finalLineNo  = lineNo;
+    *finalLinePos = linePos;
+    textLen = strlen(text);
+    if (textLen == 0)
+    {
+        goto out;
+    }
+
+    if (neuik_TextBlock_InsertText(tblk, lineNo, linePos, text,
+        finalLineNo, finalLinePos))
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    neuik_TextHistory_DropRedo__noErrChecks(hist);
+    if (hist->canJoin && hist->nApplied > 0)
+    {
+        last = &(hist->edits[hist->nApplied - 1]);
+        if (last->isInsert)
+        {
+            if (kind == TEXTHISTORY_TYPING && last->kind == kind &&
+                last->endLineNo == lineNo && last->endLinePos == linePos)
+            {
+                join   = TRUE;
+                extend = (last->textOffset + last->textLen == hist->textLen);
+            }
+        }
+        else if (last->kind != TEXTHISTORY_ERASING &&
+            last->startLineNo == lineNo && last->startLinePos == linePos)
+        {
+            join = TRUE;
+        }
+    }
+
+    textOffset = hist->textLen;
+    if (neuik_TextHistory_StoreText__noErrChecks(hist, text, textLen))
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    if (extend)
+    {
+        last->textLen   += textLen;
+        last->endLineNo  = *finalLineNo;
+        last->endLinePos = *finalLinePos;
+    }
+    else
+    {
+        group = (join) ? last->group : ++(hist->nGroups);
+        edit  = neuik_TextHistory_NewEdit__noErrChecks(hist);
+        if (edit == NULL)
+        {
+            eNum = 5;
+            goto out;
+        }
+        edit->isInsert     = TRUE;
+        edit->kind         = kind;
+        edit->group        = group;
+        edit->startLineNo  = lineNo;
+        edit->startLinePos = linePos;
+        edit->endLineNo    = *finalLineNo;
+        edit->endLinePos   = *finalLinePos;
+        edit->textOffset   = textOffset;
+        edit->textLen      = textLen;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* A new line ends a run of typing.                                       */
+    /*------------------------------------------------------------------------*/
+    hist->canJoin = (kind == TEXTHISTORY_TYPING && *finalLineNo == lineNo);
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextHistory_DeleteSection
+ *
+ *  Description:   Delete a section of a TextBlock and record the edit. A run
+ *                 of erasing (TEXTHISTORY_ERASING; backspace or delete) is
+ *                 undone as a single group.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextHistory_DeleteSection(
+    neuik_TextHistory * hist,
+    neuik_TextBlock   * tblk,
+    size_t              startLineNo,
+    size_t              startLinePos,
+    size_t              endLineNo,
+    size_t              endLinePos,
+    int                 kind)
+{
+    int                     join       = FALSE;
+    int                     extend     = FALSE;
+    size_t                  textLen    = 0;
+    size_t                  textOffset = 0;
+    size_t                  group      = 0;
+    char                  * secText    = NULL;
+    neuik_TextHistoryEdit * last       = NULL;
+    neuik_TextHistoryEdit * edit       = NULL;
+    int                     eNum       = 0; /* which error to report (if any) */
+    static char             funcName[] = "neuik_TextHistory_DeleteSection";
+    static char           * errMsgs[]  = {"", // [0] no error
+        "Argument `hist` is NULL.",                             // [1]
+        "Argument `tblk` is NULL.",                             // [2]
+        "Failure in function `neuik_TextBlock_GetSection`.",    // [3]
+        "Failure in function `neuik_TextBlock_DeleteSection`.", // [4]
+        "Failure to allocate memory.",                          // [5]
+    };
+
+    if (hist == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (tblk == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (startLineNo > endLineNo ||
+        (startLineNo == endLineNo && startLinePos >= endLinePos))
+    {
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* The deleted text must be kept for the edit to be undone.               */
+    /*------------------------------------------------------------------------*/
+    if (neuik_TextBlock_GetSection(tblk, startLineNo, startLinePos,
+        endLineNo, endLinePos, &secText))
+    {
+        eNum = 3;
+        goto out;
+    }
+    textLen = strlen(secText);
+
+    if (neuik_TextBlock_DeleteSection(tblk, startLineNo, startLinePos,
+        endLineNo, endLinePos))
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    neuik_TextHistory_DropRedo__noErrChecks(hist);
+    if (kind == TEXTHISTORY_ERASING && hist->canJoin && hist->nApplied > 0)
+    {
+        last = &(hist->edits[hist->nApplied - 1]);
+        if (!last->isInsert && last->kind == kind)
+        {
+            if (startLineNo == last->startLineNo &&
+                startLinePos == last->startLinePos)
+            {
+                /*------------------------------------------------------------*/
+                /* Forward deletion; this text follows that of the last edit. */
+                /*------------------------------------------------------------*/
+                join   = TRUE;
+                extend = (last->textOffset + last->textLen == hist->textLen);
+            }
+            else if (endLineNo == last->startLineNo &&
+                endLinePos == last->startLinePos)
+            {
+                /*------------------------------------------------------------*/
+                /* Backward deletion (backspace).                             */
+                /*------------------------------------------------------------*/
+                join = TRUE;
+            }
+        }
+    }
+
+    textOffset = hist->textLen;
+    if (neuik_TextHistory_StoreText__noErrChecks(hist, secText, textLen))
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    if (extend)
+    {
+        last->textLen += textLen;
+        neuik_TextHistory_Advance(secText, textLen,
+            &(last->endLineNo), &(last->endLinePos));
+    }
+    else
+    {
+        group = (join) ? last->group : ++(hist->nGroups);
+        edit  = neuik_TextHistory_NewEdit__noErrChecks(hist);
+        if (edit == NULL)
+        {
+            eNum = 5;
+            goto out;
+        }
+        edit->isInsert     = FALSE;
+        edit->kind         = kind;
+        edit->group        = group;
+        edit->startLineNo  = startLineNo;
+        edit->startLinePos = startLinePos;
+        edit->endLineNo    = endLineNo;
+        edit->endLinePos   = endLinePos;
+        edit->textOffset   = textOffset;
+        edit->textLen      = textLen;
+    }
+    hist->canJoin = TRUE;
+out:
+    if (secText != NULL) free(secText);
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Apply (or revert) a single recorded edit to a TextBlock and get the cursor */
+/* position that should follow it.                                           */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextHistory_ApplyEdit__noErrChecks(
+    neuik_TextHistory     * hist,
+    neuik_TextBlock       * tblk,
+    neuik_TextHistoryEdit * edit,
+    int                     revert,
+    size_t                * cursorLineNo,
+    size_t                * cursorLinePos)
+{
+    int    hasErr = 0;
+    char * endPtr;
+    char   endChar;
+
+    if (edit->isInsert == !revert)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Put the text back; it is NUL terminated in place for the insert.   */
+        /*--------------------------------------------------------------------*/
+        endPtr  = hist->text + edit->textOffset + edit->textLen;
+        endChar = *endPtr;
+        *endPtr = '\0';
+        hasErr  = neuik_TextBlock_InsertText(tblk,
+            edit->startLineNo, edit->startLinePos,
+            hist->text + edit->textOffset, cursorLineNo, cursorLinePos);
+        *endPtr = endChar;
+    }
+    else
+    {
+        hasErr = neuik_TextBlock_DeleteSection(tblk,
+            edit->startLineNo, edit->startLinePos,
+            edit->endLineNo, edit->endLinePos);
+        *cursorLineNo  = edit->startLineNo;
+        *cursorLinePos = edit->startLinePos;
+    }
+    return hasErr;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextHistory_Undo
+ *
+ *  Description:   Revert the most recent group of edits. `done` is set to
+ *                 FALSE if there was nothing to undo; otherwise the cursor
+ *                 position is set to where the reverted edits took place.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextHistory_Undo(
+    neuik_TextHistory * hist,
+    neuik_TextBlock   * tblk,
+    int               * done,
+    size_t            * cursorLineNo,
+    size_t            * cursorLinePos)
+{
+    size_t        group;
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_TextHistory_Undo";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `hist` is NULL.",            // [1]
+        "Argument `tblk` is NULL.",            // [2]
+        "Output argument `done` is NULL.",     // [3]
+        "Failure to revert a recorded edit.",  // [4]
+    };
+
+    if (hist == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (tblk == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (done == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    *done = (hist->nApplied > 0);
+    if (!(*done)) goto out;
+
+    group = hist->edits[hist->nApplied - 1].group;
+    while (hist->nApplied > 0 && hist->edits[hist->nApplied - 1].group == group)
+    {
+        if (neuik_TextHistory_ApplyEdit__noErrChecks(hist, tblk,
+            &(hist->edits[hist->nApplied - 1]), TRUE,
+            cursorLineNo, cursorLinePos))
+        {
+            eNum = 4;
+            goto out;
+        }
+        hist->nApplied--;
+    }
+    hist->canJoin = FALSE;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextHistory_Redo
+ *
+ *  Description:   Reapply the most recently undone group of edits. `done` is
+ *                 set to FALSE if there was nothing to redo; otherwise the
+ *                 cursor position is set to follow the reapplied edits.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextHistory_Redo(
+    neuik_TextHistory * hist,
+    neuik_TextBlock   * tblk,
+    int               * done,
+    size_t            * cursorLineNo,
+    size_t            * cursorLinePos)
+{
+    size_t        group;
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_TextHistory_Redo";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `hist` is NULL.",             // [1]
+        "Argument `tblk` is NULL.",             // [2]
+        "Output argument `done` is NULL.",      // [3]
+        "Failure to reapply a recorded edit.",  // [4]
+    };
+
+    if (hist == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (tblk == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (done == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    *done = (hist->nApplied < hist->nEdits);
+    if (!(*done)) goto out;
+
+    group = hist->edits[hist->nApplied].group;
+    while (hist->nApplied < hist->nEdits &&
+        hist->edits[hist->nApplied].group == group)
+    {
+        if (neuik_TextHistory_ApplyEdit__noErrChecks(hist, tblk,
+            &(hist->edits[hist->nApplied]), FALSE,
+            cursorLineNo, cursorLinePos))
+        {
+            eNum = 4;
+            goto out;
+        }
+        hist->nApplied++;
+    }
+    hist->canJoin = FALSE;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
@@ -0,0 +1,556 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "NEUIK_error.h"
+#include "NEUIK_defs.h"
+#include "neuik_UTF8.h"
+
+/*----------------------------------------------------------------------------*/
+/* Measuring the position of every character of a string with TTF_SizeUTF8    */
+/* (one call per prefix) is quadratic in the length of the string. Instead,   */
+/* a string is decoded once and the positions of its characters are summed    */
+/* from glyph advances (and kerning), which is how SDL_ttf itself places the  */
+/* glyphs. The resulting layouts are kept in a small LRU cache so that the    */
+/* text which is redrawn every frame (e.g., the line with the cursor) is not  */
+/* decoded again.                                                             */
+/*----------------------------------------------------------------------------*/
+
+#define TEXTLAYOUT_CACHE_SIZE 32
+
+static neuik_TextLayout neuik__TextLayouts[TEXTLAYOUT_CACHE_SIZE];
+static unsigned long    neuik__TextLayoutUse = 0;
+
+#if SDL_VERSIONNUM(SDL_TTF_MAJOR_VERSION, SDL_TTF_MINOR_VERSION, \
+    SDL_TTF_PATCHLEVEL) >= SDL_VERSIONNUM(2, 0, 14)
+#define TEXTLAYOUT_HAS_KERNING 1
+#endif
+
+#define UTF8_REPLACEMENT_CHAR 0xFFFD
+
+
+/*----------------------------------------------------------------------------*/
+/* Decode the UTF-8 character at `str`. An invalid byte (a stray, truncated, */
+/* overlong or out of range sequence) is a single byte which decodes as the   */
+/* replacement character (U+FFFD), as drawn by SDL_ttf.                       */
+/*----------------------------------------------------------------------------*/
+static Uint32 neuik_UTF8_Decode(
+    const char * str,
+    size_t     * nBytes)
+{
+    const unsigned char * s = (const unsigned char*)(str);
+    Uint32                cp;
+    size_t                len;
+    size_t                ctr;
+
+    if (s[0] < 0x80)
+    {
+        *nBytes = (s[0] == 0) ? 0 : 1;
+        return s[0];
+    }
+    else if ((s[0] & 0xE0) == 0xC0)
+    {
+        len = 2;
+        cp  = s[0] & 0x1F;
+    }
+    else if ((s[0] & 0xF0) == 0xE0)
+    {
+        len = 3;
+        cp  = s[0] & 0x0F;
+    }
+    else if ((s[0] & 0xF8) == 0xF0)
+    {
+        len = 4;
+        cp  = s[0] & 0x07;
+    }
+    else
+    {
+        *nBytes = 1;
+        return UTF8_REPLACEMENT_CHAR;
+    }
+
+    for (ctr = 1; ctr < len; ctr++)
+    {
+        if ((s[ctr] & 0xC0) != 0x80)
+        {
+            *nBytes = 1;
+            return UTF8_REPLACEMENT_CHAR;
+        }
+        cp = (cp << 6) | (s[ctr] & 0x3F);
+    }
+    if ((len == 2 && cp < 0x80) || (len == 3 && cp < 0x800) ||
+        (len == 4 && cp < 0x10000) || cp > 0x10FFFF ||
+        (cp >= 0xD800 && cp <= 0xDFFF))
+    {
+        *nBytes = 1;
+        return UTF8_REPLACEMENT_CHAR;
+    }
+    *nBytes = len;
+    return cp;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_UTF8_CharSize
+ *
+ *  Description:   Get the number of bytes in the UTF-8 character at `str`.
+ *
+ *  Returns:       The number of bytes; zero at the terminating NUL.
+ *
+ ******************************************************************************/
+size_t neuik_UTF8_CharSize(
+    const char * str)
+{
+    size_t nBytes = 0;
+
+    neuik_UTF8_Decode(str, &nBytes);
+    return nBytes;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_UTF8_NextPos
+ *
+ *  Description:   Get the position of the character which follows the one at
+ *                 byte position `pos` of a NUL terminated string.
+ *
+ *  Returns:       The position of the following character (`pos` at the end).
+ *
+ ******************************************************************************/
+size_t neuik_UTF8_NextPos(
+    const char * str,
+    size_t       pos)
+{
+    return pos + neuik_UTF8_CharSize(str + pos);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_UTF8_PrevPos
+ *
+ *  Description:   Get the position of the character which precedes byte
+ *                 position `pos` of a string.
+ *
+ *  Returns:       The position of the preceding character (0 at the start).
+ *
+ ******************************************************************************/
+size_t neuik_UTF8_PrevPos(
+    const char * str,
+    size_t       pos)
+{
+    size_t prev;
+    size_t nBytes = 0;
+
+    if (pos == 0) return 0;
+
+    /*------------------------------------------------------------------------*/
+    /* Back up over (at most three) continuation bytes, but only if they form */
+    /* a valid character with the lead byte that precedes them.               */
+    /*------------------------------------------------------------------------*/
+    for (prev = pos - 1; prev > 0 && pos - prev < 4; prev--)
+    {
+        if (((unsigned char)(str[prev]) & 0xC0) != 0x80) break;
+    }
+    neuik_UTF8_Decode(str + prev, &nBytes);
+    if (prev + nBytes != pos)
+    {
+        return pos - 1;
+    }
+    return prev;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Hash the text of a layout (FNV-1a); `hash` is the hash of any text which   */
+/* precedes it (2166136261u at the start).                                    */
+/*----------------------------------------------------------------------------*/
+static unsigned int neuik_TextLayout_Hash(
+    unsigned int hash,
+    const char * text,
+    size_t       nBytes)
+{
+    size_t       ctr;
+
+    for (ctr = 0; ctr < nBytes; ctr++)
+    {
+        hash ^= (unsigned char)(text[ctr]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Measure the layout of text (held in two parts) into a (cache) layout      */
+/* entry.                                                                     */
+/*                                                                            */
+/* Returns: 1 if there is an error; 0 otherwise.                              */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextLayout_Measure(
+    neuik_TextLayout * layout,
+    TTF_Font         * font,
+    const char       * text1,
+    size_t             nBytes1,
+    const char       * text2,
+    size_t             nBytes2,
+    unsigned int       hash)
+{
+    int      advance  = 0;
+    int      textH    = 0;
+    int      x        = 0;
+    int      kerning  = FALSE;
+    char     oneChar[5];
+    char   * newText  = NULL;
+    size_t * newPos   = NULL;
+    int    * newX     = NULL;
+    size_t   pos      = 0;
+    size_t   nChar    = 0;
+    size_t   charLen  = 0;
+    Uint32   cp       = 0;
+    Uint32   prevCp   = 0;
+    size_t   nBytes   = nBytes1 + nBytes2;
+
+    /*------------------------------------------------------------------------*/
+    /* There are at most `nBytes` characters (plus the end position).         */
+    /*------------------------------------------------------------------------*/
+    if (layout->allocated < nBytes + 1)
+    {
+        newPos = (size_t*)realloc(layout->charPos, (nBytes+1)*sizeof(size_t));
+        if (newPos == NULL) return 1;
+        layout->charPos = newPos;
+
+        newX = (int*)realloc(layout->charX, (nBytes+1)*sizeof(int));
+        if (newX == NULL) return 1;
+        layout->charX = newX;
+
+        newText = (char*)realloc(layout->text, nBytes + 1);
+        if (newText == NULL) return 1;
+        layout->text = newText;
+
+        layout->allocated = nBytes + 1;
+    }
+    if (nBytes1 > 0) memcpy(layout->text, text1, nBytes1);
+    if (nBytes2 > 0) memcpy(layout->text + nBytes1, text2, nBytes2);
+    layout->text[nBytes] = '\0';
+
+#ifdef TEXTLAYOUT_HAS_KERNING
+    kerning = TTF_GetFontKerning(font);
+#endif
+
+    while (pos < nBytes)
+    {
+        cp = neuik_UTF8_Decode(layout->text + pos, &charLen);
+        if (charLen == 0)
+        {
+            /*----------------------------------------------------------------*/
+            /* An embedded NUL byte; always advance by at least one byte.     */
+            /*----------------------------------------------------------------*/
+            charLen = 1;
+        }
+        if (pos + charLen > nBytes) charLen = nBytes - pos;
+
+        layout->charPos[nChar] = pos;
+
+        /*--------------------------------------------------------------------*/
+        /* Glyphs outside of the basic multilingual plane can't be measured   */
+        /* with TTF_GlyphMetrics; measure the character as a string instead.  */
+        /*--------------------------------------------------------------------*/
+        if (cp > 0xFFFF ||
+            TTF_GlyphMetrics(font, (Uint16)(cp), NULL, NULL, NULL, NULL,
+                &advance) != 0)
+        {
+            if (cp == UTF8_REPLACEMENT_CHAR)
+            {
+                strcpy(oneChar, "\xEF\xBF\xBD");
+            }
+            else
+            {
+                memcpy(oneChar, layout->text + pos, charLen);
+                oneChar[charLen] = '\0';
+            }
+            advance = 0;
+            TTF_SizeUTF8(font, oneChar, &advance, &textH);
+        }
+#ifdef TEXTLAYOUT_HAS_KERNING
+        else if (kerning && nChar > 0 && prevCp <= 0xFFFF)
+        {
+            x += TTF_GetFontKerningSizeGlyphs(font,
+                (Uint16)(prevCp), (Uint16)(cp));
+        }
+#endif
+        layout->charX[nChar] = x;
+
+        x     += advance;
+        prevCp = cp;
+        pos   += charLen;
+        nChar++;
+    }
+    layout->charPos[nChar] = nBytes;
+    layout->charX[nChar]   = x;
+
+    layout->font   = font;
+    layout->nBytes = nBytes;
+    layout->nChars = nChar;
+    layout->hash   = hash;
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_GetTextLayout
+ *
+ *  Description:   Get the layout (the byte offset and x-offset of each
+ *                 character) of `nBytes` of UTF-8 text in a font. Recently
+ *                 used layouts are cached; the returned layout is owned by the
+ *                 cache and remains valid until the next call.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_GetTextLayout(
+    TTF_Font          * font,
+    const char        * text,
+    size_t              nBytes,
+    neuik_TextLayout ** layoutPtr)
+{
+    return neuik_GetSplitTextLayout(font, text, nBytes, NULL, 0, layoutPtr);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_GetSplitTextLayout
+ *
+ *  Description:   Get the layout of text which is held in two parts (e.g., the
+ *                 text on either side of the gap of a gap buffer); the layout
+ *                 is that of `nBytes1` bytes of `text1` followed by `nBytes2`
+ *                 bytes of `text2`. The `text` of the returned layout holds a
+ *                 contiguous (NUL terminated) copy of the whole text.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_GetSplitTextLayout(
+    TTF_Font          * font,
+    const char        * text1,
+    size_t              nBytes1,
+    const char        * text2,
+    size_t              nBytes2,
+    neuik_TextLayout ** layoutPtr)
+{
+    int                eNum       = 0; /* which error to report (if any) */
+    unsigned int       hash       = 2166136261u;
+    size_t             ctr;
+    neuik_TextLayout * layout     = NULL;
+    neuik_TextLayout * oldest     = NULL;
+    static char        funcName[] = "neuik_GetSplitTextLayout";
+    static char      * errMsgs[]  = {"", // [0] no error
+        "Output argument `layoutPtr` is NULL.", // [1]
+        "Argument `font` is NULL.",             // [2]
+        "Failure to allocate memory.",          // [3]
+    };
+
+    if (layoutPtr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    *layoutPtr = NULL;
+    if (font == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (text1 == NULL) nBytes1 = 0;
+    if (text2 == NULL) nBytes2 = 0;
+
+    hash = neuik_TextLayout_Hash(hash, text1, nBytes1);
+    hash = neuik_TextLayout_Hash(hash, text2, nBytes2);
+    neuik__TextLayoutUse++;
+
+    for (ctr = 0; ctr < TEXTLAYOUT_CACHE_SIZE; ctr++)
+    {
+        layout = &neuik__TextLayouts[ctr];
+        if (layout->font == font && layout->hash == hash &&
+            layout->nBytes == nBytes1 + nBytes2 &&
+            (nBytes1 == 0 || memcmp(layout->text, text1, nBytes1) == 0) &&
+            (nBytes2 == 0 || 
+                memcmp(layout->text + nBytes1, text2, nBytes2) == 0))
+        {
+            layout->lastUse = neuik__TextLayoutUse;
+            *layoutPtr = layout;
+            goto out;
+        }
+        if (oldest == NULL || layout->lastUse < oldest->lastUse)
+        {
+            oldest = layout;
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Not cached; measure the text into the least recently used entry.       */
+    /*------------------------------------------------------------------------*/
+    oldest->font = NULL;
+    if (neuik_TextLayout_Measure(oldest, font, text1, nBytes1, 
+        text2, nBytes2, hash))
+    {
+        eNum = 3;
+        goto out;
+    }
+    oldest->lastUse = neuik__TextLayoutUse;
+    *layoutPtr = oldest;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Get the index of the character which contains a byte position.            */
+/*----------------------------------------------------------------------------*/
+static size_t neuik_TextLayout_GetCharAtPos(
+    const neuik_TextLayout * layout,
+    size_t                   pos)
+{
+    size_t lo = 0;
+    size_t hi = layout->nChars;
+    size_t mid;
+
+    /* find the final character which starts at (or before) `pos` */
+    while (lo < hi)
+    {
+        mid = (lo + hi + 1)/2;
+        if (layout->charPos[mid] <= pos)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+    return lo;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextLayout_GetX
+ *
+ *  Description:   Get the x-offset at which the character at byte position
+ *                 `pos` of laid out text is drawn (the width of the text for
+ *                 a position at, or beyond, its end).
+ *
+ *  Returns:       The x-offset in pixels.
+ *
+ ******************************************************************************/
+int neuik_TextLayout_GetX(
+    const neuik_TextLayout * layout,
+    size_t                   pos)
+{
+    if (layout == NULL) return 0;
+    if (pos >= layout->nBytes) return layout->charX[layout->nChars];
+
+    return layout->charX[neuik_TextLayout_GetCharAtPos(layout, pos)];
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextLayout_GetPosAtX
+ *
+ *  Description:   Get the byte position (always at a character boundary)
+ *                 closest to an x-offset within laid out text. A position is
+ *                 placed after a character once the x-offset is beyond two
+ *                 thirds of its width.
+ *
+ *  Returns:       The byte position.
+ *
+ ******************************************************************************/
+size_t neuik_TextLayout_GetPosAtX(
+    const neuik_TextLayout * layout,
+    int                      x)
+{
+    size_t lo;
+    size_t hi;
+    size_t mid;
+    int    charW;
+
+    if (layout == NULL || layout->nChars == 0) return 0;
+    if (x <= 0) return 0;
+    if (x >= layout->charX[layout->nChars]) return layout->nBytes;
+
+    /*------------------------------------------------------------------------*/
+    /* Find the character which contains the x-offset.                        */
+    /*------------------------------------------------------------------------*/
+    lo = 0;
+    hi = layout->nChars - 1;
+    while (lo < hi)
+    {
+        mid = (lo + hi + 1)/2;
+        if (layout->charX[mid] <= x)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+
+    charW = layout->charX[lo + 1] - layout->charX[lo];
+    if (x < layout->charX[lo + 1] - charW/3)
+    {
+        return layout->charPos[lo];
+    }
+    return layout->charPos[lo + 1];
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_FreeTextLayouts
+ *
+ *  Description:   Release all of the cached text layouts.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_FreeTextLayouts()
+{
+    size_t             ctr;
+    neuik_TextLayout * layout;
+
+    for (ctr = 0; ctr < TEXTLAYOUT_CACHE_SIZE; ctr++)
+    {
+        layout = &neuik__TextLayouts[ctr];
+        if (layout->text    != NULL) free(layout->text);
+        if (layout->charPos != NULL) free(layout->charPos);
+        if (layout->charX   != NULL) free(layout->charX);
+        memset(layout, 0, sizeof(neuik_TextLayout));
+    }
+    neuik__TextLayoutUse = 0;
+}
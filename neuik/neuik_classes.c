@@ -56,6 +56,7 @@ neuik_Class * neuik__Class_ListGroup          = NULL;
 neuik_Class * neuik__Class_ListRow            = NULL;
 neuik_Class * neuik__Class_Frame              = NULL;
 neuik_Class * neuik__Class_Stack              = NULL;
+neuik_Class * neuik__Class_ScrollPane         = NULL;
 
 /*----------------------------------------------------------------------------*/
 /* Registered class implementations : Internal Objects                        */
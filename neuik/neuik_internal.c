@@ -17,6 +17,7 @@
 #include <stdio.h>
 #include <signal.h>
 #include <setjmp.h>
+#include <SDL.h>
 
 #include "neuik_internal.h"
 #include "NEUIK_error.h"
@@ -26,6 +27,10 @@ neuik_Class ** neuik_AllClasses = NULL;
 
 neuik_FatalError neuik_Fatal = NEUIK_FATALERROR_NO_ERROR;
 
+static SDL_TLSID         neuik__ThreadStateTLS = 0;
+static SDL_mutex       * neuik__SharedLock     = NULL;
+static neuik_ThreadState neuik__ThreadStateFallback; /* if TLS is unavailable */
+
 #ifndef WIN32
     static sigjmp_buf sigjmp_buffer;
 #endif /* WIN32*/
@@ -59,6 +64,142 @@ int neuik_HasFatalError()
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_InitThreadSupport
+ *
+ *  Description:   Allocate the thread-local storage and the shared lock which
+ *                 allow parts of NEUIK to be called from several threads.
+ *
+ *                 This must be called (from the main thread) before any other
+ *                 threads call into NEUIK.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_InitThreadSupport()
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_InitThreadSupport";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Failure in `SDL_TLSCreate()`.",   // [1]
+        "Failure in `SDL_CreateMutex()`.", // [2]
+    };
+
+    if (neuik__ThreadStateTLS == 0)
+    {
+        neuik__ThreadStateTLS = SDL_TLSCreate();
+        if (neuik__ThreadStateTLS == 0)
+        {
+            eNum = 1;
+            goto out;
+        }
+    }
+    if (neuik__SharedLock == NULL)
+    {
+        neuik__SharedLock = SDL_CreateMutex();
+        if (neuik__SharedLock == NULL)
+        {
+            eNum = 2;
+            goto out;
+        }
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_QuitThreadSupport
+ *
+ *  Description:   Release the shared lock allocated by neuik_InitThreadSupport.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_QuitThreadSupport()
+{
+    if (neuik__SharedLock != NULL)
+    {
+        SDL_DestroyMutex(neuik__SharedLock);
+        neuik__SharedLock = NULL;
+    }
+    neuik__ThreadStateTLS = 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_GetThreadState
+ *
+ *  Description:   Get the NEUIK state of the calling thread; it is allocated
+ *                 on first use and freed when the thread exits.
+ *
+ *                 Before thread support is initialized (or if allocation
+ *                 fails) a single shared state is returned instead.
+ *
+ *  Returns:       A valid pointer.
+ *
+ ******************************************************************************/
+neuik_ThreadState * neuik_GetThreadState()
+{
+    neuik_ThreadState * tState = NULL;
+
+    if (neuik__ThreadStateTLS == 0) return &neuik__ThreadStateFallback;
+
+    tState = (neuik_ThreadState *)SDL_TLSGet(neuik__ThreadStateTLS);
+    if (tState != NULL) return tState;
+
+    tState = (neuik_ThreadState *)calloc(1, sizeof(neuik_ThreadState));
+    if (tState == NULL) return &neuik__ThreadStateFallback;
+
+    if (SDL_TLSSet(neuik__ThreadStateTLS, tState, free) != 0)
+    {
+        free(tState);
+        return &neuik__ThreadStateFallback;
+    }
+    return tState;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_LockShared
+ *
+ *  Description:   Acquire the (recursive) lock which protects state shared
+ *                 between threads; e.g., the error list and the font caches.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_LockShared()
+{
+    if (neuik__SharedLock != NULL) SDL_LockMutex(neuik__SharedLock);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_UnlockShared
+ *
+ *  Description:   Release the lock acquired by neuik_LockShared.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_UnlockShared()
+{
+    if (neuik__SharedLock != NULL) SDL_UnlockMutex(neuik__SharedLock);
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_RegisterClassSet